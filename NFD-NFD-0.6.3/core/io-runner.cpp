@@ -0,0 +1,161 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "io-runner.hpp"
+#include "core/logger.hpp"
+
+#include <boost/chrono/system_clocks.hpp>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace nfd {
+
+NFD_LOG_INIT(IoRunner);
+
+static thread_local IoRunner* g_currentRunner = nullptr;
+
+/** \brief maximum number of CPU relax instructions between two polls of an idle io_service
+ */
+static const unsigned MAX_RELAX_ITERATIONS = 256;
+
+static inline void
+relaxCpu()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  __asm__ __volatile__("yield");
+#endif
+}
+
+IoRunner::IoRunner(boost::asio::io_service& io, const Options& options)
+  : m_io(io)
+  , m_options(options)
+  , m_busyTime(0)
+  , m_idleTime(0)
+{
+}
+
+IoRunner*
+IoRunner::getCurrent()
+{
+  return g_currentRunner;
+}
+
+void
+IoRunner::run()
+{
+  if (m_options.cpu >= 0) {
+    if (setThreadAffinity(m_options.cpu)) {
+      NFD_LOG_INFO("Thread pinned to CPU " << m_options.cpu);
+    }
+    else {
+      NFD_LOG_WARN("Cannot pin thread to CPU " << m_options.cpu);
+    }
+  }
+
+  IoRunner* previous = g_currentRunner;
+  g_currentRunner = this;
+  try {
+    if (m_options.wantBusyPoll) {
+      NFD_LOG_INFO("Busy-polling with spin duration " << m_options.spinDuration);
+      runBusyPoll();
+    }
+    else {
+      m_io.run();
+    }
+  }
+  catch (...) {
+    g_currentRunner = previous;
+    throw;
+  }
+  g_currentRunner = previous;
+}
+
+void
+IoRunner::runBusyPoll()
+{
+  // ndn::time::steady_clock can be mocked in unit tests, but idle time must be real time
+  using Clock = boost::chrono::steady_clock;
+
+  Clock::time_point now = Clock::now();
+  Clock::time_point lastWork = now;
+  unsigned nRelaxIterations = 1;
+
+  while (!m_io.stopped()) {
+    size_t nHandlers = m_io.poll();
+    Clock::time_point after = Clock::now();
+
+    if (nHandlers > 0) {
+      m_busyTime += after - now;
+      lastWork = after;
+      nRelaxIterations = 1;
+    }
+    else if (after - lastWork < m_options.spinDuration) {
+      // back off exponentially so that a sibling hyperthread is not starved
+      for (unsigned i = 0; i < nRelaxIterations; ++i) {
+        relaxCpu();
+      }
+      nRelaxIterations = std::min(nRelaxIterations * 2, MAX_RELAX_ITERATIONS);
+      after = Clock::now();
+      m_idleTime += after - now;
+    }
+    else {
+      // nothing happened for a while, give up the CPU until the next event
+      nHandlers = m_io.run_one();
+      after = Clock::now();
+      m_idleTime += after - now;
+      if (nHandlers == 0) {
+        break; // stopped or out of work
+      }
+      lastWork = after;
+      nRelaxIterations = 1;
+    }
+
+    now = after;
+  }
+}
+
+bool
+setThreadAffinity(int cpu)
+{
+#ifdef __linux__
+  if (cpu < 0 || cpu >= CPU_SETSIZE) {
+    return false;
+  }
+
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET(cpu, &cpus);
+  return ::pthread_setaffinity_np(::pthread_self(), sizeof(cpus), &cpus) == 0;
+#else
+  return false;
+#endif
+}
+
+} // namespace nfd
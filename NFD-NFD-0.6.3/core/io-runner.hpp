@@ -0,0 +1,116 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_CORE_IO_RUNNER_HPP
+#define NFD_CORE_IO_RUNNER_HPP
+
+#include "common.hpp"
+
+namespace nfd {
+
+/** \brief runs an io_service on the calling thread
+ *
+ *  By default, IoRunner blocks in the reactor whenever there is nothing to do, like
+ *  io_service::run(). In busy-poll mode, it instead polls the io_service in a loop so that
+ *  a packet is picked up as soon as it arrives, without the wakeup latency of the reactor.
+ *  When no handler has run for \c Options::spinDuration, the loop gives up the CPU and blocks
+ *  in the reactor until the next event, then resumes polling.
+ */
+class IoRunner : noncopyable
+{
+public:
+  struct Options
+  {
+    /** \brief whether to poll the io_service in a loop instead of blocking in the reactor
+     */
+    bool wantBusyPoll = false;
+
+    /** \brief how long to keep polling after the last handler has run before blocking
+     */
+    time::microseconds spinDuration = time::microseconds(200);
+
+    /** \brief CPU to pin the thread to, or -1 to let the scheduler decide
+     */
+    int cpu = -1;
+  };
+
+  IoRunner(boost::asio::io_service& io, const Options& options);
+
+  /** \brief pin the calling thread if requested, then run handlers until the io_service
+   *         is stopped or runs out of work
+   */
+  void
+  run();
+
+  /** \return the IoRunner whose run() is executing on the calling thread, or nullptr
+   */
+  static IoRunner*
+  getCurrent();
+
+  const Options&
+  getOptions() const
+  {
+    return m_options;
+  }
+
+  /** \brief time spent running handlers, measured in busy-poll mode only
+   */
+  time::nanoseconds
+  getBusyTime() const
+  {
+    return m_busyTime;
+  }
+
+  /** \brief time spent polling without finding work or blocked in the reactor,
+   *         measured in busy-poll mode only
+   *
+   *  The handler that wakes up a blocked loop is counted as idle time.
+   */
+  time::nanoseconds
+  getIdleTime() const
+  {
+    return m_idleTime;
+  }
+
+private:
+  void
+  runBusyPoll();
+
+private:
+  boost::asio::io_service& m_io;
+  Options m_options;
+  time::nanoseconds m_busyTime;
+  time::nanoseconds m_idleTime;
+};
+
+/** \brief pin the calling thread to \p cpu
+ *  \return whether the affinity was set; always false on platforms that do not support it
+ */
+bool
+setThreadAffinity(int cpu);
+
+} // namespace nfd
+
+#endif // NFD_CORE_IO_RUNNER_HPP
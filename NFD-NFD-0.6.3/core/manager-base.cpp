@@ -25,6 +25,8 @@
 
 #include "manager-base.hpp"
 
+#include <boost/functional/hash.hpp>
+
 namespace nfd {
 
 using ndn::mgmt::ValidateParameters;
@@ -40,11 +42,22 @@ ManagerBase::~ManagerBase() = default;
 
 void
 ManagerBase::registerStatusDatasetHandler(const std::string& verb,
-                                          const ndn::mgmt::StatusDatasetHandler& handler)
+                                          const ndn::mgmt::StatusDatasetHandler& handler,
+                                          const ndn::mgmt::StatusDatasetEpoch& epoch)
 {
   m_dispatcher.addStatusDataset(makeRelPrefix(verb),
                                 ndn::mgmt::makeAcceptAllAuthorization(),
-                                handler);
+                                handler, epoch);
+}
+
+uint64_t
+ManagerBase::makeTimeDependentEpoch(uint64_t epoch, time::seconds period)
+{
+  BOOST_ASSERT(period > time::seconds::zero());
+  size_t seed = static_cast<size_t>(epoch);
+  boost::hash_combine(seed, time::duration_cast<time::seconds>(
+                              time::steady_clock::now().time_since_epoch()).count() / period.count());
+  return seed;
 }
 
 ndn::mgmt::PostNotification
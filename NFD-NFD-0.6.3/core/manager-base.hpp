@@ -82,13 +82,27 @@ PUBLIC_WITH_TESTS_ELSE_PROTECTED: // registrations to the dispatcher
   registerCommandHandler(const std::string& verb,
                          const ControlCommandHandler& handler);
 
+  /** \param epoch if given, the signed response is reused while the epoch is unchanged
+   *  \sa ndn::mgmt::Dispatcher::addStatusDataset
+   */
   void
   registerStatusDatasetHandler(const std::string& verb,
-                               const ndn::mgmt::StatusDatasetHandler& handler);
+                               const ndn::mgmt::StatusDatasetHandler& handler,
+                               const ndn::mgmt::StatusDatasetEpoch& epoch = nullptr);
 
   ndn::mgmt::PostNotification
   registerNotificationStream(const std::string& verb);
 
+  /** @brief combine @p epoch with the index of the current @p period of time
+   *
+   *  Datasets that report a remaining lifetime use this as their epoch, so that a reused
+   *  response is at most one second old, like a response found in the in-memory storage.
+   *  Datasets that report counters use a longer @p period, so that a response can be reused
+   *  although the counters keep changing.
+   */
+  static uint64_t
+  makeTimeDependentEpoch(uint64_t epoch, time::seconds period = time::seconds(1));
+
 PUBLIC_WITH_TESTS_ELSE_PROTECTED:
   /**
    * @brief extract a requester from a ControlCommand request
@@ -30,6 +30,10 @@
 #include "socket-utils.hpp"
 #include "core/global-io.hpp"
 
+#ifdef HAVE_IO_URING
+#include "io-uring-service.hpp"
+#endif
+
 #include <array>
 
 namespace nfd {
@@ -77,6 +81,14 @@ protected:
   void
   handleReceive(const boost::system::error_code& error, size_t nBytesReceived);
 
+#ifdef HAVE_IO_URING
+  /** \brief handle a datagram received through io_uring
+   */
+  void
+  handleBufferReceive(const uint8_t* buffer, size_t nBytesReceived,
+                      const boost::system::error_code& error);
+#endif
+
   void
   processErrorCode(const boost::system::error_code& error);
 
@@ -96,6 +108,9 @@ protected:
   NFD_LOG_MEMBER_DECL();
 
 private:
+#ifdef HAVE_IO_URING
+  unique_ptr<IoUringSocket> m_ioUring;
+#endif
   std::array<uint8_t, ndn::MAX_NDN_PACKET_SIZE> m_receiveBuffer;
   bool m_hasRecentlyReceived;
 };
@@ -117,6 +132,25 @@ DatagramTransport<T, U>::DatagramTransport(typename DatagramTransport::protocol:
     this->setSendQueueCapacity(sendBufferSizeOption.value());
   }
 
+  if (!applySocketBusyPoll(m_socket.native_handle())) {
+    NFD_LOG_FACE_WARN("Failed to enable busy polling on socket: " << std::strerror(errno));
+  }
+
+#ifdef HAVE_IO_URING
+  // io_uring is only used on connected sockets, whose sender is always the remote endpoint
+  if (std::is_same<U, Unicast>::value) {
+    m_ioUring = IoUringSocket::create(m_socket.native_handle(), false,
+      [this] (auto&&... args) { this->handleBufferReceive(std::forward<decltype(args)>(args)...); },
+      [this] (auto&&... args) { this->handleSend(std::forward<decltype(args)>(args)...); });
+  }
+  if (m_ioUring != nullptr) {
+    NFD_LOG_FACE_TRACE("Using io_uring");
+    m_sender = m_socket.remote_endpoint(error);
+    m_ioUring->startReceive();
+    return;
+  }
+#endif
+
   m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer), m_sender,
                               [this] (auto&&... args) {
                                 this->handleReceive(std::forward<decltype(args)>(args)...);
@@ -140,6 +174,12 @@ DatagramTransport<T, U>::doClose()
 {
   NFD_LOG_FACE_TRACE(__func__);
 
+#ifdef HAVE_IO_URING
+  if (m_ioUring != nullptr) {
+    m_ioUring->close();
+  }
+#endif
+
   if (m_socket.is_open()) {
     // Cancel all outstanding operations and close the socket.
     // Use the non-throwing variants and ignore errors, if any.
@@ -161,6 +201,13 @@ DatagramTransport<T, U>::doSend(Transport::Packet&& packet)
 {
   NFD_LOG_FACE_TRACE(__func__);
 
+#ifdef HAVE_IO_URING
+  if (m_ioUring != nullptr) {
+    m_ioUring->send(packet.packet);
+    return;
+  }
+#endif
+
   m_socket.async_send(boost::asio::buffer(packet.packet),
                       // packet.packet is copied into the lambda to retain the underlying Buffer
                       [this, p = packet.packet] (auto&&... args) {
@@ -211,6 +258,20 @@ DatagramTransport<T, U>::handleReceive(const boost::system::error_code& error, s
                                 });
 }
 
+#ifdef HAVE_IO_URING
+template<class T, class U>
+void
+DatagramTransport<T, U>::handleBufferReceive(const uint8_t* buffer, size_t nBytesReceived,
+                                             const boost::system::error_code& error)
+{
+  receiveDatagram(buffer, nBytesReceived, error);
+
+  // a multishot receive stops after an error
+  if (error && m_socket.is_open())
+    m_ioUring->startReceive();
+}
+#endif // HAVE_IO_URING
+
 template<class T, class U>
 void
 DatagramTransport<T, U>::handleSend(const boost::system::error_code& error, size_t nBytesSent)
@@ -24,10 +24,16 @@
  */
 
 #include "face-system.hpp"
+#include "packet-trace.hpp"
 #include "protocol-factory.hpp"
+#include "socket-utils.hpp"
 #include "core/global-io.hpp"
 #include "fw/face-table.hpp"
 
+#ifdef HAVE_IO_URING
+#include "io-uring-service.hpp"
+#endif
+
 namespace nfd {
 namespace face {
 
@@ -83,6 +89,35 @@ FaceSystem::setConfigFile(ConfigFile& configFile)
   configFile.addSectionHandler("face_system", bind(&FaceSystem::processConfig, this, _1, _2, _3));
 }
 
+/** \brief start, stop, or redirect packet capture
+ *
+ *  Capture continues into the same file if \p filename is unchanged.
+ */
+static void
+applyPacketTraceFile(const std::string& filename)
+{
+  PacketTraceWriter* capture = getPacketTraceCapture();
+  if (filename.empty()) {
+    if (capture != nullptr) {
+      NFD_LOG_INFO("Stopping packet capture into " << capture->getFilename());
+      setPacketTraceCapture(nullptr);
+    }
+    return;
+  }
+
+  if (capture != nullptr && capture->getFilename() == filename) {
+    return;
+  }
+
+  try {
+    setPacketTraceCapture(make_unique<PacketTraceWriter>(filename));
+  }
+  catch (const PacketTraceWriter::Error& e) {
+    BOOST_THROW_EXCEPTION(ConfigFile::Error("face_system.general.trace_file: " + std::string(e.what())));
+  }
+  NFD_LOG_INFO("Capturing packets into " << filename);
+}
+
 void
 FaceSystem::processConfig(const ConfigSection& configSection, bool isDryRun, const std::string& filename)
 {
@@ -97,12 +132,43 @@ FaceSystem::processConfig(const ConfigSection& configSection, bool isDryRun, con
       if (key == "enable_congestion_marking") {
         context.generalConfig.wantCongestionMarking = ConfigFile::parseYesNo(pair, "face_system.general");
       }
+      else if (key == "io_backend") {
+        auto value = pair.second.get_value<std::string>();
+        if (value == "io_uring") {
+#ifdef HAVE_IO_URING
+          context.generalConfig.wantIoUring = true;
+#else
+          BOOST_THROW_EXCEPTION(ConfigFile::Error("face_system.general.io_backend: io_uring is not "
+                                                  "supported on this platform"));
+#endif
+        }
+        else if (value != "asio") {
+          BOOST_THROW_EXCEPTION(ConfigFile::Error("Invalid value \"" + value + "\" for option "
+                                                  "\"io_backend\" in \"face_system.general\" section"));
+        }
+      }
+      else if (key == "socket_busy_poll") {
+        context.generalConfig.socketBusyPollTimeout =
+          time::microseconds(ConfigFile::parseNumber<uint32_t>(pair, "face_system.general"));
+      }
+      else if (key == "trace_file") {
+        context.generalConfig.packetTraceFile = pair.second.get_value<std::string>();
+      }
       else {
         BOOST_THROW_EXCEPTION(ConfigFile::Error("Unrecognized option face_system.general." + key));
       }
     }
   }
 
+  if (!isDryRun) {
+    // existing faces keep the backend and socket options they were created with
+#ifdef HAVE_IO_URING
+    IoUringService::setEnabled(context.generalConfig.wantIoUring);
+#endif
+    setSocketBusyPollTimeout(context.generalConfig.socketBusyPollTimeout);
+    applyPacketTraceFile(context.generalConfig.packetTraceFile);
+  }
+
   // process sections in protocol factories
   for (const auto& pair : m_factories) {
     const std::string& sectionName = pair.first;
@@ -85,6 +85,9 @@ public:
   struct GeneralConfig
   {
     bool wantCongestionMarking = true;
+    bool wantIoUring = false;
+    time::microseconds socketBusyPollTimeout = time::microseconds::zero();
+    std::string packetTraceFile; ///< empty if packet capture is disabled
   };
 
   /** \brief context for processing a config section in ProtocolFactory
@@ -125,21 +125,21 @@ void
 GenericLinkService::encodeLpFields(const ndn::PacketBase& netPkt, lp::Packet& lpPacket)
 {
   if (m_options.allowLocalFields) {
-    shared_ptr<lp::IncomingFaceIdTag> incomingFaceIdTag = netPkt.getTag<lp::IncomingFaceIdTag>();
-    if (incomingFaceIdTag != nullptr) {
-      lpPacket.add<lp::IncomingFaceIdField>(*incomingFaceIdTag);
+    auto incomingFaceId = netPkt.getTagValue<lp::IncomingFaceIdTag>();
+    if (incomingFaceId) {
+      lpPacket.add<lp::IncomingFaceIdField>(*incomingFaceId);
     }
   }
 
-  shared_ptr<lp::CongestionMarkTag> congestionMarkTag = netPkt.getTag<lp::CongestionMarkTag>();
-  if (congestionMarkTag != nullptr) {
-    lpPacket.add<lp::CongestionMarkField>(*congestionMarkTag);
+  auto congestionMark = netPkt.getTagValue<lp::CongestionMarkTag>();
+  if (congestionMark) {
+    lpPacket.add<lp::CongestionMarkField>(*congestionMark);
   }
 
   if (m_options.allowSelfLearning) {
-    shared_ptr<lp::NonDiscoveryTag> nonDiscoveryTag = netPkt.getTag<lp::NonDiscoveryTag>();
-    if (nonDiscoveryTag != nullptr) {
-      lpPacket.add<lp::NonDiscoveryField>(*nonDiscoveryTag);
+    auto nonDiscovery = netPkt.getTagValue<lp::NonDiscoveryTag>();
+    if (nonDiscovery) {
+      lpPacket.add<lp::NonDiscoveryField>(*nonDiscovery);
     }
 
     shared_ptr<lp::PrefixAnnouncementTag> prefixAnnouncementTag = netPkt.getTag<lp::PrefixAnnouncementTag>();
@@ -346,7 +346,7 @@ GenericLinkService::decodeInterest(const Block& netPkt, const lp::Packet& firstP
 
   if (firstPkt.has<lp::NextHopFaceIdField>()) {
     if (m_options.allowLocalFields) {
-      interest->setTag(make_shared<lp::NextHopFaceIdTag>(firstPkt.get<lp::NextHopFaceIdField>()));
+      interest->setTagValue<lp::NextHopFaceIdTag>(firstPkt.get<lp::NextHopFaceIdField>());
     }
     else {
       NFD_LOG_FACE_WARN("received NextHopFaceId, but local fields disabled: DROP");
@@ -365,12 +365,12 @@ GenericLinkService::decodeInterest(const Block& netPkt, const lp::Packet& firstP
   }
 
   if (firstPkt.has<lp::CongestionMarkField>()) {
-    interest->setTag(make_shared<lp::CongestionMarkTag>(firstPkt.get<lp::CongestionMarkField>()));
+    interest->setTagValue<lp::CongestionMarkTag>(firstPkt.get<lp::CongestionMarkField>());
   }
 
   if (firstPkt.has<lp::NonDiscoveryField>()) {
     if (m_options.allowSelfLearning) {
-      interest->setTag(make_shared<lp::NonDiscoveryTag>(firstPkt.get<lp::NonDiscoveryField>()));
+      interest->setTagValue<lp::NonDiscoveryTag>(firstPkt.get<lp::NonDiscoveryField>());
     }
     else {
       NFD_LOG_FACE_WARN("received NonDiscovery, but self-learning disabled: IGNORE");
@@ -418,7 +418,7 @@ GenericLinkService::decodeData(const Block& netPkt, const lp::Packet& firstPkt)
   }
 
   if (firstPkt.has<lp::CongestionMarkField>()) {
-    data->setTag(make_shared<lp::CongestionMarkTag>(firstPkt.get<lp::CongestionMarkField>()));
+    data->setTagValue<lp::CongestionMarkTag>(firstPkt.get<lp::CongestionMarkField>());
   }
 
   if (firstPkt.has<lp::NonDiscoveryField>()) {
@@ -465,7 +465,7 @@ GenericLinkService::decodeNack(const Block& netPkt, const lp::Packet& firstPkt)
   }
 
   if (firstPkt.has<lp::CongestionMarkField>()) {
-    nack.setTag(make_shared<lp::CongestionMarkTag>(firstPkt.get<lp::CongestionMarkField>()));
+    nack.setTagValue<lp::CongestionMarkTag>(firstPkt.get<lp::CongestionMarkField>());
   }
 
   if (firstPkt.has<lp::NonDiscoveryField>()) {
@@ -0,0 +1,732 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "io-uring-service.hpp"
+#include "core/global-io.hpp"
+#include "core/logger.hpp"
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace nfd {
+namespace face {
+
+NFD_LOG_INIT(IoUringService);
+
+boost::asio::io_service::id IoUringService::id;
+bool IoUringService::s_isEnabled = false;
+
+const uint32_t IoUringService::SQ_ENTRIES = 1024;
+const uint32_t IoUringService::CQ_ENTRIES = 8192;
+const uint16_t IoUringService::N_RECEIVE_BUFFERS = 512;
+
+static const uint16_t RECEIVE_BUFFER_GROUP = 0;
+static const size_t RECEIVE_BUFFER_SIZE = ndn::MAX_NDN_PACKET_SIZE;
+
+template<typename T>
+static T*
+getRingField(void* ring, uint32_t offset)
+{
+  return reinterpret_cast<T*>(static_cast<uint8_t*>(ring) + offset);
+}
+
+IoUringService::IoUringService(boost::asio::io_service& io)
+  : boost::asio::io_service::service(io)
+  , m_io(io)
+  , m_ringDescriptor(io)
+  , m_ringFd(-1)
+  , m_sqRing(nullptr)
+  , m_sqRingSize(0)
+  , m_cqRing(nullptr)
+  , m_cqRingSize(0)
+  , m_sqes(nullptr)
+  , m_sqesSize(0)
+  , m_sqLocalTail(0)
+  , m_nUnsubmitted(0)
+  , m_bufferRing(nullptr)
+  , m_buffers(nullptr)
+  , m_buffersSize(0)
+  , m_bufferRingTail(0)
+  , m_isWaiting(false)
+  , m_isSubmitScheduled(false)
+  , m_nSubmitCalls(0)
+  , m_nSubmitted(0)
+{
+  if (!setupRing() || !setupReceiveBuffers() || !probeMultishotReceive()) {
+    NFD_LOG_WARN("io_uring is not supported by the kernel, faces will use Boost.Asio");
+    releaseResources();
+    return;
+  }
+
+  m_ringDescriptor.assign(m_ringFd);
+  NFD_LOG_DEBUG("io_uring ready sq=" << m_sqEntries << " buffers=" << N_RECEIVE_BUFFERS);
+}
+
+IoUringService::~IoUringService()
+{
+  releaseResources();
+}
+
+void
+IoUringService::setEnabled(bool wantEnabled)
+{
+  s_isEnabled = wantEnabled;
+}
+
+bool
+IoUringService::isEnabled()
+{
+  return s_isEnabled;
+}
+
+void
+IoUringService::shutdown_service()
+{
+  // pending handlers are destroyed by the io_service; the ring is released in the destructor
+}
+
+bool
+IoUringService::setupRing()
+{
+  io_uring_params params{};
+  params.flags = IORING_SETUP_CQSIZE | IORING_SETUP_SUBMIT_ALL;
+  params.cq_entries = CQ_ENTRIES;
+  m_ringFd = static_cast<int>(::syscall(__NR_io_uring_setup, SQ_ENTRIES, &params));
+  if (m_ringFd < 0) {
+    NFD_LOG_DEBUG("io_uring_setup: " << std::strerror(errno));
+    return false;
+  }
+
+  m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+  m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  bool isSingleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+  if (isSingleMmap) {
+    m_sqRingSize = m_cqRingSize = std::max(m_sqRingSize, m_cqRingSize);
+  }
+
+  void* sqRing = ::mmap(nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                        m_ringFd, IORING_OFF_SQ_RING);
+  if (sqRing == MAP_FAILED) {
+    return false;
+  }
+  m_sqRing = sqRing;
+
+  if (isSingleMmap) {
+    m_cqRing = m_sqRing;
+  }
+  else {
+    void* cqRing = ::mmap(nullptr, m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                          m_ringFd, IORING_OFF_CQ_RING);
+    if (cqRing == MAP_FAILED) {
+      return false;
+    }
+    m_cqRing = cqRing;
+  }
+
+  m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+  void* sqes = ::mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      m_ringFd, IORING_OFF_SQES);
+  if (sqes == MAP_FAILED) {
+    return false;
+  }
+  m_sqes = static_cast<io_uring_sqe*>(sqes);
+
+  m_sqHead = getRingField<uint32_t>(m_sqRing, params.sq_off.head);
+  m_sqTail = getRingField<uint32_t>(m_sqRing, params.sq_off.tail);
+  m_sqFlags = getRingField<uint32_t>(m_sqRing, params.sq_off.flags);
+  m_sqMask = *getRingField<uint32_t>(m_sqRing, params.sq_off.ring_mask);
+  m_sqEntries = params.sq_entries;
+  m_sqLocalTail = *m_sqTail;
+
+  // entry i of the submission queue always refers to SQE i
+  auto* sqArray = getRingField<uint32_t>(m_sqRing, params.sq_off.array);
+  for (uint32_t i = 0; i < m_sqEntries; ++i) {
+    sqArray[i] = i;
+  }
+
+  m_cqHead = getRingField<uint32_t>(m_cqRing, params.cq_off.head);
+  m_cqTail = getRingField<uint32_t>(m_cqRing, params.cq_off.tail);
+  m_cqMask = *getRingField<uint32_t>(m_cqRing, params.cq_off.ring_mask);
+  m_cqes = getRingField<io_uring_cqe>(m_cqRing, params.cq_off.cqes);
+  return true;
+}
+
+bool
+IoUringService::setupReceiveBuffers()
+{
+  size_t ringSize = N_RECEIVE_BUFFERS * sizeof(io_uring_buf);
+  m_buffersSize = ringSize + N_RECEIVE_BUFFERS * RECEIVE_BUFFER_SIZE;
+  void* area = ::mmap(nullptr, m_buffersSize, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (area == MAP_FAILED) {
+    return false;
+  }
+  m_bufferRing = static_cast<io_uring_buf_ring*>(area);
+  m_buffers = static_cast<uint8_t*>(area) + ringSize;
+
+  io_uring_buf_reg reg{};
+  reg.ring_addr = reinterpret_cast<uintptr_t>(m_bufferRing);
+  reg.ring_entries = N_RECEIVE_BUFFERS;
+  reg.bgid = RECEIVE_BUFFER_GROUP;
+  if (::syscall(__NR_io_uring_register, m_ringFd, IORING_REGISTER_PBUF_RING, &reg, 1) < 0) {
+    NFD_LOG_DEBUG("IORING_REGISTER_PBUF_RING: " << std::strerror(errno));
+    return false;
+  }
+
+  for (uint16_t i = 0; i < N_RECEIVE_BUFFERS; ++i) {
+    recycleBuffer(i);
+  }
+  return true;
+}
+
+bool
+IoUringService::probeMultishotReceive()
+{
+  int fds[2];
+  if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) < 0) {
+    return false;
+  }
+
+  bool isSupported = false;
+  if (::write(fds[1], "", 1) == 1) {
+    io_uring_sqe* sqe = getSqe();
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = fds[0];
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = RECEIVE_BUFFER_GROUP;
+    sqe->user_data = 1;
+    prepareCancel(fds[0]);
+    submit();
+
+    // wait for the completion of the cancellation and the final completion of the receive
+    bool isReceiveDone = false;
+    bool isCancelDone = false;
+    while (!isReceiveDone || !isCancelDone) {
+      if (enter(0, 1, IORING_ENTER_GETEVENTS) < 0) {
+        break;
+      }
+
+      uint32_t head = *m_cqHead;
+      uint32_t tail = __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE);
+      for (; head != tail; ++head) {
+        const io_uring_cqe& cqe = m_cqes[head & m_cqMask];
+        if (cqe.user_data == 0) {
+          isCancelDone = true;
+          continue;
+        }
+        if ((cqe.flags & IORING_CQE_F_BUFFER) != 0) {
+          recycleBuffer(static_cast<uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT));
+        }
+        if ((cqe.flags & IORING_CQE_F_MORE) != 0) {
+          isSupported = isSupported || cqe.res == 1;
+        }
+        else {
+          isReceiveDone = true;
+        }
+      }
+      __atomic_store_n(m_cqHead, head, __ATOMIC_RELEASE);
+    }
+  }
+
+  ::close(fds[0]);
+  ::close(fds[1]);
+  m_nSubmitCalls = m_nSubmitted = 0;
+  return isSupported;
+}
+
+void
+IoUringService::releaseResources()
+{
+  if (m_ringDescriptor.is_open()) {
+    boost::system::error_code error;
+    m_ringDescriptor.close(error);
+  }
+  else if (m_ringFd >= 0) {
+    ::close(m_ringFd);
+  }
+  m_ringFd = -1;
+
+  if (m_sqes != nullptr) {
+    ::munmap(m_sqes, m_sqesSize);
+    m_sqes = nullptr;
+  }
+  if (m_cqRing != nullptr && m_cqRing != m_sqRing) {
+    ::munmap(m_cqRing, m_cqRingSize);
+  }
+  m_cqRing = nullptr;
+  if (m_sqRing != nullptr) {
+    ::munmap(m_sqRing, m_sqRingSize);
+    m_sqRing = nullptr;
+  }
+  if (m_bufferRing != nullptr) {
+    ::munmap(m_bufferRing, m_buffersSize);
+    m_bufferRing = nullptr;
+    m_buffers = nullptr;
+  }
+
+  m_backlog.clear();
+  m_freeOperations.clear();
+  m_operations.clear();
+}
+
+IoUringService::Operation*
+IoUringService::allocateOperation(Operation::Type type, IoUringSocket* owner)
+{
+  Operation* op = nullptr;
+  if (m_freeOperations.empty()) {
+    m_operations.push_back(make_unique<Operation>());
+    op = m_operations.back().get();
+  }
+  else {
+    op = m_freeOperations.back();
+    m_freeOperations.pop_back();
+  }
+
+  op->type = type;
+  op->owner = owner;
+  op->prev = op->next = nullptr;
+  op->nBytesToSend = 0;
+  op->nBytesSent = 0;
+  return op;
+}
+
+void
+IoUringService::freeOperation(Operation* op)
+{
+  op->owner = nullptr;
+  // keep the capacity of the vectors for the next send
+  op->packets.clear();
+  op->iov.clear();
+  m_freeOperations.push_back(op);
+}
+
+io_uring_sqe*
+IoUringService::getSqe()
+{
+  if (m_sqLocalTail - __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE) >= m_sqEntries) {
+    // without SQPOLL, the kernel consumes every submitted entry before io_uring_enter returns
+    submit();
+    if (m_sqLocalTail - __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE) >= m_sqEntries) {
+      return nullptr;
+    }
+  }
+
+  io_uring_sqe* sqe = &m_sqes[m_sqLocalTail & m_sqMask];
+  std::memset(sqe, 0, sizeof(*sqe));
+  ++m_sqLocalTail;
+  ++m_nUnsubmitted;
+  return sqe;
+}
+
+void
+IoUringService::prepare(Operation* op)
+{
+  io_uring_sqe* sqe = getSqe();
+  if (sqe == nullptr) {
+    m_backlog.push_back(op);
+    return;
+  }
+
+  const IoUringSocket* socket = op->owner;
+  sqe->fd = socket->m_fd;
+  sqe->user_data = reinterpret_cast<uintptr_t>(op);
+
+  switch (op->type) {
+    case Operation::RECEIVE:
+      sqe->opcode = IORING_OP_RECV;
+      sqe->ioprio = IORING_RECV_MULTISHOT;
+      sqe->flags = IOSQE_BUFFER_SELECT;
+      sqe->buf_group = RECEIVE_BUFFER_GROUP;
+      break;
+    case Operation::SEND:
+      sqe->msg_flags = MSG_NOSIGNAL | (socket->m_isStream ? MSG_WAITALL : 0);
+      if (op->packets.size() == 1) {
+        const Block& packet = op->packets.front();
+        sqe->opcode = IORING_OP_SEND;
+        sqe->addr = reinterpret_cast<uintptr_t>(packet.wire() + op->nBytesSent);
+        sqe->len = static_cast<uint32_t>(packet.size() - op->nBytesSent);
+      }
+      else {
+        // skip what has been sent by an earlier partial send
+        op->iov.clear();
+        size_t nBytesToSkip = op->nBytesSent;
+        for (const Block& packet : op->packets) {
+          if (nBytesToSkip >= packet.size()) {
+            nBytesToSkip -= packet.size();
+            continue;
+          }
+          op->iov.push_back({const_cast<uint8_t*>(packet.wire()) + nBytesToSkip,
+                             packet.size() - nBytesToSkip});
+          nBytesToSkip = 0;
+        }
+        std::memset(&op->msg, 0, sizeof(op->msg));
+        op->msg.msg_iov = op->iov.data();
+        op->msg.msg_iovlen = op->iov.size();
+        sqe->opcode = IORING_OP_SENDMSG;
+        sqe->addr = reinterpret_cast<uintptr_t>(&op->msg);
+        sqe->len = 1;
+      }
+      break;
+  }
+}
+
+void
+IoUringService::prepareCancel(int fd)
+{
+  io_uring_sqe* sqe = getSqe();
+  if (sqe == nullptr) {
+    NFD_LOG_ERROR("Cannot cancel operations on fd=" << fd << ": submission queue is full");
+    return;
+  }
+
+  sqe->opcode = IORING_OP_ASYNC_CANCEL;
+  sqe->fd = fd;
+  sqe->cancel_flags = IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL;
+  sqe->user_data = 0;
+}
+
+void
+IoUringService::scheduleSubmit()
+{
+  if (m_isSubmitScheduled) {
+    return;
+  }
+
+  m_isSubmitScheduled = true;
+  m_io.post([this] {
+    m_isSubmitScheduled = false;
+    submit();
+    waitForCompletions();
+  });
+}
+
+int
+IoUringService::enter(uint32_t nToSubmit, uint32_t nMinComplete, uint32_t flags)
+{
+  int ret = 0;
+  do {
+    ret = static_cast<int>(::syscall(__NR_io_uring_enter, m_ringFd, nToSubmit, nMinComplete,
+                                     flags, nullptr, 0));
+  } while (ret < 0 && errno == EINTR);
+  return ret;
+}
+
+void
+IoUringService::submit()
+{
+  if (m_nUnsubmitted > 0) {
+    __atomic_store_n(m_sqTail, m_sqLocalTail, __ATOMIC_RELEASE);
+
+    uint32_t flags = 0;
+    if ((__atomic_load_n(m_sqFlags, __ATOMIC_RELAXED) & IORING_SQ_CQ_OVERFLOW) != 0) {
+      flags |= IORING_ENTER_GETEVENTS;
+    }
+
+    int ret = enter(m_nUnsubmitted, 0, flags);
+    if (ret < 0) {
+      NFD_LOG_ERROR("io_uring_enter: " << std::strerror(errno));
+      return;
+    }
+    ++m_nSubmitCalls;
+    m_nSubmitted += ret;
+    m_nUnsubmitted -= ret;
+  }
+
+  while (!m_backlog.empty() && m_sqLocalTail - *m_sqHead < m_sqEntries) {
+    Operation* op = m_backlog.front();
+    m_backlog.pop_front();
+    if (op->owner == nullptr) {
+      freeOperation(op);
+    }
+    else {
+      prepare(op);
+      scheduleSubmit();
+    }
+  }
+}
+
+void
+IoUringService::waitForCompletions()
+{
+  if (m_isWaiting) {
+    return;
+  }
+
+  m_isWaiting = true;
+  m_ringDescriptor.async_read_some(boost::asio::null_buffers(),
+    [this] (const boost::system::error_code& error, size_t) {
+      m_isWaiting = false;
+      if (!error) {
+        processCompletions();
+      }
+    });
+
+  // The reactor only reports new readiness, so completions posted after the last pass of
+  // processCompletions but before the wait was armed must be picked up explicitly
+  if (*m_cqHead != __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE)) {
+    m_io.post([this] { processCompletions(); });
+  }
+}
+
+void
+IoUringService::processCompletions()
+{
+  for (;;) {
+    uint32_t head = *m_cqHead;
+    if (head == __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE)) {
+      if ((__atomic_load_n(m_sqFlags, __ATOMIC_RELAXED) & IORING_SQ_CQ_OVERFLOW) == 0 ||
+          enter(0, 0, IORING_ENTER_GETEVENTS) < 0) {
+        break;
+      }
+      // completions that did not fit have been moved into the completion queue
+      continue;
+    }
+
+    // release the slot before dispatching, so that the kernel can keep posting completions
+    io_uring_cqe cqe = m_cqes[head & m_cqMask];
+    __atomic_store_n(m_cqHead, head + 1, __ATOMIC_RELEASE);
+
+    auto* op = reinterpret_cast<Operation*>(cqe.user_data);
+    if (op == nullptr) {
+      // completion of a cancellation request
+      continue;
+    }
+
+    switch (op->type) {
+      case Operation::RECEIVE:
+        completeReceive(op, cqe.res, cqe.flags);
+        break;
+      case Operation::SEND:
+        completeSend(op, cqe.res);
+        break;
+    }
+  }
+
+  submit();
+  waitForCompletions();
+}
+
+void
+IoUringService::completeReceive(Operation* op, int result, uint32_t flags)
+{
+  bool hasBuffer = (flags & IORING_CQE_F_BUFFER) != 0;
+  auto bufferId = static_cast<uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT);
+  bool isFinal = (flags & IORING_CQE_F_MORE) == 0;
+
+  IoUringSocket* socket = op->owner;
+  if (isFinal) {
+    // a multishot receive stops after an error, at end of stream, or when no buffer was left
+    if (socket != nullptr) {
+      socket->unlink(op);
+    }
+    freeOperation(op);
+  }
+
+  bool wantRestart = isFinal;
+  if (socket != nullptr) {
+    if (result > 0) {
+      socket->m_onReceive(m_buffers + bufferId * RECEIVE_BUFFER_SIZE, static_cast<size_t>(result), {});
+    }
+    else if (result == 0) {
+      if (socket->m_isStream) {
+        wantRestart = false;
+        socket->m_onReceive(nullptr, 0, boost::asio::error::eof);
+      }
+    }
+    else if (result != -ENOBUFS) {
+      wantRestart = false;
+      socket->m_onReceive(nullptr, 0, boost::system::error_code(-result, boost::system::system_category()));
+    }
+  }
+
+  if (hasBuffer) {
+    recycleBuffer(bufferId);
+  }
+
+  if (socket != nullptr && wantRestart) {
+    socket->startReceive();
+  }
+}
+
+void
+IoUringService::completeSend(Operation* op, int result)
+{
+  IoUringSocket* socket = op->owner;
+  if (socket != nullptr && result > 0) {
+    op->nBytesSent += static_cast<size_t>(result);
+    if (socket->m_isStream && op->nBytesSent < op->nBytesToSend) {
+      // resume a partial send; it is submitted at the end of processCompletions
+      prepare(op);
+      return;
+    }
+  }
+
+  size_t nBytesSent = op->nBytesSent;
+  if (socket != nullptr) {
+    socket->unlink(op);
+  }
+  freeOperation(op);
+
+  if (socket == nullptr) {
+    return;
+  }
+  if (result < 0) {
+    socket->m_onSend(boost::system::error_code(-result, boost::system::system_category()), nBytesSent);
+  }
+  else {
+    socket->m_onSend({}, nBytesSent);
+  }
+}
+
+void
+IoUringService::recycleBuffer(uint16_t bufferId)
+{
+  auto* entries = reinterpret_cast<io_uring_buf*>(m_bufferRing);
+  io_uring_buf& entry = entries[m_bufferRingTail & (N_RECEIVE_BUFFERS - 1)];
+  entry.addr = reinterpret_cast<uintptr_t>(m_buffers + bufferId * RECEIVE_BUFFER_SIZE);
+  entry.len = RECEIVE_BUFFER_SIZE;
+  entry.bid = bufferId;
+  ++m_bufferRingTail;
+  __atomic_store_n(&m_bufferRing->tail, m_bufferRingTail, __ATOMIC_RELEASE);
+}
+
+unique_ptr<IoUringSocket>
+IoUringSocket::create(int fd, bool isStream, const ReceiveCallback& onReceive, const SendCallback& onSend)
+{
+  if (!IoUringService::isEnabled()) {
+    return nullptr;
+  }
+
+  auto& service = boost::asio::use_service<IoUringService>(getGlobalIoService());
+  if (!service.isAvailable()) {
+    return nullptr;
+  }
+  return make_unique<IoUringSocket>(service, fd, isStream, onReceive, onSend);
+}
+
+IoUringSocket::IoUringSocket(IoUringService& service, int fd, bool isStream,
+                             const ReceiveCallback& onReceive, const SendCallback& onSend)
+  : m_service(service)
+  , m_fd(fd)
+  , m_isStream(isStream)
+  , m_isClosed(false)
+  , m_onReceive(onReceive)
+  , m_onSend(onSend)
+  , m_operations(nullptr)
+  , m_receiveOp(nullptr)
+{
+  // On a non-blocking socket, a send that cannot complete right away may fail with EAGAIN
+  // instead of being retried by the kernel when the socket becomes writable
+  int flags = ::fcntl(m_fd, F_GETFL);
+  if (flags >= 0 && (flags & O_NONBLOCK) != 0) {
+    ::fcntl(m_fd, F_SETFL, flags & ~O_NONBLOCK);
+  }
+}
+
+IoUringSocket::~IoUringSocket()
+{
+  close();
+}
+
+void
+IoUringSocket::startReceive()
+{
+  if (m_isClosed || m_receiveOp != nullptr) {
+    return;
+  }
+
+  m_receiveOp = m_service.allocateOperation(IoUringService::Operation::RECEIVE, this);
+  link(m_receiveOp);
+  m_service.prepare(m_receiveOp);
+  m_service.scheduleSubmit();
+}
+
+void
+IoUringSocket::startSend(IoUringService::Operation* op)
+{
+  link(op);
+  m_service.prepare(op);
+  m_service.scheduleSubmit();
+}
+
+void
+IoUringSocket::close()
+{
+  if (m_isClosed) {
+    return;
+  }
+  m_isClosed = true;
+
+  if (m_operations == nullptr) {
+    return;
+  }
+
+  // detach outstanding operations: their completions are discarded from now on
+  for (auto* op = m_operations; op != nullptr; op = op->next) {
+    op->owner = nullptr;
+  }
+  m_operations = m_receiveOp = nullptr;
+
+  // the file descriptor may be closed as soon as this function returns,
+  // so the cancellation request must reach the kernel right away
+  m_service.prepareCancel(m_fd);
+  m_service.submit();
+}
+
+void
+IoUringSocket::link(IoUringService::Operation* op)
+{
+  op->prev = nullptr;
+  op->next = m_operations;
+  if (m_operations != nullptr) {
+    m_operations->prev = op;
+  }
+  m_operations = op;
+}
+
+void
+IoUringSocket::unlink(IoUringService::Operation* op)
+{
+  if (op->prev != nullptr) {
+    op->prev->next = op->next;
+  }
+  else {
+    m_operations = op->next;
+  }
+  if (op->next != nullptr) {
+    op->next->prev = op->prev;
+  }
+  if (op == m_receiveOp) {
+    m_receiveOp = nullptr;
+  }
+}
+
+} // namespace face
+} // namespace nfd
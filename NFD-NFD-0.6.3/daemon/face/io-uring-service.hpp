@@ -0,0 +1,353 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_IO_URING_SERVICE_HPP
+#define NFD_DAEMON_FACE_IO_URING_SERVICE_HPP
+
+#include "core/common.hpp"
+
+#ifndef HAVE_IO_URING
+#error "Cannot include this file when io_uring is not available"
+#endif
+
+#include <boost/asio/posix/stream_descriptor.hpp>
+#include <deque>
+
+#include <sys/socket.h>
+
+struct io_uring_cqe;
+struct io_uring_sqe;
+struct io_uring_buf_ring;
+
+namespace nfd {
+namespace face {
+
+class IoUringSocket;
+
+/** \brief io_uring I/O backend for socket-based transports
+ *
+ *  One IoUringService exists per io_service. It owns a submission and completion queue pair
+ *  and a ring of receive buffers that the kernel picks from, shared by all sockets.
+ *  Operations requested while a handler runs are queued and handed to the kernel with a single
+ *  io_uring_enter call once the io_service gets to the next handler. Completions are reaped
+ *  when the io_uring file descriptor becomes readable; it is watched by the io_service's own
+ *  reactor, so timers and all other handlers keep working unchanged.
+ *
+ *  Transports obtain an IoUringSocket through IoUringSocket::create, which returns nullptr
+ *  unless the backend has been enabled and the kernel supports it.
+ */
+class IoUringService : public boost::asio::io_service::service
+{
+public:
+  static boost::asio::io_service::id id;
+
+  explicit
+  IoUringService(boost::asio::io_service& io);
+
+  ~IoUringService() override;
+
+  /** \brief select whether transports created from now on use io_uring
+   */
+  static void
+  setEnabled(bool wantEnabled);
+
+  static bool
+  isEnabled();
+
+  /** \return whether the running kernel supports all features this backend relies on
+   */
+  bool
+  isAvailable() const
+  {
+    return m_ringFd >= 0;
+  }
+
+  /** \return number of io_uring_enter system calls made to submit operations
+   */
+  uint64_t
+  getNSubmitCalls() const
+  {
+    return m_nSubmitCalls;
+  }
+
+  /** \return number of operations submitted
+   */
+  uint64_t
+  getNSubmitted() const
+  {
+    return m_nSubmitted;
+  }
+
+public:
+  /** \brief number of submission queue entries
+   */
+  static const uint32_t SQ_ENTRIES;
+
+  /** \brief number of completion queue entries
+   */
+  static const uint32_t CQ_ENTRIES;
+
+  /** \brief number of receive buffers shared by all sockets, must be a power of 2
+   */
+  static const uint16_t N_RECEIVE_BUFFERS;
+
+private: // boost::asio::io_service::service
+  void
+  shutdown_service() final;
+
+private:
+  struct Operation
+  {
+    enum Type : uint8_t {
+      RECEIVE,
+      SEND
+    };
+
+    Type type;
+    IoUringSocket* owner;
+    Operation* prev;
+    Operation* next;
+    std::vector<Block> packets; ///< packets to send, retained until the send completes
+    size_t nBytesToSend;
+    size_t nBytesSent;
+    std::vector<iovec> iov; ///< unsent parts of the packets when sending more than one
+    msghdr msg;
+  };
+
+  bool
+  setupRing();
+
+  bool
+  setupReceiveBuffers();
+
+  /** \brief check that multishot receive with provided buffers works on this kernel
+   */
+  bool
+  probeMultishotReceive();
+
+  void
+  releaseResources();
+
+  Operation*
+  allocateOperation(Operation::Type type, IoUringSocket* owner);
+
+  void
+  freeOperation(Operation* op);
+
+  /** \return a zeroed submission queue entry, or nullptr if the submission queue is full
+   */
+  io_uring_sqe*
+  getSqe();
+
+  /** \brief queue the operation, or put it in the backlog if the submission queue is full
+   */
+  void
+  prepare(Operation* op);
+
+  void
+  prepareCancel(int fd);
+
+  /** \brief submit queued entries on the next turn of the io_service
+   */
+  void
+  scheduleSubmit();
+
+  /** \brief submit queued entries now, then move backlogged operations into the submission queue
+   */
+  void
+  submit();
+
+  int
+  enter(uint32_t nToSubmit, uint32_t nMinComplete, uint32_t flags);
+
+  void
+  waitForCompletions();
+
+  void
+  processCompletions();
+
+  void
+  completeReceive(Operation* op, int result, uint32_t flags);
+
+  void
+  completeSend(Operation* op, int result);
+
+  void
+  recycleBuffer(uint16_t bufferId);
+
+private:
+  boost::asio::io_service& m_io;
+  boost::asio::posix::stream_descriptor m_ringDescriptor;
+  int m_ringFd;
+
+  void* m_sqRing;
+  size_t m_sqRingSize;
+  void* m_cqRing;
+  size_t m_cqRingSize;
+  io_uring_sqe* m_sqes;
+  size_t m_sqesSize;
+
+  uint32_t* m_sqHead;
+  uint32_t* m_sqTail;
+  uint32_t* m_sqFlags;
+  uint32_t m_sqMask;
+  uint32_t m_sqEntries;
+  uint32_t m_sqLocalTail;
+  uint32_t m_nUnsubmitted;
+
+  uint32_t* m_cqHead;
+  uint32_t* m_cqTail;
+  uint32_t m_cqMask;
+  io_uring_cqe* m_cqes;
+
+  io_uring_buf_ring* m_bufferRing;
+  uint8_t* m_buffers;
+  size_t m_buffersSize;
+  uint16_t m_bufferRingTail;
+
+  std::vector<unique_ptr<Operation>> m_operations;
+  std::vector<Operation*> m_freeOperations;
+  std::deque<Operation*> m_backlog;
+
+  bool m_isWaiting;
+  bool m_isSubmitScheduled;
+  uint64_t m_nSubmitCalls;
+  uint64_t m_nSubmitted;
+
+  static bool s_isEnabled;
+
+  friend class IoUringSocket;
+};
+
+/** \brief a connected socket whose I/O is performed through IoUringService
+ *
+ *  Receiving uses a multishot receive that keeps delivering octets into buffers from the
+ *  service's buffer ring until an error occurs, so no operation has to be re-armed per packet.
+ *
+ *  The IoUringSocket does not own the file descriptor. close() must be called before the file
+ *  descriptor is closed, and the IoUringSocket must not be destroyed from within its callbacks.
+ */
+class IoUringSocket : noncopyable
+{
+public:
+  /** \brief called when octets have been received or the receive failed
+   *
+   *  \p buffer is only valid during the callback. After an error, nothing is received until
+   *  startReceive is called again. End of stream on a stream socket is reported as
+   *  boost::asio::error::eof.
+   */
+  using ReceiveCallback = std::function<void(const uint8_t* buffer, size_t nBytesReceived,
+                                             const boost::system::error_code& error)>;
+
+  /** \brief called when the packets passed to send() have been sent entirely or the send failed
+   *
+   *  \p nBytesSent is the total size of the packets passed to one send() call.
+   */
+  using SendCallback = std::function<void(const boost::system::error_code& error,
+                                          size_t nBytesSent)>;
+
+  /** \brief create an IoUringSocket on the global io_service
+   *  \param fd a connected socket
+   *  \param isStream true for a stream socket, on which partial sends are resumed
+   *  \return the IoUringSocket, or nullptr if the io_uring backend is disabled or unavailable
+   */
+  static unique_ptr<IoUringSocket>
+  create(int fd, bool isStream, const ReceiveCallback& onReceive, const SendCallback& onSend);
+
+  IoUringSocket(IoUringService& service, int fd, bool isStream,
+                const ReceiveCallback& onReceive, const SendCallback& onSend);
+
+  ~IoUringSocket();
+
+  /** \brief start receiving, unless a receive is already in progress
+   */
+  void
+  startReceive();
+
+  /** \brief send \p packet entirely
+   *
+   *  The underlying buffer of \p packet is retained until the send completes.
+   */
+  void
+  send(const Block& packet)
+  {
+    send(&packet, &packet + 1);
+  }
+
+  /** \brief send the packets in [\p first, \p last) entirely, in order
+   *
+   *  The packets are gathered into a single sendmsg operation. On a datagram socket,
+   *  each packet should be passed to a separate send() call.
+   */
+  template<typename Iterator>
+  void
+  send(Iterator first, Iterator last)
+  {
+    if (m_isClosed || first == last) {
+      return;
+    }
+
+    auto* op = m_service.allocateOperation(IoUringService::Operation::SEND, this);
+    for (; first != last; ++first) {
+      op->packets.push_back(*first);
+      op->nBytesToSend += first->size();
+    }
+    startSend(op);
+  }
+
+  /** \brief cancel all operations
+   *
+   *  No callback is invoked after close() returns, and further operations are ignored.
+   */
+  void
+  close();
+
+private:
+  void
+  startSend(IoUringService::Operation* op);
+
+  void
+  link(IoUringService::Operation* op);
+
+  void
+  unlink(IoUringService::Operation* op);
+
+private:
+  IoUringService& m_service;
+  int m_fd;
+  bool m_isStream;
+  bool m_isClosed;
+  ReceiveCallback m_onReceive;
+  SendCallback m_onSend;
+  IoUringService::Operation* m_operations;
+  IoUringService::Operation* m_receiveOp;
+
+  friend class IoUringService;
+};
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_IO_URING_SERVICE_HPP
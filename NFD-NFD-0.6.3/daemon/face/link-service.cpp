@@ -25,6 +25,7 @@
 
 #include "link-service.hpp"
 #include "face.hpp"
+#include "fw/forwarder.hpp"
 
 namespace nfd {
 namespace face {
@@ -34,6 +35,7 @@ NFD_LOG_INIT(LinkService);
 LinkService::LinkService()
   : m_face(nullptr)
   , m_transport(nullptr)
+  , m_forwarder(nullptr)
 {
 }
 
@@ -91,7 +93,12 @@ LinkService::receiveInterest(const Interest& interest)
 
   ++this->nInInterests;
 
-  afterReceiveInterest(interest);
+  if (m_forwarder != nullptr) {
+    m_forwarder->startProcessInterest(*m_face, interest);
+  }
+  if (!afterReceiveInterest.isEmpty()) {
+    afterReceiveInterest(interest);
+  }
 }
 
 void
@@ -101,7 +108,12 @@ LinkService::receiveData(const Data& data)
 
   ++this->nInData;
 
-  afterReceiveData(data);
+  if (m_forwarder != nullptr) {
+    m_forwarder->startProcessData(*m_face, data);
+  }
+  if (!afterReceiveData.isEmpty()) {
+    afterReceiveData(data);
+  }
 }
 
 void
@@ -111,7 +123,12 @@ LinkService::receiveNack(const ndn::lp::Nack& nack)
 
   ++this->nInNacks;
 
-  afterReceiveNack(nack);
+  if (m_forwarder != nullptr) {
+    m_forwarder->startProcessNack(*m_face, nack);
+  }
+  if (!afterReceiveNack.isEmpty()) {
+    afterReceiveNack(nack);
+  }
 }
 
 void
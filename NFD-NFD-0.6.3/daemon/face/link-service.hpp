@@ -31,6 +31,9 @@
 #include "transport.hpp"
 
 namespace nfd {
+
+class Forwarder;
+
 namespace face {
 
 class Face;
@@ -111,6 +114,21 @@ public:
   virtual const Counters&
   getCounters() const;
 
+  /** \brief deliver received packets to \p forwarder
+   *
+   *  Received Interests, Data, and Nacks enter the forwarding pipelines through a direct call
+   *  on \p forwarder. The afterReceive* signals are still emitted afterwards, for observers
+   *  that are connected to them.
+   *
+   *  \param forwarder the forwarder, or nullptr to deliver packets through the signals only
+   *  \pre setFaceAndTransport has been called
+   */
+  void
+  setForwarder(Forwarder* forwarder)
+  {
+    m_forwarder = forwarder;
+  }
+
 public: // upper interface to be used by forwarding
   /** \brief send Interest
    *  \pre setTransport has been called
@@ -201,6 +219,7 @@ private: // lower interface to be overridden in subclass
 private:
   Face* m_face;
   Transport* m_transport;
+  Forwarder* m_forwarder;
 };
 
 inline const Face*
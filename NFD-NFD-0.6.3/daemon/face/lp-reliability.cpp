@@ -30,12 +30,23 @@
 namespace nfd {
 namespace face {
 
+/** \brief compare TxSequence numbers, allowing for wraparound
+ */
+static bool
+isSeqLess(lp::Sequence a, lp::Sequence b)
+{
+  return static_cast<int64_t>(a - b) < 0;
+}
+
+static const size_t INITIAL_WINDOW_CAPACITY = 64;
+
 LpReliability::LpReliability(const LpReliability::Options& options, GenericLinkService* linkService)
   : m_options(options)
   , m_linkService(linkService)
-  , m_firstUnackedFrag(m_unackedFrags.begin())
   , m_lastTxSeqNo(-1) // set to "-1" to start TxSequence numbers at 0
   , m_isIdleAckTimerRunning(false)
+  , m_isRtoTimerRunning(false)
+  , m_isPeerUsingAckRanges(false)
 {
   BOOST_ASSERT(m_linkService != nullptr);
 
@@ -65,8 +76,8 @@ LpReliability::handleOutgoing(std::vector<lp::Packet>& frags, lp::Packet&& pkt,
 {
   BOOST_ASSERT(m_options.isEnabled);
 
-  auto unackedFragsIt = m_unackedFrags.begin();
   auto sendTime = time::steady_clock::now();
+  auto rtoExpiry = sendTime + m_rto.computeRto();
 
   auto netPkt = make_shared<NetPkt>(std::move(pkt), isInterest);
   netPkt->unackedFrags.reserve(frags.size());
@@ -76,20 +87,18 @@ LpReliability::handleOutgoing(std::vector<lp::Packet>& frags, lp::Packet&& pkt,
     lp::Sequence txSeq = assignTxSequence(frag);
 
     // Store LpPacket for future retransmissions
-    unackedFragsIt = m_unackedFrags.emplace_hint(unackedFragsIt,
-                                                 std::piecewise_construct,
-                                                 std::forward_as_tuple(txSeq),
-                                                 std::forward_as_tuple(frag));
-    unackedFragsIt->second.sendTime = sendTime;
-    unackedFragsIt->second.rtoTimer = scheduler::schedule(m_rto.computeRto(), [=] { onLpPacketLost(txSeq); });
-    unackedFragsIt->second.netPkt = netPkt;
-
-    if (m_unackedFrags.size() == 1) {
-      m_firstUnackedFrag = m_unackedFrags.begin();
-    }
+    UnackedFrag& unackedFrag = m_unackedFrags.emplace(txSeq, frag);
+    unackedFrag.sendTime = sendTime;
+    unackedFrag.rtoExpiry = rtoExpiry;
+    unackedFrag.netPkt = netPkt;
 
     // Add to associated NetPkt
-    netPkt->unackedFrags.push_back(unackedFragsIt);
+    netPkt->unackedFrags.push_back(txSeq);
+  }
+
+  // The timer keeps running as long as there are unacknowledged fragments
+  if (!m_isRtoTimerRunning && !m_unackedFrags.empty()) {
+    this->startRtoTimer(rtoExpiry);
   }
 }
 
@@ -102,44 +111,31 @@ LpReliability::processIncomingPacket(const lp::Packet& pkt)
 
   // Extract and parse Acks
   for (lp::Sequence ackSeq : pkt.list<lp::AckField>()) {
-    auto fragIt = m_unackedFrags.find(ackSeq);
-    if (fragIt == m_unackedFrags.end()) {
-      // Ignore an Ack for an unknown TxSequence number
-      continue;
-    }
-    auto& frag = fragIt->second;
+    this->processAck(ackSeq, now);
+  }
 
-    // Cancel the RTO timer for the acknowledged fragment
-    frag.rtoTimer.cancel();
+  for (const lp::AckRange& range : pkt.list<lp::AckRangeField>()) {
+    m_isPeerUsingAckRanges = true;
 
-    if (frag.retxCount == 0) {
-      // This sequence had no retransmissions, so use it to calculate the RTO
-      m_rto.addMeasurement(time::duration_cast<RttEstimator::Duration>(now - frag.sendTime));
+    // Only TxSequences in the current window can match an unacknowledged fragment. The window
+    // may shrink while the range is processed, but does not grow past lastSeq.
+    if (m_unackedFrags.empty()) {
+      break;
+    }
+    lp::Sequence firstSeq = m_unackedFrags.getFirstSequence();
+    lp::Sequence lastSeq = m_lastTxSeqNo;
+    if (!isSeqLess(range.getFirst(), firstSeq)) {
+      firstSeq = range.getFirst();
+    }
+    if (isSeqLess(range.getLast(), lastSeq)) {
+      lastSeq = range.getLast();
+    }
+    if (isSeqLess(lastSeq, firstSeq)) {
+      continue;
     }
 
-    // Look for frags with TxSequence numbers < ackSeq (allowing for wraparound) and consider them
-    // lost if a configurable number of Acks containing greater TxSequence numbers have been
-    // received.
-    auto lostLpPackets = findLostLpPackets(fragIt);
-
-    // Remove the fragment from the map of unacknowledged fragments and from its associated network
-    // packet. Potentially increment the start of the window.
-    onLpPacketAcknowledged(fragIt);
-
-    // This set contains TxSequences that have been removed by onLpPacketLost below because they
-    // were part of a network packet that was removed due to a fragment exceeding retx, as well as
-    // any other TxSequences removed by onLpPacketLost. This prevents onLpPacketLost from being
-    // called later for an invalid iterator.
-    std::set<lp::Sequence> removedLpPackets;
-
-    // Resend or fail fragments considered lost. Potentially increment the start of the window.
-    for (lp::Sequence txSeq : lostLpPackets) {
-      if (removedLpPackets.find(txSeq) == removedLpPackets.end()) {
-        auto removedThisTxSeq = this->onLpPacketLost(txSeq);
-        for (auto removedTxSeq : removedThisTxSeq) {
-          removedLpPackets.insert(removedTxSeq);
-        }
-      }
+    for (uint64_t i = 0, n = lastSeq - firstSeq; i <= n; ++i) {
+      this->processAck(firstSeq + i, now);
     }
   }
 
@@ -165,18 +161,32 @@ LpReliability::piggyback(lp::Packet& pkt, ssize_t mtu)
   ssize_t remainingSpace = (mtu == MTU_UNLIMITED ? ndn::MAX_NDN_PACKET_SIZE : mtu) - reservedSpace;
   remainingSpace -= pktSize;
 
+  // Ack size = Ack TLV-TYPE (3 octets) + TLV-LENGTH (1 octet) + uint64_t (8 octets)
+  const ssize_t ackSize = tlv::sizeOfVarNumber(lp::tlv::Ack) +
+                          tlv::sizeOfVarNumber(sizeof(lp::Sequence)) +
+                          sizeof(lp::Sequence);
+  bool wantAckRanges = m_options.wantAckRanges || m_isPeerUsingAckRanges;
+
   while (!m_ackQueue.empty()) {
-    lp::Sequence ackSeq = m_ackQueue.front();
-    // Ack size = Ack TLV-TYPE (3 octets) + TLV-LENGTH (1 octet) + uint64_t (8 octets)
-    const ssize_t ackSize = tlv::sizeOfVarNumber(lp::tlv::Ack) +
-                            tlv::sizeOfVarNumber(sizeof(lp::Sequence)) +
-                            sizeof(lp::Sequence);
+    const AckQueue::Run& run = m_ackQueue.frontRun();
+
+    if (wantAckRanges && run.length > 1) {
+      // AckRange size = AckRange TLV-TYPE (3 octets) + TLV-LENGTH (1 octet) +
+      //                 uint64_t (8 octets) + run length (1 to 8 octets)
+      ssize_t ackRangeSize = lp::AckRange::estimateSize(run.length);
+      if (ackRangeSize <= remainingSpace) {
+        pkt.add<lp::AckRangeField>(lp::AckRange(run.first, run.first + run.length - 1));
+        m_ackQueue.popRun();
+        remainingSpace -= ackRangeSize;
+        continue;
+      }
+    }
 
     if (ackSize > remainingSpace) {
       break;
     }
 
-    pkt.add<lp::AckField>(ackSeq);
+    pkt.add<lp::AckField>(m_ackQueue.front());
     m_ackQueue.pop();
     remainingSpace -= ackSize;
   }
@@ -187,7 +197,7 @@ LpReliability::assignTxSequence(lp::Packet& frag)
 {
   lp::Sequence txSeq = ++m_lastTxSeqNo;
   frag.set<lp::TxSequenceField>(txSeq);
-  if (m_unackedFrags.size() > 0 && m_lastTxSeqNo == m_firstUnackedFrag->first) {
+  if (!m_unackedFrags.empty() && m_lastTxSeqNo == m_unackedFrags.getFirstSequence()) {
     BOOST_THROW_EXCEPTION(std::length_error("TxSequence range exceeded"));
   }
   return m_lastTxSeqNo;
@@ -215,51 +225,114 @@ LpReliability::stopIdleAckTimer()
   m_isIdleAckTimerRunning = false;
 }
 
-std::vector<lp::Sequence>
-LpReliability::findLostLpPackets(LpReliability::UnackedFrags::iterator ackIt)
+void
+LpReliability::startRtoTimer(time::steady_clock::TimePoint expiry)
 {
-  std::vector<lp::Sequence> lostLpPackets;
+  m_isRtoTimerRunning = true;
+  m_rtoTimer = scheduler::schedule(std::max(expiry - time::steady_clock::now(),
+                                            time::steady_clock::Duration::zero()),
+                                   [this] { onRtoTimeout(); });
+}
 
-  for (auto it = m_firstUnackedFrag; ; ++it) {
-    if (it == m_unackedFrags.end()) {
-      it = m_unackedFrags.begin();
-    }
+void
+LpReliability::onRtoTimeout()
+{
+  m_isRtoTimerRunning = false;
 
-    if (it->first == ackIt->first) {
-      break;
+  auto now = time::steady_clock::now();
+  // fragments retransmitted below are not looked at again in this round
+  lp::Sequence lastSeq = m_lastTxSeqNo;
+
+  while (!m_unackedFrags.empty()) {
+    lp::Sequence txSeq = m_unackedFrags.getFirstSequence();
+    const UnackedFrag& frag = m_unackedFrags.at(txSeq);
+    if (frag.rtoExpiry > now || isSeqLess(lastSeq, txSeq)) {
+      this->startRtoTimer(frag.rtoExpiry);
+      return;
     }
 
-    auto& unackedFrag = it->second;
-    unackedFrag.nGreaterSeqAcks++;
+    this->onLpPacketLost(txSeq);
+  }
+}
+
+void
+LpReliability::processAck(lp::Sequence ackSeq, time::steady_clock::TimePoint now)
+{
+  UnackedFrag* frag = m_unackedFrags.find(ackSeq);
+  if (frag == nullptr) {
+    // Ignore an Ack for an unknown TxSequence number
+    return;
+  }
+
+  if (frag->retxCount == 0) {
+    // This sequence had no retransmissions, so use it to calculate the RTO
+    m_rto.addMeasurement(time::duration_cast<RttEstimator::Duration>(now - frag->sendTime));
+  }
+
+  // Remove the fragment from the window of unacknowledged fragments and from its associated
+  // network packet. Potentially increment the start of the window.
+  this->onLpPacketAcknowledged(ackSeq);
+
+  // Resend or fail fragments with TxSequence numbers < ackSeq (allowing for wraparound) that are
+  // considered lost because a configurable number of Acks containing greater TxSequence numbers
+  // have been received.
+  this->findLostLpPackets(ackSeq);
+}
+
+void
+LpReliability::findLostLpPackets(lp::Sequence ackSeq)
+{
+  size_t threshold = std::max<size_t>(m_options.seqNumLossThreshold, 1);
+  while (m_greatestAcks.size() > threshold) {
+    m_greatestAcks.erase(m_greatestAcks.begin());
+  }
 
-    if (unackedFrag.nGreaterSeqAcks >= m_options.seqNumLossThreshold) {
-      lostLpPackets.push_back(it->first);
+  auto pos = std::upper_bound(m_greatestAcks.begin(), m_greatestAcks.end(), ackSeq, &isSeqLess);
+  if (m_greatestAcks.size() < threshold) {
+    m_greatestAcks.insert(pos, ackSeq);
+    if (m_greatestAcks.size() < threshold) {
+      return;
     }
   }
+  else if (pos != m_greatestAcks.begin()) {
+    m_greatestAcks.insert(pos, ackSeq);
+    m_greatestAcks.erase(m_greatestAcks.begin());
+  }
+  else {
+    // not among the greatest Acks, so no fragment gains enough greater Acks
+    return;
+  }
 
-  return lostLpPackets;
+  // Every fragment before lossBound has seen at least threshold Acks for greater TxSequences.
+  // Lost fragments leave the window (retransmissions get new TxSequences after lossBound), so
+  // the loop only visits the start of the window.
+  lp::Sequence lossBound = m_greatestAcks.front();
+  while (!m_unackedFrags.empty() && isSeqLess(m_unackedFrags.getFirstSequence(), lossBound)) {
+    this->onLpPacketLost(m_unackedFrags.getFirstSequence());
+  }
 }
 
-std::vector<lp::Sequence>
-LpReliability::onLpPacketLost(lp::Sequence txSeq)
+size_t
+LpReliability::countGreaterAcks(lp::Sequence txSeq) const
 {
-  BOOST_ASSERT(m_unackedFrags.count(txSeq) > 0);
-  auto txSeqIt = m_unackedFrags.find(txSeq);
+  return std::count_if(m_greatestAcks.begin(), m_greatestAcks.end(),
+                       [txSeq] (lp::Sequence ackSeq) { return isSeqLess(txSeq, ackSeq); });
+}
 
-  auto& txFrag = txSeqIt->second;
-  txFrag.rtoTimer.cancel();
-  auto netPkt = txFrag.netPkt;
-  std::vector<lp::Sequence> removedThisTxSeq;
+void
+LpReliability::onLpPacketLost(lp::Sequence txSeq)
+{
+  UnackedFrag* txFrag = m_unackedFrags.find(txSeq);
+  BOOST_ASSERT(txFrag != nullptr);
+  auto netPkt = txFrag->netPkt;
 
   // Check if maximum number of retransmissions exceeded
-  if (txFrag.retxCount >= m_options.maxRetx) {
-    // Delete all LpPackets of NetPkt from m_unackedFrags (except this one)
-    for (size_t i = 0; i < netPkt->unackedFrags.size(); i++) {
-      if (netPkt->unackedFrags[i] != txSeqIt) {
-        removedThisTxSeq.push_back(netPkt->unackedFrags[i]->first);
-        deleteUnackedFrag(netPkt->unackedFrags[i]);
-      }
+  if (txFrag->retxCount >= m_options.maxRetx) {
+    // Delete all LpPackets of NetPkt from m_unackedFrags
+    for (lp::Sequence fragSeq : netPkt->unackedFrags) {
+      m_unackedFrags.erase(fragSeq);
     }
+    netPkt->unackedFrags.clear();
 
     ++m_linkService->nRetxExhausted;
 
@@ -271,52 +344,45 @@ LpReliability::onLpPacketLost(lp::Sequence txSeq)
       Block frag(&*fragBegin, std::distance(fragBegin, fragEnd));
       onDroppedInterest(Interest(frag));
     }
-
-    removedThisTxSeq.push_back(txSeqIt->first);
-    deleteUnackedFrag(txSeqIt);
   }
   else {
     // Assign new TxSequence
-    lp::Sequence newTxSeq = assignTxSequence(txFrag.pkt);
+    lp::Sequence newTxSeq = assignTxSequence(txFrag->pkt);
     netPkt->didRetx = true;
 
-    // Move fragment to new TxSequence mapping
-    auto newTxFragIt = m_unackedFrags.emplace_hint(
-      m_firstUnackedFrag != m_unackedFrags.end() && m_firstUnackedFrag->first > newTxSeq
-        ? m_firstUnackedFrag
-        : m_unackedFrags.end(),
-      std::piecewise_construct,
-      std::forward_as_tuple(newTxSeq),
-      std::forward_as_tuple(txFrag.pkt));
-    auto& newTxFrag = newTxFragIt->second;
-    newTxFrag.retxCount = txFrag.retxCount + 1;
+    // Move fragment to the slot of the new TxSequence; this may reallocate the window
+    lp::Packet pkt = std::move(txFrag->pkt);
+    size_t retxCount = txFrag->retxCount + 1;
+    m_unackedFrags.erase(txSeq);
+
+    auto now = time::steady_clock::now();
+    UnackedFrag& newTxFrag = m_unackedFrags.emplace(newTxSeq, std::move(pkt));
+    newTxFrag.sendTime = now;
+    newTxFrag.rtoExpiry = now + m_rto.computeRto();
+    newTxFrag.retxCount = retxCount;
     newTxFrag.netPkt = netPkt;
 
     // Update associated NetPkt
-    auto fragInNetPkt = std::find(netPkt->unackedFrags.begin(), netPkt->unackedFrags.end(), txSeqIt);
+    auto fragInNetPkt = std::find(netPkt->unackedFrags.begin(), netPkt->unackedFrags.end(), txSeq);
     BOOST_ASSERT(fragInNetPkt != netPkt->unackedFrags.end());
-    *fragInNetPkt = newTxFragIt;
-
-    removedThisTxSeq.push_back(txSeqIt->first);
-    deleteUnackedFrag(txSeqIt);
+    *fragInNetPkt = newTxSeq;
 
     // Retransmit fragment
     m_linkService->sendLpPacket(lp::Packet(newTxFrag.pkt));
 
-    // Start RTO timer for this sequence
-    newTxFrag.rtoTimer = scheduler::schedule(m_rto.computeRto(), [=] { onLpPacketLost(newTxSeq); });
+    if (!m_isRtoTimerRunning) {
+      this->startRtoTimer(newTxFrag.rtoExpiry);
+    }
   }
-
-  return removedThisTxSeq;
 }
 
 void
-LpReliability::onLpPacketAcknowledged(UnackedFrags::iterator fragIt)
+LpReliability::onLpPacketAcknowledged(lp::Sequence txSeq)
 {
-  auto netPkt = fragIt->second.netPkt;
+  auto netPkt = m_unackedFrags.at(txSeq).netPkt;
 
   // Remove from NetPkt unacked fragment list
-  auto fragInNetPkt = std::find(netPkt->unackedFrags.begin(), netPkt->unackedFrags.end(), fragIt);
+  auto fragInNetPkt = std::find(netPkt->unackedFrags.begin(), netPkt->unackedFrags.end(), txSeq);
   BOOST_ASSERT(fragInNetPkt != netPkt->unackedFrags.end());
   *fragInNetPkt = netPkt->unackedFrags.back();
   netPkt->unackedFrags.pop_back();
@@ -331,35 +397,14 @@ LpReliability::onLpPacketAcknowledged(UnackedFrags::iterator fragIt)
     }
   }
 
-  deleteUnackedFrag(fragIt);
-}
-
-void
-LpReliability::deleteUnackedFrag(UnackedFrags::iterator fragIt)
-{
-  lp::Sequence firstUnackedTxSeq = m_firstUnackedFrag->first;
-  lp::Sequence currentTxSeq = fragIt->first;
-  auto nextFragIt = m_unackedFrags.erase(fragIt);
-
-  if (!m_unackedFrags.empty() && firstUnackedTxSeq == currentTxSeq) {
-    // If "first" fragment in send window (allowing for wraparound), increment window begin
-    if (nextFragIt == m_unackedFrags.end()) {
-      m_firstUnackedFrag = m_unackedFrags.begin();
-    }
-    else {
-      m_firstUnackedFrag = nextFragIt;
-    }
-  }
-  else if (m_unackedFrags.empty()) {
-    m_firstUnackedFrag = m_unackedFrags.end();
-  }
+  m_unackedFrags.erase(txSeq);
 }
 
 LpReliability::UnackedFrag::UnackedFrag(lp::Packet pkt)
   : pkt(std::move(pkt))
   , sendTime(time::steady_clock::now())
+  , rtoExpiry(sendTime)
   , retxCount(0)
-  , nGreaterSeqAcks(0)
 {
 }
 
@@ -370,5 +415,140 @@ LpReliability::NetPkt::NetPkt(lp::Packet&& pkt, bool isInterest)
 {
 }
 
+LpReliability::UnackedFrags::UnackedFrags()
+  : m_slots(INITIAL_WINDOW_CAPACITY)
+  , m_first(0)
+  , m_last(0)
+  , m_size(0)
+{
+}
+
+const LpReliability::UnackedFrag*
+LpReliability::UnackedFrags::find(lp::Sequence txSeq) const
+{
+  if (m_size == 0 || txSeq - m_first > m_last - m_first) {
+    return nullptr;
+  }
+
+  const auto& slot = m_slots[txSeq & (m_slots.size() - 1)];
+  return slot ? &*slot : nullptr;
+}
+
+LpReliability::UnackedFrag*
+LpReliability::UnackedFrags::find(lp::Sequence txSeq)
+{
+  return const_cast<UnackedFrag*>(const_cast<const UnackedFrags*>(this)->find(txSeq));
+}
+
+LpReliability::UnackedFrag&
+LpReliability::UnackedFrags::at(lp::Sequence txSeq)
+{
+  UnackedFrag* frag = this->find(txSeq);
+  if (frag == nullptr) {
+    BOOST_THROW_EXCEPTION(std::out_of_range("TxSequence " + to_string(txSeq) + " is not in window"));
+  }
+  return *frag;
+}
+
+LpReliability::UnackedFrag&
+LpReliability::UnackedFrags::emplace(lp::Sequence txSeq, lp::Packet pkt)
+{
+  if (m_size == 0) {
+    m_first = m_last = txSeq;
+  }
+  else {
+    BOOST_ASSERT(isSeqLess(m_last, txSeq));
+    uint64_t span = txSeq - m_first + 1;
+    if (span > m_slots.size()) {
+      this->grow(span);
+    }
+    m_last = txSeq;
+  }
+
+  auto& slot = this->getSlot(txSeq);
+  BOOST_ASSERT(!slot);
+  slot.emplace(std::move(pkt));
+  ++m_size;
+  return *slot;
+}
+
+void
+LpReliability::UnackedFrags::erase(lp::Sequence txSeq)
+{
+  auto& slot = this->getSlot(txSeq);
+  BOOST_ASSERT(this->find(txSeq) != nullptr);
+  slot = nullopt;
+  --m_size;
+
+  if (m_size == 0) {
+    return;
+  }
+
+  // Each TxSequence is skipped over at most once by each end of the window
+  if (txSeq == m_first) {
+    do {
+      ++m_first;
+    } while (!this->getSlot(m_first));
+  }
+  else if (txSeq == m_last) {
+    do {
+      --m_last;
+    } while (!this->getSlot(m_last));
+  }
+}
+
+void
+LpReliability::UnackedFrags::grow(uint64_t minCapacity)
+{
+  size_t capacity = m_slots.size();
+  while (capacity < minCapacity) {
+    capacity *= 2;
+  }
+
+  std::vector<optional<UnackedFrag>> slots(capacity);
+  for (uint64_t i = 0, n = m_last - m_first; i <= n; ++i) {
+    lp::Sequence txSeq = m_first + i;
+    auto& slot = this->getSlot(txSeq);
+    if (slot) {
+      slots[txSeq & (capacity - 1)] = std::move(slot);
+    }
+  }
+  m_slots = std::move(slots);
+}
+
+void
+LpReliability::AckQueue::push(lp::Sequence txSeq)
+{
+  if (!m_runs.empty() && m_runs.back().first + m_runs.back().length == txSeq) {
+    ++m_runs.back().length;
+  }
+  else {
+    m_runs.push_back({txSeq, 1});
+  }
+  ++m_size;
+}
+
+void
+LpReliability::AckQueue::pop()
+{
+  BOOST_ASSERT(!m_runs.empty());
+  Run& run = m_runs.front();
+  if (--run.length == 0) {
+    m_runs.pop_front();
+  }
+  else {
+    ++run.first;
+  }
+  --m_size;
+}
+
+void
+LpReliability::AckQueue::popRun()
+{
+  BOOST_ASSERT(!m_runs.empty());
+  m_size -= m_runs.front().length;
+  m_runs.pop_front();
+}
+
 } // namespace face
 } // namespace nfd
@@ -32,7 +32,7 @@
 #include <ndn-cxx/lp/packet.hpp>
 #include <ndn-cxx/lp/sequence.hpp>
 
-#include <queue>
+#include <deque>
 
 namespace nfd {
 namespace face {
@@ -41,6 +41,10 @@ class GenericLinkService;
 
 /** \brief provides for reliable sending and receiving of link-layer packets
  *  \sa https://redmine.named-data.net/projects/nfd/wiki/NDNLPv2
+ *
+ *  Unacknowledged fragments are kept in a circular window indexed by TxSequence. A single
+ *  retransmission timer per link tracks the oldest unacknowledged fragment, and loss detection
+ *  by greater Acks only needs to look at the fragments at the start of the window.
  */
 class LpReliability : noncopyable
 {
@@ -63,6 +67,14 @@ public:
      *         numbers are acknowledged
      */
     size_t seqNumLossThreshold = 3;
+
+    /** \brief acknowledge runs of consecutive TxSequences with AckRange fields
+     *
+     *  AckRange is ignored by peers that do not understand it, so this should only be enabled
+     *  when the peer is known to support it. Regardless of this option, AckRange fields are used
+     *  after the peer has sent one.
+     */
+    bool wantAckRanges = false;
   };
 
   LpReliability(const Options& options, GenericLinkService* linkService);
@@ -107,7 +119,8 @@ public:
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   class UnackedFrag;
   class NetPkt;
-  using UnackedFrags = std::map<lp::Sequence, UnackedFrag>;
+  class UnackedFrags;
+  class AckQueue;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /** \brief assign TxSequence number to a fragment
@@ -132,39 +145,59 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
   stopIdleAckTimer();
 
-  /** \brief find and mark as lost fragments where a configurable number of Acks
-   *         (\p m_options.seqNumLossThreshold) have been received for greater TxSequence numbers
-   *  \param ackIt iterator pointing to acknowledged fragment
-   *  \return vector containing TxSequences of fragments marked lost by this mechanism
+  /** \brief (re)start the retransmission timer to expire at \p expiry
    */
-  std::vector<lp::Sequence>
-  findLostLpPackets(UnackedFrags::iterator ackIt);
+  void
+  startRtoTimer(time::steady_clock::TimePoint expiry);
 
-  /** \brief resend (or give up on) a lost fragment
-   *  \return vector of the TxSequences of fragments removed due to a network packet being removed
+  /** \brief resend or give up on fragments at the start of the window whose RTO has expired,
+   *         then restart the retransmission timer for the oldest remaining fragment
+   *
+   *  Fragments are sent in TxSequence order, so the oldest unacknowledged fragment is also the
+   *  first to expire, unless the RTO estimate decreased in the meantime. In that case the later
+   *  fragment is retransmitted when the oldest one expires or is acknowledged.
    */
-  std::vector<lp::Sequence>
-  onLpPacketLost(lp::Sequence txSeq);
+  void
+  onRtoTimeout();
+
+  /** \brief process an Ack for a single TxSequence
+   *
+   *  Acks for unknown TxSequences are ignored.
+   */
+  void
+  processAck(lp::Sequence ackSeq, time::steady_clock::TimePoint now);
 
-  /** \brief remove the fragment with the given sequence number from the map of unacknowledged
-   *         fragments, as well as its associated network packet (if any)
-   *  \param fragIt iterator to acknowledged fragment
+  /** \brief record an Ack for an unacknowledged fragment, and resend (or give up on) fragments
+   *         for which a configurable number of Acks (\p m_options.seqNumLossThreshold) have been
+   *         received for greater TxSequence numbers
    *
-   *  If the given TxSequence marks the beginning of the send window, the window will be incremented.
-   *  If the associated network packet has been fully transmitted, it will be removed.
+   *  Only the greatest acknowledged TxSequences are remembered. The smallest of them bounds the
+   *  fragments considered lost, which all sit at the start of the window.
    */
   void
-  onLpPacketAcknowledged(UnackedFrags::iterator fragIt);
+  findLostLpPackets(lp::Sequence ackSeq);
 
-  /** \brief delete a fragment from UnackedFrags and advance acknowledge window if necessary
-   *  \param fragIt iterator to an UnackedFrag, must be dereferencable
-   *  \post fragIt is not in m_unackedFrags
-   *  \post if was equal to m_firstUnackedFrag,
-   *        m_firstUnackedFrag is set to the UnackedFrag after fragIt with consideration of
-   *        TxSequence number wraparound, or set to m_unackedFrags.end() if m_unackedFrags is empty
+  /** \return number of Acks received for TxSequences greater than \p txSeq,
+   *          capped at \p m_options.seqNumLossThreshold
+   */
+  size_t
+  countGreaterAcks(lp::Sequence txSeq) const;
+
+  /** \brief resend (or give up on) a lost fragment
+   *
+   *  If the maximum number of retransmissions is exceeded, all fragments of the associated
+   *  network packet are removed from the window.
+   */
+  void
+  onLpPacketLost(lp::Sequence txSeq);
+
+  /** \brief remove the fragment with the given sequence number from the window of unacknowledged
+   *         fragments, as well as from its associated network packet
+   *
+   *  If the associated network packet has been fully transmitted, the counters are incremented.
    */
   void
-  deleteUnackedFrag(UnackedFrags::iterator fragIt);
+  onLpPacketAcknowledged(lp::Sequence txSeq);
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /** \brief contains a sent fragment that has not been acknowledged and associated data
@@ -177,10 +210,9 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 
   public:
     lp::Packet pkt;
-    scheduler::ScopedEventId rtoTimer;
     time::steady_clock::TimePoint sendTime;
+    time::steady_clock::TimePoint rtoExpiry;
     size_t retxCount;
-    size_t nGreaterSeqAcks; //!< number of Acks received for sequences greater than this fragment
     shared_ptr<NetPkt> netPkt;
   };
 
@@ -192,12 +224,163 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
     NetPkt(lp::Packet&& pkt, bool isInterest);
 
   public:
-    std::vector<UnackedFrags::iterator> unackedFrags;
+    std::vector<lp::Sequence> unackedFrags;
     lp::Packet pkt;
     bool isInterest;
     bool didRetx;
   };
 
+  /** \brief circular window of unacknowledged fragments, indexed by TxSequence
+   *
+   *  The window spans from the first to the last unacknowledged TxSequence, allowing for
+   *  wraparound. Each TxSequence in the span has a slot, which is empty if the fragment has been
+   *  acknowledged or retransmitted under a new TxSequence. The capacity is a power of two and
+   *  doubles when the span outgrows it.
+   */
+  class UnackedFrags
+  {
+  public:
+    UnackedFrags();
+
+    size_t
+    size() const
+    {
+      return m_size;
+    }
+
+    bool
+    empty() const
+    {
+      return m_size == 0;
+    }
+
+    size_t
+    capacity() const
+    {
+      return m_slots.size();
+    }
+
+    size_t
+    count(lp::Sequence txSeq) const
+    {
+      return this->find(txSeq) == nullptr ? 0 : 1;
+    }
+
+    /** \return the fragment with \p txSeq, or nullptr if it is not in the window
+     */
+    UnackedFrag*
+    find(lp::Sequence txSeq);
+
+    const UnackedFrag*
+    find(lp::Sequence txSeq) const;
+
+    /** \throw std::out_of_range \p txSeq is not in the window
+     */
+    UnackedFrag&
+    at(lp::Sequence txSeq);
+
+    /** \return TxSequence of the first unacknowledged fragment
+     *  \pre !empty()
+     */
+    lp::Sequence
+    getFirstSequence() const
+    {
+      BOOST_ASSERT(!empty());
+      return m_first;
+    }
+
+    /** \brief insert a fragment
+     *  \pre \p txSeq is greater than every TxSequence in the window, allowing for wraparound
+     */
+    UnackedFrag&
+    emplace(lp::Sequence txSeq, lp::Packet pkt);
+
+    /** \brief remove a fragment, and advance the start of the window if necessary
+     *  \pre count(txSeq) > 0
+     */
+    void
+    erase(lp::Sequence txSeq);
+
+  private:
+    optional<UnackedFrag>&
+    getSlot(lp::Sequence txSeq)
+    {
+      return m_slots[txSeq & (m_slots.size() - 1)];
+    }
+
+    void
+    grow(uint64_t minCapacity);
+
+  private:
+    std::vector<optional<UnackedFrag>> m_slots;
+    lp::Sequence m_first; ///< first unacknowledged TxSequence, valid if not empty
+    lp::Sequence m_last; ///< last unacknowledged TxSequence, valid if not empty
+    size_t m_size;
+  };
+
+  /** \brief TxSequences waiting to be acknowledged, stored as runs of consecutive numbers
+   */
+  class AckQueue
+  {
+  public:
+    struct Run
+    {
+      lp::Sequence first;
+      uint64_t length;
+    };
+
+    bool
+    empty() const
+    {
+      return m_runs.empty();
+    }
+
+    /** \return number of pending TxSequences
+     */
+    size_t
+    size() const
+    {
+      return m_size;
+    }
+
+    lp::Sequence
+    front() const
+    {
+      return m_runs.front().first;
+    }
+
+    lp::Sequence
+    back() const
+    {
+      return m_runs.back().first + m_runs.back().length - 1;
+    }
+
+    const Run&
+    frontRun() const
+    {
+      return m_runs.front();
+    }
+
+    /** \brief append a TxSequence, extending the last run if it is consecutive
+     */
+    void
+    push(lp::Sequence txSeq);
+
+    /** \brief remove the first pending TxSequence
+     */
+    void
+    pop();
+
+    /** \brief remove the first run
+     */
+    void
+    popRun();
+
+  private:
+    std::deque<Run> m_runs;
+    size_t m_size = 0;
+  };
+
 public:
   /// TxSequence TLV-TYPE (3 octets) + TxSequence TLV-LENGTH (1 octet) + sizeof(lp::Sequence)
   static constexpr size_t RESERVED_HEADER_SPACE = 3 + 1 + sizeof(lp::Sequence);
@@ -206,16 +389,17 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   Options m_options;
   GenericLinkService* m_linkService;
   UnackedFrags m_unackedFrags;
-  /** An iterator that points to the first unacknowledged fragment in the current window. The window
-   *  can wrap around so that the beginning of the window is at a TxSequence greater than other
-   *  fragments in the window. When the window is moved past the last item in the iterator, the
-   *  first fragment in the map will become the start of the window.
+  /** The greatest acknowledged TxSequences, in ascending order, up to seqNumLossThreshold of them.
+   *  Every unacknowledged fragment before the first of them is considered lost.
    */
-  UnackedFrags::iterator m_firstUnackedFrag;
-  std::queue<lp::Sequence> m_ackQueue;
+  std::vector<lp::Sequence> m_greatestAcks;
+  AckQueue m_ackQueue;
   lp::Sequence m_lastTxSeqNo;
   scheduler::ScopedEventId m_idleAckTimer;
   bool m_isIdleAckTimerRunning;
+  scheduler::ScopedEventId m_rtoTimer;
+  bool m_isRtoTimerRunning;
+  bool m_isPeerUsingAckRanges;
   RttEstimator m_rto;
 };
 
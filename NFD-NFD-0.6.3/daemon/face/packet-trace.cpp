@@ -0,0 +1,180 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "packet-trace.hpp"
+
+#include <cstring>
+
+namespace nfd {
+namespace face {
+
+static const char TRACE_MAGIC[8] = {'N', 'D', 'N', 'T', 'R', 'A', 'C', 'E'};
+static const uint32_t TRACE_VERSION = 1;
+static const size_t RECORD_HEADER_SIZE = 24;
+
+static void
+putUint(uint8_t* buf, uint64_t value, size_t size)
+{
+  for (size_t i = size; i > 0; --i) {
+    buf[i - 1] = static_cast<uint8_t>(value);
+    value >>= 8;
+  }
+}
+
+static uint64_t
+getUint(const uint8_t* buf, size_t size)
+{
+  uint64_t value = 0;
+  for (size_t i = 0; i < size; ++i) {
+    value = (value << 8) | buf[i];
+  }
+  return value;
+}
+
+PacketTraceWriter::PacketTraceWriter(const std::string& filename)
+  : m_filename(filename)
+  , m_os(filename, std::ios::binary | std::ios::trunc)
+  , m_nRecords(0)
+{
+  if (!m_os) {
+    BOOST_THROW_EXCEPTION(Error("Cannot open packet trace file " + filename));
+  }
+
+  uint8_t header[sizeof(TRACE_MAGIC) + 4];
+  std::memcpy(header, TRACE_MAGIC, sizeof(TRACE_MAGIC));
+  putUint(header + sizeof(TRACE_MAGIC), TRACE_VERSION, 4);
+  m_os.write(reinterpret_cast<const char*>(header), sizeof(header));
+}
+
+void
+PacketTraceWriter::write(FaceId faceId, PacketTraceRecord::Direction direction, const Block& packet)
+{
+  this->writeRecord(time::system_clock::now(), faceId, direction, packet);
+}
+
+void
+PacketTraceWriter::write(const PacketTraceRecord& record)
+{
+  this->writeRecord(record.timestamp, record.faceId, record.direction, record.packet);
+}
+
+void
+PacketTraceWriter::writeRecord(const time::system_clock::TimePoint& timestamp, FaceId faceId,
+                               PacketTraceRecord::Direction direction, const Block& packet)
+{
+  uint8_t header[RECORD_HEADER_SIZE] = {};
+  auto ns = time::duration_cast<time::nanoseconds>(timestamp.time_since_epoch()).count();
+  putUint(header, static_cast<uint64_t>(ns), 8);
+  putUint(header + 8, faceId, 8);
+  putUint(header + 16, packet.size(), 4);
+  header[20] = direction;
+
+  m_os.write(reinterpret_cast<const char*>(header), sizeof(header));
+  m_os.write(reinterpret_cast<const char*>(packet.wire()), packet.size());
+  ++m_nRecords;
+}
+
+void
+PacketTraceWriter::flush()
+{
+  m_os.flush();
+}
+
+PacketTraceReader::PacketTraceReader(const std::string& filename)
+  : m_is(filename, std::ios::binary)
+{
+  if (!m_is) {
+    BOOST_THROW_EXCEPTION(Error("Cannot open packet trace file " + filename));
+  }
+
+  uint8_t header[sizeof(TRACE_MAGIC) + 4];
+  if (!m_is.read(reinterpret_cast<char*>(header), sizeof(header)) ||
+      std::memcmp(header, TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0) {
+    BOOST_THROW_EXCEPTION(Error(filename + " is not a packet trace file"));
+  }
+
+  uint32_t version = static_cast<uint32_t>(getUint(header + sizeof(TRACE_MAGIC), 4));
+  if (version != TRACE_VERSION) {
+    BOOST_THROW_EXCEPTION(Error("Unsupported packet trace version " + to_string(version)));
+  }
+}
+
+bool
+PacketTraceReader::read(PacketTraceRecord& record)
+{
+  uint8_t header[RECORD_HEADER_SIZE];
+  m_is.read(reinterpret_cast<char*>(header), sizeof(header));
+  if (m_is.gcount() == 0) {
+    return false;
+  }
+  if (static_cast<size_t>(m_is.gcount()) != sizeof(header)) {
+    BOOST_THROW_EXCEPTION(Error("Truncated packet trace record header"));
+  }
+
+  uint8_t direction = header[20];
+  if (direction != PacketTraceRecord::INCOMING && direction != PacketTraceRecord::OUTGOING) {
+    BOOST_THROW_EXCEPTION(Error("Invalid direction in packet trace record"));
+  }
+
+  // a corrupted length must not cause a huge allocation; no face sends a larger packet
+  size_t length = static_cast<size_t>(getUint(header + 16, 4));
+  if (length > ndn::MAX_NDN_PACKET_SIZE) {
+    BOOST_THROW_EXCEPTION(Error("Packet trace record length " + to_string(length) +
+                                " exceeds the maximum packet size"));
+  }
+  auto buffer = make_shared<ndn::Buffer>(length);
+  if (!m_is.read(reinterpret_cast<char*>(buffer->data()), length)) {
+    BOOST_THROW_EXCEPTION(Error("Truncated packet trace record"));
+  }
+
+  record.timestamp = time::system_clock::TimePoint(
+                       time::nanoseconds(static_cast<int64_t>(getUint(header, 8))));
+  record.faceId = getUint(header + 8, 8);
+  record.direction = static_cast<PacketTraceRecord::Direction>(direction);
+  try {
+    record.packet = Block(buffer);
+  }
+  catch (const tlv::Error& e) {
+    BOOST_THROW_EXCEPTION(Error("Malformed packet in packet trace record: " + std::string(e.what())));
+  }
+  return true;
+}
+
+static unique_ptr<PacketTraceWriter> g_capture;
+
+void
+setPacketTraceCapture(unique_ptr<PacketTraceWriter> writer)
+{
+  g_capture = std::move(writer);
+}
+
+PacketTraceWriter*
+getPacketTraceCapture()
+{
+  return g_capture.get();
+}
+
+} // namespace face
+} // namespace nfd
@@ -0,0 +1,153 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_PACKET_TRACE_HPP
+#define NFD_DAEMON_FACE_PACKET_TRACE_HPP
+
+#include "face.hpp"
+
+#include <fstream>
+
+namespace nfd {
+namespace face {
+
+/** \brief a link-layer packet captured on a face
+ *
+ *  A trace file starts with the 8-octet magic "NDNTRACE" and a 4-octet format version.
+ *  Each record that follows has a 24-octet header and the wire encoding of the packet:
+ *  \li timestamp in nanoseconds since the Unix epoch (8 octets)
+ *  \li FaceId (8 octets)
+ *  \li length of the wire encoding (4 octets)
+ *  \li direction (1 octet), and 3 reserved octets
+ *
+ *  Integers are in network byte order.
+ */
+struct PacketTraceRecord
+{
+  enum Direction : uint8_t {
+    INCOMING = 0,
+    OUTGOING = 1
+  };
+
+  time::system_clock::TimePoint timestamp;
+  FaceId faceId = INVALID_FACEID;
+  Direction direction = INCOMING;
+  Block packet;
+};
+
+/** \brief writes a packet trace file
+ */
+class PacketTraceWriter : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    explicit
+    Error(const std::string& what)
+      : std::runtime_error(what)
+    {
+    }
+  };
+
+  /** \brief create or truncate \p filename and write the file header
+   *  \throw Error the file cannot be opened
+   */
+  explicit
+  PacketTraceWriter(const std::string& filename);
+
+  const std::string&
+  getFilename() const
+  {
+    return m_filename;
+  }
+
+  /** \brief append a record timestamped with the current time
+   */
+  void
+  write(FaceId faceId, PacketTraceRecord::Direction direction, const Block& packet);
+
+  void
+  write(const PacketTraceRecord& record);
+
+  void
+  flush();
+
+  uint64_t
+  getNRecords() const
+  {
+    return m_nRecords;
+  }
+
+private:
+  void
+  writeRecord(const time::system_clock::TimePoint& timestamp, FaceId faceId,
+              PacketTraceRecord::Direction direction, const Block& packet);
+
+private:
+  std::string m_filename;
+  std::ofstream m_os;
+  uint64_t m_nRecords;
+};
+
+/** \brief reads a packet trace file
+ */
+class PacketTraceReader : noncopyable
+{
+public:
+  using Error = PacketTraceWriter::Error;
+
+  /** \brief open \p filename and verify the file header
+   *  \throw Error the file cannot be opened or is not a packet trace
+   */
+  explicit
+  PacketTraceReader(const std::string& filename);
+
+  /** \brief read the next record
+   *  \retval false end of file has been reached
+   *  \throw Error the record is truncated or malformed, or longer than ndn::MAX_NDN_PACKET_SIZE
+   */
+  bool
+  read(PacketTraceRecord& record);
+
+private:
+  std::ifstream m_is;
+};
+
+/** \brief set the trace that captures packets sent and received on every face
+ *  \param writer the trace, or nullptr to stop capturing
+ */
+void
+setPacketTraceCapture(unique_ptr<PacketTraceWriter> writer);
+
+/** \return the trace that captures packets, or nullptr if capture is disabled
+ */
+PacketTraceWriter*
+getPacketTraceCapture();
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_PACKET_TRACE_HPP
@@ -0,0 +1,131 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "shm-factory.hpp"
+
+#include <boost/filesystem.hpp>
+
+namespace nfd {
+namespace face {
+
+NFD_LOG_INIT(ShmFactory);
+NFD_REGISTER_PROTOCOL_FACTORY(ShmFactory);
+
+const std::string&
+ShmFactory::getId()
+{
+  static std::string id("shm");
+  return id;
+}
+
+ShmFactory::ShmFactory(const CtorParams& params)
+  : ProtocolFactory(params)
+{
+}
+
+void
+ShmFactory::processConfig(OptionalConfigSection configSection,
+                          FaceSystem::ConfigContext& context)
+{
+  // shm
+  // {
+  //   path /var/run/nfd-shm.sock
+  //   ring_capacity 4194304
+  // }
+
+  m_wantCongestionMarking = context.generalConfig.wantCongestionMarking;
+
+  if (!configSection) {
+    if (!context.isDryRun && !m_channels.empty()) {
+      NFD_LOG_WARN("Cannot disable shm channel after initialization");
+    }
+    return;
+  }
+
+  std::string path = "/var/run/nfd-shm.sock";
+  size_t ringCapacity = ndn::shm::DEFAULT_RING_CAPACITY;
+
+  for (const auto& pair : *configSection) {
+    const std::string& key = pair.first;
+    const ConfigSection& value = pair.second;
+
+    if (key == "path") {
+      path = value.get_value<std::string>();
+    }
+    else if (key == "ring_capacity") {
+      ringCapacity = ConfigFile::parseNumber<size_t>(pair, "face_system.shm");
+      if (!ndn::shm::isValidRingCapacity(ringCapacity)) {
+        BOOST_THROW_EXCEPTION(ConfigFile::Error("face_system.shm.ring_capacity must be a power of 2 "
+                                                "not less than " +
+                                                to_string(ndn::shm::MIN_RING_CAPACITY)));
+      }
+    }
+    else {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error("Unrecognized option face_system.shm." + key));
+    }
+  }
+
+  if (!context.isDryRun) {
+    m_ringCapacity = ringCapacity;
+
+    auto channel = this->createChannel(path);
+    if (!channel->isListening()) {
+      channel->listen(this->addFace, nullptr);
+    }
+  }
+}
+
+void
+ShmFactory::createFace(const CreateFaceRequest& req,
+                       const FaceCreatedCallback& onCreated,
+                       const FaceCreationFailedCallback& onFailure)
+{
+  onFailure(406, "Unsupported protocol");
+}
+
+shared_ptr<ShmChannel>
+ShmFactory::createChannel(const std::string& unixSocketPath)
+{
+  boost::filesystem::path p(unixSocketPath);
+  p = boost::filesystem::canonical(p.parent_path()) / p.filename();
+  unix_stream::Endpoint endpoint(p.string());
+
+  auto it = m_channels.find(endpoint);
+  if (it != m_channels.end())
+    return it->second;
+
+  auto channel = make_shared<ShmChannel>(endpoint, m_ringCapacity, m_wantCongestionMarking);
+  m_channels[endpoint] = channel;
+  return channel;
+}
+
+std::vector<shared_ptr<const Channel>>
+ShmFactory::getChannels() const
+{
+  return getChannelsFromMap(m_channels);
+}
+
+} // namespace face
+} // namespace nfd
@@ -0,0 +1,377 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "shm-transport.hpp"
+#include "core/global-io.hpp"
+
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace nfd {
+namespace face {
+
+NFD_LOG_INIT(ShmTransport);
+
+/** \brief maximum number of packets received in one round before yielding to other handlers
+ */
+static const size_t MAX_RECEIVE_BATCH = 64;
+
+ShmTransport::ShmTransport(boost::asio::local::stream_protocol::socket&& socket, size_t ringCapacity)
+  : m_socket(std::move(socket))
+  , m_doorbell(getGlobalIoService())
+  , m_peerDoorbell(-1)
+  , m_segmentFd(-1)
+  , m_segment(nullptr)
+  , m_segmentSize(0)
+  , m_sendQueueBytes(0)
+  , m_doorbellValue(0)
+  , m_socketBuffer(0)
+  , m_isDoorbellArmed(false)
+  , m_isPollScheduled(false)
+{
+  this->setLocalUri(FaceUri("shm://" + m_socket.local_endpoint().path()));
+  this->setRemoteUri(FaceUri::fromFd(m_socket.native_handle()));
+  this->setScope(ndn::nfd::FACE_SCOPE_LOCAL);
+  this->setPersistency(ndn::nfd::FACE_PERSISTENCY_ON_DEMAND);
+  this->setLinkType(ndn::nfd::LINK_TYPE_POINT_TO_POINT);
+  this->setMtu(MTU_UNLIMITED);
+
+  NFD_LOG_FACE_INFO("Creating transport");
+
+  try {
+    createSegment(ringCapacity);
+    sendSegment();
+  }
+  catch (const Error&) {
+    releaseResources();
+    throw;
+  }
+
+  startWatchingSocket();
+  schedulePoll();
+}
+
+ShmTransport::~ShmTransport()
+{
+  releaseResources();
+}
+
+void
+ShmTransport::createSegment(size_t ringCapacity)
+{
+  BOOST_ASSERT(ndn::shm::isValidRingCapacity(ringCapacity));
+
+  m_segmentFd = ::memfd_create("nfd-shm-face", MFD_CLOEXEC);
+  if (m_segmentFd < 0) {
+    BOOST_THROW_EXCEPTION(Error("memfd_create failed: "s + std::strerror(errno)));
+  }
+
+  m_segmentSize = ndn::shm::getSegmentSize(ringCapacity);
+  if (::ftruncate(m_segmentFd, m_segmentSize) < 0) {
+    BOOST_THROW_EXCEPTION(Error("ftruncate failed: "s + std::strerror(errno)));
+  }
+
+  void* addr = ::mmap(nullptr, m_segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_segmentFd, 0);
+  if (addr == MAP_FAILED) {
+    BOOST_THROW_EXCEPTION(Error("mmap failed: "s + std::strerror(errno)));
+  }
+  m_segment = static_cast<uint8_t*>(addr);
+
+  ndn::shm::Ring::initializeSegment(m_segment, ringCapacity);
+  m_rxRing = make_unique<ndn::shm::Ring>(m_segment, ndn::shm::RING_TO_FORWARDER);
+  m_txRing = make_unique<ndn::shm::Ring>(m_segment, ndn::shm::RING_TO_CLIENT);
+
+  int doorbell = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (doorbell < 0) {
+    BOOST_THROW_EXCEPTION(Error("eventfd failed: "s + std::strerror(errno)));
+  }
+  m_doorbell.assign(doorbell);
+
+  m_peerDoorbell = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (m_peerDoorbell < 0) {
+    BOOST_THROW_EXCEPTION(Error("eventfd failed: "s + std::strerror(errno)));
+  }
+}
+
+void
+ShmTransport::sendSegment()
+{
+  // segment, forwarder's eventfd, client's eventfd
+  int fds[] = {m_segmentFd, m_doorbell.native_handle(), m_peerDoorbell};
+
+  uint8_t version = ndn::shm::SEGMENT_VERSION;
+  iovec iov{&version, sizeof(version)};
+  union {
+    cmsghdr align;
+    char buf[CMSG_SPACE(sizeof(fds))];
+  } control;
+  std::memset(&control, 0, sizeof(control));
+
+  msghdr msg{};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control.buf;
+  msg.msg_controllen = sizeof(control.buf);
+
+  cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+  std::memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+  if (::sendmsg(m_socket.native_handle(), &msg, MSG_NOSIGNAL) != sizeof(version)) {
+    BOOST_THROW_EXCEPTION(Error("sendmsg failed: "s + std::strerror(errno)));
+  }
+
+  // the mapping stays valid after the descriptor is closed
+  ::close(m_segmentFd);
+  m_segmentFd = -1;
+}
+
+ssize_t
+ShmTransport::getSendQueueLength()
+{
+  size_t ringBytes = m_txRing == nullptr ? 0 : m_txRing->getUsedSpace();
+  return m_sendQueueBytes + ringBytes;
+}
+
+void
+ShmTransport::doClose()
+{
+  NFD_LOG_FACE_TRACE(__func__);
+
+  releaseResources();
+
+  // Ensure that the Transport stays alive at least
+  // until all pending handlers are dispatched
+  getGlobalIoService().post([this] {
+    this->setState(TransportState::CLOSED);
+  });
+}
+
+void
+ShmTransport::doSend(Transport::Packet&& packet)
+{
+  NFD_LOG_FACE_TRACE(__func__);
+
+  if (getState() != TransportState::UP)
+    return;
+
+  if (m_sendQueue.empty() && m_txRing->tryWrite(packet.packet)) {
+    if (m_txRing->shouldWakeConsumer()) {
+      notifyPeer();
+    }
+    return;
+  }
+
+  m_sendQueueBytes += packet.packet.size();
+  m_sendQueue.push(std::move(packet.packet));
+  flushSendQueue();
+}
+
+void
+ShmTransport::startWatchingSocket()
+{
+  m_socket.async_read_some(boost::asio::buffer(&m_socketBuffer, sizeof(m_socketBuffer)),
+                           [this] (const auto& error, size_t) { this->handleSocketRead(error); });
+}
+
+void
+ShmTransport::handleSocketRead(const boost::system::error_code& error)
+{
+  // boost::asio::error::operation_aborted must be checked first: in that case, the Transport
+  // may already have been destructed, therefore it's unsafe to call getState() or do logging.
+  if (error == boost::asio::error::operation_aborted ||
+      getState() == TransportState::CLOSING ||
+      getState() == TransportState::FAILED ||
+      getState() == TransportState::CLOSED) {
+    return;
+  }
+
+  if (error == boost::asio::error::eof) {
+    this->setState(TransportState::CLOSING);
+  }
+  else {
+    // the application is not supposed to write to the socket after the handshake
+    NFD_LOG_FACE_ERROR("Unexpected socket event: " << (error ? error.message() : "data received"));
+    this->setState(TransportState::FAILED);
+  }
+  doClose();
+}
+
+void
+ShmTransport::schedulePoll()
+{
+  if (!m_isPollScheduled) {
+    m_isPollScheduled = true;
+    getGlobalIoService().post([this] { poll(); });
+  }
+}
+
+void
+ShmTransport::poll()
+{
+  m_isPollScheduled = false;
+  if (m_segment == nullptr) {
+    return;
+  }
+
+  size_t nReceived = 0;
+  Block element;
+  while (nReceived < MAX_RECEIVE_BATCH) {
+    try {
+      if (!m_rxRing->tryRead(element)) {
+        break;
+      }
+    }
+    catch (const tlv::Error& e) {
+      NFD_LOG_FACE_ERROR("Failed to parse incoming packet: " << e.what());
+      this->setState(TransportState::FAILED);
+      doClose();
+      return;
+    }
+    ++nReceived;
+    this->receive(Transport::Packet(std::move(element)));
+    if (m_segment == nullptr) {
+      return; // transport was closed while processing the packet
+    }
+  }
+
+  if (nReceived > 0) {
+    NFD_LOG_FACE_TRACE("Received " << nReceived << " packets");
+    if (m_rxRing->shouldWakeProducer()) {
+      notifyPeer();
+    }
+  }
+
+  flushSendQueue();
+
+  if (nReceived > 0 || !m_rxRing->prepareConsumerWait()) {
+    schedulePoll();
+  }
+  else {
+    armDoorbell();
+  }
+}
+
+void
+ShmTransport::flushSendQueue()
+{
+  bool hasWritten = false;
+  while (!m_sendQueue.empty()) {
+    const Block& block = m_sendQueue.front();
+    if (m_txRing->tryWrite(block)) {
+      m_sendQueueBytes -= block.size();
+      m_sendQueue.pop();
+      hasWritten = true;
+      continue;
+    }
+
+    if (m_txRing->prepareProducerWait(ndn::shm::Ring::getRecordSize(block.size()))) {
+      armDoorbell();
+      break;
+    }
+  }
+
+  if (hasWritten && m_txRing->shouldWakeConsumer()) {
+    notifyPeer();
+  }
+}
+
+void
+ShmTransport::armDoorbell()
+{
+  if (m_isDoorbellArmed) {
+    return;
+  }
+
+  m_isDoorbellArmed = true;
+  m_doorbell.async_read_some(boost::asio::buffer(&m_doorbellValue, sizeof(m_doorbellValue)),
+                             [this] (const auto& error, size_t) { this->handleDoorbell(error); });
+}
+
+void
+ShmTransport::handleDoorbell(const boost::system::error_code& error)
+{
+  if (error == boost::asio::error::operation_aborted) {
+    return;
+  }
+
+  m_isDoorbellArmed = false;
+  if (error) {
+    NFD_LOG_FACE_ERROR("Failed to wait for application: " << error.message());
+    this->setState(TransportState::FAILED);
+    doClose();
+    return;
+  }
+
+  poll();
+}
+
+void
+ShmTransport::notifyPeer()
+{
+  uint64_t value = 1;
+  if (::write(m_peerDoorbell, &value, sizeof(value)) != sizeof(value) && errno != EAGAIN) {
+    NFD_LOG_FACE_WARN("Failed to signal application: " << std::strerror(errno));
+  }
+}
+
+void
+ShmTransport::releaseResources()
+{
+  // Cancel all outstanding operations and close the descriptors.
+  // Use the non-throwing variants and ignore errors, if any.
+  boost::system::error_code error;
+  m_socket.cancel(error);
+  m_socket.close(error);
+  m_doorbell.cancel(error);
+  m_doorbell.close(error);
+
+  if (m_peerDoorbell >= 0) {
+    ::close(m_peerDoorbell);
+    m_peerDoorbell = -1;
+  }
+  if (m_segmentFd >= 0) {
+    ::close(m_segmentFd);
+    m_segmentFd = -1;
+  }
+
+  m_rxRing.reset();
+  m_txRing.reset();
+  if (m_segment != nullptr) {
+    ::munmap(m_segment, m_segmentSize);
+    m_segment = nullptr;
+  }
+
+  std::queue<Block> emptyQueue;
+  std::swap(emptyQueue, m_sendQueue);
+  m_sendQueueBytes = 0;
+}
+
+} // namespace face
+} // namespace nfd
@@ -0,0 +1,146 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_SHM_TRANSPORT_HPP
+#define NFD_DAEMON_FACE_SHM_TRANSPORT_HPP
+
+#include "transport.hpp"
+
+#include <ndn-cxx/transport/shm-ring.hpp>
+
+#include <boost/asio/posix/stream_descriptor.hpp>
+#include <queue>
+
+#ifndef HAVE_SHM_FACE
+#error "Cannot include this file when shared memory faces are not available"
+#endif
+
+namespace nfd {
+namespace face {
+
+/**
+ * \brief A Transport that exchanges packets with a local application through
+ *        shared memory rings
+ *
+ * The transport creates a memfd segment holding two ndn::shm::Ring and an eventfd for each
+ * side, and passes them to the application over the accepted Unix stream socket. Packets are
+ * then copied directly into and out of the rings. The eventfd of the other side is signaled
+ * only when that side has announced it is going to sleep, so no system call is made while
+ * packets keep flowing. The socket itself only serves to detect that the application is gone.
+ */
+class ShmTransport final : public Transport
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    explicit
+    Error(const std::string& what)
+      : std::runtime_error(what)
+    {
+    }
+  };
+
+  /**
+   * \brief Set up shared memory with the application connected on \p socket
+   * \param ringCapacity capacity of each ring in octets, see ndn::shm::isValidRingCapacity
+   * \throw Error the segment or the eventfds cannot be created or sent
+   */
+  ShmTransport(boost::asio::local::stream_protocol::socket&& socket, size_t ringCapacity);
+
+  ~ShmTransport() override;
+
+  ssize_t
+  getSendQueueLength() override;
+
+protected:
+  void
+  doClose() override;
+
+  void
+  doSend(Transport::Packet&& packet) override;
+
+private:
+  void
+  createSegment(size_t ringCapacity);
+
+  void
+  sendSegment();
+
+  void
+  startWatchingSocket();
+
+  void
+  handleSocketRead(const boost::system::error_code& error);
+
+  void
+  schedulePoll();
+
+  /**
+   * \brief drain the receive ring and the send queue
+   *
+   * While packets keep arriving, polling is rescheduled through the io_service without any
+   * system call. The eventfd is only armed after a round that found the receive ring empty.
+   */
+  void
+  poll();
+
+  void
+  flushSendQueue();
+
+  void
+  armDoorbell();
+
+  void
+  handleDoorbell(const boost::system::error_code& error);
+
+  void
+  notifyPeer();
+
+  void
+  releaseResources();
+
+private:
+  boost::asio::local::stream_protocol::socket m_socket;
+  boost::asio::posix::stream_descriptor m_doorbell;
+  int m_peerDoorbell;
+  int m_segmentFd;
+  uint8_t* m_segment;
+  size_t m_segmentSize;
+  unique_ptr<ndn::shm::Ring> m_rxRing;
+  unique_ptr<ndn::shm::Ring> m_txRing;
+
+  std::queue<Block> m_sendQueue;
+  size_t m_sendQueueBytes;
+  uint64_t m_doorbellValue;
+  uint8_t m_socketBuffer;
+  bool m_isDoorbellArmed;
+  bool m_isPollScheduled;
+};
+
+} // namespace face
+} // namespace nfd
+
+#endif // NFD_DAEMON_FACE_SHM_TRANSPORT_HPP
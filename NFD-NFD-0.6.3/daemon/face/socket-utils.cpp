@@ -29,6 +29,7 @@
 #if defined(__linux__)
 #include <linux/sockios.h>
 #include <sys/ioctl.h>
+#include <sys/socket.h>
 #elif defined(__APPLE__)
 #include <sys/socket.h>
 #endif
@@ -53,5 +54,34 @@ getTxQueueLength(int fd)
   return queueLength;
 }
 
+static time::microseconds g_busyPollTimeout(0);
+
+void
+setSocketBusyPollTimeout(time::microseconds timeout)
+{
+  g_busyPollTimeout = timeout;
+}
+
+time::microseconds
+getSocketBusyPollTimeout()
+{
+  return g_busyPollTimeout;
+}
+
+bool
+applySocketBusyPoll(int fd)
+{
+  if (g_busyPollTimeout == time::microseconds::zero()) {
+    return true;
+  }
+
+#if defined(__linux__) && defined(SO_BUSY_POLL)
+  int value = static_cast<int>(g_busyPollTimeout.count());
+  return setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, &value, sizeof(value)) == 0;
+#else
+  return false;
+#endif
+}
+
 } // namespace face
 } // namespace nfd
@@ -42,6 +42,23 @@ namespace face {
 ssize_t
 getTxQueueLength(int fd);
 
+/** \brief set the SO_BUSY_POLL timeout given to sockets of transports created from now on
+ *  \param timeout how long a blocking receive busy-polls the device queue; zero leaves
+ *                 sockets unchanged
+ */
+void
+setSocketBusyPollTimeout(time::microseconds timeout);
+
+time::microseconds
+getSocketBusyPollTimeout();
+
+/** \brief set SO_BUSY_POLL on \p fd to the timeout given to setSocketBusyPollTimeout
+ *  \return false if the option could not be set, e.g., because it is unsupported on the
+ *          current platform or the process lacks CAP_NET_ADMIN; true otherwise
+ */
+bool
+applySocketBusyPoll(int fd);
+
 } // namespace face
 } // namespace nfd
 
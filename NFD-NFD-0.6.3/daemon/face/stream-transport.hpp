@@ -30,7 +30,12 @@
 #include "socket-utils.hpp"
 #include "core/global-io.hpp"
 
-#include <queue>
+#ifdef HAVE_IO_URING
+#include "io-uring-service.hpp"
+#endif
+
+#include <deque>
+#include <numeric>
 
 namespace nfd {
 namespace face {
@@ -52,6 +57,19 @@ public:
   explicit
   StreamTransport(typename protocol::socket&& socket);
 
+  /** \brief maximum number of octets written by a single write operation
+   *
+   *  Packets queued while a write is in progress are gathered into the next write,
+   *  up to this many octets. A single packet is always sent even if it is larger.
+   */
+  static constexpr size_t MAX_SEND_BATCH_SIZE = 131072;
+
+  /** \brief maximum number of packets written by a single write operation
+   *
+   *  Boost.Asio passes at most 64 buffers to each writev call.
+   */
+  static constexpr size_t MAX_SEND_BATCH_PACKETS = 64;
+
   ssize_t
   getSendQueueLength() override;
 
@@ -65,6 +83,9 @@ protected:
   void
   doSend(Transport::Packet&& packet) override;
 
+  /** \brief write as many queued packets as allowed by the batch limits in one operation
+   *  \pre no write is in progress and the send queue is not empty
+   */
   void
   sendFromQueue();
 
@@ -79,6 +100,33 @@ protected:
   handleReceive(const boost::system::error_code& error,
                 size_t nBytesReceived);
 
+#ifdef HAVE_IO_URING
+  /** \brief handle octets received through io_uring
+   */
+  void
+  handleBufferReceive(const uint8_t* buffer, size_t nBytesReceived,
+                      const boost::system::error_code& error);
+#endif
+
+  /** \brief parse packets from the receive buffer after \p nBytesReceived octets were appended
+   *  \return false if the transport has been closed
+   */
+  bool
+  processReceiveBuffer(size_t nBytesReceived);
+
+  /** \brief perform I/O on m_socket through io_uring, if that backend is enabled
+   */
+  void
+  attachIoUring();
+
+  /** \brief cancel all io_uring operations on m_socket
+   *
+   *  No io_uring callback is invoked afterwards. Call attachIoUring again once m_socket
+   *  has been replaced.
+   */
+  void
+  detachIoUring();
+
   void
   processErrorCode(const boost::system::error_code& error);
 
@@ -100,23 +148,39 @@ protected:
   NFD_LOG_MEMBER_DECL();
 
 private:
+#ifdef HAVE_IO_URING
+  unique_ptr<IoUringSocket> m_ioUring;
+#endif
   uint8_t m_receiveBuffer[ndn::MAX_NDN_PACKET_SIZE];
   size_t m_receiveBufferSize;
-  std::queue<Block> m_sendQueue;
-  size_t m_sendQueueBytes;
+  std::deque<Block> m_sendQueue;
+  size_t m_sendQueueBytes; ///< octets in m_sendQueue, including those being written
+  size_t m_nSendingPackets; ///< number of packets at the front of m_sendQueue being written
 };
 
+template<class T>
+constexpr size_t StreamTransport<T>::MAX_SEND_BATCH_SIZE;
+
+template<class T>
+constexpr size_t StreamTransport<T>::MAX_SEND_BATCH_PACKETS;
+
 
 template<class T>
 StreamTransport<T>::StreamTransport(typename StreamTransport::protocol::socket&& socket)
   : m_socket(std::move(socket))
   , m_receiveBufferSize(0)
   , m_sendQueueBytes(0)
+  , m_nSendingPackets(0)
 {
   // No queue capacity is set because there is no theoretical limit to the size of m_sendQueue.
   // Therefore, protecting against send queue overflows is less critical than in other transport
   // types. Instead, we use the default threshold specified in the GenericLinkService options.
 
+  if (!applySocketBusyPoll(m_socket.native_handle())) {
+    NFD_LOG_FACE_WARN("Failed to enable busy polling on socket: " << std::strerror(errno));
+  }
+
+  attachIoUring();
   startReceive();
 }
 
@@ -137,6 +201,8 @@ StreamTransport<T>::doClose()
 {
   NFD_LOG_FACE_TRACE(__func__);
 
+  detachIoUring();
+
   if (m_socket.is_open()) {
     // Cancel all outstanding operations and shutdown the socket
     // so that no further sends or receives are possible.
@@ -187,11 +253,11 @@ StreamTransport<T>::doSend(Transport::Packet&& packet)
   if (getState() != TransportState::UP)
     return;
 
-  bool wasQueueEmpty = m_sendQueue.empty();
-  m_sendQueue.push(packet.packet);
+  m_sendQueue.push_back(packet.packet);
   m_sendQueueBytes += packet.packet.size();
 
-  if (wasQueueEmpty)
+  // otherwise, the packet is sent together with others queued meanwhile when the write completes
+  if (m_nSendingPackets == 0)
     sendFromQueue();
 }
 
@@ -199,7 +265,31 @@ template<class T>
 void
 StreamTransport<T>::sendFromQueue()
 {
-  boost::asio::async_write(m_socket, boost::asio::buffer(m_sendQueue.front()),
+  BOOST_ASSERT(m_nSendingPackets == 0);
+  BOOST_ASSERT(!m_sendQueue.empty());
+
+  size_t nBytes = m_sendQueue.front().size();
+  m_nSendingPackets = 1;
+  while (m_nSendingPackets < m_sendQueue.size() && m_nSendingPackets < MAX_SEND_BATCH_PACKETS &&
+         nBytes + m_sendQueue[m_nSendingPackets].size() <= MAX_SEND_BATCH_SIZE) {
+    nBytes += m_sendQueue[m_nSendingPackets].size();
+    ++m_nSendingPackets;
+  }
+  auto end = m_sendQueue.begin() + m_nSendingPackets;
+
+#ifdef HAVE_IO_URING
+  if (m_ioUring != nullptr) {
+    m_ioUring->send(m_sendQueue.begin(), end);
+    return;
+  }
+#endif
+
+  std::vector<boost::asio::const_buffer> buffers;
+  buffers.reserve(m_nSendingPackets);
+  std::transform(m_sendQueue.begin(), end, std::back_inserter(buffers),
+                 [] (const Block& block) { return boost::asio::buffer(block.wire(), block.size()); });
+
+  boost::asio::async_write(m_socket, buffers,
                            [this] (auto&&... args) { this->handleSend(std::forward<decltype(args)>(args)...); });
 }
 
@@ -211,12 +301,16 @@ StreamTransport<T>::handleSend(const boost::system::error_code& error,
   if (error)
     return processErrorCode(error);
 
-  NFD_LOG_FACE_TRACE("Successfully sent: " << nBytesSent << " bytes");
+  NFD_LOG_FACE_TRACE("Successfully sent: " << nBytesSent << " bytes in " <<
+                     m_nSendingPackets << " packets");
 
-  BOOST_ASSERT(!m_sendQueue.empty());
-  BOOST_ASSERT(m_sendQueue.front().size() == nBytesSent);
+  BOOST_ASSERT(m_nSendingPackets > 0 && m_nSendingPackets <= m_sendQueue.size());
+  BOOST_ASSERT(std::accumulate(m_sendQueue.begin(), m_sendQueue.begin() + m_nSendingPackets, size_t(0),
+                               [] (size_t sum, const Block& block) { return sum + block.size(); }) ==
+               nBytesSent);
   m_sendQueueBytes -= nBytesSent;
-  m_sendQueue.pop();
+  m_sendQueue.erase(m_sendQueue.begin(), m_sendQueue.begin() + m_nSendingPackets);
+  m_nSendingPackets = 0;
 
   if (!m_sendQueue.empty())
     sendFromQueue();
@@ -228,6 +322,13 @@ StreamTransport<T>::startReceive()
 {
   BOOST_ASSERT(getState() == TransportState::UP);
 
+#ifdef HAVE_IO_URING
+  if (m_ioUring != nullptr) {
+    m_ioUring->startReceive();
+    return;
+  }
+#endif
+
   m_socket.async_receive(boost::asio::buffer(m_receiveBuffer + m_receiveBufferSize,
                                              ndn::MAX_NDN_PACKET_SIZE - m_receiveBufferSize),
                          [this] (auto&&... args) { this->handleReceive(std::forward<decltype(args)>(args)...); });
@@ -243,6 +344,38 @@ StreamTransport<T>::handleReceive(const boost::system::error_code& error,
 
   NFD_LOG_FACE_TRACE("Received: " << nBytesReceived << " bytes");
 
+  if (processReceiveBuffer(nBytesReceived))
+    startReceive();
+}
+
+#ifdef HAVE_IO_URING
+template<class T>
+void
+StreamTransport<T>::handleBufferReceive(const uint8_t* buffer, size_t nBytesReceived,
+                                        const boost::system::error_code& error)
+{
+  if (error)
+    return processErrorCode(error);
+
+  NFD_LOG_FACE_TRACE("Received: " << nBytesReceived << " bytes");
+
+  // the received octets may not fit in the free part of the receive buffer at once
+  while (nBytesReceived > 0 && getState() == TransportState::UP) {
+    size_t nBytesCopied = std::min(nBytesReceived, ndn::MAX_NDN_PACKET_SIZE - m_receiveBufferSize);
+    std::copy_n(buffer, nBytesCopied, m_receiveBuffer + m_receiveBufferSize);
+    buffer += nBytesCopied;
+    nBytesReceived -= nBytesCopied;
+
+    if (!processReceiveBuffer(nBytesCopied))
+      return;
+  }
+}
+#endif // HAVE_IO_URING
+
+template<class T>
+bool
+StreamTransport<T>::processReceiveBuffer(size_t nBytesReceived)
+{
   m_receiveBufferSize += nBytesReceived;
   size_t offset = 0;
   bool isOk = true;
@@ -262,7 +395,7 @@ StreamTransport<T>::handleReceive(const boost::system::error_code& error,
     NFD_LOG_FACE_ERROR("Failed to parse incoming packet or packet too large to process");
     this->setState(TransportState::FAILED);
     doClose();
-    return;
+    return false;
   }
 
   if (offset > 0) {
@@ -275,7 +408,32 @@ StreamTransport<T>::handleReceive(const boost::system::error_code& error,
     }
   }
 
-  startReceive();
+  return true;
+}
+
+template<class T>
+void
+StreamTransport<T>::attachIoUring()
+{
+#ifdef HAVE_IO_URING
+  m_ioUring = IoUringSocket::create(m_socket.native_handle(), true,
+    [this] (auto&&... args) { this->handleBufferReceive(std::forward<decltype(args)>(args)...); },
+    [this] (auto&&... args) { this->handleSend(std::forward<decltype(args)>(args)...); });
+  if (m_ioUring != nullptr) {
+    NFD_LOG_FACE_TRACE("Using io_uring");
+  }
+#endif
+}
+
+template<class T>
+void
+StreamTransport<T>::detachIoUring()
+{
+#ifdef HAVE_IO_URING
+  if (m_ioUring != nullptr) {
+    m_ioUring->close();
+  }
+#endif
 }
 
 template<class T>
@@ -320,9 +478,10 @@ template<class T>
 void
 StreamTransport<T>::resetSendQueue()
 {
-  std::queue<Block> emptyQueue;
+  std::deque<Block> emptyQueue;
   std::swap(emptyQueue, m_sendQueue);
   m_sendQueueBytes = 0;
+  m_nSendingPackets = 0;
 }
 
 template<class T>
@@ -103,6 +103,7 @@ TcpTransport::handleError(const boost::system::error_code& error)
     this->setState(TransportState::DOWN);
 
     // cancel all outstanding operations
+    this->detachIoUring();
     boost::system::error_code error;
     m_socket.cancel(error);
 
@@ -160,6 +161,7 @@ TcpTransport::handleReconnect(const boost::system::error_code& error)
   this->setLocalUri(FaceUri(m_socket.local_endpoint()));
   NFD_LOG_FACE_TRACE("TCP connection reestablished");
   this->setState(TransportState::UP);
+  this->attachIoUring();
   this->startReceive();
 }
 
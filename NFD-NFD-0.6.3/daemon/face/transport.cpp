@@ -25,6 +25,7 @@
 
 #include "transport.hpp"
 #include "face.hpp"
+#include "packet-trace.hpp"
 
 namespace nfd {
 namespace face {
@@ -113,6 +114,12 @@ Transport::send(Packet&& packet)
     this->nOutBytes += packet.packet.size();
   }
 
+  PacketTraceWriter* trace = getPacketTraceCapture();
+  if (trace != nullptr) {
+    trace->write(m_face == nullptr ? INVALID_FACEID : m_face->getId(),
+                 PacketTraceRecord::OUTGOING, packet.packet);
+  }
+
   this->doSend(std::move(packet));
 }
 
@@ -125,6 +132,12 @@ Transport::receive(Packet&& packet)
   ++this->nInPackets;
   this->nInBytes += packet.packet.size();
 
+  PacketTraceWriter* trace = getPacketTraceCapture();
+  if (trace != nullptr) {
+    trace->write(m_face == nullptr ? INVALID_FACEID : m_face->getId(),
+                 PacketTraceRecord::INCOMING, packet.packet);
+  }
+
   m_service->receivePacket(std::move(packet));
 }
 
@@ -0,0 +1,309 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "adaptive-multipath-strategy.hpp"
+#include "algorithm.hpp"
+#include "core/logger.hpp"
+#include "core/random.hpp"
+
+namespace nfd {
+namespace fw {
+
+NFD_LOG_INIT(AdaptiveMultipathStrategy);
+NFD_REGISTER_STRATEGY(AdaptiveMultipathStrategy);
+
+const time::milliseconds AdaptiveMultipathStrategy::RETX_SUPPRESSION_INITIAL(10);
+const time::milliseconds AdaptiveMultipathStrategy::RETX_SUPPRESSION_MAX(250);
+const time::milliseconds AdaptiveMultipathStrategy::MEASUREMENTS_LIFETIME(60000);
+const time::milliseconds AdaptiveMultipathStrategy::MIN_QUEUING_DELAY(10);
+
+const double AdaptiveMultipathStrategy::INITIAL_WEIGHT = 10.0;
+const double AdaptiveMultipathStrategy::MIN_WEIGHT = 1.0;
+const double AdaptiveMultipathStrategy::MAX_WEIGHT = 100.0;
+const double AdaptiveMultipathStrategy::ADDITIVE_INCREASE = 1.0;
+const double AdaptiveMultipathStrategy::MULTIPLICATIVE_DECREASE = 0.5;
+
+AdaptiveMultipathStrategy::AdaptiveMultipathStrategy(Forwarder& forwarder, const Name& name)
+  : Strategy(forwarder)
+  , ProcessNackTraits(this)
+  , m_retxSuppression(RETX_SUPPRESSION_INITIAL,
+                      RetxSuppressionExponential::DEFAULT_MULTIPLIER,
+                      RETX_SUPPRESSION_MAX)
+{
+  ParsedInstanceName parsed = parseInstanceName(name);
+  if (!parsed.parameters.empty()) {
+    BOOST_THROW_EXCEPTION(std::invalid_argument("AdaptiveMultipathStrategy does not accept parameters"));
+  }
+  if (parsed.version && *parsed.version != getStrategyName()[-1].toVersion()) {
+    BOOST_THROW_EXCEPTION(std::invalid_argument(
+      "AdaptiveMultipathStrategy does not support version " + to_string(*parsed.version)));
+  }
+  this->setInstanceName(makeInstanceName(name, getStrategyName()));
+}
+
+const Name&
+AdaptiveMultipathStrategy::getStrategyName()
+{
+  static Name strategyName("/localhost/nfd/strategy/adaptive-multipath/%FD%01");
+  return strategyName;
+}
+
+void
+AdaptiveMultipathStrategy::afterReceiveInterest(const Face& inFace, const Interest& interest,
+                                                const shared_ptr<pit::Entry>& pitEntry)
+{
+  RetxSuppressionResult suppression = m_retxSuppression.decidePerPitEntry(*pitEntry);
+  if (suppression == RetxSuppressionResult::SUPPRESS) {
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " suppressed");
+    return;
+  }
+
+  MtInfo& mi = this->getOrCreateMtInfo(*pitEntry);
+
+  if (suppression == RetxSuppressionResult::NEW) {
+    Face* outFace = this->pickNextHop(inFace, interest, pitEntry, mi, false);
+    if (outFace == nullptr) {
+      NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " noNextHop");
+
+      lp::NackHeader nackHeader;
+      nackHeader.setReason(lp::NackReason::NO_ROUTE);
+      this->sendNack(pitEntry, inFace, nackHeader);
+
+      this->rejectPendingInterest(pitEntry);
+      return;
+    }
+
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " newPitEntry-to=" << outFace->getId());
+    this->forwardInterest(interest, *outFace, pitEntry, mi.getNextHop(outFace->getId()));
+    return;
+  }
+
+  Face* outFace = this->pickNextHop(inFace, interest, pitEntry, mi, true);
+  if (outFace != nullptr) {
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " retransmit-unused-to=" << outFace->getId());
+    this->forwardInterest(interest, *outFace, pitEntry, mi.getNextHop(outFace->getId()));
+    return;
+  }
+
+  outFace = this->pickNextHop(inFace, interest, pitEntry, mi, false);
+  if (outFace == nullptr) {
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " retransmitNoNextHop");
+    return;
+  }
+
+  NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " retransmit-retry-to=" << outFace->getId());
+  this->forwardInterest(interest, *outFace, pitEntry, mi.getNextHop(outFace->getId()));
+}
+
+void
+AdaptiveMultipathStrategy::beforeSatisfyInterest(const shared_ptr<pit::Entry>& pitEntry,
+                                                 const Face& inFace, const Data& data)
+{
+  PitInfo* pi = pitEntry->getStrategyInfo<PitInfo>();
+  if (pi != nullptr) {
+    pi->rtoTimers.erase(inFace.getId());
+  }
+
+  auto outRecord = pitEntry->getOutRecord(inFace);
+  if (outRecord == pitEntry->out_end()) {
+    NFD_LOG_DEBUG(pitEntry->getInterest() << " dataFrom " << inFace.getId() << " no-out-record");
+    return;
+  }
+
+  NextHopInfo& ni = this->getOrCreateMtInfo(*pitEntry).getNextHop(inFace.getId());
+  time::nanoseconds rtt = time::steady_clock::now() - outRecord->getLastRenewed();
+  ni.rtt.addMeasurement(time::duration_cast<RttEstimator::Duration>(rtt));
+  ni.lastRtt = rtt;
+  ni.minRtt = std::min(ni.minRtt, rtt);
+
+  time::nanoseconds queuingDelay = rtt - ni.minRtt;
+  if (data.getCongestionMark() > 0) {
+    NFD_LOG_DEBUG(pitEntry->getInterest() << " dataFrom " << inFace.getId() << " congestion-mark");
+    decreaseWeight(ni);
+  }
+  else if (queuingDelay > std::max<time::nanoseconds>(ni.minRtt, MIN_QUEUING_DELAY)) {
+    NFD_LOG_DEBUG(pitEntry->getInterest() << " dataFrom " << inFace.getId() << " queuing-delay="
+                  << time::duration_cast<time::microseconds>(queuingDelay).count());
+    decreaseWeight(ni);
+  }
+  else {
+    increaseWeight(ni);
+  }
+}
+
+void
+AdaptiveMultipathStrategy::afterReceiveNack(const Face& inFace, const lp::Nack& nack,
+                                            const shared_ptr<pit::Entry>& pitEntry)
+{
+  PitInfo* pi = pitEntry->getStrategyInfo<PitInfo>();
+  if (pi != nullptr) {
+    pi->rtoTimers.erase(inFace.getId());
+  }
+
+  lp::NackReason reason = nack.getReason();
+  MtInfo& mi = this->getOrCreateMtInfo(*pitEntry);
+  NextHopInfo& ni = mi.getNextHop(inFace.getId());
+  if (reason == lp::NackReason::CONGESTION || nack.getCongestionMark() > 0) {
+    decreaseWeight(ni);
+  }
+  else if (reason != lp::NackReason::DUPLICATE) {
+    ni.weight = MIN_WEIGHT;
+  }
+
+  if (reason != lp::NackReason::DUPLICATE && pitEntry->hasInRecords()) {
+    const Face& downstream = pitEntry->in_begin()->getFace();
+    const Interest& interest = pitEntry->getInterest();
+    Face* outFace = this->pickNextHop(downstream, interest, pitEntry, mi, true);
+    if (outFace != nullptr) {
+      NFD_LOG_DEBUG(interest << " nack=" << reason << " from=" << inFace.getId()
+                    << " retry-to=" << outFace->getId());
+      this->forwardInterest(interest, *outFace, pitEntry, mi.getNextHop(outFace->getId()));
+      return;
+    }
+  }
+
+  this->processNack(inFace, nack, pitEntry);
+}
+
+AdaptiveMultipathStrategy::MtInfo&
+AdaptiveMultipathStrategy::getOrCreateMtInfo(const pit::Entry& pitEntry)
+{
+  const fib::Entry& fibEntry = this->lookupFib(pitEntry);
+  measurements::Entry* me = this->getMeasurements().get(fibEntry);
+
+  // If the FIB entry is not under the strategy's namespace, find a part of the prefix
+  // that falls under the strategy's namespace
+  const Name& name = pitEntry.getName();
+  for (size_t prefixLen = fibEntry.getPrefix().size() + 1;
+       me == nullptr && prefixLen <= name.size(); ++prefixLen) {
+    me = this->getMeasurements().get(name.getPrefix(prefixLen));
+  }
+
+  // Either the FIB entry or the Interest's name must be under this strategy's namespace
+  BOOST_ASSERT(me != nullptr);
+
+  this->getMeasurements().extendLifetime(*me, MEASUREMENTS_LIFETIME);
+  return *me->insertStrategyInfo<MtInfo>().first;
+}
+
+Face*
+AdaptiveMultipathStrategy::pickNextHop(const Face& inFace, const Interest& interest,
+                                       const shared_ptr<pit::Entry>& pitEntry,
+                                       MtInfo& mi, bool wantUnused)
+{
+  const fib::Entry& fibEntry = this->lookupFib(*pitEntry);
+
+  std::vector<std::pair<Face*, double>> candidates;
+  double totalWeight = 0.0;
+  for (const fib::NextHop& nexthop : fibEntry.getNextHops()) {
+    Face& outFace = nexthop.getFace();
+
+    // do not forward back to the same face, unless it is ad hoc
+    if (outFace.getId() == inFace.getId() && outFace.getLinkType() != ndn::nfd::LINK_TYPE_AD_HOC)
+      continue;
+
+    if (wouldViolateScope(inFace, interest, outFace))
+      continue;
+
+    if (wantUnused && pitEntry->getOutRecord(outFace) != pitEntry->out_end())
+      continue;
+
+    double weight = mi.getNextHop(outFace.getId()).weight;
+    candidates.emplace_back(&outFace, weight);
+    totalWeight += weight;
+  }
+
+  if (candidates.empty()) {
+    return nullptr;
+  }
+
+  std::uniform_real_distribution<double> dist(0.0, totalWeight);
+  double r = dist(getGlobalRng());
+  for (const auto& candidate : candidates) {
+    if (r < candidate.second) {
+      return candidate.first;
+    }
+    r -= candidate.second;
+  }
+  return candidates.back().first;
+}
+
+void
+AdaptiveMultipathStrategy::increaseWeight(NextHopInfo& ni)
+{
+  ni.weight = std::min(ni.weight + ADDITIVE_INCREASE, MAX_WEIGHT);
+}
+
+void
+AdaptiveMultipathStrategy::decreaseWeight(NextHopInfo& ni)
+{
+  // react to at most one congestion signal per RTT, since the signals of Interests that were
+  // already in flight do not reflect the previous decrease
+  auto now = time::steady_clock::now();
+  if (now < ni.nextDecreaseAllowed) {
+    return;
+  }
+
+  ni.weight = std::max(ni.weight * MULTIPLICATIVE_DECREASE, MIN_WEIGHT);
+  ni.nextDecreaseAllowed = now + ni.lastRtt;
+}
+
+void
+AdaptiveMultipathStrategy::forwardInterest(const Interest& interest, Face& outFace,
+                                           const shared_ptr<pit::Entry>& pitEntry, NextHopInfo& ni)
+{
+  this->sendInterest(pitEntry, outFace, interest);
+
+  PitInfo* pi = pitEntry->insertStrategyInfo<PitInfo>().first;
+  pi->rtoTimers[outFace.getId()] = scheduler::schedule(ni.rtt.computeRto(),
+    bind(&AdaptiveMultipathStrategy::onRtoTimeout, this, weak_ptr<pit::Entry>(pitEntry), outFace.getId()));
+}
+
+void
+AdaptiveMultipathStrategy::onRtoTimeout(const weak_ptr<pit::Entry>& pitEntryWeak, FaceId outFaceId)
+{
+  shared_ptr<pit::Entry> pitEntry = pitEntryWeak.lock();
+  // if pitEntry is gone, RTO timer should have been cancelled
+  if (pitEntry == nullptr || pitEntry->isSatisfied) {
+    return;
+  }
+
+  NFD_LOG_DEBUG(pitEntry->getInterest() << " timeoutFrom " << outFaceId);
+  NextHopInfo& ni = this->getOrCreateMtInfo(*pitEntry).getNextHop(outFaceId);
+  decreaseWeight(ni);
+  ni.rtt.doubleMultiplier();
+}
+
+AdaptiveMultipathStrategy::NextHopInfo::NextHopInfo()
+  : weight(INITIAL_WEIGHT)
+  , rtt(16, 1_ms, 0.1)
+  , minRtt(time::nanoseconds::max())
+  , lastRtt(time::nanoseconds::zero())
+  , nextDecreaseAllowed(time::steady_clock::TimePoint::min())
+{
+}
+
+} // namespace fw
+} // namespace nfd
@@ -0,0 +1,176 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_ADAPTIVE_MULTIPATH_STRATEGY_HPP
+#define NFD_DAEMON_FW_ADAPTIVE_MULTIPATH_STRATEGY_HPP
+
+#include "strategy.hpp"
+#include "process-nack-traits.hpp"
+#include "retx-suppression-exponential.hpp"
+#include "core/rtt-estimator.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief Adaptive Multipath strategy
+ *
+ *  This strategy splits Interests over all nexthops of a FIB entry, choosing the upstream of
+ *  each new Interest at random with a probability proportional to a per-nexthop weight.
+ *  The weights are kept per namespace in the Measurements table and adapted with AIMD control:
+ *  \li Data without congestion signal from a nexthop increases its weight by a constant;
+ *  \li a CongestionMark on Data or Nack, a Nack-Congestion, a timeout, or an RTT sample whose
+ *      queuing delay exceeds the base RTT of the nexthop decreases its weight multiplicatively,
+ *      at most once per RTT;
+ *  \li a Nack with any other reason except Duplicate sets its weight to the minimum.
+ *
+ *  A Nacked Interest is forwarded to another nexthop that has not been tried;
+ *  Nack is returned to downstreams if all tried upstreams have returned Nacks.
+ *  A consumer retransmission that is not suppressed goes to an untried nexthop if possible.
+ *  Nack-NoRoute is returned if there is no usable nexthop.
+ */
+class AdaptiveMultipathStrategy : public Strategy
+                                , public ProcessNackTraits<AdaptiveMultipathStrategy>
+{
+public:
+  explicit
+  AdaptiveMultipathStrategy(Forwarder& forwarder, const Name& name = getStrategyName());
+
+  static const Name&
+  getStrategyName();
+
+  void
+  afterReceiveInterest(const Face& inFace, const Interest& interest,
+                       const shared_ptr<pit::Entry>& pitEntry) override;
+
+  void
+  beforeSatisfyInterest(const shared_ptr<pit::Entry>& pitEntry,
+                        const Face& inFace, const Data& data) override;
+
+  void
+  afterReceiveNack(const Face& inFace, const lp::Nack& nack,
+                   const shared_ptr<pit::Entry>& pitEntry) override;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** \brief per-nexthop state of a namespace
+   */
+  class NextHopInfo
+  {
+  public:
+    NextHopInfo();
+
+  public:
+    double weight;
+    RttEstimator rtt;
+    time::nanoseconds minRtt;
+    time::nanoseconds lastRtt;
+    time::steady_clock::TimePoint nextDecreaseAllowed;
+  };
+
+  /** \brief StrategyInfo in measurements table
+   */
+  class MtInfo : public StrategyInfo
+  {
+  public:
+    static constexpr int
+    getTypeId()
+    {
+      return 1050;
+    }
+
+    NextHopInfo&
+    getNextHop(FaceId faceId)
+    {
+      return nexthops[faceId];
+    }
+
+  public:
+    std::unordered_map<FaceId, NextHopInfo> nexthops;
+  };
+
+  /** \brief StrategyInfo on PIT entry
+   */
+  class PitInfo : public StrategyInfo
+  {
+  public:
+    static constexpr int
+    getTypeId()
+    {
+      return 1051;
+    }
+
+  public:
+    std::unordered_map<FaceId, scheduler::ScopedEventId> rtoTimers;
+  };
+
+  /** \brief get or create per-namespace measurements for \p pitEntry
+   */
+  MtInfo&
+  getOrCreateMtInfo(const pit::Entry& pitEntry);
+
+  /** \brief pick a nexthop at random, in proportion to the nexthop weights
+   *  \param wantUnused if true, the nexthop must not have an out-record
+   *  \return the chosen face, or nullptr if no nexthop is eligible
+   */
+  Face*
+  pickNextHop(const Face& inFace, const Interest& interest, const shared_ptr<pit::Entry>& pitEntry,
+              MtInfo& mi, bool wantUnused);
+
+  static void
+  increaseWeight(NextHopInfo& ni);
+
+  static void
+  decreaseWeight(NextHopInfo& ni);
+
+private:
+  void
+  forwardInterest(const Interest& interest, Face& outFace,
+                  const shared_ptr<pit::Entry>& pitEntry, NextHopInfo& ni);
+
+  void
+  onRtoTimeout(const weak_ptr<pit::Entry>& pitEntryWeak, FaceId outFaceId);
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  static const time::milliseconds RETX_SUPPRESSION_INITIAL;
+  static const time::milliseconds RETX_SUPPRESSION_MAX;
+  static const time::milliseconds MEASUREMENTS_LIFETIME;
+  /// queuing delay below this value is not considered a congestion signal
+  static const time::milliseconds MIN_QUEUING_DELAY;
+
+  static const double INITIAL_WEIGHT;
+  static const double MIN_WEIGHT;
+  static const double MAX_WEIGHT;
+  static const double ADDITIVE_INCREASE;
+  static const double MULTIPLICATIVE_DECREASE;
+
+private:
+  RetxSuppressionExponential m_retxSuppression;
+
+  friend ProcessNackTraits<AdaptiveMultipathStrategy>;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_ADAPTIVE_MULTIPATH_STRATEGY_HPP
@@ -0,0 +1,288 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "consistent-hash-strategy.hpp"
+#include "algorithm.hpp"
+#include "core/city-hash.hpp"
+#include "core/logger.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+namespace nfd {
+namespace fw {
+
+NFD_LOG_INIT(ConsistentHashStrategy);
+NFD_REGISTER_STRATEGY(ConsistentHashStrategy);
+
+const time::milliseconds ConsistentHashStrategy::RETX_SUPPRESSION_INITIAL(10);
+const time::milliseconds ConsistentHashStrategy::RETX_SUPPRESSION_MAX(250);
+const time::milliseconds ConsistentHashStrategy::DEFAULT_FAILOVER_TIMEOUT(1000);
+
+ConsistentHashStrategy::ConsistentHashStrategy(Forwarder& forwarder, const Name& name)
+  : Strategy(forwarder)
+  , ProcessNackTraits(this)
+  , m_failoverTimeout(DEFAULT_FAILOVER_TIMEOUT)
+  , m_retxSuppression(RETX_SUPPRESSION_INITIAL,
+                      RetxSuppressionExponential::DEFAULT_MULTIPLIER,
+                      RETX_SUPPRESSION_MAX)
+{
+  ParsedInstanceName parsed = parseInstanceName(name);
+  if (!parsed.parameters.empty()) {
+    processParams(parsed.parameters);
+  }
+
+  if (parsed.version && *parsed.version != getStrategyName()[-1].toVersion()) {
+    BOOST_THROW_EXCEPTION(std::invalid_argument(
+      "ConsistentHashStrategy does not support version " + to_string(*parsed.version)));
+  }
+  this->setInstanceName(makeInstanceName(name, getStrategyName()));
+}
+
+const Name&
+ConsistentHashStrategy::getStrategyName()
+{
+  static Name strategyName("/localhost/nfd/strategy/consistent-hash/%FD%01");
+  return strategyName;
+}
+
+static uint64_t
+getParamValue(const std::string& param, const std::string& value)
+{
+  try {
+    if (!value.empty() && value[0] == '-')
+      BOOST_THROW_EXCEPTION(boost::bad_lexical_cast());
+
+    return boost::lexical_cast<uint64_t>(value);
+  }
+  catch (const boost::bad_lexical_cast&) {
+    BOOST_THROW_EXCEPTION(std::invalid_argument("Value of " + param + " must be a non-negative integer"));
+  }
+}
+
+void
+ConsistentHashStrategy::processParams(const PartialName& params)
+{
+  for (const auto& component : params) {
+    std::string paramStr(reinterpret_cast<const char*>(component.value()), component.value_size());
+    auto n = paramStr.find("~");
+    if (n == std::string::npos) {
+      BOOST_THROW_EXCEPTION(std::invalid_argument("Format is <parameter>~<value>"));
+    }
+
+    auto f = paramStr.substr(0, n);
+    auto s = paramStr.substr(n + 1);
+    if (f == "n-components") {
+      m_nComponents = getParamValue(f, s);
+      if (*m_nComponents == 0) {
+        BOOST_THROW_EXCEPTION(std::invalid_argument("Value of n-components must be positive"));
+      }
+    }
+    else if (f == "failover-timeout") {
+      m_failoverTimeout = time::milliseconds(getParamValue(f, s));
+    }
+    else {
+      BOOST_THROW_EXCEPTION(std::invalid_argument("Parameter should be n-components or failover-timeout"));
+    }
+  }
+}
+
+uint64_t
+ConsistentHashStrategy::computeNameHash(const Interest& interest, const fib::Entry& fibEntry) const
+{
+  const Name& name = interest.getName();
+  size_t nComponents = m_nComponents ? *m_nComponents : fibEntry.getPrefix().size() + 1;
+  nComponents = std::min(nComponents, name.size());
+
+  uint64_t hash = 0;
+  for (size_t i = 0; i < nComponents; ++i) {
+    const name::Component& component = name.get(i);
+    hash = CityHash64WithSeed(reinterpret_cast<const char*>(component.value()),
+                              component.value_size(), hash ^ component.type());
+  }
+  return hash;
+}
+
+uint64_t
+ConsistentHashStrategy::computeScore(uint64_t nameHash, const Face& face)
+{
+  FaceId faceId = face.getId();
+  return CityHash64WithSeed(reinterpret_cast<const char*>(&faceId), sizeof(faceId), nameHash);
+}
+
+std::vector<Face*>
+ConsistentHashStrategy::rankNextHops(const Face& inFace, const Interest& interest,
+                                     const fib::Entry& fibEntry) const
+{
+  uint64_t nameHash = this->computeNameHash(interest, fibEntry);
+
+  struct Candidate
+  {
+    Face* face;
+    uint64_t cost;
+    uint64_t score;
+  };
+  std::vector<Candidate> candidates;
+  for (const fib::NextHop& nexthop : fibEntry.getNextHops()) {
+    Face& outFace = nexthop.getFace();
+
+    // do not forward back to the same face, unless it is ad hoc
+    if (outFace.getId() == inFace.getId() && outFace.getLinkType() != ndn::nfd::LINK_TYPE_AD_HOC)
+      continue;
+
+    if (wouldViolateScope(inFace, interest, outFace))
+      continue;
+
+    candidates.push_back({&outFace, nexthop.getCost(), computeScore(nameHash, outFace)});
+  }
+
+  std::sort(candidates.begin(), candidates.end(), [] (const Candidate& a, const Candidate& b) {
+    return std::tie(a.cost, b.score) < std::tie(b.cost, a.score);
+  });
+
+  std::vector<Face*> ranked;
+  ranked.reserve(candidates.size());
+  for (const Candidate& candidate : candidates) {
+    ranked.push_back(candidate.face);
+  }
+  return ranked;
+}
+
+void
+ConsistentHashStrategy::afterReceiveInterest(const Face& inFace, const Interest& interest,
+                                             const shared_ptr<pit::Entry>& pitEntry)
+{
+  RetxSuppressionResult suppression = m_retxSuppression.decidePerPitEntry(*pitEntry);
+  if (suppression == RetxSuppressionResult::SUPPRESS) {
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " suppressed");
+    return;
+  }
+
+  const fib::Entry& fibEntry = this->lookupFib(*pitEntry);
+  std::vector<Face*> ranked = this->rankNextHops(inFace, interest, fibEntry);
+
+  if (suppression == RetxSuppressionResult::NEW) {
+    if (ranked.empty()) {
+      NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " noNextHop");
+
+      lp::NackHeader nackHeader;
+      nackHeader.setReason(lp::NackReason::NO_ROUTE);
+      this->sendNack(pitEntry, inFace, nackHeader);
+
+      this->rejectPendingInterest(pitEntry);
+      return;
+    }
+
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " newPitEntry-to=" << ranked.front()->getId());
+    this->forwardInterest(interest, *ranked.front(), pitEntry);
+    return;
+  }
+
+  // retransmission: try an upstream that has not been tried, otherwise go back to the first one
+  if (this->forwardToUntried(inFace, interest, pitEntry)) {
+    return;
+  }
+
+  if (ranked.empty()) {
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " retransmitNoNextHop");
+    return;
+  }
+
+  NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " retransmit-retry-to=" << ranked.front()->getId());
+  this->forwardInterest(interest, *ranked.front(), pitEntry);
+}
+
+void
+ConsistentHashStrategy::beforeSatisfyInterest(const shared_ptr<pit::Entry>& pitEntry,
+                                              const Face& inFace, const Data& data)
+{
+  PitInfo* pi = pitEntry->getStrategyInfo<PitInfo>();
+  if (pi != nullptr) {
+    pi->failoverTimer.cancel();
+  }
+}
+
+void
+ConsistentHashStrategy::afterReceiveNack(const Face& inFace, const lp::Nack& nack,
+                                         const shared_ptr<pit::Entry>& pitEntry)
+{
+  if (pitEntry->hasInRecords() && nack.getReason() != lp::NackReason::DUPLICATE) {
+    const Face& downstream = pitEntry->in_begin()->getFace();
+    if (this->forwardToUntried(downstream, pitEntry->getInterest(), pitEntry)) {
+      NFD_LOG_DEBUG(nack.getInterest() << " nack=" << nack.getReason()
+                    << " from=" << inFace.getId() << " failover");
+      return;
+    }
+  }
+
+  this->processNack(inFace, nack, pitEntry);
+}
+
+bool
+ConsistentHashStrategy::forwardToUntried(const Face& inFace, const Interest& interest,
+                                         const shared_ptr<pit::Entry>& pitEntry)
+{
+  const fib::Entry& fibEntry = this->lookupFib(*pitEntry);
+  for (Face* outFace : this->rankNextHops(inFace, interest, fibEntry)) {
+    if (pitEntry->getOutRecord(*outFace) == pitEntry->out_end()) {
+      NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " untried-to=" << outFace->getId());
+      this->forwardInterest(interest, *outFace, pitEntry);
+      return true;
+    }
+  }
+  return false;
+}
+
+void
+ConsistentHashStrategy::forwardInterest(const Interest& interest, Face& outFace,
+                                        const shared_ptr<pit::Entry>& pitEntry)
+{
+  this->sendInterest(pitEntry, outFace, interest);
+
+  if (m_failoverTimeout <= time::milliseconds::zero()) {
+    return;
+  }
+
+  PitInfo* pi = pitEntry->insertStrategyInfo<PitInfo>().first;
+  pi->failoverTimer = scheduler::schedule(m_failoverTimeout,
+    bind(&ConsistentHashStrategy::onFailoverTimeout, this, weak_ptr<pit::Entry>(pitEntry)));
+}
+
+void
+ConsistentHashStrategy::onFailoverTimeout(const weak_ptr<pit::Entry>& pitEntryWeak)
+{
+  shared_ptr<pit::Entry> pitEntry = pitEntryWeak.lock();
+  // if pitEntry is gone, failover timer should have been cancelled
+  if (pitEntry == nullptr || !pitEntry->hasInRecords() || pitEntry->isSatisfied) {
+    return;
+  }
+
+  const Face& downstream = pitEntry->in_begin()->getFace();
+  if (!this->forwardToUntried(downstream, pitEntry->getInterest(), pitEntry)) {
+    NFD_LOG_DEBUG(pitEntry->getInterest() << " failoverTimeout no-untried-nexthop");
+  }
+}
+
+} // namespace fw
+} // namespace nfd
@@ -0,0 +1,147 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_CONSISTENT_HASH_STRATEGY_HPP
+#define NFD_DAEMON_FW_CONSISTENT_HASH_STRATEGY_HPP
+
+#include "strategy.hpp"
+#include "process-nack-traits.hpp"
+#include "retx-suppression-exponential.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief Consistent Hash strategy
+ *
+ *  This strategy forwards every Interest under a name prefix to the same upstream, so that
+ *  several upstream caches reachable over equal-cost next hops each hold a different part of
+ *  the content, instead of each holding a copy of the popular content.
+ *
+ *  The strategy hashes the first N components of the Interest Name, and ranks the eligible
+ *  nexthops (except downstream) by rendezvous hashing: each nexthop gets a score computed from
+ *  the name hash and its FaceId. Nexthops are ranked by cost first, then by descending score.
+ *  Adding or removing a nexthop therefore only moves the prefixes that rank it first.
+ *
+ *  A new Interest is forwarded to the first ranked nexthop. If that upstream returns a Nack,
+ *  or does not return Data before the failover timeout, the Interest is forwarded to the next
+ *  ranked nexthop that has not been tried. A consumer retransmission that is not suppressed
+ *  goes to the next untried nexthop too, or to the first ranked nexthop if all have been tried.
+ *
+ *  This strategy returns Nack to all downstreams with reason NoRoute if there is no usable
+ *  nexthop, and returns Nack to all downstreams if all tried upstreams have returned Nacks.
+ *
+ *  Parameters are given as name components after the strategy name:
+ *  \li n-components~N hashes the first N components of the Interest Name;
+ *      if omitted, the components of the FIB prefix plus one component are hashed.
+ *  \li failover-timeout~T waits T milliseconds for Data before trying the next nexthop;
+ *      0 disables failover on timeout. The default is 1000.
+ */
+class ConsistentHashStrategy : public Strategy
+                             , public ProcessNackTraits<ConsistentHashStrategy>
+{
+public:
+  explicit
+  ConsistentHashStrategy(Forwarder& forwarder, const Name& name = getStrategyName());
+
+  static const Name&
+  getStrategyName();
+
+  void
+  afterReceiveInterest(const Face& inFace, const Interest& interest,
+                       const shared_ptr<pit::Entry>& pitEntry) override;
+
+  void
+  beforeSatisfyInterest(const shared_ptr<pit::Entry>& pitEntry,
+                        const Face& inFace, const Data& data) override;
+
+  void
+  afterReceiveNack(const Face& inFace, const lp::Nack& nack,
+                   const shared_ptr<pit::Entry>& pitEntry) override;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** \brief StrategyInfo on PIT entry
+   */
+  class PitInfo : public StrategyInfo
+  {
+  public:
+    static constexpr int
+    getTypeId()
+    {
+      return 1040;
+    }
+
+  public:
+    scheduler::ScopedEventId failoverTimer;
+  };
+
+  /** \return hash of the Name components that determine the upstream of \p interest
+   */
+  uint64_t
+  computeNameHash(const Interest& interest, const fib::Entry& fibEntry) const;
+
+  /** \return score of \p face for the name hash \p nameHash
+   */
+  static uint64_t
+  computeScore(uint64_t nameHash, const Face& face);
+
+  /** \return eligible nexthops of \p fibEntry, in the order they should be tried
+   */
+  std::vector<Face*>
+  rankNextHops(const Face& inFace, const Interest& interest, const fib::Entry& fibEntry) const;
+
+private:
+  void
+  processParams(const PartialName& params);
+
+  /** \brief forward \p interest to the first ranked nexthop that has not been tried
+   *  \return whether an untried nexthop was found
+   */
+  bool
+  forwardToUntried(const Face& inFace, const Interest& interest,
+                   const shared_ptr<pit::Entry>& pitEntry);
+
+  void
+  forwardInterest(const Interest& interest, Face& outFace,
+                  const shared_ptr<pit::Entry>& pitEntry);
+
+  void
+  onFailoverTimeout(const weak_ptr<pit::Entry>& pitEntryWeak);
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  static const time::milliseconds RETX_SUPPRESSION_INITIAL;
+  static const time::milliseconds RETX_SUPPRESSION_MAX;
+  static const time::milliseconds DEFAULT_FAILOVER_TIMEOUT;
+
+  optional<size_t> m_nComponents;
+  time::milliseconds m_failoverTimeout;
+  RetxSuppressionExponential m_retxSuppression;
+
+  friend ProcessNackTraits<ConsistentHashStrategy>;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_CONSISTENT_HASH_STRATEGY_HPP
@@ -38,6 +38,7 @@ NFD_LOG_INIT(FaceTable);
 
 FaceTable::FaceTable()
   : m_lastFaceId(face::FACEID_RESERVED_MAX)
+  , m_epoch(0)
 {
 }
 
@@ -81,6 +82,7 @@ FaceTable::addImpl(shared_ptr<Face> face, FaceId faceId)
   face->setId(faceId);
   auto ret = m_faces.emplace(faceId, face);
   BOOST_VERIFY(ret.second);
+  ++m_epoch;
 
   NFD_LOG_INFO("Added face id=" << faceId <<
                " remote=" << face->getRemoteUri() <<
@@ -102,6 +104,7 @@ FaceTable::remove(FaceId faceId)
 
   m_faces.erase(i);
   face->setId(face::INVALID_FACEID);
+  ++m_epoch;
 
   NFD_LOG_INFO("Removed face id=" << faceId <<
                " remote=" << face->getRemoteUri() <<
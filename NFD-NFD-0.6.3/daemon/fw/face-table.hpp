@@ -64,6 +64,14 @@ public:
   size_t
   size() const;
 
+  /** \return a number that changes whenever a face is added or removed
+   */
+  uint64_t
+  getEpoch() const
+  {
+    return m_epoch;
+  }
+
 public: // enumeration
   using FaceMap = std::map<FaceId, shared_ptr<Face>>;
   using ForwardRange = boost::indirected_range<const boost::select_second_const_range<FaceMap>>;
@@ -102,6 +110,7 @@ private:
 private:
   FaceId m_lastFaceId;
   FaceMap m_faces;
+  uint64_t m_epoch;
 };
 
 } // namespace nfd
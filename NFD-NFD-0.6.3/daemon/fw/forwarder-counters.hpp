@@ -44,6 +44,8 @@ public:
 
   PacketCounter nCsHits;
   PacketCounter nCsMisses;
+
+  PacketCounter nShedInterests;
 };
 
 } // namespace nfd
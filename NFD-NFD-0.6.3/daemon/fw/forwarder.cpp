@@ -51,18 +51,8 @@ Forwarder::Forwarder()
   , m_strategyChoice(*this)
 {
   m_faceTable.afterAdd.connect([this] (Face& face) {
-    face.afterReceiveInterest.connect(
-      [this, &face] (const Interest& interest) {
-        this->startProcessInterest(face, interest);
-      });
-    face.afterReceiveData.connect(
-      [this, &face] (const Data& data) {
-        this->startProcessData(face, data);
-      });
-    face.afterReceiveNack.connect(
-      [this, &face] (const lp::Nack& nack) {
-        this->startProcessNack(face, nack);
-      });
+    // incoming packets enter the pipelines with a direct call rather than through signals
+    face.getLinkService()->setForwarder(this);
     face.onDroppedInterest.connect(
       [this, &face] (const Interest& interest) {
         this->onDroppedInterest(face, interest);
@@ -71,6 +61,7 @@ Forwarder::Forwarder()
 
   m_faceTable.beforeRemove.connect([this] (Face& face) {
     cleanupOnFaceRemoval(m_nameTree, m_fib, m_pit, face);
+    m_nShedInterests.erase(face.getId());
   });
 
   m_strategyChoice.setDefaultStrategy(getDefaultStrategyName());
@@ -78,13 +69,20 @@ Forwarder::Forwarder()
 
 Forwarder::~Forwarder() = default;
 
+uint64_t
+Forwarder::getNShedInterests(const Face& face) const
+{
+  auto it = m_nShedInterests.find(face.getId());
+  return it == m_nShedInterests.end() ? 0 : static_cast<uint64_t>(it->second);
+}
+
 void
 Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
 {
   // receive Interest
   NFD_LOG_DEBUG("onIncomingInterest face=" << inFace.getId() <<
                 " interest=" << interest.getName());
-  interest.setTag(make_shared<lp::IncomingFaceIdTag>(inFace.getId()));
+  interest.setTagValue<lp::IncomingFaceIdTag>(inFace.getId());
   ++m_counters.nInInterests;
 
   // /localhost scope control
@@ -113,6 +111,16 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
     const_cast<Interest&>(interest).setForwardingHint({});
   }
 
+  // PIT admission control; renewing an existing in-record is always allowed
+  if (!m_pit.canAdmitInRecord(inFace)) {
+    shared_ptr<pit::Entry> existingEntry = m_pit.find(interest);
+    if (existingEntry == nullptr || existingEntry->getInRecord(inFace) == existingEntry->in_end()) {
+      // goto Interest shedding pipeline
+      this->onInterestShed(inFace, interest);
+      return;
+    }
+  }
+
   // PIT insert
   shared_ptr<pit::Entry> pitEntry = m_pit.insert(interest).first;
 
@@ -162,6 +170,31 @@ Forwarder::onInterestLoop(Face& inFace, const Interest& interest)
   inFace.sendNack(nack);
 }
 
+void
+Forwarder::onInterestShed(Face& inFace, const Interest& interest)
+{
+  ++m_counters.nShedInterests;
+  ++m_nShedInterests[inFace.getId()];
+
+  // if multi-access or ad hoc face, drop
+  if (inFace.getLinkType() != ndn::nfd::LINK_TYPE_POINT_TO_POINT) {
+    NFD_LOG_DEBUG("onInterestShed face=" << inFace.getId() <<
+                  " interest=" << interest.getName() <<
+                  " drop");
+    return;
+  }
+
+  NFD_LOG_DEBUG("onInterestShed face=" << inFace.getId() <<
+                " interest=" << interest.getName() <<
+                " send-Nack-congestion");
+
+  // send Nack with reason=CONGESTION
+  // note: Don't enter outgoing Nack pipeline because it needs an in-record.
+  lp::Nack nack(interest);
+  nack.setReason(lp::NackReason::CONGESTION);
+  inFace.sendNack(nack);
+}
+
 static inline bool
 compare_InRecord_expiry(const pit::InRecord& a, const pit::InRecord& b)
 {
@@ -184,10 +217,10 @@ Forwarder::onContentStoreMiss(const Face& inFace, const shared_ptr<pit::Entry>&
   this->setExpiryTimer(pitEntry, time::duration_cast<time::milliseconds>(lastExpiryFromNow));
 
   // has NextHopFaceId?
-  shared_ptr<lp::NextHopFaceIdTag> nextHopTag = interest.getTag<lp::NextHopFaceIdTag>();
-  if (nextHopTag != nullptr) {
+  auto nextHopFaceId = interest.getTagValue<lp::NextHopFaceIdTag>();
+  if (nextHopFaceId) {
     // chosen NextHop face exists?
-    Face* nextHopFace = m_faceTable.get(*nextHopTag);
+    Face* nextHopFace = m_faceTable.get(*nextHopFaceId);
     if (nextHopFace != nullptr) {
       NFD_LOG_DEBUG("onContentStoreMiss interest=" << interest.getName() << " nexthop-faceid=" << nextHopFace->getId());
       // go to outgoing Interest pipeline
@@ -209,7 +242,7 @@ Forwarder::onContentStoreHit(const Face& inFace, const shared_ptr<pit::Entry>& p
   NFD_LOG_DEBUG("onContentStoreHit interest=" << interest.getName());
   ++m_counters.nCsHits;
 
-  data.setTag(make_shared<lp::IncomingFaceIdTag>(face::FACEID_CONTENT_STORE));
+  data.setTagValue<lp::IncomingFaceIdTag>(face::FACEID_CONTENT_STORE);
   // XXX should we lookup PIT for other Interests that also match csMatch?
 
   pitEntry->isSatisfied = true;
@@ -256,7 +289,7 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
 {
   // receive Data
   NFD_LOG_DEBUG("onIncomingData face=" << inFace.getId() << " data=" << data.getName());
-  data.setTag(make_shared<lp::IncomingFaceIdTag>(inFace.getId()));
+  data.setTagValue<lp::IncomingFaceIdTag>(inFace.getId());
   ++m_counters.nInData;
 
   // /localhost scope control
@@ -395,7 +428,7 @@ void
 Forwarder::onIncomingNack(Face& inFace, const lp::Nack& nack)
 {
   // receive Nack
-  nack.setTag(make_shared<lp::IncomingFaceIdTag>(inFace.getId()));
+  nack.setTagValue<lp::IncomingFaceIdTag>(inFace.getId());
   ++m_counters.nInNacks;
 
   // if multi-access or ad hoc face, drop
@@ -63,6 +63,11 @@ public:
     return m_counters;
   }
 
+  /** \return number of Interests from \p face shed because of PIT admission control
+   */
+  uint64_t
+  getNShedInterests(const Face& face) const;
+
 public: // faces and policies
   FaceTable&
   getFaceTable()
@@ -193,6 +198,11 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
   VIRTUAL_WITH_TESTS void
   onInterestLoop(Face& inFace, const Interest& interest);
 
+  /** \brief Interest shedding pipeline, when PIT admission control rejects an Interest
+   */
+  VIRTUAL_WITH_TESTS void
+  onInterestShed(Face& inFace, const Interest& interest);
+
   /** \brief Content Store miss pipeline
   */
   VIRTUAL_WITH_TESTS void
@@ -256,21 +266,20 @@ PROTECTED_WITH_TESTS_ELSE_PRIVATE:
   insertDeadNonceList(pit::Entry& pitEntry, Face* upstream);
 
   /** \brief call trigger (method) on the effective strategy of pitEntry
+   *
+   *  The trigger is a lambda taken by value, so that it is inlined into the pipeline
+   *  instead of being type-erased.
    */
-#ifdef WITH_TESTS
-  virtual void
-  dispatchToStrategy(pit::Entry& pitEntry, std::function<void(fw::Strategy&)> trigger)
-#else
   template<class Function>
   void
   dispatchToStrategy(pit::Entry& pitEntry, Function trigger)
-#endif
   {
     trigger(m_strategyChoice.findEffectiveStrategy(pitEntry));
   }
 
 private:
   ForwarderCounters m_counters;
+  std::unordered_map<FaceId, PacketCounter> m_nShedInterests;
 
   FaceTable m_faceTable;
   unique_ptr<fw::UnsolicitedDataPolicy> m_unsolicitedDataPolicy;
@@ -0,0 +1,366 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "segment-prefetch-strategy.hpp"
+#include "algorithm.hpp"
+#include "core/logger.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+namespace nfd {
+namespace fw {
+
+NFD_LOG_INIT(SegmentPrefetchStrategy);
+NFD_REGISTER_STRATEGY(SegmentPrefetchStrategy);
+
+const size_t SegmentPrefetchStrategy::DEFAULT_MAX_DEPTH = 16;
+const size_t SegmentPrefetchStrategy::DEFAULT_FACE_BUDGET = 64;
+const size_t SegmentPrefetchStrategy::INITIAL_DEPTH = 2;
+const size_t SegmentPrefetchStrategy::SEQUENTIAL_THRESHOLD = 2;
+const time::milliseconds SegmentPrefetchStrategy::MEASUREMENTS_LIFETIME(10000);
+
+SegmentPrefetchStrategy::SegmentPrefetchStrategy(Forwarder& forwarder, const Name& name)
+  // Specifying BestRouteStrategy2's own name in its constructor prevents an exception from occuring
+  // when specifying parameters to SegmentPrefetchStrategy
+  : BestRouteStrategy2(forwarder, BestRouteStrategy2::getStrategyName())
+  , m_maxDepth(DEFAULT_MAX_DEPTH)
+  , m_faceBudget(DEFAULT_FACE_BUDGET)
+  , m_state(make_shared<State>())
+{
+  ParsedInstanceName parsed = parseInstanceName(name);
+  if (!parsed.parameters.empty()) {
+    processParams(parsed.parameters);
+  }
+
+  if (parsed.version && *parsed.version != getStrategyName()[-1].toVersion()) {
+    BOOST_THROW_EXCEPTION(std::invalid_argument(
+      "SegmentPrefetchStrategy does not support version " + to_string(*parsed.version)));
+  }
+  this->setInstanceName(makeInstanceName(name, getStrategyName()));
+}
+
+const Name&
+SegmentPrefetchStrategy::getStrategyName()
+{
+  static Name strategyName("/localhost/nfd/strategy/segment-prefetch/%FD%01");
+  return strategyName;
+}
+
+static size_t
+getParamValue(const std::string& param, const std::string& value)
+{
+  try {
+    if (!value.empty() && value[0] == '-')
+      BOOST_THROW_EXCEPTION(boost::bad_lexical_cast());
+
+    auto n = boost::lexical_cast<size_t>(value);
+    if (n == 0)
+      BOOST_THROW_EXCEPTION(boost::bad_lexical_cast());
+    return n;
+  }
+  catch (const boost::bad_lexical_cast&) {
+    BOOST_THROW_EXCEPTION(std::invalid_argument("Value of " + param + " must be a positive integer"));
+  }
+}
+
+void
+SegmentPrefetchStrategy::processParams(const PartialName& params)
+{
+  for (const auto& component : params) {
+    std::string paramStr(reinterpret_cast<const char*>(component.value()), component.value_size());
+    auto n = paramStr.find("~");
+    if (n == std::string::npos) {
+      BOOST_THROW_EXCEPTION(std::invalid_argument("Format is <parameter>~<value>"));
+    }
+
+    auto f = paramStr.substr(0, n);
+    auto s = paramStr.substr(n + 1);
+    if (f == "max-depth") {
+      m_maxDepth = getParamValue(f, s);
+    }
+    else if (f == "face-budget") {
+      m_faceBudget = getParamValue(f, s);
+    }
+    else {
+      BOOST_THROW_EXCEPTION(std::invalid_argument("Parameter should be max-depth or face-budget"));
+    }
+  }
+}
+
+void
+SegmentPrefetchStrategy::afterReceiveInterest(const Face& inFace, const Interest& interest,
+                                              const shared_ptr<pit::Entry>& pitEntry)
+{
+  PitInfo* pi = pitEntry->getStrategyInfo<PitInfo>();
+  if (pi != nullptr && !pi->isRequested && !pi->isSatisfied) {
+    // the Interest is aggregated into a pending prefetch Interest, whose Data will satisfy it
+    NFD_LOG_DEBUG(interest << " from=" << inFace.getId() << " aggregated-into-prefetch");
+    pi->isRequested = true;
+  }
+  else {
+    BestRouteStrategy2::afterReceiveInterest(inFace, interest, pitEntry);
+  }
+
+  this->onRequest(inFace, interest, pitEntry);
+}
+
+void
+SegmentPrefetchStrategy::afterContentStoreHit(const shared_ptr<pit::Entry>& pitEntry,
+                                              const Face& inFace, const Data& data)
+{
+  BestRouteStrategy2::afterContentStoreHit(pitEntry, inFace, data);
+
+  this->onRequest(inFace, pitEntry->getInterest(), pitEntry);
+}
+
+void
+SegmentPrefetchStrategy::beforeSatisfyInterest(const shared_ptr<pit::Entry>& pitEntry,
+                                               const Face& inFace, const Data& data)
+{
+  BestRouteStrategy2::beforeSatisfyInterest(pitEntry, inFace, data);
+
+  PitInfo* pi = pitEntry->getStrategyInfo<PitInfo>();
+  if (pi != nullptr) {
+    pi->isSatisfied = true;
+  }
+
+  const Name& name = data.getName();
+  const optional<name::Component>& finalBlock = data.getFinalBlock();
+  if (!finalBlock || !finalBlock->isSegment() || name.empty() || !name[-1].isSegment()) {
+    return;
+  }
+
+  measurements::Entry* me = this->getMeasurements().findExactMatch(name.getPrefix(-1));
+  if (me == nullptr) {
+    return;
+  }
+  MtInfo* mi = me->getStrategyInfo<MtInfo>();
+  if (mi != nullptr) {
+    mi->finalSegment = finalBlock->toSegment();
+  }
+}
+
+void
+SegmentPrefetchStrategy::afterReceiveNack(const Face& inFace, const lp::Nack& nack,
+                                          const shared_ptr<pit::Entry>& pitEntry)
+{
+  PitInfo* pi = pitEntry->getStrategyInfo<PitInfo>();
+  if (pi == nullptr || pi->isRequested) {
+    BestRouteStrategy2::afterReceiveNack(inFace, nack, pitEntry);
+    return;
+  }
+
+  // no downstream is waiting for the prefetch Interest
+  NFD_LOG_DEBUG(nack.getInterest() << " prefetch-nack=" << nack.getReason() <<
+                " from=" << inFace.getId());
+  const Name& name = pitEntry->getName();
+  measurements::Entry* me = this->getMeasurements().findExactMatch(name.getPrefix(-1));
+  MtInfo* mi = me == nullptr ? nullptr : me->getStrategyInfo<MtInfo>();
+  if (mi != nullptr && mi->prefetched.erase(name[-1].toSegment()) > 0) {
+    decreaseDepth(*mi);
+  }
+
+  this->rejectPendingInterest(pitEntry);
+}
+
+void
+SegmentPrefetchStrategy::onRequest(const Face& inFace, const Interest& interest,
+                                   const shared_ptr<pit::Entry>& pitEntry)
+{
+  MtInfo* mi = this->getOrCreateMtInfo(interest.getName());
+  if (mi == nullptr) {
+    return;
+  }
+
+  this->afterSegmentRequested(*mi, interest.getName()[-1].toSegment());
+  this->prefetch(inFace, interest, pitEntry, *mi);
+}
+
+SegmentPrefetchStrategy::MtInfo*
+SegmentPrefetchStrategy::getOrCreateMtInfo(const Name& name)
+{
+  if (name.empty() || !name[-1].isSegment()) {
+    return nullptr;
+  }
+
+  measurements::Entry* me = this->getMeasurements().get(name.getPrefix(-1));
+  if (me == nullptr) {
+    return nullptr;
+  }
+  this->getMeasurements().extendLifetime(*me, MEASUREMENTS_LIFETIME);
+
+  MtInfo* mi = nullptr;
+  bool isNew = false;
+  std::tie(mi, isNew) = me->insertStrategyInfo<MtInfo>(m_state);
+  if (isNew) {
+    mi->depth = std::min(INITIAL_DEPTH, m_maxDepth);
+  }
+  return mi;
+}
+
+void
+SegmentPrefetchStrategy::afterSegmentRequested(MtInfo& mi, uint64_t segment)
+{
+  if (mi.prefetched.erase(segment) > 0) {
+    ++m_state->counters.nUsefulPrefetches;
+    increaseDepth(mi, m_maxDepth);
+  }
+
+  if (!mi.lastSegment) {
+    mi.lastSegment = segment;
+    return;
+  }
+
+  uint64_t lastSegment = *mi.lastSegment;
+  if (segment == lastSegment + 1) {
+    ++mi.nSequential;
+    mi.lastSegment = segment;
+  }
+  else if (segment > lastSegment) {
+    // the downstream skipped some segments, so segments prefetched among them are wasted
+    auto skippedEnd = mi.prefetched.lower_bound(segment);
+    auto nSkipped = std::distance(mi.prefetched.begin(), skippedEnd);
+    if (nSkipped > 0) {
+      m_state->counters.nWastedPrefetches += nSkipped;
+      mi.prefetched.erase(mi.prefetched.begin(), skippedEnd);
+      decreaseDepth(mi);
+    }
+    mi.nSequential = 0;
+    mi.lastSegment = segment;
+  }
+  else if (lastSegment - segment > m_maxDepth) {
+    // far behind the last segment: another retrieval of the object has started
+    mi.nSequential = 0;
+    mi.lastSegment = segment;
+    mi.nextPrefetch = segment + 1;
+  }
+  // otherwise, this is a retransmission or a reordered Interest
+}
+
+void
+SegmentPrefetchStrategy::prefetch(const Face& inFace, const Interest& interest,
+                                  const shared_ptr<pit::Entry>& pitEntry, MtInfo& mi)
+{
+  if (mi.nSequential < SEQUENTIAL_THRESHOLD) {
+    return;
+  }
+
+  uint64_t first = std::max(mi.nextPrefetch, *mi.lastSegment + 1);
+  uint64_t last = *mi.lastSegment + mi.depth;
+  if (mi.finalSegment) {
+    last = std::min(last, *mi.finalSegment);
+  }
+  if (first > last) {
+    return;
+  }
+
+  // prefetch from the lowest-cost nexthop
+  Face* outFace = nullptr;
+  for (const fib::NextHop& nexthop : this->lookupFib(*pitEntry).getNextHops()) {
+    Face& face = nexthop.getFace();
+    if (face.getId() != inFace.getId() && !wouldViolateScope(inFace, interest, face)) {
+      outFace = &face;
+      break;
+    }
+  }
+  if (outFace == nullptr) {
+    return;
+  }
+
+  Name prefix = interest.getName().getPrefix(-1);
+  for (uint64_t segment = first; segment <= last; ++segment) {
+    if (m_state->nPending[outFace->getId()] >= m_faceBudget) {
+      // resume when a downstream requests the next segment
+      NFD_LOG_DEBUG(prefix << " prefetch-budget-exceeded face=" << outFace->getId());
+      ++m_state->counters.nBudgetExceeded;
+      break;
+    }
+    mi.nextPrefetch = segment + 1;
+
+    // same CanBePrefix and MustBeFresh as downstream Interests, so that they can be aggregated
+    auto prefetchInterest = make_shared<Interest>(Name(prefix).appendSegment(segment));
+    prefetchInterest->setCanBePrefix(interest.getCanBePrefix());
+    prefetchInterest->setMustBeFresh(interest.getMustBeFresh());
+    prefetchInterest->setInterestLifetime(interest.getInterestLifetime());
+    prefetchInterest->setForwardingHint(interest.getForwardingHint());
+
+    shared_ptr<pit::Entry> prefetchPitEntry = this->createLocalPitEntry(*prefetchInterest);
+    if (prefetchPitEntry == nullptr) {
+      // already pending or cached
+      continue;
+    }
+    prefetchPitEntry->insertStrategyInfo<PitInfo>(m_state, outFace->getId());
+    mi.prefetched.insert(segment);
+    ++m_state->counters.nPrefetchInterests;
+
+    NFD_LOG_DEBUG(*prefetchInterest << " prefetch-to=" << outFace->getId());
+    this->sendInterest(prefetchPitEntry, *outFace, *prefetchInterest);
+  }
+}
+
+void
+SegmentPrefetchStrategy::increaseDepth(MtInfo& mi, size_t maxDepth)
+{
+  mi.depth = std::min(mi.depth + 1, maxDepth);
+}
+
+void
+SegmentPrefetchStrategy::decreaseDepth(MtInfo& mi)
+{
+  mi.depth = std::max<size_t>(mi.depth / 2, 1);
+}
+
+SegmentPrefetchStrategy::MtInfo::MtInfo(shared_ptr<State> state)
+  : depth(INITIAL_DEPTH)
+  , m_state(std::move(state))
+{
+}
+
+SegmentPrefetchStrategy::MtInfo::~MtInfo()
+{
+  m_state->counters.nWastedPrefetches += prefetched.size();
+}
+
+SegmentPrefetchStrategy::PitInfo::PitInfo(shared_ptr<State> state, FaceId upstream)
+  : m_state(std::move(state))
+  , m_upstream(upstream)
+{
+  ++m_state->nPending[m_upstream];
+}
+
+SegmentPrefetchStrategy::PitInfo::~PitInfo()
+{
+  auto it = m_state->nPending.find(m_upstream);
+  if (it != m_state->nPending.end() && --it->second == 0) {
+    m_state->nPending.erase(it);
+  }
+
+  if (!isSatisfied) {
+    ++m_state->counters.nFailedPrefetches;
+  }
+}
+
+} // namespace fw
+} // namespace nfd
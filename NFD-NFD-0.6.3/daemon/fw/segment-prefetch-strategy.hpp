@@ -0,0 +1,222 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_SEGMENT_PREFETCH_STRATEGY_HPP
+#define NFD_DAEMON_FW_SEGMENT_PREFETCH_STRATEGY_HPP
+
+#include "best-route-strategy2.hpp"
+
+#include <set>
+
+namespace nfd {
+namespace fw {
+
+/** \brief Segment Prefetch strategy
+ *
+ *  This strategy forwards Interests in the same way as BestRouteStrategy2. In addition, it
+ *  detects sequential access to the segments of an object, i.e. Interests whose last name
+ *  component is a segment number, and speculatively sends Interests for the next segments
+ *  from the forwarder itself. Returned Data is admitted into the ContentStore, so that
+ *  subsequent Interests from downstreams are satisfied locally, or aggregated into the pending
+ *  prefetch Interest.
+ *
+ *  Access patterns are kept per object in the Measurements table. Prefetching starts after
+ *  SEQUENTIAL_THRESHOLD consecutive segments have been requested, and covers up to \p depth
+ *  segments ahead of the last requested segment, without exceeding the final segment if known.
+ *  The depth of each object adapts to usefulness: it grows by one whenever a prefetched segment
+ *  is requested, and is halved whenever prefetched segments are skipped or Nacked.
+ *
+ *  Prefetch Interests are sent to the lowest-cost nexthop. The number of prefetch Interests
+ *  pending on each upstream face is capped by a budget, beyond which prefetching is paused.
+ *
+ *  Parameters:
+ *  \li max-depth~K: maximum number of segments to prefetch ahead, default 16
+ *  \li face-budget~N: maximum number of pending prefetch Interests per upstream face, default 64
+ */
+class SegmentPrefetchStrategy : public BestRouteStrategy2
+{
+public:
+  /** \brief counters of prefetch usefulness
+   */
+  class Counters
+  {
+  public:
+    /// prefetch Interests sent
+    uint64_t nPrefetchInterests = 0;
+    /// prefetched segments subsequently requested by a downstream
+    uint64_t nUsefulPrefetches = 0;
+    /// prefetched segments never requested by a downstream
+    uint64_t nWastedPrefetches = 0;
+    /// prefetch Interests that did not bring back Data
+    uint64_t nFailedPrefetches = 0;
+    /// prefetches not sent because the upstream face was over budget
+    uint64_t nBudgetExceeded = 0;
+  };
+
+  explicit
+  SegmentPrefetchStrategy(Forwarder& forwarder, const Name& name = getStrategyName());
+
+  static const Name&
+  getStrategyName();
+
+  const Counters&
+  getCounters() const
+  {
+    return m_state->counters;
+  }
+
+  void
+  afterReceiveInterest(const Face& inFace, const Interest& interest,
+                       const shared_ptr<pit::Entry>& pitEntry) override;
+
+  void
+  afterContentStoreHit(const shared_ptr<pit::Entry>& pitEntry,
+                       const Face& inFace, const Data& data) override;
+
+  void
+  beforeSatisfyInterest(const shared_ptr<pit::Entry>& pitEntry,
+                        const Face& inFace, const Data& data) override;
+
+  void
+  afterReceiveNack(const Face& inFace, const lp::Nack& nack,
+                   const shared_ptr<pit::Entry>& pitEntry) override;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** \brief state shared between the strategy and its StrategyInfo items,
+   *         which may outlive the strategy instance
+   */
+  class State
+  {
+  public:
+    Counters counters;
+    /// FaceId => number of pending prefetch Interests
+    std::unordered_map<FaceId, size_t> nPending;
+  };
+
+  /** \brief StrategyInfo in measurements table, for the name prefix of an object
+   */
+  class MtInfo : public StrategyInfo
+  {
+  public:
+    static constexpr int
+    getTypeId()
+    {
+      return 1060;
+    }
+
+    explicit
+    MtInfo(shared_ptr<State> state);
+
+    ~MtInfo() override;
+
+  public:
+    size_t depth;
+    optional<uint64_t> lastSegment;
+    /// number of consecutive segments requested before lastSegment
+    size_t nSequential = 0;
+    /// segments below this number have been considered for prefetching
+    uint64_t nextPrefetch = 0;
+    optional<uint64_t> finalSegment;
+    /// prefetched segments not yet requested by a downstream
+    std::set<uint64_t> prefetched;
+
+  private:
+    shared_ptr<State> m_state;
+  };
+
+  /** \brief StrategyInfo on the PIT entry of a prefetch Interest
+   */
+  class PitInfo : public StrategyInfo
+  {
+  public:
+    static constexpr int
+    getTypeId()
+    {
+      return 1061;
+    }
+
+    PitInfo(shared_ptr<State> state, FaceId upstream);
+
+    ~PitInfo() override;
+
+  public:
+    /// whether a downstream Interest has been aggregated into the prefetch Interest
+    bool isRequested = false;
+    /// whether Data has been retrieved
+    bool isSatisfied = false;
+
+  private:
+    shared_ptr<State> m_state;
+    FaceId m_upstream;
+  };
+
+  /** \return per-object measurements for the object of \p name, or nullptr if \p name does not
+   *          end with a segment number
+   */
+  MtInfo*
+  getOrCreateMtInfo(const Name& name);
+
+  /** \brief updates the access pattern of an object after a downstream requests \p segment
+   */
+  void
+  afterSegmentRequested(MtInfo& mi, uint64_t segment);
+
+  /** \brief sends prefetch Interests for segments following the one requested by \p interest
+   */
+  void
+  prefetch(const Face& inFace, const Interest& interest, const shared_ptr<pit::Entry>& pitEntry,
+           MtInfo& mi);
+
+  static void
+  increaseDepth(MtInfo& mi, size_t maxDepth);
+
+  static void
+  decreaseDepth(MtInfo& mi);
+
+private:
+  void
+  processParams(const PartialName& params);
+
+  void
+  onRequest(const Face& inFace, const Interest& interest, const shared_ptr<pit::Entry>& pitEntry);
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  static const size_t DEFAULT_MAX_DEPTH;
+  static const size_t DEFAULT_FACE_BUDGET;
+  static const size_t INITIAL_DEPTH;
+  /// number of consecutive segments that must be requested before prefetching starts
+  static const size_t SEQUENTIAL_THRESHOLD;
+  static const time::milliseconds MEASUREMENTS_LIFETIME;
+
+private:
+  size_t m_maxDepth;
+  size_t m_faceBudget;
+  shared_ptr<State> m_state;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_SEGMENT_PREFETCH_STRATEGY_HPP
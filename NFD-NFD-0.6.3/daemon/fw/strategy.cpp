@@ -249,6 +249,20 @@ Strategy::sendNacks(const shared_ptr<pit::Entry>& pitEntry, const lp::NackHeader
   // warning: don't loop on pitEntry->getInRecords(), because in-record is deleted when sending Nack
 }
 
+shared_ptr<pit::Entry>
+Strategy::createLocalPitEntry(const Interest& interest)
+{
+  Pit& pit = m_forwarder.getPit();
+  if (pit.isOverBudget() || pit.find(interest) != nullptr ||
+      m_forwarder.getCs().contains(interest)) {
+    return nullptr;
+  }
+
+  shared_ptr<pit::Entry> pitEntry = pit.insert(interest).first;
+  m_forwarder.setExpiryTimer(pitEntry, interest.getInterestLifetime());
+  return pitEntry;
+}
+
 const fib::Entry&
 Strategy::lookupFib(const pit::Entry& pitEntry) const
 {
@@ -269,7 +283,7 @@ Strategy::lookupFib(const pit::Entry& pitEntry) const
 
   const fib::Entry* fibEntry = nullptr;
   for (const Delegation& del : fh) {
-    fibEntry = &fib.findLongestPrefixMatch(del.name);
+    fibEntry = &fib.findDelegationMatch(del.name);
     if (fibEntry->hasNextHops()) {
       if (fibEntry->getPrefix().size() == 0) {
         // in consumer region, return the default route
@@ -308,6 +308,20 @@ protected: // actions
     m_forwarder.setExpiryTimer(pitEntry, duration);
   }
 
+  /** \brief create a PIT entry for an Interest originated by the forwarder itself
+   *  \param interest the Interest; must be created with make_shared
+   *  \return the new PIT entry, or nullptr if the Interest is already pending, can be satisfied
+   *          by the ContentStore, or the PIT is over its budget
+   *
+   *  The PIT entry has no in-record, so that Data returned for it is admitted into the
+   *  ContentStore but not sent to any downstream, unless a downstream Interest is aggregated
+   *  into the PIT entry before the Data arrives.
+   *  The strategy should forward the Interest with sendInterest action.
+   *  The PIT entry expires after the InterestLifetime.
+   */
+  shared_ptr<pit::Entry>
+  createLocalPitEntry(const Interest& interest);
+
 protected: // accessors
   /** \brief performs a FIB lookup, considering Link object if present
    */
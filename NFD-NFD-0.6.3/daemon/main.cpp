@@ -24,10 +24,12 @@
  */
 
 #include "nfd.hpp"
+#include "mgmt/general-config-section.hpp"
 #include "rib/service.hpp"
 
 #include "core/extended-error-message.hpp"
 #include "core/global-io.hpp"
+#include "core/io-runner.hpp"
 #include "core/logger.hpp"
 #include "core/privilege-helper.hpp"
 #include "core/version.hpp"
@@ -116,7 +118,8 @@ public:
     std::condition_variable cv;
 
     std::string configFile = this->m_configFile; // c++11 lambda cannot capture member variables
-    boost::thread ribThread([configFile, &retval, &ribIo, mainIo, &cv, &m] {
+    IoRunner::Options ribRunnerOptions = general::getRibRunnerOptions();
+    boost::thread ribThread([configFile, ribRunnerOptions, &retval, &ribIo, mainIo, &cv, &m] {
         {
           std::lock_guard<std::mutex> lock(m);
           ribIo = &getGlobalIoService();
@@ -129,7 +132,8 @@ public:
           ndn::KeyChain ribKeyChain;
           // must be created inside a separate thread
           rib::Service ribService(configFile, ribKeyChain);
-          getGlobalIoService().run(); // ribIo is not thread-safe to use here
+          // ribIo is not thread-safe to use here
+          IoRunner(getGlobalIoService(), ribRunnerOptions).run();
         }
         catch (const std::exception& e) {
           NFD_LOG_FATAL(e.what());
@@ -151,7 +155,7 @@ public:
     }
 
     try {
-      mainIo->run();
+      IoRunner(*mainIo, general::getForwardingRunnerOptions()).run();
     }
     catch (const std::exception& e) {
       NFD_LOG_FATAL(getExtendedErrorMessage(e));
@@ -109,6 +109,22 @@ CsManager::serveInfo(const Name& topPrefix, const Interest& interest,
   info.setNHits(m_fwCnt.nCsHits);
   info.setNMisses(m_fwCnt.nCsMisses);
 
+  auto addPartition = [&info] (const cs::Partition& partition) {
+    info.addPartition(ndn::nfd::CsPartition()
+                      .setPrefix(partition.getPrefix())
+                      .setCapacity(partition.getLimit())
+                      .setNEntries(partition.size())
+                      .setNHits(partition.nHits)
+                      .setNMisses(partition.nMisses)
+                      .setNEvictions(partition.nEvictions));
+  };
+
+  // the default partition comes first, with prefix "/" which cannot be configured
+  addPartition(m_cs.getDefaultPartition());
+  for (const auto& prefixAndPartition : m_cs.getPartitions()) {
+    addPartition(*prefixAndPartition.second);
+  }
+
   context.append(info.wireEncode());
   context.end();
 }
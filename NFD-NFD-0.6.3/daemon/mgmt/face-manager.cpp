@@ -29,7 +29,9 @@
 #include "face/generic-link-service.hpp"
 #include "face/protocol-factory.hpp"
 #include "fw/face-table.hpp"
+#include "fw/forwarder.hpp"
 
+#include <boost/functional/hash.hpp>
 #include <boost/logic/tribool.hpp>
 
 #include <ndn-cxx/lp/tags.hpp>
@@ -39,12 +41,17 @@ namespace nfd {
 
 NFD_LOG_INIT(FaceManager);
 
+const time::seconds FaceManager::COUNTERS_EPOCH_PERIOD(5);
+
 FaceManager::FaceManager(FaceSystem& faceSystem,
+                         const Forwarder& forwarder,
                          Dispatcher& dispatcher,
                          CommandAuthenticator& authenticator)
   : NfdManagerBase(dispatcher, authenticator, "faces")
   , m_faceSystem(faceSystem)
   , m_faceTable(faceSystem.getFaceTable())
+  , m_forwarder(forwarder)
+  , m_nFaceUpdates(0)
 {
   // register handlers for ControlCommand
   registerCommandHandler<ndn::nfd::FaceCreateCommand>("create",
@@ -57,9 +64,10 @@ FaceManager::FaceManager(FaceSystem& faceSystem,
     bind(&FaceManager::destroyFace, this, _2, _3, _4, _5));
 
   // register handlers for StatusDataset
-  registerStatusDatasetHandler("list", bind(&FaceManager::listFaces, this, _1, _2, _3));
+  auto facesEpoch = bind(&FaceManager::getFacesEpoch, this);
+  registerStatusDatasetHandler("list", bind(&FaceManager::listFaces, this, _1, _2, _3), facesEpoch);
   registerStatusDatasetHandler("channels", bind(&FaceManager::listChannels, this, _1, _2, _3));
-  registerStatusDatasetHandler("query", bind(&FaceManager::queryFaces, this, _1, _2, _3));
+  registerStatusDatasetHandler("query", bind(&FaceManager::queryFaces, this, _1, _2, _3), facesEpoch);
 
   // register notification stream
   m_postNotification = registerNotificationStream("events");
@@ -243,6 +251,7 @@ FaceManager::updateFace(const Name& topPrefix, const Interest& interest,
     face->setPersistency(parameters.getFacePersistency());
   }
   setLinkServiceOptions(*face, parameters);
+  ++m_nFaceUpdates;
 
   // Set ControlResponse fields
   response = collectFaceProperties(*face, false);
@@ -336,6 +345,24 @@ FaceManager::listFaces(const Name& topPrefix, const Interest& interest,
   context.end();
 }
 
+uint64_t
+FaceManager::getFacesEpoch() const
+{
+  bool hasExpiringFaces = std::any_of(m_faceTable.begin(), m_faceTable.end(), [] (const Face& face) {
+    return face.getExpirationTime() != time::steady_clock::TimePoint::max();
+  });
+
+  size_t seed = static_cast<size_t>(m_faceTable.getEpoch());
+  boost::hash_combine(seed, m_nFaceUpdates);
+  if (hasExpiringFaces) {
+    return makeTimeDependentEpoch(seed);
+  }
+
+  // Counters change with every packet, including the request itself and its response;
+  // they are refreshed once per COUNTERS_EPOCH_PERIOD instead.
+  return makeTimeDependentEpoch(seed, COUNTERS_EPOCH_PERIOD);
+}
+
 void
 FaceManager::listChannels(const Name& topPrefix, const Interest& interest,
                           ndn::mgmt::StatusDatasetContext& context)
@@ -420,7 +447,7 @@ FaceManager::matchFilter(const ndn::nfd::FaceQueryFilter& filter, const Face& fa
 }
 
 ndn::nfd::FaceStatus
-FaceManager::collectFaceStatus(const Face& face, const time::steady_clock::TimePoint& now)
+FaceManager::collectFaceStatus(const Face& face, const time::steady_clock::TimePoint& now) const
 {
   ndn::nfd::FaceStatus status;
 
@@ -448,7 +475,8 @@ FaceManager::collectFaceStatus(const Face& face, const time::steady_clock::TimeP
         .setNInNacks(counters.nInNacks)
         .setNOutNacks(counters.nOutNacks)
         .setNInBytes(counters.nInBytes)
-        .setNOutBytes(counters.nOutBytes);
+        .setNOutBytes(counters.nOutBytes)
+        .setNShedInterests(m_forwarder.getNShedInterests(face));
 
   return status;
 }
@@ -35,6 +35,8 @@
 
 namespace nfd {
 
+class Forwarder;
+
 /**
  * @brief implement the Face Management of NFD Management Protocol.
  * @sa https://redmine.named-data.net/projects/nfd/wiki/FaceMgmt
@@ -43,6 +45,7 @@ class FaceManager : public NfdManagerBase
 {
 public:
   FaceManager(FaceSystem& faceSystem,
+              const Forwarder& forwarder,
               Dispatcher& dispatcher,
               CommandAuthenticator& authenticator);
 
@@ -92,14 +95,23 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // StatusDataset
   queryFaces(const Name& topPrefix, const Interest& interest,
              ndn::mgmt::StatusDatasetContext& context);
 
+  /** \brief epoch of faces/list and faces/query datasets
+   *
+   *  Changes when a face is added, removed, or updated. Face counters are not tracked;
+   *  instead, the epoch also changes every COUNTERS_EPOCH_PERIOD, or every second if a face
+   *  has an expiration time.
+   */
+  uint64_t
+  getFacesEpoch() const;
+
 private: // helpers for StatusDataset handler
   static bool
   matchFilter(const ndn::nfd::FaceQueryFilter& filter, const Face& face);
 
   /** \brief get status of face, including properties and counters
    */
-  static ndn::nfd::FaceStatus
-  collectFaceStatus(const Face& face, const time::steady_clock::TimePoint& now);
+  ndn::nfd::FaceStatus
+  collectFaceStatus(const Face& face, const time::steady_clock::TimePoint& now) const;
 
   /** \brief copy face properties into traits
    *  \tparam FaceTraits either FaceStatus or FaceEventNotification
@@ -118,12 +130,18 @@ private: // NotificationStream
 private:
   FaceSystem& m_faceSystem;
   FaceTable& m_faceTable;
+  const Forwarder& m_forwarder;
   ndn::mgmt::PostNotification m_postNotification;
   signal::ScopedConnection m_faceAddConn;
   signal::ScopedConnection m_faceRemoveConn;
+  uint64_t m_nFaceUpdates;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   std::map<FaceId, signal::ScopedConnection> m_faceStateChangeConn;
+
+  /** \brief how long a faces/list or faces/query response may be reused while counters change
+   */
+  static const time::seconds COUNTERS_EPOCH_PERIOD;
 };
 
 } // namespace nfd
@@ -50,7 +50,8 @@ FibManager::FibManager(Fib& fib,
   registerCommandHandler<ndn::nfd::FibRemoveNextHopCommand>("remove-nexthop",
     bind(&FibManager::removeNextHop, this, _2, _3, _4, _5));
 
-  registerStatusDatasetHandler("list", bind(&FibManager::listEntries, this, _1, _2, _3));
+  registerStatusDatasetHandler("list", bind(&FibManager::listEntries, this, _1, _2, _3),
+                               [this] { return m_fib.getEpoch(); });
 }
 
 void
@@ -78,7 +79,7 @@ FibManager::addNextHop(const Name& topPrefix, const Interest& interest,
   }
 
   fib::Entry* entry = m_fib.insert(prefix).first;
-  entry->addNextHop(*face, cost);
+  m_fib.addNextHop(*entry, *face, cost);
 
   NFD_LOG_TRACE("fib/add-nexthop(" << prefix << ',' << faceId << ',' << cost << "): OK");
   return done(ControlResponse(200, "Success").setBody(parameters.wireEncode()));
@@ -107,12 +108,18 @@ FibManager::removeNextHop(const Name& topPrefix, const Interest& interest,
     return;
   }
 
-  entry->removeNextHop(*face);
-  if (!entry->hasNextHops()) {
+  bool isNextHop = entry->hasNextHop(*face);
+  if (!isNextHop && entry->hasNextHops()) {
+    NFD_LOG_TRACE("fib/remove-nexthop(" << prefix << ',' << faceId << "): OK no-nexthop");
+    return;
+  }
+
+  if (!isNextHop || entry->getNextHops().size() == 1) {
     m_fib.erase(*entry);
     NFD_LOG_TRACE("fib/remove-nexthop(" << prefix << ',' << faceId << "): OK entry-erased");
   }
   else {
+    m_fib.removeNextHop(*entry, *face);
     NFD_LOG_TRACE("fib/remove-nexthop(" << prefix << ',' << faceId << "): OK nexthop-removed");
   }
 }
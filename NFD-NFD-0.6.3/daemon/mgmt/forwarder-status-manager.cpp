@@ -25,7 +25,10 @@
 
 #include "forwarder-status-manager.hpp"
 #include "fw/forwarder.hpp"
+#include "fw/segment-prefetch-strategy.hpp"
+#include "core/io-runner.hpp"
 #include "core/version.hpp"
+#include "table/table-arena.hpp"
 
 namespace nfd {
 
@@ -38,6 +41,8 @@ ForwarderStatusManager::ForwarderStatusManager(Forwarder& forwarder, Dispatcher&
 {
   m_dispatcher.addStatusDataset("status/general", ndn::mgmt::makeAcceptAllAuthorization(),
                                 bind(&ForwarderStatusManager::listGeneralStatus, this, _1, _2, _3));
+  m_dispatcher.addStatusDataset("status/arena", ndn::mgmt::makeAcceptAllAuthorization(),
+                                bind(&ForwarderStatusManager::listArenaStatus, this, _1, _2, _3));
 }
 
 ndn::nfd::ForwarderStatus
@@ -61,7 +66,33 @@ ForwarderStatusManager::collectGeneralStatus()
         .setNInData(counters.nInData)
         .setNOutData(counters.nOutData)
         .setNInNacks(counters.nInNacks)
-        .setNOutNacks(counters.nOutNacks);
+        .setNOutNacks(counters.nOutNacks)
+        .setNShedInterests(counters.nShedInterests);
+
+  fw::SegmentPrefetchStrategy::Counters prefetch;
+  for (const strategy_choice::Entry& entry : m_forwarder.getStrategyChoice()) {
+    auto strategy = dynamic_cast<const fw::SegmentPrefetchStrategy*>(&entry.getStrategy());
+    if (strategy != nullptr) {
+      const fw::SegmentPrefetchStrategy::Counters& c = strategy->getCounters();
+      prefetch.nPrefetchInterests += c.nPrefetchInterests;
+      prefetch.nUsefulPrefetches += c.nUsefulPrefetches;
+      prefetch.nWastedPrefetches += c.nWastedPrefetches;
+      prefetch.nFailedPrefetches += c.nFailedPrefetches;
+      prefetch.nBudgetExceeded += c.nBudgetExceeded;
+    }
+  }
+  status.setNPrefetchInterests(prefetch.nPrefetchInterests)
+        .setNUsefulPrefetches(prefetch.nUsefulPrefetches)
+        .setNWastedPrefetches(prefetch.nWastedPrefetches)
+        .setNFailedPrefetches(prefetch.nFailedPrefetches)
+        .setNPrefetchBudgetExceeded(prefetch.nBudgetExceeded);
+
+  // the dataset is produced on the forwarding thread
+  const IoRunner* runner = IoRunner::getCurrent();
+  if (runner != nullptr && runner->getOptions().wantBusyPoll) {
+    status.setBusyTime(time::duration_cast<time::milliseconds>(runner->getBusyTime()))
+          .setIdleTime(time::duration_cast<time::milliseconds>(runner->getIdleTime()));
+  }
 
   return status;
 }
@@ -81,4 +112,24 @@ ForwarderStatusManager::listGeneralStatus(const Name& topPrefix, const Interest&
   context.end();
 }
 
+void
+ForwarderStatusManager::listArenaStatus(const Name& topPrefix, const Interest& interest,
+                                        ndn::mgmt::StatusDatasetContext& context)
+{
+  context.setExpiry(STATUS_FRESHNESS);
+
+  const TableArena& arena = getTableArena();
+  ndn::nfd::ArenaInfo info;
+  info.setPageMode(arena.getOptions().pageMode)
+      .setNChunks(arena.getNChunks())
+      .setNHugePageChunks(arena.getNHugePageChunks())
+      .setNMappedBytes(arena.getNMappedBytes())
+      .setNAllocatedBytes(arena.getNAllocatedBytes())
+      .setNFreeBytes(arena.getNFreeBytes())
+      .setNFallbackAllocations(arena.getNFallbackAllocations());
+
+  context.append(info.wireEncode());
+  context.end();
+}
+
 } // namespace nfd
@@ -27,6 +27,7 @@
 #define NFD_DAEMON_MGMT_FORWARDER_STATUS_MANAGER_HPP
 
 #include "core/manager-base.hpp"
+#include <ndn-cxx/mgmt/nfd/arena-info.hpp>
 #include <ndn-cxx/mgmt/nfd/forwarder-status.hpp>
 
 namespace nfd {
@@ -52,6 +53,12 @@ private:
   listGeneralStatus(const Name& topPrefix, const Interest& interest,
                     ndn::mgmt::StatusDatasetContext& context);
 
+  /** \brief provide table arena dataset
+   */
+  void
+  listArenaStatus(const Name& topPrefix, const Interest& interest,
+                  ndn::mgmt::StatusDatasetContext& context);
+
 private:
   Forwarder&  m_forwarder;
   Dispatcher& m_dispatcher;
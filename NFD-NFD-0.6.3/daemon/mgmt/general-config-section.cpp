@@ -29,6 +29,20 @@
 namespace nfd {
 namespace general {
 
+static IoRunner::Options g_forwardingRunnerOptions;
+static IoRunner::Options g_ribRunnerOptions;
+
+static int
+parseCpu(const ConfigSection::value_type& option)
+{
+  int cpu = ConfigFile::parseNumber<int>(option, "general");
+  if (cpu < 0) {
+    BOOST_THROW_EXCEPTION(ConfigFile::Error("Invalid value \"" + option.second.get_value<std::string>() +
+                                            "\" for option \"" + option.first + "\" in \"general\" section"));
+  }
+  return cpu;
+}
+
 static void
 onConfig(const ConfigSection& section, bool isDryRun, const std::string&)
 {
@@ -36,10 +50,16 @@ onConfig(const ConfigSection& section, bool isDryRun, const std::string&)
   // {
   //   user "ndn-user"
   //   group "ndn-user"
+  //   busy_poll no
+  //   busy_poll_spin 200
+  //   forwarding_cpu 2
+  //   rib_cpu 3
   // }
 
   std::string user;
   std::string group;
+  IoRunner::Options forwardingRunnerOptions;
+  IoRunner::Options ribRunnerOptions;
 
   for (const auto& i : section) {
     if (i.first == "user") {
@@ -66,9 +86,30 @@ onConfig(const ConfigSection& section, bool isDryRun, const std::string&)
         BOOST_THROW_EXCEPTION(ConfigFile::Error("Invalid value for \"group\" in \"general\" section"));
       }
     }
+    else if (i.first == "busy_poll") {
+      // applies to both the forwarding and RIB threads
+      forwardingRunnerOptions.wantBusyPoll = ribRunnerOptions.wantBusyPoll =
+        ConfigFile::parseYesNo(i, "general");
+    }
+    else if (i.first == "busy_poll_spin") {
+      forwardingRunnerOptions.spinDuration = ribRunnerOptions.spinDuration =
+        time::microseconds(ConfigFile::parseNumber<uint32_t>(i, "general"));
+    }
+    else if (i.first == "forwarding_cpu") {
+      forwardingRunnerOptions.cpu = parseCpu(i);
+    }
+    else if (i.first == "rib_cpu") {
+      ribRunnerOptions.cpu = parseCpu(i);
+    }
   }
 
   PrivilegeHelper::initialize(user, group);
+
+  if (!isDryRun) {
+    // takes effect when the threads start; not changed by a configuration reload
+    g_forwardingRunnerOptions = forwardingRunnerOptions;
+    g_ribRunnerOptions = ribRunnerOptions;
+  }
 }
 
 void
@@ -77,5 +118,17 @@ setConfigFile(ConfigFile& config)
   config.addSectionHandler("general", &onConfig);
 }
 
+const IoRunner::Options&
+getForwardingRunnerOptions()
+{
+  return g_forwardingRunnerOptions;
+}
+
+const IoRunner::Options&
+getRibRunnerOptions()
+{
+  return g_ribRunnerOptions;
+}
+
 } // namespace general
 } // namespace nfd
@@ -27,6 +27,7 @@
 #define NFD_MGMT_GENERAL_CONFIG_SECTION_HPP
 
 #include "core/config-file.hpp"
+#include "core/io-runner.hpp"
 
 namespace nfd {
 namespace general {
@@ -34,6 +35,16 @@ namespace general {
 void
 setConfigFile(ConfigFile& config);
 
+/** \brief options for running the forwarding thread, from the last processed configuration
+ */
+const IoRunner::Options&
+getForwardingRunnerOptions();
+
+/** \brief options for running the RIB thread, from the last processed configuration
+ */
+const IoRunner::Options&
+getRibRunnerOptions();
+
 } // namespace general
 } // namespace nfd
 
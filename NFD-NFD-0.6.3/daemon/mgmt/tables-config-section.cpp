@@ -52,6 +52,11 @@ TablesConfigSection::ensureConfigured()
 
   m_forwarder.getCs().setLimit(DEFAULT_CS_MAX_PACKETS);
   // Don't set default cs_policy because it's already created by CS itself.
+  m_forwarder.getCs().setAdmissionFilter(nullptr);
+  m_forwarder.getCs().setCompressor(nullptr);
+  this->processCsPartitionsSection(ConfigSection(), false);
+  m_forwarder.getPit().setBudget(0, 0);
+  m_forwarder.getPit().setFaceQuota(0);
   m_forwarder.setUnsolicitedDataPolicy(make_unique<fw::DefaultUnsolicitedDataPolicy>());
 
   m_isConfigured = true;
@@ -77,6 +82,61 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun)
     }
   }
 
+  bool wantAdmissionFilter = false;
+  OptionalConfigSection csAdmissionNode = section.get_child_optional("cs_admission");
+  if (csAdmissionNode) {
+    std::string admission = csAdmissionNode->get_value<std::string>();
+    if (admission == "tinylfu") {
+      wantAdmissionFilter = true;
+    }
+    else if (admission != "none") {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error(
+        "Invalid value \"" + admission + "\" for option \"cs_admission\" in \"tables\" section"));
+    }
+  }
+
+  std::string compressionCodec = "none";
+  OptionalConfigSection csCompressionNode = section.get_child_optional("cs_compression");
+  if (csCompressionNode) {
+    compressionCodec = csCompressionNode->get_value<std::string>();
+    if (compressionCodec != "none" && cs::Compressor::getCodecs().count(compressionCodec) == 0) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error(
+        "Unavailable value \"" + compressionCodec + "\" for option \"cs_compression\" "
+        "in \"tables\" section"));
+    }
+  }
+
+  size_t csHotPercent = Cs::DEFAULT_HOT_PERCENT;
+  OptionalConfigSection csHotPercentNode = section.get_child_optional("cs_compression_hot_percent");
+  if (csHotPercentNode) {
+    csHotPercent = ConfigFile::parseNumber<size_t>(*csHotPercentNode, "cs_compression_hot_percent",
+                                                   "tables");
+    if (csHotPercent > 100) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error(
+        "Invalid value \"" + std::to_string(csHotPercent) + "\" for option "
+        "\"cs_compression_hot_percent\" in \"tables\" section"));
+    }
+  }
+
+  size_t nPitMaxEntries = 0;
+  OptionalConfigSection pitMaxEntriesNode = section.get_child_optional("pit_max_entries");
+  if (pitMaxEntriesNode) {
+    nPitMaxEntries = ConfigFile::parseNumber<size_t>(*pitMaxEntriesNode, "pit_max_entries", "tables");
+  }
+
+  size_t nPitMaxBytes = 0;
+  OptionalConfigSection pitMaxSizeNode = section.get_child_optional("pit_max_size");
+  if (pitMaxSizeNode) {
+    // in MiB
+    nPitMaxBytes = ConfigFile::parseNumber<size_t>(*pitMaxSizeNode, "pit_max_size", "tables") << 20;
+  }
+
+  size_t nPitFaceQuota = 0;
+  OptionalConfigSection pitFaceQuotaNode = section.get_child_optional("pit_face_quota");
+  if (pitFaceQuotaNode) {
+    nPitFaceQuota = ConfigFile::parseNumber<size_t>(*pitFaceQuotaNode, "pit_face_quota", "tables");
+  }
+
   unique_ptr<fw::UnsolicitedDataPolicy> unsolicitedDataPolicy;
   OptionalConfigSection unsolicitedDataPolicyNode = section.get_child_optional("cs_unsolicited_policy");
   if (unsolicitedDataPolicyNode) {
@@ -91,6 +151,8 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun)
     unsolicitedDataPolicy = make_unique<fw::DefaultUnsolicitedDataPolicy>();
   }
 
+  TableArena::Options arenaOptions = parseArenaOptions(section);
+
   OptionalConfigSection strategyChoiceSection = section.get_child_optional("strategy_choice");
   if (strategyChoiceSection) {
     processStrategyChoiceSection(*strategyChoiceSection, isDryRun);
@@ -101,21 +163,78 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun)
     processNetworkRegionSection(*networkRegionSection, isDryRun);
   }
 
+  OptionalConfigSection csPartitionsSection = section.get_child_optional("cs_partitions");
+  processCsPartitionsSection(csPartitionsSection ? *csPartitionsSection : ConfigSection(), isDryRun);
+
   if (isDryRun) {
     return;
   }
 
   Cs& cs = m_forwarder.getCs();
   cs.setLimit(nCsMaxPackets);
-  if (cs.size() == 0 && csPolicy != nullptr) {
+  if (cs.getDefaultPartition().size() == 0 && csPolicy != nullptr) {
     cs.setPolicy(std::move(csPolicy));
   }
+  if (!wantAdmissionFilter) {
+    cs.setAdmissionFilter(nullptr);
+  }
+  else if (cs.getAdmissionFilter() == nullptr) {
+    cs.setAdmissionFilter(make_unique<cs::TinyLfu>(nCsMaxPackets));
+  }
+  cs.setHotPercent(csHotPercent);
+  if (compressionCodec == "none") {
+    cs.setCompressor(nullptr);
+  }
+  else if (cs.getCompressor() == nullptr || cs.getCompressor()->getCodec() != compressionCodec) {
+    cs.setCompressor(cs::Compressor::create(compressionCodec));
+  }
+
+  Pit& pit = m_forwarder.getPit();
+  pit.setBudget(nPitMaxEntries, nPitMaxBytes);
+  pit.setFaceQuota(nPitFaceQuota);
 
   m_forwarder.setUnsolicitedDataPolicy(std::move(unsolicitedDataPolicy));
 
+  getTableArena().setOptions(arenaOptions);
+
   m_isConfigured = true;
 }
 
+TableArena::Options
+TablesConfigSection::parseArenaOptions(const ConfigSection& section)
+{
+  TableArena::Options options;
+
+  OptionalConfigSection pageModeNode = section.get_child_optional("arena_page_mode");
+  if (pageModeNode) {
+    std::string pageMode = pageModeNode->get_value<std::string>();
+    if (pageMode == "off") {
+      options.pageMode = ndn::nfd::ARENA_PAGE_MODE_OFF;
+    }
+    else if (pageMode == "normal") {
+      options.pageMode = ndn::nfd::ARENA_PAGE_MODE_NORMAL;
+    }
+    else if (pageMode == "transparent") {
+      options.pageMode = ndn::nfd::ARENA_PAGE_MODE_TRANSPARENT;
+    }
+    else if (pageMode == "explicit") {
+      options.pageMode = ndn::nfd::ARENA_PAGE_MODE_EXPLICIT;
+    }
+    else {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error(
+        "Invalid value \"" + pageMode + "\" for option \"arena_page_mode\" in \"tables\" section"));
+    }
+  }
+
+  OptionalConfigSection maxSizeNode = section.get_child_optional("arena_max_size");
+  if (maxSizeNode) {
+    // in MiB
+    options.maxSize = ConfigFile::parseNumber<size_t>(*maxSizeNode, "arena_max_size", "tables") << 20;
+  }
+
+  return options;
+}
+
 void
 TablesConfigSection::processStrategyChoiceSection(const ConfigSection& section, bool isDryRun)
 {
@@ -169,4 +288,108 @@ TablesConfigSection::processNetworkRegionSection(const ConfigSection& section, b
   }
 }
 
+void
+TablesConfigSection::processCsPartitionsSection(const ConfigSection& section, bool isDryRun)
+{
+  struct PartitionOptions
+  {
+    size_t nMaxPackets = 0;
+    unique_ptr<cs::Policy> policy;
+    bool wantAdmissionFilter = false;
+  };
+
+  std::map<Name, PartitionOptions> partitions;
+  for (const auto& prefixAndOptions : section) {
+    Name prefix(prefixAndOptions.first);
+    if (prefix.empty()) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error(
+        "Partition \"/\" in \"cs_partitions\" section is reserved for the default partition, "
+        "which is configured with cs_max_packets, cs_policy and cs_admission"));
+    }
+
+    PartitionOptions options;
+    bool hasCapacity = false;
+    std::string policyName = "lru";
+    for (const auto& option : prefixAndOptions.second) {
+      if (option.first == "capacity") {
+        options.nMaxPackets = ConfigFile::parseNumber<size_t>(option, "cs_partitions");
+        hasCapacity = true;
+      }
+      else if (option.first == "policy") {
+        policyName = option.second.get_value<std::string>();
+      }
+      else if (option.first == "admission") {
+        std::string admission = option.second.get_value<std::string>();
+        if (admission == "tinylfu") {
+          options.wantAdmissionFilter = true;
+        }
+        else if (admission != "none") {
+          BOOST_THROW_EXCEPTION(ConfigFile::Error(
+            "Invalid value \"" + admission + "\" for option \"admission\" of partition \"" +
+            prefix.toUri() + "\" in \"cs_partitions\" section"));
+        }
+      }
+      else {
+        BOOST_THROW_EXCEPTION(ConfigFile::Error(
+          "Unrecognized option \"" + option.first + "\" of partition \"" + prefix.toUri() +
+          "\" in \"cs_partitions\" section"));
+      }
+    }
+
+    if (!hasCapacity) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error(
+        "Missing option \"capacity\" of partition \"" + prefix.toUri() +
+        "\" in \"cs_partitions\" section"));
+    }
+
+    options.policy = cs::Policy::create(policyName);
+    if (options.policy == nullptr) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error(
+        "Unknown policy \"" + policyName + "\" of partition \"" + prefix.toUri() +
+        "\" in \"cs_partitions\" section"));
+    }
+
+    if (!partitions.emplace(prefix, std::move(options)).second) {
+      BOOST_THROW_EXCEPTION(ConfigFile::Error(
+        "Duplicate partition \"" + prefix.toUri() + "\" in \"cs_partitions\" section"));
+    }
+  }
+
+  if (isDryRun) {
+    return;
+  }
+
+  Cs& cs = m_forwarder.getCs();
+  std::vector<Name> removedPrefixes;
+  for (const auto& prefixAndPartition : cs.getPartitions()) {
+    if (partitions.count(prefixAndPartition.first) == 0) {
+      removedPrefixes.push_back(prefixAndPartition.first);
+    }
+  }
+  for (const Name& prefix : removedPrefixes) {
+    cs.erasePartition(prefix);
+  }
+
+  for (auto& prefixAndOptions : partitions) {
+    PartitionOptions& options = prefixAndOptions.second;
+    cs::Partition* partition = cs.getPartition(prefixAndOptions.first);
+    if (partition == nullptr) {
+      partition = &cs.addPartition(prefixAndOptions.first, options.nMaxPackets, std::move(options.policy));
+    }
+    else {
+      partition->setLimit(options.nMaxPackets);
+      if (partition->size() == 0 && partition->getPolicy()->getName() != options.policy->getName()) {
+        partition->setPolicy(std::move(options.policy));
+      }
+    }
+
+    if (!options.wantAdmissionFilter) {
+      partition->setAdmissionFilter(nullptr);
+    }
+    else if (partition->getAdmissionFilter() == nullptr) {
+      partition->setAdmissionFilter(make_unique<cs::TinyLfu>(options.nMaxPackets));
+    }
+  }
+}
+
 } // namespace nfd
@@ -28,6 +28,7 @@
 
 #include "fw/forwarder.hpp"
 #include "core/config-file.hpp"
+#include "table/table-arena.hpp"
 
 namespace nfd {
 
@@ -39,7 +40,10 @@ namespace nfd {
  *  {
  *    cs_max_packets 65536
  *    cs_policy lru
+ *    cs_admission tinylfu
  *    cs_unsolicited_policy drop-all
+ *    arena_page_mode transparent
+ *    arena_max_size 4096
  *
  *    strategy_choice
  *    {
@@ -54,14 +58,29 @@ namespace nfd {
  *      /example/region1
  *      /example/region2
  *    }
+ *
+ *    cs_partitions
+ *    {
+ *      /example/video
+ *      {
+ *        capacity 16384
+ *        policy lru
+ *        admission tinylfu
+ *      }
+ *    }
  *  }
  *  \endcode
  *
  *  During a configuration reload,
- *  \li cs_max_packets, cs_policy, and cs_unsolicited_policy are applied;
+ *  \li cs_max_packets, cs_policy, cs_admission, and cs_unsolicited_policy are applied;
+ *      defaults are used if an option is omitted.
+ *      An enabled admission filter keeps its frequency estimates unless cs_max_packets changes.
+ *  \li arena_page_mode and arena_max_size are applied to future table allocations;
  *      defaults are used if an option is omitted.
  *  \li strategy_choice entries are inserted, but old entries are not deleted.
  *  \li network_region is applied; it's kept unchanged if the section is omitted.
+ *  \li cs_partitions is applied: partitions that are no longer listed are erased together
+ *      with their Data, and a partition policy is changed only if the partition is empty.
  *
  *  It's necessary to call \p ensureConfigured() after initial configuration and
  *  configuration reload, so that the correct defaults are applied in case
@@ -85,12 +104,18 @@ private:
   void
   processConfig(const ConfigSection& section, bool isDryRun);
 
+  static TableArena::Options
+  parseArenaOptions(const ConfigSection& section);
+
   void
   processStrategyChoiceSection(const ConfigSection& section, bool isDryRun);
 
   void
   processNetworkRegionSection(const ConfigSection& section, bool isDryRun);
 
+  void
+  processCsPartitionsSection(const ConfigSection& section, bool isDryRun);
+
 private:
   static const size_t DEFAULT_CS_MAX_PACKETS;
 
@@ -138,7 +138,8 @@ Nfd::initializeManagement()
   m_authenticator = CommandAuthenticator::create();
 
   m_forwarderStatusManager = make_unique<ForwarderStatusManager>(*m_forwarder, *m_dispatcher);
-  m_faceManager = make_unique<FaceManager>(*m_faceSystem, *m_dispatcher, *m_authenticator);
+  m_faceManager = make_unique<FaceManager>(*m_faceSystem, *m_forwarder,
+                                           *m_dispatcher, *m_authenticator);
   m_fibManager = make_unique<FibManager>(m_forwarder->getFib(), m_forwarder->getFaceTable(),
                                          *m_dispatcher, *m_authenticator);
   m_csManager = make_unique<CsManager>(m_forwarder->getCs(), m_forwarder->getCounters(),
@@ -169,7 +170,8 @@ Nfd::initializeManagement()
 
   // add FIB entry for NFD Management Protocol
   Name topPrefix("/localhost/nfd");
-  m_forwarder->getFib().insert(topPrefix).first->addNextHop(*m_internalFace, 0);
+  Fib& fib = m_forwarder->getFib();
+  fib.addNextHop(*fib.insert(topPrefix).first, *m_internalFace, 0);
   m_dispatcher->addTopPrefix(topPrefix, false);
 }
 
@@ -0,0 +1,225 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cs-compressor.hpp"
+#include "core/config.hpp"
+
+#include <cmath>
+
+#ifdef HAVE_LIBZSTD
+#include <zstd.h>
+#endif // HAVE_LIBZSTD
+#ifdef HAVE_LIBLZ4
+#include <lz4.h>
+#endif // HAVE_LIBLZ4
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif // HAVE_ZLIB
+
+namespace nfd {
+namespace cs {
+
+constexpr size_t Compressor::ENTROPY_SAMPLE_SIZE;
+constexpr double Compressor::INCOMPRESSIBLE_ENTROPY;
+
+/** \brief scratch space for compression output, before it is copied into an exact-size buffer
+ *  \note Like the table arena, this is only used from the forwarding thread.
+ */
+static std::vector<uint8_t>&
+getScratch(size_t size)
+{
+  static std::vector<uint8_t> scratch;
+  if (scratch.size() < size) {
+    scratch.resize(size);
+  }
+  return scratch;
+}
+
+static bool
+assignIfSmaller(const std::vector<uint8_t>& scratch, size_t compressedSize, size_t inputSize,
+                CompressedBuffer& output)
+{
+  if (compressedSize >= inputSize) {
+    return false;
+  }
+  output.assign(scratch.begin(), scratch.begin() + compressedSize);
+  return true;
+}
+
+#ifdef HAVE_LIBZSTD
+class ZstdCompressor : public Compressor
+{
+public:
+  ZstdCompressor()
+    : Compressor("zstd")
+  {
+  }
+
+  bool
+  compress(const uint8_t* input, size_t inputSize, CompressedBuffer& output) const final
+  {
+    auto& scratch = getScratch(ZSTD_compressBound(inputSize));
+    size_t compressedSize = ZSTD_compress(scratch.data(), scratch.size(), input, inputSize, LEVEL);
+    return !ZSTD_isError(compressedSize) && assignIfSmaller(scratch, compressedSize, inputSize, output);
+  }
+
+  bool
+  decompress(const uint8_t* input, size_t inputSize, uint8_t* output, size_t outputSize) const final
+  {
+    size_t size = ZSTD_decompress(output, outputSize, input, inputSize);
+    return !ZSTD_isError(size) && size == outputSize;
+  }
+
+private:
+  /// fast levels favor hit latency over compression ratio
+  static constexpr int LEVEL = 1;
+};
+#endif // HAVE_LIBZSTD
+
+#ifdef HAVE_LIBLZ4
+class Lz4Compressor : public Compressor
+{
+public:
+  Lz4Compressor()
+    : Compressor("lz4")
+  {
+  }
+
+  bool
+  compress(const uint8_t* input, size_t inputSize, CompressedBuffer& output) const final
+  {
+    if (inputSize > LZ4_MAX_INPUT_SIZE) {
+      return false;
+    }
+    auto& scratch = getScratch(LZ4_compressBound(static_cast<int>(inputSize)));
+    int compressedSize = LZ4_compress_default(reinterpret_cast<const char*>(input),
+                                              reinterpret_cast<char*>(scratch.data()),
+                                              static_cast<int>(inputSize),
+                                              static_cast<int>(scratch.size()));
+    return compressedSize > 0 &&
+           assignIfSmaller(scratch, static_cast<size_t>(compressedSize), inputSize, output);
+  }
+
+  bool
+  decompress(const uint8_t* input, size_t inputSize, uint8_t* output, size_t outputSize) const final
+  {
+    int size = LZ4_decompress_safe(reinterpret_cast<const char*>(input),
+                                   reinterpret_cast<char*>(output),
+                                   static_cast<int>(inputSize), static_cast<int>(outputSize));
+    return size >= 0 && static_cast<size_t>(size) == outputSize;
+  }
+};
+#endif // HAVE_LIBLZ4
+
+#ifdef HAVE_ZLIB
+class ZlibCompressor : public Compressor
+{
+public:
+  ZlibCompressor()
+    : Compressor("zlib")
+  {
+  }
+
+  bool
+  compress(const uint8_t* input, size_t inputSize, CompressedBuffer& output) const final
+  {
+    uLongf compressedSize = compressBound(inputSize);
+    auto& scratch = getScratch(compressedSize);
+    int ret = compress2(scratch.data(), &compressedSize, input, inputSize, Z_BEST_SPEED);
+    return ret == Z_OK && assignIfSmaller(scratch, compressedSize, inputSize, output);
+  }
+
+  bool
+  decompress(const uint8_t* input, size_t inputSize, uint8_t* output, size_t outputSize) const final
+  {
+    uLongf size = outputSize;
+    int ret = uncompress(output, &size, input, inputSize);
+    return ret == Z_OK && size == outputSize;
+  }
+};
+#endif // HAVE_ZLIB
+
+unique_ptr<Compressor>
+Compressor::create(const std::string& codec)
+{
+#ifdef HAVE_LIBZSTD
+  if (codec == "zstd") {
+    return make_unique<ZstdCompressor>();
+  }
+#endif // HAVE_LIBZSTD
+#ifdef HAVE_LIBLZ4
+  if (codec == "lz4") {
+    return make_unique<Lz4Compressor>();
+  }
+#endif // HAVE_LIBLZ4
+#ifdef HAVE_ZLIB
+  if (codec == "zlib") {
+    return make_unique<ZlibCompressor>();
+  }
+#endif // HAVE_ZLIB
+  return nullptr;
+}
+
+std::set<std::string>
+Compressor::getCodecs()
+{
+  std::set<std::string> codecs;
+#ifdef HAVE_LIBZSTD
+  codecs.insert("zstd");
+#endif // HAVE_LIBZSTD
+#ifdef HAVE_LIBLZ4
+  codecs.insert("lz4");
+#endif // HAVE_LIBLZ4
+#ifdef HAVE_ZLIB
+  codecs.insert("zlib");
+#endif // HAVE_ZLIB
+  return codecs;
+}
+
+bool
+Compressor::isLikelyIncompressible(const uint8_t* buf, size_t size)
+{
+  // a shorter sample has a lower entropy even if it is random, so it is left to the codec
+  if (size < ENTROPY_SAMPLE_SIZE) {
+    return false;
+  }
+
+  std::array<uint16_t, 256> histogram{};
+  for (size_t i = 0; i < ENTROPY_SAMPLE_SIZE; ++i) {
+    ++histogram[buf[i]];
+  }
+
+  double entropy = 0.0;
+  for (uint16_t count : histogram) {
+    if (count > 0) {
+      double p = static_cast<double>(count) / ENTROPY_SAMPLE_SIZE;
+      entropy -= p * std::log2(p);
+    }
+  }
+  return entropy > INCOMPRESSIBLE_ENTROPY;
+}
+
+} // namespace cs
+} // namespace nfd
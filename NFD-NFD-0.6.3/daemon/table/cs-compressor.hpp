@@ -0,0 +1,110 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_COMPRESSOR_HPP
+#define NFD_DAEMON_TABLE_CS_COMPRESSOR_HPP
+
+#include "table-arena.hpp"
+
+namespace nfd {
+namespace cs {
+
+/** \brief storage of a compressed Data wire encoding
+ *
+ *  Small buffers are carved from the size classes of the table arena.
+ */
+using CompressedBuffer = std::vector<uint8_t, TableArenaAllocator<uint8_t>>;
+
+/** \brief compresses Data wire encodings of CS entries that are not recently used
+ *
+ *  Available codecs depend on the libraries found at configure time:
+ *  "zstd" (libzstd), "lz4" (liblz4), and "zlib" (zlib).
+ */
+class Compressor : noncopyable
+{
+public:
+  virtual
+  ~Compressor() = default;
+
+  /** \return a Compressor using \p codec, or nullptr if \p codec is unknown or unavailable
+   */
+  static unique_ptr<Compressor>
+  create(const std::string& codec);
+
+  /** \return codecs available in this build
+   */
+  static std::set<std::string>
+  getCodecs();
+
+  const std::string&
+  getCodec() const
+  {
+    return m_codec;
+  }
+
+  /** \brief compress \p inputSize octets at \p input into \p output
+   *  \return whether the codec succeeded and \p output is smaller than the input
+   */
+  virtual bool
+  compress(const uint8_t* input, size_t inputSize, CompressedBuffer& output) const = 0;
+
+  /** \brief decompress \p inputSize octets at \p input into exactly \p outputSize octets
+   *  \return whether the codec succeeded and produced exactly \p outputSize octets
+   */
+  virtual bool
+  decompress(const uint8_t* input, size_t inputSize, uint8_t* output, size_t outputSize) const = 0;
+
+  /** \brief estimate whether \p size octets at \p buf are already compressed or encrypted
+   *
+   *  The Shannon entropy of the byte distribution of a prefix of the buffer is computed;
+   *  compressed and encrypted payloads are close to 8 bits per octet.
+   */
+  static bool
+  isLikelyIncompressible(const uint8_t* buf, size_t size);
+
+public:
+  /** \brief number of octets examined by isLikelyIncompressible
+   */
+  static constexpr size_t ENTROPY_SAMPLE_SIZE = 512;
+
+  /** \brief entropy in bits per octet above which a sample is considered incompressible
+   */
+  static constexpr double INCOMPRESSIBLE_ENTROPY = 7.2;
+
+protected:
+  explicit
+  Compressor(const std::string& codec)
+    : m_codec(codec)
+  {
+  }
+
+private:
+  const std::string m_codec;
+};
+
+} // namespace cs
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CS_COMPRESSOR_HPP
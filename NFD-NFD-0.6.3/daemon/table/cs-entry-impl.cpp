@@ -54,7 +54,7 @@ EntryImpl::unsetUnsolicited()
 }
 
 int
-compareQueryWithData(const Name& queryName, const Data& data)
+compareQueryWithData(const Name& queryName, const Entry& data)
 {
   bool queryIsFullName = !queryName.empty() && queryName[-1].isImplicitSha256Digest();
 
@@ -75,7 +75,7 @@ compareQueryWithData(const Name& queryName, const Data& data)
 }
 
 int
-compareDataWithData(const Data& lhs, const Data& rhs)
+compareDataWithData(const Entry& lhs, const Entry& rhs)
 {
   int cmp = lhs.getName().compare(rhs.getName());
   if (cmp != 0) {
@@ -93,15 +93,15 @@ EntryImpl::operator<(const EntryImpl& other) const
       return m_queryName < other.m_queryName;
     }
     else {
-      return compareQueryWithData(m_queryName, other.getData()) < 0;
+      return compareQueryWithData(m_queryName, other) < 0;
     }
   }
   else {
     if (other.isQuery()) {
-      return compareQueryWithData(other.m_queryName, this->getData()) > 0;
+      return compareQueryWithData(other.m_queryName, *this) > 0;
     }
     else {
-      return compareDataWithData(this->getData(), other.getData()) < 0;
+      return compareDataWithData(*this, other) < 0;
     }
   }
 }
@@ -27,10 +27,13 @@
 #define NFD_DAEMON_TABLE_CS_ENTRY_IMPL_HPP
 
 #include "cs-entry.hpp"
+#include "cs-internal.hpp"
 
 namespace nfd {
 namespace cs {
 
+class Partition;
+
 /** \brief an Entry in ContentStore implementation
  *
  *  An Entry is either a stored Entry which contains a Data packet and related attributes,
@@ -58,12 +61,62 @@ public:
   bool
   operator<(const EntryImpl& other) const;
 
+public: // replacement policy
+  /** \brief intrusive links for the cleanup index of a replacement policy
+   *
+   *  A policy links entries into its cleanup queues through this hook, so that
+   *  moving or removing an entry is a constant-time pointer update.
+   *  \sa EntryQueue
+   */
+  struct PolicyHook
+  {
+    iterator prev;
+    iterator next;
+    uint8_t queue = 0; ///< ID of the queue this entry is linked into, 0 if not linked
+  };
+
+  /** \return intrusive hook for the replacement policy
+   *  \note The hook is not part of the ordering, so it can be modified on an entry in the Table.
+   */
+  PolicyHook&
+  getPolicyHook() const
+  {
+    return m_policyHook;
+  }
+
+  /** \return intrusive hook for the queue of uncompressed entries kept by the ContentStore
+   *  \sa Cs::setCompressor
+   */
+  PolicyHook&
+  getCompressionHook() const
+  {
+    return m_compressionHook;
+  }
+
+public: // partition
+  /** \return the partition whose replacement policy manages this entry
+   */
+  Partition*
+  getPartition() const
+  {
+    return m_partition;
+  }
+
+  void
+  setPartition(Partition* partition)
+  {
+    m_partition = partition;
+  }
+
 private:
   bool
   isQuery() const;
 
 private:
   Name m_queryName;
+  mutable PolicyHook m_policyHook;
+  mutable PolicyHook m_compressionHook;
+  Partition* m_partition = nullptr;
 };
 
 } // namespace cs
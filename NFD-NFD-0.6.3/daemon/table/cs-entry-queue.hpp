@@ -0,0 +1,167 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_ENTRY_QUEUE_HPP
+#define NFD_DAEMON_TABLE_CS_ENTRY_QUEUE_HPP
+
+#include "cs-entry-impl.hpp"
+
+namespace nfd {
+namespace cs {
+
+/** \brief a doubly linked list of Table iterators threaded through EntryImpl::PolicyHook
+ *
+ *  EntryQueue does not allocate: the links are stored in the entries themselves,
+ *  so that push, move, and erase are constant-time pointer updates.
+ *  An entry can be linked into at most one EntryQueue per hook at any moment.
+ *  Each EntryQueue using the same hook must have a distinct non-zero ID.
+ */
+class EntryQueue : noncopyable
+{
+public:
+  using HookAccessor = EntryImpl::PolicyHook& (EntryImpl::*)() const;
+
+  /** \param id queue ID
+   *  \param hook the hook of EntryImpl that links this queue, the policy hook by default
+   */
+  explicit
+  EntryQueue(uint8_t id, HookAccessor hook = &EntryImpl::getPolicyHook)
+    : m_id(id)
+    , m_hook(hook)
+    , m_size(0)
+  {
+    BOOST_ASSERT(id != 0);
+  }
+
+  bool
+  empty() const
+  {
+    return m_size == 0;
+  }
+
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  /** \return the entry at the front of the queue
+   *  \pre !empty()
+   */
+  iterator
+  front() const
+  {
+    BOOST_ASSERT(!this->empty());
+    return m_head;
+  }
+
+  /** \return whether \p i is linked into this queue
+   */
+  bool
+  contains(iterator i) const
+  {
+    return this->getHook(i).queue == m_id;
+  }
+
+  /** \brief links \p i at the back of the queue
+   *  \pre \p i is not linked into any queue
+   */
+  void
+  pushBack(iterator i)
+  {
+    EntryImpl::PolicyHook& hook = this->getHook(i);
+    BOOST_ASSERT(hook.queue == 0);
+
+    if (this->empty()) {
+      m_head = i;
+    }
+    else {
+      this->getHook(m_tail).next = i;
+      hook.prev = m_tail;
+    }
+    m_tail = i;
+    hook.queue = m_id;
+    ++m_size;
+  }
+
+  /** \brief unlinks \p i from the queue
+   *  \pre contains(i)
+   */
+  void
+  erase(iterator i)
+  {
+    EntryImpl::PolicyHook& hook = this->getHook(i);
+    BOOST_ASSERT(hook.queue == m_id);
+
+    if (m_size == 1) {
+      // nothing else is linked
+    }
+    else if (i == m_head) {
+      m_head = hook.next;
+    }
+    else if (i == m_tail) {
+      m_tail = hook.prev;
+    }
+    else {
+      this->getHook(hook.prev).next = hook.next;
+      this->getHook(hook.next).prev = hook.prev;
+    }
+    hook.queue = 0;
+    --m_size;
+  }
+
+  /** \brief moves \p i to the back of the queue
+   *  \pre contains(i)
+   */
+  void
+  moveToBack(iterator i)
+  {
+    BOOST_ASSERT(this->contains(i));
+    if (i == m_tail) {
+      return;
+    }
+    this->erase(i);
+    this->pushBack(i);
+  }
+
+private:
+  EntryImpl::PolicyHook&
+  getHook(iterator i) const
+  {
+    return ((*i).*m_hook)();
+  }
+
+private:
+  const uint8_t m_id;
+  const HookAccessor m_hook;
+  size_t m_size;
+  iterator m_head; ///< valid only if !empty()
+  iterator m_tail; ///< valid only if !empty()
+};
+
+} // namespace cs
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CS_ENTRY_QUEUE_HPP
@@ -28,10 +28,18 @@
 namespace nfd {
 namespace cs {
 
+const Data&
+Entry::getData() const
+{
+  BOOST_ASSERT(this->hasData() && !this->isCompressed());
+  return *m_data;
+}
+
 void
 Entry::setData(shared_ptr<const Data> data, bool isUnsolicited)
 {
   m_data = data;
+  m_compressed.reset();
   m_isUnsolicited = isUnsolicited;
 
   updateStaleTime();
@@ -48,21 +56,54 @@ void
 Entry::updateStaleTime()
 {
   BOOST_ASSERT(this->hasData());
-  m_staleTime = time::steady_clock::now() + time::milliseconds(m_data->getFreshnessPeriod());
+  time::milliseconds freshnessPeriod = m_compressed != nullptr ? m_compressed->freshnessPeriod :
+                                                                 m_data->getFreshnessPeriod();
+  m_staleTime = time::steady_clock::now() + freshnessPeriod;
+}
+
+/** \return whether \p interest carries a PublisherPublicKeyLocator selector
+ */
+static bool
+hasKeyLocatorSelector(const Interest& interest)
+{
+  const Block& wire = interest.wireEncode();
+  wire.parse();
+  auto selectors = wire.find(tlv::Selectors);
+  if (selectors == wire.elements_end()) {
+    return false;
+  }
+  selectors->parse();
+  // PublisherPublicKeyLocator is encoded as a KeyLocator element within Selectors
+  return selectors->find(tlv::KeyLocator) != selectors->elements_end();
 }
 
 bool
 Entry::canSatisfy(const Interest& interest) const
 {
   BOOST_ASSERT(this->hasData());
-  if (!interest.matchesData(*m_data)) {
-    return false;
+  if (m_compressed == nullptr) {
+    if (!interest.matchesData(*m_data)) {
+      return false;
+    }
+  }
+  else {
+    // apart from the KeyLocator selector, matching the Data is equivalent to matching its full name
+    if (!interest.matchesName(m_compressed->fullName)) {
+      return false;
+    }
   }
 
   if (interest.getMustBeFresh() == static_cast<int>(true) && this->isStale()) {
     return false;
   }
 
+  if (m_compressed != nullptr && hasKeyLocatorSelector(interest)) {
+    // the decoded Data is not kept, so that a lookup does not grow the memory usage of the entry
+    if (!interest.matchesData(*this->decodeCompressed())) {
+      return false;
+    }
+  }
+
   return true;
 }
 
@@ -70,9 +111,55 @@ void
 Entry::reset()
 {
   m_data.reset();
+  m_compressed.reset();
   m_isUnsolicited = false;
+  m_isIncompressible = false;
   m_staleTime = time::steady_clock::TimePoint();
 }
 
+bool
+Entry::compress(const Compressor& compressor)
+{
+  BOOST_ASSERT(this->hasData() && !this->isCompressed());
+  const Block& wire = m_data->wireEncode();
+
+  auto compressed = make_unique<CompressedData>();
+  if (!compressor.compress(wire.wire(), wire.size(), compressed->wire)) {
+    m_isIncompressible = true;
+    return false;
+  }
+
+  // the names must not share the buffer of the Data packet
+  compressed->name = m_data->getName().deepCopy();
+  compressed->fullName = m_data->getFullName().deepCopy();
+  compressed->freshnessPeriod = m_data->getFreshnessPeriod();
+  compressed->wireSize = wire.size();
+  compressed->compressor = &compressor;
+
+  m_compressed = std::move(compressed);
+  m_data.reset();
+  return true;
+}
+
+void
+Entry::decompress()
+{
+  BOOST_ASSERT(this->isCompressed());
+  m_data = this->decodeCompressed();
+  m_compressed.reset();
+}
+
+shared_ptr<const Data>
+Entry::decodeCompressed() const
+{
+  BOOST_ASSERT(this->isCompressed());
+  auto buffer = make_shared<ndn::Buffer>(m_compressed->wireSize);
+  bool ok = m_compressed->compressor->decompress(m_compressed->wire.data(), m_compressed->wire.size(),
+                                                 buffer->data(), buffer->size());
+  // the input was produced by the same compressor from a valid packet
+  BOOST_VERIFY(ok);
+  return make_shared<Data>(Block(buffer));
+}
+
 } // namespace cs
 } // namespace nfd
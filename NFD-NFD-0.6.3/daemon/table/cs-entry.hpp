@@ -26,7 +26,7 @@
 #ifndef NFD_DAEMON_TABLE_CS_ENTRY_HPP
 #define NFD_DAEMON_TABLE_CS_ENTRY_HPP
 
-#include "core/common.hpp"
+#include "cs-compressor.hpp"
 
 namespace nfd {
 namespace cs {
@@ -37,14 +37,11 @@ class Entry
 {
 public: // exposed through ContentStore enumeration
   /** \return the stored Data
-   *  \pre hasData()
+   *  \pre hasData() && !isCompressed()
+   *  \note A compressed entry must be restored with decompress() first.
    */
   const Data&
-  getData() const
-  {
-    BOOST_ASSERT(this->hasData());
-    return *m_data;
-  }
+  getData() const;
 
   /** \return Name of the stored Data
    *  \pre hasData()
@@ -53,7 +50,7 @@ public: // exposed through ContentStore enumeration
   getName() const
   {
     BOOST_ASSERT(this->hasData());
-    return m_data->getName();
+    return m_compressed != nullptr ? m_compressed->name : m_data->getName();
   }
 
   /** \return full name (including implicit digest) of the stored Data
@@ -63,7 +60,7 @@ public: // exposed through ContentStore enumeration
   getFullName() const
   {
     BOOST_ASSERT(this->hasData());
-    return m_data->getFullName();
+    return m_compressed != nullptr ? m_compressed->fullName : m_data->getFullName();
   }
 
   /** \return whether the stored Data is unsolicited
@@ -106,7 +103,7 @@ public: // used by generic ContentStore implementation
   bool
   hasData() const
   {
-    return m_data != nullptr;
+    return m_data != nullptr || m_compressed != nullptr;
   }
 
   /** \brief replaces the stored Data
@@ -133,9 +130,87 @@ public: // used by generic ContentStore implementation
   void
   reset();
 
+public: // compression
+  /** \return whether the wire encoding of the stored Data is kept compressed
+   */
+  bool
+  isCompressed() const
+  {
+    return m_compressed != nullptr;
+  }
+
+  /** \return whether the stored Data was found not to benefit from compression
+   */
+  bool
+  isIncompressible() const
+  {
+    return m_isIncompressible;
+  }
+
+  void
+  setIncompressible()
+  {
+    m_isIncompressible = true;
+  }
+
+  /** \brief replaces the stored Data with its wire encoding compressed by \p compressor
+   *  \pre hasData() && !isCompressed()
+   *  \return whether the Data has been compressed; if false, the entry is marked incompressible
+   *  \note \p compressor must outlive the compressed entry.
+   */
+  bool
+  compress(const Compressor& compressor);
+
+  /** \brief restores the stored Data from its compressed wire encoding
+   *  \pre isCompressed()
+   */
+  void
+  decompress();
+
+  /** \return size of the compressed wire encoding
+   *  \pre isCompressed()
+   */
+  size_t
+  getCompressedSize() const
+  {
+    BOOST_ASSERT(this->isCompressed());
+    return m_compressed->wire.size();
+  }
+
+  /** \return size of the wire encoding before compression
+   *  \pre isCompressed()
+   */
+  size_t
+  getUncompressedSize() const
+  {
+    BOOST_ASSERT(this->isCompressed());
+    return m_compressed->wireSize;
+  }
+
 private:
+  /** \brief decode the Data from the compressed wire encoding
+   */
+  shared_ptr<const Data>
+  decodeCompressed() const;
+
+private:
+  /** \brief Data attributes needed by lookups, and the compressed wire encoding
+   */
+  struct CompressedData
+  {
+    Name name;
+    Name fullName;
+    time::milliseconds freshnessPeriod;
+    size_t wireSize;
+    CompressedBuffer wire;
+    const Compressor* compressor;
+  };
+
+  /// the stored Data, unless it is compressed
   shared_ptr<const Data> m_data;
+  unique_ptr<CompressedData> m_compressed;
   bool m_isUnsolicited;
+  bool m_isIncompressible = false;
   time::steady_clock::TimePoint m_staleTime;
 };
 
@@ -30,14 +30,14 @@
 #ifndef NFD_DAEMON_TABLE_CS_INTERNAL_HPP
 #define NFD_DAEMON_TABLE_CS_INTERNAL_HPP
 
-#include "core/common.hpp"
+#include "table-arena.hpp"
 
 namespace nfd {
 namespace cs {
 
 class EntryImpl;
 
-typedef std::set<EntryImpl> Table;
+typedef std::set<EntryImpl, std::less<EntryImpl>, TableArenaAllocator<EntryImpl>> Table;
 typedef Table::const_iterator iterator;
 
 } // namespace cs
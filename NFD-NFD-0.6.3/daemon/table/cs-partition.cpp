@@ -0,0 +1,82 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cs-partition.hpp"
+#include "cs.hpp"
+
+namespace nfd {
+namespace cs {
+
+Partition::Partition(Cs& cs, const Name& prefix, unique_ptr<Policy> policy)
+  : m_cs(cs)
+  , m_prefix(prefix)
+{
+  this->setPolicyImpl(std::move(policy));
+}
+
+void
+Partition::setLimit(size_t nMaxPackets)
+{
+  m_policy->setLimit(nMaxPackets);
+  if (m_admissionFilter != nullptr) {
+    m_admissionFilter->setCapacity(nMaxPackets);
+  }
+  m_cs.afterLimitChange();
+}
+
+void
+Partition::setPolicy(unique_ptr<Policy> policy)
+{
+  BOOST_ASSERT(policy != nullptr);
+  BOOST_ASSERT(m_policy != nullptr);
+  size_t limit = m_policy->getLimit();
+  this->setPolicyImpl(std::move(policy));
+  m_policy->setLimit(limit);
+}
+
+void
+Partition::setPolicyImpl(unique_ptr<Policy> policy)
+{
+  m_policy = std::move(policy);
+  m_beforeEvictConnection = m_policy->beforeEvict.connect([this] (iterator it) {
+      ++nEvictions;
+      m_cs.beforeEvict(it);
+    });
+
+  m_policy->setCs(&m_cs);
+  BOOST_ASSERT(m_policy->getCs() == &m_cs);
+}
+
+void
+Partition::setAdmissionFilter(unique_ptr<TinyLfu> filter)
+{
+  m_admissionFilter = std::move(filter);
+  if (m_admissionFilter != nullptr) {
+    m_admissionFilter->setCapacity(m_policy->getLimit());
+  }
+}
+
+} // namespace cs
+} // namespace nfd
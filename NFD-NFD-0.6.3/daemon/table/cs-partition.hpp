@@ -0,0 +1,139 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_PARTITION_HPP
+#define NFD_DAEMON_TABLE_CS_PARTITION_HPP
+
+#include "cs-policy.hpp"
+#include "cs-tinylfu.hpp"
+#include "core/counter.hpp"
+
+namespace nfd {
+namespace cs {
+
+class Cs;
+
+/** \brief a partition of the Content Store
+ *
+ *  A partition holds Data whose Name is under its prefix, unless a partition with a longer
+ *  prefix exists. Each partition has its own capacity, replacement policy and admission filter,
+ *  so that Data in one namespace cannot evict Data of another namespace.
+ *  The partition of a Data packet is determined when the Data is inserted.
+ *
+ *  \sa Cs::addPartition
+ */
+class Partition : noncopyable
+{
+public:
+  Partition(Cs& cs, const Name& prefix, unique_ptr<Policy> policy);
+
+  /** \return name prefix of Data in this partition
+   */
+  const Name&
+  getPrefix() const
+  {
+    return m_prefix;
+  }
+
+  /** \return number of stored packets
+   */
+  size_t
+  size() const
+  {
+    return m_policy->getNEntries();
+  }
+
+  /** \return capacity (in number of packets)
+   */
+  size_t
+  getLimit() const
+  {
+    return m_policy->getLimit();
+  }
+
+  /** \brief change capacity (in number of packets)
+   */
+  void
+  setLimit(size_t nMaxPackets);
+
+  /** \return replacement policy
+   */
+  Policy*
+  getPolicy() const
+  {
+    return m_policy.get();
+  }
+
+  /** \brief change replacement policy
+   *  \pre size() == 0
+   */
+  void
+  setPolicy(unique_ptr<Policy> policy);
+
+  /** \return admission filter, or nullptr if every Data is admitted
+   */
+  TinyLfu*
+  getAdmissionFilter() const
+  {
+    return m_admissionFilter.get();
+  }
+
+  /** \brief change admission filter
+   *  \param filter the admission filter, or nullptr to admit every Data
+   *
+   *  The filter is resized to the capacity of this partition.
+   */
+  void
+  setAdmissionFilter(unique_ptr<TinyLfu> filter);
+
+private:
+  void
+  setPolicyImpl(unique_ptr<Policy> policy);
+
+public:
+  /** \brief lookups answered by an entry of this partition
+   */
+  PacketCounter nHits;
+
+  /** \brief lookups that found no match, and whose Interest Name falls into this partition
+   */
+  PacketCounter nMisses;
+
+  /** \brief entries evicted by the replacement policy of this partition
+   */
+  PacketCounter nEvictions;
+
+private:
+  Cs& m_cs;
+  Name m_prefix;
+  unique_ptr<Policy> m_policy;
+  unique_ptr<TinyLfu> m_admissionFilter;
+  signal::ScopedConnection m_beforeEvictConnection;
+};
+
+} // namespace cs
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CS_PARTITION_HPP
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /**
- * Copyright (c) 2014-2016,  Regents of the University of California,
+ * Copyright (c) 2014-2018,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -35,60 +35,56 @@ NFD_REGISTER_CS_POLICY(LruPolicy);
 
 LruPolicy::LruPolicy()
   : Policy(POLICY_NAME)
+  , m_queue(1)
 {
 }
 
 void
 LruPolicy::doAfterInsert(iterator i)
 {
-  this->insertToQueue(i, true);
+  m_queue.pushBack(i);
   this->evictEntries();
 }
 
 void
 LruPolicy::doAfterRefresh(iterator i)
 {
-  this->insertToQueue(i, false);
+  m_queue.moveToBack(i);
 }
 
 void
 LruPolicy::doBeforeErase(iterator i)
 {
-  m_queue.get<1>().erase(i);
+  m_queue.erase(i);
 }
 
 void
 LruPolicy::doBeforeUse(iterator i)
 {
-  this->insertToQueue(i, false);
+  m_queue.moveToBack(i);
+}
+
+optional<iterator>
+LruPolicy::doPeekVictim() const
+{
+  if (m_queue.empty()) {
+    return nullopt;
+  }
+  return m_queue.front();
 }
 
 void
 LruPolicy::evictEntries()
 {
   BOOST_ASSERT(this->getCs() != nullptr);
-  while (this->getCs()->size() > this->getLimit()) {
+  while (this->getNEntries() > this->getLimit()) {
     BOOST_ASSERT(!m_queue.empty());
     iterator i = m_queue.front();
-    m_queue.pop_front();
+    m_queue.erase(i);
     this->emitSignal(beforeEvict, i);
   }
 }
 
-void
-LruPolicy::insertToQueue(iterator i, bool isNewEntry)
-{
-  Queue::iterator it;
-  bool isNew = false;
-  // push_back only if iterator i does not exist
-  std::tie(it, isNew) = m_queue.push_back(i);
-
-  BOOST_ASSERT(isNew == isNewEntry);
-  if (!isNewEntry) {
-    m_queue.relocate(m_queue.end(), it);
-  }
-}
-
 } // namespace lru
 } // namespace cs
 } // namespace nfd
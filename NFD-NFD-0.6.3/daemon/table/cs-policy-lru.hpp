@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /**
- * Copyright (c) 2014-2016,  Regents of the University of California,
+ * Copyright (c) 2014-2018,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -27,39 +27,20 @@
 #define NFD_DAEMON_TABLE_CS_POLICY_LRU_HPP
 
 #include "cs-policy.hpp"
-
-#include <boost/multi_index_container.hpp>
-#include <boost/multi_index/sequenced_index.hpp>
-#include <boost/multi_index/hashed_index.hpp>
+#include "cs-entry-queue.hpp"
 
 namespace nfd {
 namespace cs {
 namespace lru {
 
-struct EntryItComparator
-{
-  bool
-  operator()(const iterator& a, const iterator& b) const
-  {
-    return *a < *b;
-  }
-};
-
-typedef boost::multi_index_container<
-    iterator,
-    boost::multi_index::indexed_by<
-      boost::multi_index::sequenced<>,
-      boost::multi_index::ordered_unique<
-        boost::multi_index::identity<iterator>, EntryItComparator
-      >
-    >
-  > Queue;
-
 /** \brief LRU cs replacement policy
  *
  * The least recently used entries get removed first.
  * Everytime when any entry is used or refreshed, Policy should witness the usage
  * of it.
+ *
+ * The queue is linked through the entries themselves (see EntryQueue),
+ * so that insertion, usage, and eviction are O(1) and do not allocate.
  */
 class LruPolicy : public Policy
 {
@@ -82,17 +63,14 @@ private:
   virtual void
   doBeforeUse(iterator i) override;
 
+  virtual optional<iterator>
+  doPeekVictim() const override;
+
   virtual void
   evictEntries() override;
 
 private:
-  /** \brief moves an entry to the end of queue
-   */
-  void
-  insertToQueue(iterator i, bool isNewEntry);
-
-private:
-  Queue m_queue;
+  EntryQueue m_queue;
 };
 
 } // namespace lru
@@ -71,12 +71,23 @@ PriorityFifoPolicy::doBeforeUse(iterator i)
   BOOST_ASSERT(m_entryInfoMap.find(i) != m_entryInfoMap.end());
 }
 
+optional<iterator>
+PriorityFifoPolicy::doPeekVictim() const
+{
+  for (const Queue& queue : m_queues) {
+    if (!queue.empty()) {
+      return queue.front();
+    }
+  }
+  return nullopt;
+}
+
 void
 PriorityFifoPolicy::evictEntries()
 {
   BOOST_ASSERT(this->getCs() != nullptr);
 
-  while (this->getCs()->size() > this->getLimit()) {
+  while (this->getNEntries() > this->getLimit()) {
     this->evictOne();
   }
 }
@@ -99,6 +99,9 @@ private:
   void
   doBeforeUse(iterator i) override;
 
+  optional<iterator>
+  doPeekVictim() const override;
+
   void
   evictEntries() override;
 
@@ -0,0 +1,134 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cs-policy-slru.hpp"
+#include "cs.hpp"
+
+namespace nfd {
+namespace cs {
+namespace slru {
+
+const std::string SlruPolicy::POLICY_NAME = "slru";
+NFD_REGISTER_CS_POLICY(SlruPolicy);
+
+const size_t SlruPolicy::PROTECTED_PERCENT = 80;
+
+SlruPolicy::SlruPolicy()
+  : Policy(POLICY_NAME)
+  , m_probation(1)
+  , m_protected(2)
+{
+}
+
+void
+SlruPolicy::doAfterInsert(iterator i)
+{
+  m_probation.pushBack(i);
+  this->evictEntries();
+}
+
+void
+SlruPolicy::doAfterRefresh(iterator i)
+{
+  this->touch(i);
+}
+
+void
+SlruPolicy::doBeforeErase(iterator i)
+{
+  if (m_protected.contains(i)) {
+    m_protected.erase(i);
+  }
+  else {
+    m_probation.erase(i);
+  }
+}
+
+void
+SlruPolicy::doBeforeUse(iterator i)
+{
+  this->touch(i);
+}
+
+optional<iterator>
+SlruPolicy::doPeekVictim() const
+{
+  const EntryQueue& queue = m_probation.empty() ? m_protected : m_probation;
+  if (queue.empty()) {
+    return nullopt;
+  }
+  return queue.front();
+}
+
+void
+SlruPolicy::evictEntries()
+{
+  BOOST_ASSERT(this->getCs() != nullptr);
+
+  // limit may have been lowered
+  this->shrinkProtected();
+
+  while (this->getNEntries() > this->getLimit()) {
+    EntryQueue& queue = m_probation.empty() ? m_protected : m_probation;
+    BOOST_ASSERT(!queue.empty());
+    iterator i = queue.front();
+    queue.erase(i);
+    this->emitSignal(beforeEvict, i);
+  }
+}
+
+void
+SlruPolicy::touch(iterator i)
+{
+  if (m_protected.contains(i)) {
+    m_protected.moveToBack(i);
+    return;
+  }
+
+  m_probation.erase(i);
+  m_protected.pushBack(i);
+  this->shrinkProtected();
+}
+
+void
+SlruPolicy::shrinkProtected()
+{
+  size_t protectedLimit = this->getProtectedLimit();
+  while (m_protected.size() > protectedLimit) {
+    iterator i = m_protected.front();
+    m_protected.erase(i);
+    m_probation.pushBack(i);
+  }
+}
+
+size_t
+SlruPolicy::getProtectedLimit() const
+{
+  return this->getLimit() / 100 * PROTECTED_PERCENT + this->getLimit() % 100 * PROTECTED_PERCENT / 100;
+}
+
+} // namespace slru
+} // namespace cs
+} // namespace nfd
@@ -0,0 +1,107 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_POLICY_SLRU_HPP
+#define NFD_DAEMON_TABLE_CS_POLICY_SLRU_HPP
+
+#include "cs-policy.hpp"
+#include "cs-entry-queue.hpp"
+
+namespace nfd {
+namespace cs {
+namespace slru {
+
+/** \brief Segmented LRU cs replacement policy
+ *
+ *  This policy splits the cache into a probationary segment and a protected segment,
+ *  each ordered by recency of use.
+ *  A new entry is placed into the probationary segment.
+ *  An entry that is used while in the probationary segment is promoted into the protected segment.
+ *  When the protected segment exceeds its share of the limit, its least recently used entry
+ *  is demoted to the most recently used end of the probationary segment.
+ *  Eviction takes the least recently used entry of the probationary segment first,
+ *  so that a scan of Data that are never requested again cannot flush the protected segment.
+ *
+ *  Both segments are linked through the entries themselves (see EntryQueue),
+ *  so that every operation is O(1) and does not allocate.
+ */
+class SlruPolicy : public Policy
+{
+public:
+  SlruPolicy();
+
+public:
+  static const std::string POLICY_NAME;
+
+  /** \brief share of the limit reserved for the protected segment, in percent
+   */
+  static const size_t PROTECTED_PERCENT;
+
+private:
+  void
+  doAfterInsert(iterator i) override;
+
+  void
+  doAfterRefresh(iterator i) override;
+
+  void
+  doBeforeErase(iterator i) override;
+
+  void
+  doBeforeUse(iterator i) override;
+
+  optional<iterator>
+  doPeekVictim() const override;
+
+  void
+  evictEntries() override;
+
+private:
+  /** \brief moves an entry to the most recently used end of the protected segment
+   */
+  void
+  touch(iterator i);
+
+  /** \brief demotes entries from the protected segment until it fits in its share
+   */
+  void
+  shrinkProtected();
+
+  size_t
+  getProtectedLimit() const;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  EntryQueue m_probation;
+  EntryQueue m_protected;
+};
+
+} // namespace slru
+
+using slru::SlruPolicy;
+
+} // namespace cs
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CS_POLICY_SLRU_HPP
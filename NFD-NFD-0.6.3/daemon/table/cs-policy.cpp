@@ -61,7 +61,12 @@ Policy::getPolicyNames()
 
 Policy::Policy(const std::string& policyName)
   : m_policyName(policyName)
+  , m_nEntries(0)
 {
+  m_beforeEvictConnection = beforeEvict.connect([this] (iterator) {
+    BOOST_ASSERT(m_nEntries > 0);
+    --m_nEntries;
+  });
 }
 
 void
@@ -76,6 +81,7 @@ void
 Policy::afterInsert(iterator i)
 {
   BOOST_ASSERT(m_cs != nullptr);
+  ++m_nEntries;
   this->doAfterInsert(i);
 }
 
@@ -90,6 +96,8 @@ void
 Policy::beforeErase(iterator i)
 {
   BOOST_ASSERT(m_cs != nullptr);
+  BOOST_ASSERT(m_nEntries > 0);
+  --m_nEntries;
   this->doBeforeErase(i);
 }
 
@@ -100,5 +108,12 @@ Policy::beforeUse(iterator i)
   this->doBeforeUse(i);
 }
 
+optional<iterator>
+Policy::peekVictim() const
+{
+  BOOST_ASSERT(m_cs != nullptr);
+  return this->doPeekVictim();
+}
+
 } // namespace cs
 } // namespace nfd
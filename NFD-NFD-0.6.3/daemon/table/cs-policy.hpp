@@ -94,6 +94,15 @@ public:
   void
   setLimit(size_t nMaxEntries);
 
+  /** \brief gets number of entries in the cleanup index of this policy
+   *
+   *  This counts entries that have been inserted and not yet erased or evicted.
+   *  A policy implementation should compare this, not the CS size, with the hard limit,
+   *  because a CS may divide its entries among several policies.
+   */
+  size_t
+  getNEntries() const;
+
   /** \brief emits when an entry is being evicted
    *
    *  A policy implementation should emit this signal to cause CS to erase the entry from its index.
@@ -130,6 +139,14 @@ public:
   void
   beforeUse(iterator i);
 
+  /** \brief gets the entry that would be evicted next
+   *  \retval nullopt the policy has no entry to evict
+   *
+   *  CS invokes this method to let an admission filter compare a new entry with the victim.
+   */
+  optional<iterator>
+  peekVictim() const;
+
 protected:
   /** \brief invoked after a new entry is created in CS
    *
@@ -167,6 +184,14 @@ protected:
   virtual void
   doBeforeUse(iterator i) = 0;
 
+  /** \brief gets the entry that would be evicted next
+   *
+   *  When overridden in a subclass, a policy implementation should return the entry that
+   *  \p evictEntries would evict first, without changing its cleanup index.
+   */
+  virtual optional<iterator>
+  doPeekVictim() const = 0;
+
   /** \brief evicts zero or more entries
    *  \post CS size does not exceed hard limit
    */
@@ -187,6 +212,8 @@ private:
   std::string m_policyName;
   size_t m_limit;
   Cs* m_cs;
+  size_t m_nEntries;
+  signal::ScopedConnection m_beforeEvictConnection;
 };
 
 inline const std::string&
@@ -213,6 +240,12 @@ Policy::getLimit() const
   return m_limit;
 }
 
+inline size_t
+Policy::getNEntries() const
+{
+  return m_nEntries;
+}
+
 } // namespace cs
 } // namespace nfd
 
@@ -0,0 +1,180 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cs-tinylfu.hpp"
+
+#include <algorithm>
+
+namespace nfd {
+namespace cs {
+
+constexpr size_t TinyLfu::SKETCH_DEPTH;
+constexpr uint8_t TinyLfu::MAX_COUNT;
+constexpr size_t TinyLfu::SAMPLES_PER_ENTRY;
+
+static size_t
+roundUpToPowerOfTwo(size_t n)
+{
+  size_t p = 1;
+  while (p < n) {
+    p <<= 1;
+  }
+  return p;
+}
+
+TinyLfu::TinyLfu(size_t capacity)
+  : m_capacity(0)
+  , m_nAdmitted(0)
+  , m_nRejected(0)
+{
+  this->setCapacity(capacity);
+}
+
+void
+TinyLfu::setCapacity(size_t capacity)
+{
+  if (capacity == m_capacity && !m_sketch.empty()) {
+    return;
+  }
+
+  m_capacity = capacity;
+  m_width = roundUpToPowerOfTwo(std::max<size_t>(capacity, 64));
+  m_sketch.assign(SKETCH_DEPTH * m_width, 0);
+
+  // 8 bits per counter column keeps the doorkeeper false positive rate low at full capacity
+  m_nDoorkeeperBits = m_width * 8;
+  m_doorkeeper.assign(m_nDoorkeeperBits / 64, 0);
+
+  m_sampleSize = std::max<size_t>(capacity, 1) * SAMPLES_PER_ENTRY;
+  m_nSamples = 0;
+}
+
+uint64_t
+TinyLfu::hashName(const Name& name)
+{
+  // std::hash<Name> is not well mixed in its high bits, so it is finalized as in SplitMix64
+  uint64_t h = std::hash<Name>()(name);
+  h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+  return h ^ (h >> 31);
+}
+
+size_t
+TinyLfu::getSketchIndex(uint64_t hash, size_t row) const
+{
+  // double hashing: row i probes h1 + i * h2, with an odd h2
+  uint64_t h1 = hash;
+  uint64_t h2 = (hash >> 32) | 1;
+  return row * m_width + static_cast<size_t>((h1 + row * h2) & (m_width - 1));
+}
+
+size_t
+TinyLfu::getDoorkeeperIndex(uint64_t hash, size_t i) const
+{
+  uint64_t h = i == 0 ? hash : (hash >> 32) ^ (hash << 17);
+  return static_cast<size_t>(h & (m_nDoorkeeperBits - 1));
+}
+
+bool
+TinyLfu::isInDoorkeeper(uint64_t hash) const
+{
+  for (size_t i = 0; i < 2; ++i) {
+    size_t bit = this->getDoorkeeperIndex(hash, i);
+    if ((m_doorkeeper[bit / 64] & (uint64_t(1) << (bit % 64))) == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t
+TinyLfu::getSketchCount(uint64_t hash) const
+{
+  uint8_t count = MAX_COUNT;
+  for (size_t row = 0; row < SKETCH_DEPTH; ++row) {
+    count = std::min(count, m_sketch[this->getSketchIndex(hash, row)]);
+  }
+  return count;
+}
+
+void
+TinyLfu::recordAccess(const Name& name)
+{
+  uint64_t hash = hashName(name);
+
+  if (!this->isInDoorkeeper(hash)) {
+    for (size_t i = 0; i < 2; ++i) {
+      size_t bit = this->getDoorkeeperIndex(hash, i);
+      m_doorkeeper[bit / 64] |= uint64_t(1) << (bit % 64);
+    }
+  }
+  else {
+    // conservative update: only the smallest counters are incremented
+    size_t count = this->getSketchCount(hash);
+    if (count < MAX_COUNT) {
+      for (size_t row = 0; row < SKETCH_DEPTH; ++row) {
+        uint8_t& counter = m_sketch[this->getSketchIndex(hash, row)];
+        if (counter == count) {
+          ++counter;
+        }
+      }
+    }
+  }
+
+  if (++m_nSamples >= m_sampleSize) {
+    this->age();
+  }
+}
+
+size_t
+TinyLfu::estimate(const Name& name) const
+{
+  uint64_t hash = hashName(name);
+  return this->getSketchCount(hash) + (this->isInDoorkeeper(hash) ? 1 : 0);
+}
+
+bool
+TinyLfu::admit(const Name& candidate, const Name& victim)
+{
+  if (this->estimate(candidate) > this->estimate(victim)) {
+    ++m_nAdmitted;
+    return true;
+  }
+  ++m_nRejected;
+  return false;
+}
+
+void
+TinyLfu::age()
+{
+  for (uint8_t& counter : m_sketch) {
+    counter >>= 1;
+  }
+  std::fill(m_doorkeeper.begin(), m_doorkeeper.end(), 0);
+  m_nSamples /= 2;
+}
+
+} // namespace cs
+} // namespace nfd
@@ -0,0 +1,149 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_TINYLFU_HPP
+#define NFD_DAEMON_TABLE_CS_TINYLFU_HPP
+
+#include "core/common.hpp"
+
+namespace nfd {
+namespace cs {
+
+/** \brief TinyLFU admission filter
+ *
+ *  This filter estimates how often each Name has been accessed recently, and admits a new
+ *  entry into a full CS only if the new entry is estimated to be more popular than the entry
+ *  that the replacement policy would evict.
+ *
+ *  Frequencies are kept in a count-min sketch of 4-bit saturating counters. The first access
+ *  to a Name only sets its bits in a doorkeeper Bloom filter, so that Names accessed once do not
+ *  occupy the sketch. After a number of accesses proportional to the capacity, all counters are
+ *  halved and the doorkeeper is cleared, so that the estimates follow changes in popularity.
+ */
+class TinyLfu : noncopyable
+{
+public:
+  /** \param capacity number of entries in the CS
+   */
+  explicit
+  TinyLfu(size_t capacity);
+
+  /** \brief resize for a new CS capacity
+   *
+   *  If \p capacity differs from the current capacity, all frequency estimates are cleared.
+   */
+  void
+  setCapacity(size_t capacity);
+
+  /** \brief record an access to \p name
+   */
+  void
+  recordAccess(const Name& name);
+
+  /** \return estimated number of recent accesses to \p name
+   */
+  size_t
+  estimate(const Name& name) const;
+
+  /** \brief decide whether \p candidate should replace \p victim
+   *  \return whether \p candidate is estimated to be more popular than \p victim
+   */
+  bool
+  admit(const Name& candidate, const Name& victim);
+
+  /** \return number of candidates admitted by \c admit
+   */
+  uint64_t
+  getNAdmitted() const
+  {
+    return m_nAdmitted;
+  }
+
+  /** \return number of candidates rejected by \c admit
+   */
+  uint64_t
+  getNRejected() const
+  {
+    return m_nRejected;
+  }
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** \brief number of rows in the sketch
+   */
+  static constexpr size_t SKETCH_DEPTH = 4;
+
+  /** \brief saturation value of a sketch counter
+   */
+  static constexpr uint8_t MAX_COUNT = 15;
+
+  /** \brief number of accesses between two agings, per entry of capacity
+   */
+  static constexpr size_t SAMPLES_PER_ENTRY = 10;
+
+  /** \brief halve all counters and clear the doorkeeper
+   */
+  void
+  age();
+
+  size_t
+  getSampleSize() const
+  {
+    return m_sampleSize;
+  }
+
+private:
+  static uint64_t
+  hashName(const Name& name);
+
+  size_t
+  getSketchIndex(uint64_t hash, size_t row) const;
+
+  size_t
+  getDoorkeeperIndex(uint64_t hash, size_t i) const;
+
+  bool
+  isInDoorkeeper(uint64_t hash) const;
+
+  size_t
+  getSketchCount(uint64_t hash) const;
+
+private:
+  size_t m_capacity;
+  size_t m_width; ///< counters per row, a power of two
+  std::vector<uint8_t> m_sketch; ///< SKETCH_DEPTH rows of m_width counters
+  std::vector<uint64_t> m_doorkeeper;
+  size_t m_nDoorkeeperBits; ///< a power of two
+
+  size_t m_sampleSize;
+  size_t m_nSamples;
+
+  uint64_t m_nAdmitted;
+  uint64_t m_nRejected;
+};
+
+} // namespace cs
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CS_TINYLFU_HPP
@@ -37,6 +37,8 @@ NDN_CXX_ASSERT_FORWARD_ITERATOR(Cs::const_iterator);
 
 NFD_LOG_INIT(ContentStore);
 
+constexpr size_t Cs::DEFAULT_HOT_PERCENT;
+
 static unique_ptr<Policy>
 makeDefaultPolicy()
 {
@@ -44,17 +46,26 @@ makeDefaultPolicy()
 }
 
 Cs::Cs(size_t nMaxPackets)
-  : m_shouldAdmit(true)
+  : m_hotPercent(DEFAULT_HOT_PERCENT)
+  , m_hotEntries(1, &EntryImpl::getCompressionHook)
+  , m_nCompressedEntries(0)
+  , m_nCompressedBytes(0)
+  , m_nUncompressedBytes(0)
+  , m_shouldAdmit(true)
   , m_shouldServe(true)
 {
-  this->setPolicyImpl(makeDefaultPolicy());
-  m_policy->setLimit(nMaxPackets);
+  m_defaultPartition = make_unique<Partition>(*this, Name(), makeDefaultPolicy());
+  m_defaultPartition->getPolicy()->setLimit(nMaxPackets);
 }
 
 void
 Cs::insert(const Data& data, bool isUnsolicited)
 {
-  if (!m_shouldAdmit || m_policy->getLimit() == 0) {
+  if (!m_shouldAdmit) {
+    return;
+  }
+  Partition* partition = &this->findPartition(data.getName());
+  if (partition->getLimit() == 0) {
     return;
   }
   NFD_LOG_DEBUG("insert " << data.getName());
@@ -73,18 +84,52 @@ Cs::insert(const Data& data, bool isUnsolicited)
   std::tie(it, isNewEntry) = m_table.emplace(data.shared_from_this(), isUnsolicited);
   EntryImpl& entry = const_cast<EntryImpl&>(*it);
 
+  if (isNewEntry) {
+    entry.setPartition(partition);
+  }
+  else {
+    // an existing entry stays in the partition that admitted it
+    partition = entry.getPartition();
+  }
+  Policy* policy = partition->getPolicy();
+  TinyLfu* admissionFilter = partition->getAdmissionFilter();
+
+  if (isNewEntry && admissionFilter != nullptr) {
+    admissionFilter->recordAccess(data.getName());
+
+    // the new entry would cause an eviction: compare it with the victim
+    optional<iterator> victim;
+    if (partition->size() >= partition->getLimit()) {
+      victim = policy->peekVictim();
+    }
+    if (victim && !admissionFilter->admit(data.getName(), (*victim)->getName())) {
+      NFD_LOG_DEBUG("  not-admitted victim=" << (*victim)->getName());
+      // the policy has not seen the new entry yet
+      m_table.erase(it);
+      return;
+    }
+  }
+
   entry.updateStaleTime();
 
+  if (m_compressor != nullptr) {
+    if (isNewEntry && Compressor::isLikelyIncompressible(data.getContent().value(),
+                                                         data.getContent().value_size())) {
+      entry.setIncompressible();
+    }
+    this->makeHot(it);
+  }
+
   if (!isNewEntry) { // existing entry
     // XXX This doesn't forbid unsolicited Data from refreshing a solicited entry.
     if (entry.isUnsolicited() && !isUnsolicited) {
       entry.unsetUnsolicited();
     }
 
-    m_policy->afterRefresh(it);
+    policy->afterRefresh(it);
   }
   else {
-    m_policy->afterInsert(it);
+    policy->afterInsert(it);
   }
 }
 
@@ -101,7 +146,8 @@ Cs::erase(const Name& prefix, size_t limit, const AfterEraseCallback& cb)
 
   size_t nErased = 0;
   while (first != last && nErased < limit) {
-    m_policy->beforeErase(first);
+    first->getPartition()->getPolicy()->beforeErase(first);
+    this->beforeRemove(first);
     first = m_table.erase(first);
     ++nErased;
   }
@@ -119,7 +165,7 @@ Cs::find(const Interest& interest,
   BOOST_ASSERT(static_cast<bool>(hitCallback));
   BOOST_ASSERT(static_cast<bool>(missCallback));
 
-  if (!m_shouldServe || m_policy->getLimit() == 0) {
+  if (!m_shouldServe) {
     missCallback(interest);
     return;
   }
@@ -141,16 +187,47 @@ Cs::find(const Interest& interest,
     match = this->findLeftmost(interest, first, last);
   }
 
+  // the admission filter estimates the popularity of Data names, which is what insert()
+  // compares; the Interest name is only recorded when there is no Data to attribute it to
   if (match == last) {
     NFD_LOG_DEBUG("  no-match");
+    Partition& partition = this->findPartition(prefix);
+    if (partition.getAdmissionFilter() != nullptr) {
+      partition.getAdmissionFilter()->recordAccess(prefix);
+    }
+    ++partition.nMisses;
     missCallback(interest);
     return;
   }
   NFD_LOG_DEBUG("  matching " << match->getName());
-  m_policy->beforeUse(match);
+  Partition& matchPartition = *match->getPartition();
+  if (matchPartition.getAdmissionFilter() != nullptr) {
+    matchPartition.getAdmissionFilter()->recordAccess(match->getName());
+  }
+  ++matchPartition.nHits;
+  matchPartition.getPolicy()->beforeUse(match);
+  if (m_compressor != nullptr) {
+    this->makeHot(match);
+  }
   hitCallback(interest, match->getData());
 }
 
+bool
+Cs::contains(const Interest& interest) const
+{
+  if (!m_shouldServe) {
+    return false;
+  }
+
+  const Name& prefix = interest.getName();
+  iterator first = m_table.lower_bound(prefix);
+  iterator last = m_table.end();
+  if (prefix.size() > 0) {
+    last = m_table.lower_bound(prefix.getSuccessor());
+  }
+  return this->findLeftmost(interest, first, last) != last;
+}
+
 iterator
 Cs::findLeftmost(const Interest& interest, iterator first, iterator last) const
 {
@@ -207,24 +284,202 @@ Cs::dump()
 void
 Cs::setPolicy(unique_ptr<Policy> policy)
 {
+  NFD_LOG_DEBUG("set-policy " << policy->getName());
+  m_defaultPartition->setPolicy(std::move(policy));
+}
+
+void
+Cs::setLimit(size_t nMaxPackets)
+{
+  m_defaultPartition->setLimit(nMaxPackets);
+}
+
+void
+Cs::setAdmissionFilter(unique_ptr<TinyLfu> filter)
+{
+  NFD_LOG_DEBUG("set-admission-filter " << (filter == nullptr ? "none" : "tinylfu"));
+  m_defaultPartition->setAdmissionFilter(std::move(filter));
+}
+
+Partition*
+Cs::getPartition(const Name& prefix) const
+{
+  if (prefix.empty()) {
+    return m_defaultPartition.get();
+  }
+  auto it = m_partitions.find(prefix);
+  return it == m_partitions.end() ? nullptr : it->second.get();
+}
+
+Partition&
+Cs::addPartition(const Name& prefix, size_t nMaxPackets, unique_ptr<Policy> policy)
+{
+  BOOST_ASSERT(!prefix.empty());
   BOOST_ASSERT(policy != nullptr);
-  BOOST_ASSERT(m_policy != nullptr);
-  size_t limit = m_policy->getLimit();
-  this->setPolicyImpl(std::move(policy));
-  m_policy->setLimit(limit);
+  NFD_LOG_DEBUG("add-partition " << prefix << " limit=" << nMaxPackets << " policy=" << policy->getName());
+
+  auto partition = make_unique<Partition>(*this, prefix, std::move(policy));
+  Partition& result = *partition;
+  bool isNew = m_partitions.emplace(prefix, std::move(partition)).second;
+  BOOST_ASSERT(isNew);
+  result.setLimit(nMaxPackets);
+  return result;
 }
 
 void
-Cs::setPolicyImpl(unique_ptr<Policy> policy)
+Cs::erasePartition(const Name& prefix)
 {
-  NFD_LOG_DEBUG("set-policy " << policy->getName());
-  m_policy = std::move(policy);
-  m_beforeEvictConnection = m_policy->beforeEvict.connect([this] (iterator it) {
-      m_table.erase(it);
-    });
+  BOOST_ASSERT(!prefix.empty());
+  auto partitionIt = m_partitions.find(prefix);
+  if (partitionIt == m_partitions.end()) {
+    return;
+  }
+  NFD_LOG_DEBUG("erase-partition " << prefix);
+
+  // entries of a partition are under its prefix, but may share it with a longer partition
+  Partition* partition = partitionIt->second.get();
+  iterator first = m_table.lower_bound(prefix);
+  iterator last = m_table.lower_bound(prefix.getSuccessor());
+  while (first != last) {
+    if (first->getPartition() != partition) {
+      ++first;
+      continue;
+    }
+    partition->getPolicy()->beforeErase(first);
+    this->beforeRemove(first);
+    first = m_table.erase(first);
+  }
+  BOOST_ASSERT(partition->size() == 0);
+
+  m_partitions.erase(partitionIt);
+  this->afterLimitChange();
+}
+
+Partition&
+Cs::findPartition(const Name& name) const
+{
+  if (m_partitions.empty()) {
+    return *m_defaultPartition;
+  }
+
+  // longest prefix match: at most name.size()+1 lookups, regardless of the partitions
+  // that sort between the matching prefix and name
+  for (ssize_t prefixLen = name.size(); prefixLen >= 0; --prefixLen) {
+    auto it = m_partitions.find(name.getPrefix(prefixLen));
+    if (it != m_partitions.end()) {
+      return *it->second;
+    }
+  }
+  return *m_defaultPartition;
+}
 
-  m_policy->setCs(this);
-  BOOST_ASSERT(m_policy->getCs() == this);
+void
+Cs::beforeEvict(iterator it)
+{
+  this->beforeRemove(it);
+  m_table.erase(it);
+}
+
+void
+Cs::afterLimitChange()
+{
+  if (m_compressor != nullptr) {
+    this->compressColdEntries();
+  }
+}
+
+void
+Cs::setCompressor(unique_ptr<Compressor> compressor)
+{
+  NFD_LOG_DEBUG("set-compressor " << (compressor == nullptr ? "none" : compressor->getCodec()));
+  for (iterator it = m_table.begin(); it != m_table.end(); ++it) {
+    this->beforeRemove(it);
+    if (it->isCompressed()) {
+      const_cast<EntryImpl&>(*it).decompress();
+    }
+  }
+  BOOST_ASSERT(m_hotEntries.empty() && m_nCompressedEntries == 0);
+  m_compressor = std::move(compressor);
+}
+
+void
+Cs::setHotPercent(size_t hotPercent)
+{
+  m_hotPercent = hotPercent;
+  if (m_compressor != nullptr) {
+    this->compressColdEntries();
+  }
+}
+
+void
+Cs::makeHot(iterator it) const
+{
+  BOOST_ASSERT(m_compressor != nullptr);
+  if (it->isCompressed()) {
+    this->decompress(it);
+  }
+  if (it->isIncompressible()) {
+    return;
+  }
+
+  if (m_hotEntries.contains(it)) {
+    m_hotEntries.moveToBack(it);
+  }
+  else {
+    m_hotEntries.pushBack(it);
+  }
+  this->compressColdEntries();
+}
+
+void
+Cs::decompress(iterator it) const
+{
+  --m_nCompressedEntries;
+  m_nCompressedBytes -= it->getCompressedSize();
+  m_nUncompressedBytes -= it->getUncompressedSize();
+  const_cast<EntryImpl&>(*it).decompress();
+}
+
+void
+Cs::beforeRemove(iterator it) const
+{
+  if (m_hotEntries.contains(it)) {
+    m_hotEntries.erase(it);
+  }
+  else if (it->isCompressed()) {
+    --m_nCompressedEntries;
+    m_nCompressedBytes -= it->getCompressedSize();
+    m_nUncompressedBytes -= it->getUncompressedSize();
+  }
+}
+
+size_t
+Cs::getNMaxHotEntries() const
+{
+  size_t limit = m_defaultPartition->getLimit();
+  for (const auto& partition : m_partitions) {
+    limit += partition.second->getLimit();
+  }
+  return std::max<size_t>(limit * m_hotPercent / 100, 1);
+}
+
+void
+Cs::compressColdEntries() const
+{
+  size_t nMaxHotEntries = this->getNMaxHotEntries();
+  while (m_hotEntries.size() > nMaxHotEntries) {
+    iterator it = m_hotEntries.front();
+    m_hotEntries.erase(it);
+
+    EntryImpl& entry = const_cast<EntryImpl&>(*it);
+    if (!entry.compress(*m_compressor)) {
+      NFD_LOG_TRACE("  incompressible " << entry.getName());
+      continue;
+    }
+    ++m_nCompressedEntries;
+    m_nCompressedBytes += entry.getCompressedSize();
+    m_nUncompressedBytes += entry.getUncompressedSize();
+  }
 }
 
 void
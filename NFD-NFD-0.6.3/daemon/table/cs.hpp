@@ -29,6 +29,9 @@
 #include "cs-policy.hpp"
 #include "cs-internal.hpp"
 #include "cs-entry-impl.hpp"
+#include "cs-entry-queue.hpp"
+#include "cs-compressor.hpp"
+#include "cs-partition.hpp"
 #include <ndn-cxx/util/signal.hpp>
 #include <boost/iterator/transform_iterator.hpp>
 
@@ -37,13 +40,25 @@ namespace cs {
 
 /** \brief implements the Content Store
  *
- *  This Content Store implementation consists of a Table and a replacement policy.
+ *  This Content Store implementation consists of a Table and one or more partitions,
+ *  each having a replacement policy.
  *
  *  The Table is a container ( \c std::set ) sorted by full Names of stored Data packets.
  *  Data packets are wrapped in Entry objects. Each Entry contains the Data packet itself,
  *  and a few additional attributes such as when the Data becomes non-fresh.
  *
  *  The replacement policy is implemented in a subclass of \c Policy.
+ *  An optional admission filter ( \c TinyLfu ) may reject a new Data packet when the CS is full,
+ *  if the Data is estimated to be less popular than the entry that the policy would evict.
+ *
+ *  Every Data packet is admitted into the \c Partition whose prefix is the longest prefix of
+ *  its Name; the default partition, which has the empty prefix, holds every other Data packet.
+ *  Capacity, policy and admission filter of the CS refer to the default partition.
+ *
+ *  With an optional \c Compressor, only a window of recently inserted or used entries is kept
+ *  uncompressed; entries leaving the window keep their Data wire encoding compressed, and are
+ *  decompressed when they are used again. Data whose Content appears to be already compressed
+ *  or encrypted, and Data that does not shrink, is never compressed.
  */
 class Cs : noncopyable
 {
@@ -82,6 +97,15 @@ public:
        const HitCallback& hitCallback,
        const MissCallback& missCallback) const;
 
+  /** \brief determines whether a stored Data packet can satisfy \p interest
+   *
+   *  Unlike find(), this lookup has no side effects: it does not count a hit or a miss,
+   *  does not inform the admission filter or the replacement policy, and does not
+   *  decompress the matching entry.
+   */
+  bool
+  contains(const Interest& interest) const;
+
   /** \brief get number of stored packets
    */
   size_t
@@ -96,23 +120,20 @@ public: // configuration
   size_t
   getLimit() const
   {
-    return m_policy->getLimit();
+    return m_defaultPartition->getLimit();
   }
 
   /** \brief change capacity (in number of packets)
    */
   void
-  setLimit(size_t nMaxPackets)
-  {
-    return m_policy->setLimit(nMaxPackets);
-  }
+  setLimit(size_t nMaxPackets);
 
   /** \brief get replacement policy
    */
   Policy*
   getPolicy() const
   {
-    return m_policy.get();
+    return m_defaultPartition->getPolicy();
   }
 
   /** \brief change replacement policy
@@ -121,6 +142,81 @@ public: // configuration
   void
   setPolicy(unique_ptr<Policy> policy);
 
+  /** \brief get admission filter
+   *  \retval nullptr no admission filter, every Data is admitted
+   */
+  TinyLfu*
+  getAdmissionFilter() const
+  {
+    return m_defaultPartition->getAdmissionFilter();
+  }
+
+  /** \brief change admission filter
+   *  \param filter the admission filter, or nullptr to admit every Data
+   *
+   *  The filter is resized to the current capacity.
+   */
+  void
+  setAdmissionFilter(unique_ptr<TinyLfu> filter);
+
+  /** \brief get compressor of entries that are not recently used
+   *  \retval nullptr entries are not compressed
+   */
+  Compressor*
+  getCompressor() const
+  {
+    return m_compressor.get();
+  }
+
+  /** \brief change compressor of entries that are not recently used
+   *  \param compressor the compressor, or nullptr to store every entry uncompressed
+   *
+   *  Entries compressed by the previous compressor are decompressed. Entries stored earlier
+   *  are compressed after they are next used and then leave the uncompressed window.
+   */
+  void
+  setCompressor(unique_ptr<Compressor> compressor);
+
+  /** \return size of the uncompressed window, in percent of the capacity
+   */
+  size_t
+  getHotPercent() const
+  {
+    return m_hotPercent;
+  }
+
+  /** \brief change size of the uncompressed window, in percent of the capacity
+   *  \note The window always contains at least one entry.
+   */
+  void
+  setHotPercent(size_t hotPercent);
+
+  static constexpr size_t DEFAULT_HOT_PERCENT = 10;
+
+  /** \return number of compressed entries
+   */
+  size_t
+  getNCompressedEntries() const
+  {
+    return m_nCompressedEntries;
+  }
+
+  /** \return total size of compressed wire encodings
+   */
+  size_t
+  getCompressedBytes() const
+  {
+    return m_nCompressedBytes;
+  }
+
+  /** \return total size of the wire encodings of compressed entries before compression
+   */
+  size_t
+  getUncompressedBytes() const
+  {
+    return m_nUncompressedBytes;
+  }
+
   /** \brief get CS_ENABLE_ADMIT flag
    *  \sa https://redmine.named-data.net/projects/nfd/wiki/CsMgmt#Update-config
    */
@@ -151,6 +247,47 @@ public: // configuration
   void
   enableServe(bool shouldServe);
 
+public: // partitions
+  using PartitionTable = std::map<Name, unique_ptr<Partition>>;
+
+  /** \return the default partition, which holds Data that is not under any other partition
+   */
+  Partition&
+  getDefaultPartition() const
+  {
+    return *m_defaultPartition;
+  }
+
+  /** \return partitions other than the default partition, indexed by prefix
+   */
+  const PartitionTable&
+  getPartitions() const
+  {
+    return m_partitions;
+  }
+
+  /** \return the partition with exactly \p prefix, or nullptr if it does not exist
+   */
+  Partition*
+  getPartition(const Name& prefix) const;
+
+  /** \brief add a partition for Data under \p prefix
+   *  \param prefix name prefix; must not be empty
+   *  \param nMaxPackets capacity of the new partition
+   *  \param policy replacement policy of the new partition
+   *  \pre getPartition(prefix) == nullptr
+   *
+   *  Data stored before the partition is added remain in their previous partition.
+   */
+  Partition&
+  addPartition(const Name& prefix, size_t nMaxPackets, unique_ptr<Policy> policy);
+
+  /** \brief erase a partition and all Data it holds
+   *  \pre prefix is not empty
+   */
+  void
+  erasePartition(const Name& prefix);
+
 public: // enumeration
   struct EntryFromEntryImpl
   {
@@ -198,8 +335,45 @@ private: // find
   iterator
   findRightmostAmongExact(const Interest& interest, iterator first, iterator last) const;
 
+private: // partitions
+  /** \return the partition whose prefix is the longest prefix of \p name
+   */
+  Partition&
+  findPartition(const Name& name) const;
+
+  /** \brief erase an entry evicted by the policy of its partition
+   */
+  void
+  beforeEvict(iterator it);
+
+  void
+  afterLimitChange();
+
+  friend class Partition;
+
+private: // compression
+  /** \brief move \p it to the back of the uncompressed window, decompressing it if needed,
+   *         and compress entries that leave the window
+   *  \pre m_compressor != nullptr
+   */
+  void
+  makeHot(iterator it) const;
+
+  void
+  decompress(iterator it) const;
+
+  /** \brief unlink \p it from the uncompressed window and account for its removal
+   */
+  void
+  beforeRemove(iterator it) const;
+
+  /** \return number of entries in the uncompressed window, based on the capacity of all partitions
+   */
+  size_t
+  getNMaxHotEntries() const;
+
   void
-  setPolicyImpl(unique_ptr<Policy> policy);
+  compressColdEntries() const;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
@@ -207,8 +381,15 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 
 private:
   Table m_table;
-  unique_ptr<Policy> m_policy;
-  signal::ScopedConnection m_beforeEvictConnection;
+  unique_ptr<Partition> m_defaultPartition;
+  PartitionTable m_partitions;
+
+  unique_ptr<Compressor> m_compressor;
+  size_t m_hotPercent;
+  mutable EntryQueue m_hotEntries; ///< uncompressed window, least recently used at front
+  mutable size_t m_nCompressedEntries;
+  mutable size_t m_nCompressedBytes;
+  mutable size_t m_nUncompressedBytes;
 
   bool m_shouldAdmit; ///< if false, no Data will be admitted
   bool m_shouldServe; ///< if false, all lookups will miss
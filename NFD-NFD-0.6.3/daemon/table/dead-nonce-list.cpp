@@ -104,8 +104,9 @@ DeadNonceList::add(const Name& name, uint32_t nonce)
 DeadNonceList::Entry
 DeadNonceList::makeEntry(const Name& name, uint32_t nonce)
 {
-  Block nameWire = name.wireEncode();
-  return CityHash64WithSeed(reinterpret_cast<const char*>(nameWire.wire()), nameWire.size(),
+  // Name caches its hash, so this does not need the wire encoding of the name
+  uint64_t nameHash = std::hash<Name>()(name);
+  return CityHash64WithSeed(reinterpret_cast<const char*>(&nameHash), sizeof(nameHash),
                             static_cast<uint64_t>(nonce));
 }
 
@@ -36,6 +36,10 @@ NDN_CXX_ASSERT_FORWARD_ITERATOR(Fib::const_iterator);
 
 const unique_ptr<Entry> Fib::s_emptyEntry = make_unique<Entry>(Name());
 
+/** \brief maximum number of delegation names in Fib::m_delegationMatches
+ */
+static const size_t DELEGATION_MATCHES_LIMIT = 1024;
+
 static inline bool
 nteHasFibEntry(const name_tree::Entry& nte)
 {
@@ -45,6 +49,7 @@ nteHasFibEntry(const name_tree::Entry& nte)
 Fib::Fib(NameTree& nameTree)
   : m_nameTree(nameTree)
   , m_nItems(0)
+  , m_epoch(0)
 {
 }
 
@@ -77,6 +82,22 @@ Fib::findLongestPrefixMatch(const measurements::Entry& measurementsEntry) const
   return this->findLongestPrefixMatchImpl(measurementsEntry);
 }
 
+const Entry&
+Fib::findDelegationMatch(const Name& delegationName) const
+{
+  auto it = m_delegationMatches.find(delegationName);
+  if (it != m_delegationMatches.end()) {
+    return *it->second;
+  }
+
+  const Entry& entry = this->findLongestPrefixMatchImpl(delegationName);
+  if (m_delegationMatches.size() >= DELEGATION_MATCHES_LIMIT) {
+    m_delegationMatches.clear();
+  }
+  m_delegationMatches.emplace(delegationName, &entry);
+  return entry;
+}
+
 Entry*
 Fib::findExactMatch(const Name& prefix)
 {
@@ -98,6 +119,8 @@ Fib::insert(const Name& prefix)
 
   nte.setFibEntry(make_unique<Entry>(prefix));
   ++m_nItems;
+  ++m_epoch;
+  m_delegationMatches.clear();
   return {nte.getFibEntry(), true};
 }
 
@@ -111,6 +134,8 @@ Fib::erase(name_tree::Entry* nte, bool canDeleteNte)
     m_nameTree.eraseIfEmpty(nte);
   }
   --m_nItems;
+  ++m_epoch;
+  m_delegationMatches.clear();
 }
 
 void
@@ -133,10 +158,20 @@ Fib::erase(const Entry& entry)
   this->erase(nte);
 }
 
+void
+Fib::addNextHop(Entry& entry, Face& face, uint64_t cost)
+{
+  entry.addNextHop(face, cost);
+  ++m_epoch;
+}
+
 void
 Fib::removeNextHop(Entry& entry, const Face& face)
 {
-  entry.removeNextHop(face);
+  if (entry.hasNextHop(face)) {
+    entry.removeNextHop(face);
+    ++m_epoch;
+  }
 
   if (!entry.hasNextHops()) {
     name_tree::Entry* nte = m_nameTree.getEntry(entry);
@@ -58,6 +58,16 @@ public:
     return m_nItems;
   }
 
+  /** \return a number that changes whenever an entry or a nexthop is inserted, updated, or erased
+   *  \note Changes made directly on a fib::Entry are not accounted for;
+   *        use Fib::addNextHop and Fib::removeNextHop instead.
+   */
+  uint64_t
+  getEpoch() const
+  {
+    return m_epoch;
+  }
+
 public: // lookup
   /** \brief performs a longest prefix match
    */
@@ -78,6 +88,15 @@ public: // lookup
   const Entry&
   findLongestPrefixMatch(const measurements::Entry& measurementsEntry) const;
 
+  /** \brief performs a longest prefix match for a forwarding hint delegation name
+   *
+   *  This is equivalent to .findLongestPrefixMatch(delegationName), but the result is
+   *  remembered until a FIB entry is inserted or erased, because Interests carrying
+   *  forwarding hints typically share a small number of delegation names.
+   */
+  const Entry&
+  findDelegationMatch(const Name& delegationName) const;
+
   /** \brief performs an exact match lookup
    */
   Entry*
@@ -105,7 +124,14 @@ public: // mutation
   void
   erase(const Entry& entry);
 
+  /** \brief adds a NextHop record for face, or updates its cost
+   */
+  void
+  addNextHop(Entry& entry, Face& face, uint64_t cost);
+
   /** \brief removes the NextHop record for face
+   *
+   *  The entry is erased if it has no more nexthops.
    */
   void
   removeNextHop(Entry& entry, const Face& face);
@@ -150,6 +176,14 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
+  uint64_t m_epoch;
+
+  /** \brief delegation name => longest prefix match result
+   *
+   *  Cleared when an entry is inserted or erased. Changes of nexthops do not affect
+   *  longest prefix match results, so they leave the cache intact.
+   */
+  mutable std::unordered_map<Name, const Entry*> m_delegationMatches;
 
   /** \brief the empty FIB entry.
    *
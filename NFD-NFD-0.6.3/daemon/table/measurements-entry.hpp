@@ -27,7 +27,6 @@
 #define NFD_DAEMON_TABLE_MEASUREMENTS_ENTRY_HPP
 
 #include "strategy-info-host.hpp"
-#include "core/scheduler.hpp"
 
 namespace nfd {
 
@@ -54,7 +53,6 @@ public:
 private:
   Name m_name;
   time::steady_clock::TimePoint m_expiry;
-  scheduler::EventId m_cleanup;
 
   name_tree::Entry* m_nameTreeEntry;
 
@@ -31,6 +31,9 @@
 namespace nfd {
 namespace measurements {
 
+constexpr time::nanoseconds Measurements::SWEEP_INTERVAL;
+constexpr size_t Measurements::SWEEP_LIMIT;
+
 Measurements::Measurements(NameTree& nameTree)
   : m_nameTree(nameTree)
   , m_nItems(0)
@@ -40,17 +43,27 @@ Measurements::Measurements(NameTree& nameTree)
 Entry&
 Measurements::get(name_tree::Entry& nte)
 {
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+
   Entry* entry = nte.getMeasurementsEntry();
   if (entry != nullptr) {
+    if (isExpired(*entry, now)) {
+      // expired but not yet reclaimed: reuse as a new entry
+      entry->clearStrategyInfo();
+      entry->m_expiry = now + getInitialLifetime();
+    }
     return *entry;
   }
 
   nte.setMeasurementsEntry(make_unique<Entry>(nte.getName()));
   ++m_nItems;
   entry = nte.getMeasurementsEntry();
+  entry->m_expiry = now + getInitialLifetime();
 
-  entry->m_expiry = time::steady_clock::now() + getInitialLifetime();
-  entry->m_cleanup = scheduler::schedule(getInitialLifetime(), [=] { cleanup(*entry); });
+  if (m_sweepQueue.empty()) {
+    m_sweepEvent = scheduler::schedule(SWEEP_INTERVAL, [this] { sweep(); });
+  }
+  m_sweepQueue.push_back(entry);
 
   return *entry;
 }
@@ -93,10 +106,11 @@ template<typename K>
 Entry*
 Measurements::findLongestPrefixMatchImpl(const K& key, const EntryPredicate& pred) const
 {
+  time::steady_clock::TimePoint now = time::steady_clock::now();
   name_tree::Entry* match = m_nameTree.findLongestPrefixMatch(key,
-    [&pred] (const name_tree::Entry& nte) {
+    [&pred, now] (const name_tree::Entry& nte) {
       const Entry* entry = nte.getMeasurementsEntry();
-      return entry != nullptr && pred(*entry);
+      return entry != nullptr && !isExpired(*entry, now) && pred(*entry);
     });
   if (match != nullptr) {
     return match->getMeasurementsEntry();
@@ -120,7 +134,15 @@ Entry*
 Measurements::findExactMatch(const Name& name) const
 {
   const name_tree::Entry* nte = m_nameTree.findExactMatch(name);
-  return nte == nullptr ? nullptr : nte->getMeasurementsEntry();
+  if (nte == nullptr) {
+    return nullptr;
+  }
+
+  Entry* entry = nte->getMeasurementsEntry();
+  if (entry == nullptr || isExpired(*entry, time::steady_clock::now())) {
+    return nullptr;
+  }
+  return entry;
 }
 
 void
@@ -134,9 +156,36 @@ Measurements::extendLifetime(Entry& entry, const time::nanoseconds& lifetime)
     return;
   }
 
-  scheduler::cancel(entry.m_cleanup);
   entry.m_expiry = expiry;
-  entry.m_cleanup = scheduler::schedule(lifetime, [&] { cleanup(entry); });
+}
+
+void
+Measurements::sweep()
+{
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+
+  size_t nVisits = std::min(m_sweepQueue.size(), SWEEP_LIMIT);
+  size_t nReclaimed = 0;
+  for (size_t i = 0; i < nVisits; ++i) {
+    Entry* entry = m_sweepQueue.front();
+    m_sweepQueue.pop_front();
+    if (isExpired(*entry, now)) {
+      this->cleanup(*entry);
+      ++nReclaimed;
+    }
+    else {
+      m_sweepQueue.push_back(entry);
+    }
+  }
+
+  if (m_sweepQueue.empty()) {
+    return;
+  }
+
+  // While most visited entries turn out expired, there is a backlog of expired entries:
+  // continue after other events had a chance to run, instead of waiting for the next interval.
+  time::nanoseconds delay = nReclaimed * 2 > nVisits ? 0_ns : SWEEP_INTERVAL;
+  m_sweepEvent = scheduler::schedule(delay, [this] { sweep(); });
 }
 
 void
@@ -28,6 +28,9 @@
 
 #include "measurements-entry.hpp"
 #include "name-tree.hpp"
+#include "core/scheduler.hpp"
+
+#include <deque>
 
 namespace nfd {
 
@@ -75,6 +78,11 @@ public:
  *  The Measurements table is a data structure for forwarding strategies to store per name prefix
  *  measurements. A strategy can access this table via \c Strategy::getMeasurements(), and then
  *  place any object that derive from \c StrategyInfo type onto Measurements entries.
+ *
+ *  Entries do not own timers. Each entry carries an expiry time that is updated in place, and
+ *  expired entries are reclaimed by a periodic sweep that visits a bounded number of entries.
+ *  Between expiry and reclamation, an entry is invisible to lookups, and \c get() returns it
+ *  with its StrategyInfo cleared, as if it had been erased and inserted again.
  */
 class Measurements : noncopyable
 {
@@ -143,10 +151,34 @@ public:
   void
   extendLifetime(Entry& entry, const time::nanoseconds& lifetime);
 
+  /** \return number of entries, including expired entries not yet reclaimed by the sweep
+   */
   size_t
   size() const;
 
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** \brief interval between two sweeps
+   */
+  static constexpr time::nanoseconds SWEEP_INTERVAL = 1_s;
+
+  /** \brief maximum number of entries visited by one sweep
+   *
+   *  If most visited entries are expired, the next sweep runs without waiting for SWEEP_INTERVAL.
+   */
+  static constexpr size_t SWEEP_LIMIT = 4096;
+
 private:
+  static bool
+  isExpired(const Entry& entry, const time::steady_clock::TimePoint& now)
+  {
+    return entry.m_expiry <= now;
+  }
+
+  /** \brief visit up to SWEEP_LIMIT entries, reclaiming expired ones, and schedule the next sweep
+   */
+  void
+  sweep();
+
   void
   cleanup(Entry& entry);
 
@@ -162,6 +194,13 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
+
+  /** \brief sweep order of all entries
+   *
+   *  The sweep is scheduled if and only if this queue is not empty.
+   */
+  std::deque<Entry*> m_sweepQueue;
+  scheduler::ScopedEventId m_sweepEvent;
 };
 
 inline time::nanoseconds
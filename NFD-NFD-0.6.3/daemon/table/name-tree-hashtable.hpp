@@ -27,6 +27,7 @@
 #define NFD_DAEMON_TABLE_NAME_TREE_HASHTABLE_HPP
 
 #include "name-tree-entry.hpp"
+#include "table-arena.hpp"
 
 namespace nfd {
 namespace name_tree {
@@ -57,6 +58,7 @@ computeHashes(const Name& name, size_t prefixLen = std::numeric_limits<size_t>::
  *
  *  Zero or more nodes can be added to a hashtable bucket. They are organized as
  *  a doubly linked list through prev and next pointers.
+ *  Nodes are allocated from the TableArena.
  */
 class Node : noncopyable
 {
@@ -71,6 +73,18 @@ public:
    */
   ~Node();
 
+  static void*
+  operator new(size_t size)
+  {
+    return getTableArena().allocate(size);
+  }
+
+  static void
+  operator delete(void* ptr, size_t size)
+  {
+    getTableArena().deallocate(ptr, size);
+  }
+
 public:
   const HashValue hash;
   Node* prev;
@@ -31,11 +31,11 @@ namespace nfd {
 bool
 NetworkRegionTable::isInProducerRegion(const DelegationList& forwardingHint) const
 {
-  for (const Name& regionName : *this) {
-    for (const Delegation& delegation : forwardingHint) {
-      if (delegation.name.isPrefixOf(regionName)) {
-        return true;
-      }
+  for (const Delegation& delegation : forwardingHint) {
+    // in canonical order, region names under the delegation name immediately follow it
+    auto it = this->lower_bound(delegation.name);
+    if (it != this->end() && delegation.name.isPrefixOf(*it)) {
+      return true;
     }
   }
   return false;
@@ -24,6 +24,8 @@
  */
 
 #include "pit-entry.hpp"
+#include "pit.hpp"
+
 #include <algorithm>
 
 namespace nfd {
@@ -34,6 +36,7 @@ Entry::Entry(const Interest& interest)
   , dataFreshnessPeriod(0_ms)
   , m_interest(interest.shared_from_this())
   , m_nameTreeEntry(nullptr)
+  , m_pit(nullptr)
 {
 }
 
@@ -66,6 +69,9 @@ Entry::insertOrUpdateInRecord(Face& face, const Interest& interest)
   if (it == m_inRecords.end()) {
     m_inRecords.emplace_front(face);
     it = m_inRecords.begin();
+    if (m_pit != nullptr) {
+      m_pit->chargeInRecord(face);
+    }
   }
 
   it->update(interest);
@@ -78,6 +84,9 @@ Entry::deleteInRecord(const Face& face)
   auto it = std::find_if(m_inRecords.begin(), m_inRecords.end(),
     [&face] (const InRecord& inRecord) { return &inRecord.getFace() == &face; });
   if (it != m_inRecords.end()) {
+    if (m_pit != nullptr) {
+      m_pit->refundInRecord(face);
+    }
     m_inRecords.erase(it);
   }
 }
@@ -85,6 +94,11 @@ Entry::deleteInRecord(const Face& face)
 void
 Entry::clearInRecords()
 {
+  if (m_pit != nullptr) {
+    for (const InRecord& inRecord : m_inRecords) {
+      m_pit->refundInRecord(inRecord.getFace());
+    }
+  }
   m_inRecords.clear();
 }
 
@@ -40,6 +40,8 @@ class Entry;
 
 namespace pit {
 
+class Pit;
+
 /** \brief an unordered collection of in-records
  */
 typedef std::list<InRecord> InRecordCollection;
@@ -238,8 +240,10 @@ private:
   OutRecordCollection m_outRecords;
 
   name_tree::Entry* m_nameTreeEntry;
+  Pit* m_pit; ///< the PIT charged for in-records, nullptr if not in a PIT
 
   friend class name_tree::Entry;
+  friend class Pit;
 };
 
 } // namespace pit
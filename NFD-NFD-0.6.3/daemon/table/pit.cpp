@@ -24,6 +24,7 @@
  */
 
 #include "pit.hpp"
+#include "table-arena.hpp"
 
 namespace nfd {
 namespace pit {
@@ -37,6 +38,11 @@ nteHasPitEntries(const name_tree::Entry& nte)
 Pit::Pit(NameTree& nameTree)
   : m_nameTree(nameTree)
   , m_nItems(0)
+  , m_nMaxEntries(0)
+  , m_nMaxBytes(0)
+  , m_faceQuota(0)
+  , m_nBytes(0)
+  , m_nInRecords(0)
 {
 }
 
@@ -77,9 +83,11 @@ Pit::findOrInsert(const Interest& interest, bool allowInsert)
     return {nullptr, true};
   }
 
-  auto entry = make_shared<Entry>(interest);
+  auto entry = std::allocate_shared<Entry>(TableArenaAllocator<Entry>(), interest);
   nte->insertPitEntry(entry);
+  entry->m_pit = this;
   ++m_nItems;
+  m_nBytes += getEntryCost(*entry);
   return {entry, true};
 }
 
@@ -105,6 +113,13 @@ Pit::erase(Entry* entry, bool canDeleteNte)
   name_tree::Entry* nte = m_nameTree.getEntry(*entry);
   BOOST_ASSERT(nte != nullptr);
 
+  // in-records left on an erased entry are no longer charged, even if the entry is kept alive
+  for (const InRecord& inRecord : entry->getInRecords()) {
+    this->refundInRecord(inRecord.getFace());
+  }
+  entry->m_pit = nullptr;
+  m_nBytes -= getEntryCost(*entry);
+
   nte->erasePitEntry(entry);
   if (canDeleteNte) {
     m_nameTree.eraseIfEmpty(nte);
@@ -123,6 +138,71 @@ Pit::deleteInOutRecords(Entry* entry, const Face& face)
   /// \todo decide whether to delete PIT entry if there's no more in/out-record left
 }
 
+void
+Pit::setBudget(size_t nMaxEntries, size_t nMaxBytes)
+{
+  m_nMaxEntries = nMaxEntries;
+  m_nMaxBytes = nMaxBytes;
+}
+
+size_t
+Pit::getNInRecords(const Face& face) const
+{
+  auto it = m_nFaceInRecords.find(&face);
+  return it == m_nFaceInRecords.end() ? 0 : it->second;
+}
+
+bool
+Pit::canAdmitInRecord(const Face& face) const
+{
+  bool isOverBudget = this->isOverBudget();
+  if (m_faceQuota == 0 && !isOverBudget) {
+    return true;
+  }
+
+  size_t nInRecords = this->getNInRecords(face);
+  if (m_faceQuota > 0 && nInRecords >= m_faceQuota) {
+    return false;
+  }
+  if (!isOverBudget) {
+    return true;
+  }
+  if (this->isOverHardLimit()) {
+    return false;
+  }
+  if (m_nFaceInRecords.empty()) {
+    return true;
+  }
+  // nInRecords < m_nInRecords / m_nFaceInRecords.size()
+  return nInRecords * m_nFaceInRecords.size() < m_nInRecords;
+}
+
+size_t
+Pit::getEntryCost(const Entry& entry)
+{
+  return sizeof(Entry) + entry.getName().wireEncode().size();
+}
+
+void
+Pit::chargeInRecord(const Face& face)
+{
+  ++m_nFaceInRecords[&face];
+  ++m_nInRecords;
+  m_nBytes += sizeof(InRecord);
+}
+
+void
+Pit::refundInRecord(const Face& face)
+{
+  auto it = m_nFaceInRecords.find(&face);
+  BOOST_ASSERT(it != m_nFaceInRecords.end() && it->second > 0);
+  if (--it->second == 0) {
+    m_nFaceInRecords.erase(it);
+  }
+  --m_nInRecords;
+  m_nBytes -= sizeof(InRecord);
+}
+
 Pit::const_iterator
 Pit::begin() const
 {
@@ -98,6 +98,86 @@ public:
   void
   deleteInOutRecords(Entry* entry, const Face& face);
 
+public: // admission control
+  /** \brief sets the budget of the PIT
+   *  \param nMaxEntries maximum number of entries, 0 means unlimited
+   *  \param nMaxBytes maximum estimated memory usage in bytes, 0 means unlimited
+   *
+   *  The budget is not enforced by the PIT itself; the forwarder consults canAdmitInRecord
+   *  before an Interest can create an in-record.
+   */
+  void
+  setBudget(size_t nMaxEntries, size_t nMaxBytes);
+
+  size_t
+  getMaxEntries() const
+  {
+    return m_nMaxEntries;
+  }
+
+  size_t
+  getMaxBytes() const
+  {
+    return m_nMaxBytes;
+  }
+
+  /** \brief sets the maximum number of in-records per face, 0 means unlimited
+   */
+  void
+  setFaceQuota(size_t nMaxInRecords)
+  {
+    m_faceQuota = nMaxInRecords;
+  }
+
+  size_t
+  getFaceQuota() const
+  {
+    return m_faceQuota;
+  }
+
+  /** \return estimated memory usage of entries and their in-records, in bytes
+   */
+  size_t
+  getNBytes() const
+  {
+    return m_nBytes;
+  }
+
+  /** \return number of in-records of \p face
+   */
+  size_t
+  getNInRecords(const Face& face) const;
+
+  /** \return whether the number of entries or the estimated memory usage exceeds the budget
+   */
+  bool
+  isOverBudget() const
+  {
+    return (m_nMaxEntries > 0 && m_nItems >= m_nMaxEntries) ||
+           (m_nMaxBytes > 0 && m_nBytes >= m_nMaxBytes);
+  }
+
+  /** \return whether the number of entries or the estimated memory usage exceeds the budget
+   *          by more than a quarter, at which point no face is admitted
+   */
+  bool
+  isOverHardLimit() const
+  {
+    return (m_nMaxEntries > 0 && m_nItems > m_nMaxEntries + m_nMaxEntries / 4) ||
+           (m_nMaxBytes > 0 && m_nBytes > m_nMaxBytes + m_nMaxBytes / 4);
+  }
+
+  /** \brief determines whether \p face may add an in-record
+   *
+   *  A face cannot have more in-records than the per-face quota. While the PIT is over budget,
+   *  only faces having fewer in-records than the average of all faces that have in-records
+   *  are admitted, so that the faces responsible for the overload are the ones to be shed.
+   *  Past the hard limit, no face is admitted, so that the budget holds even if every face
+   *  stays below the average.
+   */
+  bool
+  canAdmitInRecord(const Face& face) const;
+
 public: // enumeration
   typedef Iterator const_iterator;
 
@@ -122,6 +202,17 @@ private:
   void
   erase(Entry* pitEntry, bool canDeleteNte);
 
+  /** \brief estimated memory usage of \p entry, excluding its in-records
+   */
+  static size_t
+  getEntryCost(const Entry& entry);
+
+  void
+  chargeInRecord(const Face& face);
+
+  void
+  refundInRecord(const Face& face);
+
   /** \brief finds or inserts a PIT entry for Interest
    *  \param interest the Interest; must be created with make_shared if allowInsert
    *  \param allowInsert whether inserting new entry is allowed.
@@ -136,6 +227,15 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
+
+  size_t m_nMaxEntries;
+  size_t m_nMaxBytes;
+  size_t m_faceQuota;
+  size_t m_nBytes;
+  size_t m_nInRecords;
+  std::unordered_map<const Face*, size_t> m_nFaceInRecords; ///< only faces having in-records
+
+  friend class Entry;
 };
 
 } // namespace pit
@@ -27,10 +27,32 @@
 
 namespace nfd {
 
+constexpr int StrategyInfoHost::N_INLINE_SLOTS;
+constexpr size_t StrategyInfoHost::INLINE_SLOT_SIZE;
+
+StrategyInfoHost::~StrategyInfoHost()
+{
+  this->clearStrategyInfo();
+}
+
 void
 StrategyInfoHost::clearStrategyInfo()
 {
-  m_items.clear();
+  for (InlineSlot& inlineSlot : m_slots) {
+    if (inlineSlot.typeId != 0) {
+      clearInlineSlot(inlineSlot);
+    }
+  }
+  m_overflow.reset();
+}
+
+void
+StrategyInfoHost::clearInlineSlot(InlineSlot& inlineSlot)
+{
+  BOOST_ASSERT(inlineSlot.typeId != 0);
+  inlineSlot.item->~StrategyInfo();
+  inlineSlot.item = nullptr;
+  inlineSlot.typeId = 0;
 }
 
 } // namespace nfd
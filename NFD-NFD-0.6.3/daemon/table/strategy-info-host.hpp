@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /**
- * Copyright (c) 2014-2016,  Regents of the University of California,
+ * Copyright (c) 2014-2018,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -31,10 +31,25 @@
 namespace nfd {
 
 /** \brief base class for an entity onto which StrategyInfo items may be placed
+ *
+ *  A StrategyInfo item is stored in one of a few fixed-size inline slots if its type fits,
+ *  so that placing it onto a table entry does not allocate.
+ *  Each StrategyInfo type is assigned a slot at compile time according to its type ID.
+ *  If the slot is occupied by an item of another type, or the type is too large,
+ *  the item is stored in an overflow map that is allocated on first use.
  */
 class StrategyInfoHost
 {
 public:
+  StrategyInfoHost() = default;
+
+  StrategyInfoHost(const StrategyInfoHost&) = delete;
+
+  StrategyInfoHost&
+  operator=(const StrategyInfoHost&) = delete;
+
+  ~StrategyInfoHost();
+
   /** \brief get a StrategyInfo item
    *  \tparam T type of StrategyInfo, must be a subclass of fw::StrategyInfo
    *  \return an existing StrategyInfo item of type T, or nullptr if it does not exist
@@ -46,8 +61,16 @@ public:
     static_assert(std::is_base_of<fw::StrategyInfo, T>::value,
                   "T must inherit from StrategyInfo");
 
-    auto it = m_items.find(T::getTypeId());
-    if (it == m_items.end()) {
+    int slot = getInlineSlot<T>();
+    if (slot >= 0 && m_slots[slot].typeId == T::getTypeId()) {
+      return static_cast<T*>(m_slots[slot].item);
+    }
+
+    if (m_overflow == nullptr) {
+      return nullptr;
+    }
+    auto it = m_overflow->find(T::getTypeId());
+    if (it == m_overflow->end()) {
       return nullptr;
     }
     return static_cast<T*>(it->second.get());
@@ -65,12 +88,27 @@ public:
     static_assert(std::is_base_of<fw::StrategyInfo, T>::value,
                   "T must inherit from StrategyInfo");
 
-    unique_ptr<fw::StrategyInfo>& item = m_items[T::getTypeId()];
-    bool isNew = (item == nullptr);
-    if (isNew) {
-      item.reset(new T(std::forward<A>(args)...));
+    T* existing = this->getStrategyInfo<T>();
+    if (existing != nullptr) {
+      return {existing, false};
+    }
+
+    int slot = getInlineSlot<T>();
+    if (slot >= 0 && m_slots[slot].typeId == 0) {
+      InlineSlot& inlineSlot = m_slots[slot];
+      T* item = constructInline<T>(std::integral_constant<bool, getInlineSlot<T>() >= 0>(),
+                                   inlineSlot, std::forward<A>(args)...);
+      inlineSlot.item = item;
+      inlineSlot.typeId = T::getTypeId();
+      return {item, true};
+    }
+
+    if (m_overflow == nullptr) {
+      m_overflow = make_unique<OverflowMap>();
     }
-    return {static_cast<T*>(item.get()), isNew};
+    unique_ptr<fw::StrategyInfo>& item = (*m_overflow)[T::getTypeId()];
+    item.reset(new T(std::forward<A>(args)...));
+    return {static_cast<T*>(item.get()), true};
   }
 
   /** \brief erase a StrategyInfo item
@@ -84,7 +122,13 @@ public:
     static_assert(std::is_base_of<fw::StrategyInfo, T>::value,
                   "T must inherit from StrategyInfo");
 
-    return m_items.erase(T::getTypeId());
+    int slot = getInlineSlot<T>();
+    if (slot >= 0 && m_slots[slot].typeId == T::getTypeId()) {
+      this->clearInlineSlot(m_slots[slot]);
+      return 1;
+    }
+
+    return m_overflow == nullptr ? 0 : m_overflow->erase(T::getTypeId());
   }
 
   /** \brief clear all StrategyInfo items
@@ -92,8 +136,61 @@ public:
   void
   clearStrategyInfo();
 
+public:
+  /** \brief number of inline slots
+   */
+  static constexpr int N_INLINE_SLOTS = 2;
+
+  /** \brief maximum size of a StrategyInfo type that can be stored in an inline slot
+   */
+  static constexpr size_t INLINE_SLOT_SIZE = 48;
+
+  /** \return index of the inline slot assigned to StrategyInfo type T, or -1 if T does not fit
+   */
+  template<typename T>
+  static constexpr int
+  getInlineSlot()
+  {
+    return sizeof(T) <= INLINE_SLOT_SIZE && alignof(T) <= alignof(std::max_align_t) ?
+           T::getTypeId() % N_INLINE_SLOTS : -1;
+  }
+
+private:
+  struct InlineSlot
+  {
+    int typeId = 0; ///< type ID of the stored item, 0 if the slot is empty
+    fw::StrategyInfo* item = nullptr;
+    std::aligned_storage<INLINE_SLOT_SIZE, alignof(std::max_align_t)>::type storage;
+  };
+
+  /** \brief construct a T in \p inlineSlot
+   *
+   *  Overloaded on whether T fits so that placement new is never instantiated for types
+   *  larger than a slot.
+   */
+  template<typename T, typename ...A>
+  static T*
+  constructInline(std::true_type, InlineSlot& inlineSlot, A&&... args)
+  {
+    return new (&inlineSlot.storage) T(std::forward<A>(args)...);
+  }
+
+  template<typename T, typename ...A>
+  static T*
+  constructInline(std::false_type, InlineSlot&, A&&...)
+  {
+    BOOST_ASSERT(false);
+    return nullptr;
+  }
+
+  static void
+  clearInlineSlot(InlineSlot& inlineSlot);
+
+  using OverflowMap = std::unordered_map<int, unique_ptr<fw::StrategyInfo>>;
+
 private:
-  std::unordered_map<int, unique_ptr<fw::StrategyInfo>> m_items;
+  InlineSlot m_slots[N_INLINE_SLOTS];
+  unique_ptr<OverflowMap> m_overflow;
 };
 
 } // namespace nfd
@@ -0,0 +1,230 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table-arena.hpp"
+#include "core/logger.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+#include <sys/mman.h>
+
+namespace nfd {
+
+NFD_LOG_INIT(TableArena);
+
+constexpr size_t TableArena::CHUNK_SIZE;
+constexpr size_t TableArena::SIZE_CLASS_GRANULARITY;
+constexpr size_t TableArena::MAX_BLOCK_SIZE;
+constexpr size_t TableArena::N_SIZE_CLASSES;
+
+TableArena::TableArena()
+  : m_bumpPos(nullptr)
+  , m_bumpEnd(nullptr)
+  , m_hasWarnedExplicit(false)
+  , m_nHugePageChunks(0)
+  , m_nAllocatedBytes(0)
+  , m_nFreeBytes(0)
+  , m_nFallbackAllocations(0)
+{
+  m_freeLists.fill(nullptr);
+}
+
+TableArena::~TableArena()
+{
+  for (uintptr_t chunk : m_chunks) {
+    ::munmap(reinterpret_cast<void*>(chunk), CHUNK_SIZE);
+  }
+}
+
+void
+TableArena::setOptions(const Options& options)
+{
+  if (options.pageMode != m_options.pageMode) {
+    NFD_LOG_INFO("page mode " << m_options.pageMode << " -> " << options.pageMode);
+  }
+  m_options = options;
+}
+
+void*
+TableArena::allocate(size_t size)
+{
+  if (m_options.pageMode == ndn::nfd::ARENA_PAGE_MODE_OFF) {
+    return ::operator new(size);
+  }
+
+  if (size > MAX_BLOCK_SIZE) {
+    ++m_nFallbackAllocations;
+    return ::operator new(size);
+  }
+
+  size_t sizeClass = getSizeClass(std::max<size_t>(size, 1));
+  size_t blockSize = getBlockSize(sizeClass);
+
+  FreeBlock* block = m_freeLists[sizeClass];
+  if (block != nullptr) {
+    m_freeLists[sizeClass] = block->next;
+    m_nFreeBytes -= blockSize;
+  }
+  else {
+    if (static_cast<size_t>(m_bumpEnd - m_bumpPos) < blockSize && !this->mapChunk()) {
+      ++m_nFallbackAllocations;
+      return ::operator new(size);
+    }
+    block = reinterpret_cast<FreeBlock*>(m_bumpPos);
+    m_bumpPos += blockSize;
+  }
+
+  m_nAllocatedBytes += blockSize;
+  return block;
+}
+
+void
+TableArena::deallocate(void* ptr, size_t size) noexcept
+{
+  if (size > MAX_BLOCK_SIZE || !this->contains(ptr)) {
+    ::operator delete(ptr);
+    return;
+  }
+
+  size_t sizeClass = getSizeClass(std::max<size_t>(size, 1));
+  size_t blockSize = getBlockSize(sizeClass);
+
+  auto block = static_cast<FreeBlock*>(ptr);
+  block->next = m_freeLists[sizeClass];
+  m_freeLists[sizeClass] = block;
+
+  m_nAllocatedBytes -= blockSize;
+  m_nFreeBytes += blockSize;
+}
+
+bool
+TableArena::contains(const void* ptr) const
+{
+  if (m_chunks.empty()) {
+    return false;
+  }
+  // chunks are aligned to their size
+  uintptr_t chunk = reinterpret_cast<uintptr_t>(ptr) & ~(CHUNK_SIZE - 1);
+  return m_chunks.count(chunk) > 0;
+}
+
+static void*
+mapAlignedChunk(size_t chunkSize)
+{
+  // over-allocate, then trim the unaligned head and tail
+  void* mapped = ::mmap(nullptr, 2 * chunkSize, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mapped == MAP_FAILED) {
+    return nullptr;
+  }
+
+  uintptr_t begin = reinterpret_cast<uintptr_t>(mapped);
+  uintptr_t aligned = (begin + chunkSize - 1) & ~(chunkSize - 1);
+  if (aligned > begin) {
+    ::munmap(mapped, aligned - begin);
+  }
+  uintptr_t tail = aligned + chunkSize;
+  uintptr_t end = begin + 2 * chunkSize;
+  if (end > tail) {
+    ::munmap(reinterpret_cast<void*>(tail), end - tail);
+  }
+  return reinterpret_cast<void*>(aligned);
+}
+
+bool
+TableArena::mapChunk()
+{
+  if (m_options.maxSize > 0 && this->getNMappedBytes() + CHUNK_SIZE > m_options.maxSize) {
+    return false;
+  }
+
+  void* chunk = nullptr;
+  bool isHuge = false;
+
+  if (m_options.pageMode == ndn::nfd::ARENA_PAGE_MODE_EXPLICIT) {
+#ifdef MAP_HUGETLB
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#ifdef MAP_HUGE_2MB
+    flags |= MAP_HUGE_2MB;
+#endif
+    chunk = ::mmap(nullptr, CHUNK_SIZE, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (chunk == MAP_FAILED) {
+      chunk = nullptr;
+    }
+    else {
+      isHuge = true;
+    }
+#endif // MAP_HUGETLB
+    if (chunk == nullptr && !m_hasWarnedExplicit) {
+      NFD_LOG_WARN("Cannot map explicit huge pages, falling back to transparent huge pages");
+      m_hasWarnedExplicit = true;
+    }
+  }
+
+  if (chunk == nullptr) {
+    chunk = mapAlignedChunk(CHUNK_SIZE);
+    if (chunk == nullptr) {
+      NFD_LOG_WARN("Cannot map chunk: " << std::strerror(errno));
+      return false;
+    }
+#ifdef MADV_HUGEPAGE
+    if (m_options.pageMode != ndn::nfd::ARENA_PAGE_MODE_NORMAL) {
+      isHuge = ::madvise(chunk, CHUNK_SIZE, MADV_HUGEPAGE) == 0;
+    }
+#endif // MADV_HUGEPAGE
+  }
+
+  m_chunks.insert(reinterpret_cast<uintptr_t>(chunk));
+  if (isHuge) {
+    ++m_nHugePageChunks;
+  }
+
+  // the tail of the previous chunk is a multiple of the granularity; keep it on a free list
+  size_t tailSize = static_cast<size_t>(m_bumpEnd - m_bumpPos);
+  if (tailSize >= SIZE_CLASS_GRANULARITY) {
+    size_t sizeClass = getSizeClass(tailSize);
+    auto block = reinterpret_cast<FreeBlock*>(m_bumpPos);
+    block->next = m_freeLists[sizeClass];
+    m_freeLists[sizeClass] = block;
+    m_nFreeBytes += tailSize;
+  }
+
+  m_bumpPos = static_cast<uint8_t*>(chunk);
+  m_bumpEnd = m_bumpPos + CHUNK_SIZE;
+  NFD_LOG_DEBUG("mapped chunk " << chunk << (isHuge ? " with huge pages" : "") <<
+                ", " << m_chunks.size() << " chunks total");
+  return true;
+}
+
+TableArena&
+getTableArena()
+{
+  // never destroyed, because table entries may be released during static destruction
+  static TableArena* arena = new TableArena;
+  return *arena;
+}
+
+} // namespace nfd
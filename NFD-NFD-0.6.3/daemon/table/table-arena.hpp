@@ -0,0 +1,245 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_TABLE_ARENA_HPP
+#define NFD_DAEMON_TABLE_TABLE_ARENA_HPP
+
+#include "core/common.hpp"
+
+#include <ndn-cxx/encoding/nfd-constants.hpp>
+
+#include <array>
+
+namespace nfd {
+
+/** \brief a memory pool for NameTree nodes, PIT entries, and CS entries
+ *
+ *  When enabled, the arena maps memory in 2 MiB chunks aligned to 2 MiB, optionally backed by
+ *  transparent or explicit huge pages, and carves them into size classes. Table entries that
+ *  are allocated close in time end up close in memory, and a large table is covered by few
+ *  TLB entries. Released blocks are kept on per-size-class free lists; chunks are only
+ *  returned to the operating system when the arena is destroyed.
+ *
+ *  Allocations larger than the largest size class, and allocations that would exceed the
+ *  configured size limit, are served by the general heap.
+ *
+ *  \warning TableArena is not thread-safe. The global instance is used by the forwarding tables
+ *           and must only be accessed from the forwarding thread.
+ */
+class TableArena : noncopyable
+{
+public:
+  using PageMode = ndn::nfd::ArenaPageMode;
+
+  struct Options
+  {
+    /** \brief kind of pages backing newly mapped chunks; ARENA_PAGE_MODE_OFF disables the arena
+     */
+    PageMode pageMode = ndn::nfd::ARENA_PAGE_MODE_OFF;
+
+    /** \brief maximum number of octets mapped by the arena; 0 means unlimited
+     */
+    size_t maxSize = 0;
+  };
+
+  TableArena();
+
+  ~TableArena();
+
+  /** \brief change the options
+   *
+   *  New options apply to future allocations. Blocks allocated earlier stay where they are,
+   *  and can be released regardless of the current options.
+   */
+  void
+  setOptions(const Options& options);
+
+  const Options&
+  getOptions() const
+  {
+    return m_options;
+  }
+
+  /** \brief allocate \p size octets
+   *  \throw std::bad_alloc
+   */
+  void*
+  allocate(size_t size);
+
+  /** \brief release a block returned by allocate(size)
+   */
+  void
+  deallocate(void* ptr, size_t size) noexcept;
+
+  /** \brief number of chunks mapped so far
+   */
+  size_t
+  getNChunks() const
+  {
+    return m_chunks.size();
+  }
+
+  /** \brief number of chunks that were mapped with huge pages
+   */
+  size_t
+  getNHugePageChunks() const
+  {
+    return m_nHugePageChunks;
+  }
+
+  /** \brief number of octets mapped so far
+   */
+  size_t
+  getNMappedBytes() const
+  {
+    return m_chunks.size() * CHUNK_SIZE;
+  }
+
+  /** \brief number of octets, rounded up to size classes, handed out and not yet released
+   */
+  size_t
+  getNAllocatedBytes() const
+  {
+    return m_nAllocatedBytes;
+  }
+
+  /** \brief number of octets held on free lists
+   *
+   *  This is the external fragmentation of the arena: memory that was released by one size
+   *  class and cannot be reused by another.
+   */
+  size_t
+  getNFreeBytes() const
+  {
+    return m_nFreeBytes;
+  }
+
+  /** \brief number of allocations served by the general heap while the arena is enabled
+   */
+  uint64_t
+  getNFallbackAllocations() const
+  {
+    return m_nFallbackAllocations;
+  }
+
+  /** \return whether \p ptr points into a chunk of this arena
+   */
+  bool
+  contains(const void* ptr) const;
+
+public:
+  static constexpr size_t CHUNK_SIZE = 2 * 1024 * 1024;
+  static constexpr size_t SIZE_CLASS_GRANULARITY = 16;
+  static constexpr size_t MAX_BLOCK_SIZE = 1024;
+  static constexpr size_t N_SIZE_CLASSES = MAX_BLOCK_SIZE / SIZE_CLASS_GRANULARITY;
+
+private:
+  static constexpr size_t
+  getSizeClass(size_t size)
+  {
+    return (size + SIZE_CLASS_GRANULARITY - 1) / SIZE_CLASS_GRANULARITY - 1;
+  }
+
+  static constexpr size_t
+  getBlockSize(size_t sizeClass)
+  {
+    return (sizeClass + 1) * SIZE_CLASS_GRANULARITY;
+  }
+
+  /** \brief map a new chunk and make it the current bump region
+   *  \return whether a chunk was mapped
+   */
+  bool
+  mapChunk();
+
+private:
+  struct FreeBlock
+  {
+    FreeBlock* next;
+  };
+
+  Options m_options;
+  std::array<FreeBlock*, N_SIZE_CLASSES> m_freeLists;
+  uint8_t* m_bumpPos;
+  uint8_t* m_bumpEnd;
+  std::unordered_set<uintptr_t> m_chunks;
+  bool m_hasWarnedExplicit;
+
+  size_t m_nHugePageChunks;
+  size_t m_nAllocatedBytes;
+  size_t m_nFreeBytes;
+  uint64_t m_nFallbackAllocations;
+};
+
+/** \return the arena used by the forwarding tables
+ */
+TableArena&
+getTableArena();
+
+/** \brief an Allocator that places objects in the global TableArena
+ */
+template<typename T>
+class TableArenaAllocator
+{
+public:
+  using value_type = T;
+
+  TableArenaAllocator() noexcept = default;
+
+  template<typename U>
+  TableArenaAllocator(const TableArenaAllocator<U>&) noexcept
+  {
+  }
+
+  T*
+  allocate(size_t n)
+  {
+    return static_cast<T*>(getTableArena().allocate(n * sizeof(T)));
+  }
+
+  void
+  deallocate(T* ptr, size_t n) noexcept
+  {
+    getTableArena().deallocate(ptr, n * sizeof(T));
+  }
+};
+
+template<typename T, typename U>
+bool
+operator==(const TableArenaAllocator<T>&, const TableArenaAllocator<U>&) noexcept
+{
+  return true;
+}
+
+template<typename T, typename U>
+bool
+operator!=(const TableArenaAllocator<T>&, const TableArenaAllocator<U>&) noexcept
+{
+  return false;
+}
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_TABLE_ARENA_HPP
@@ -175,6 +175,8 @@ man_pages = [
     ('manpages/ndn-autoconfig.conf', 'ndn-autoconfig.conf', u'NDN auto-configuration client configuration file', '', 5),
     ('manpages/nfd-autoreg', 'nfd-autoreg', u'NFD auto-registration server', '', 1),
     ('manpages/nfd-asf-strategy', 'nfd-asf-strategy', u'NFD ASF strategy', '', 7),
+    ('manpages/nfd-consistent-hash-strategy', 'nfd-consistent-hash-strategy', u'NFD Consistent Hash strategy', '', 7),
+    ('manpages/nfd-segment-prefetch-strategy', 'nfd-segment-prefetch-strategy', u'NFD Segment Prefetch strategy', '', 7),
 ]
 
 
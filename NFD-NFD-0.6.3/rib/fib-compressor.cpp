@@ -0,0 +1,207 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fib-compressor.hpp"
+#include "core/logger.hpp"
+
+namespace nfd {
+namespace rib {
+
+NFD_LOG_INIT(FibCompressor);
+
+FibCompressor::FibUpdateList
+FibCompressor::compress(const FibUpdateList& updates)
+{
+  m_undo.clear();
+
+  std::set<Name> changed;
+  for (const FibUpdate& update : updates) {
+    Entry& entry = this->touch(update.name);
+    this->account(entry, -1);
+    if (update.action == FibUpdate::ADD_NEXTHOP) {
+      entry.nexthops[update.faceId] = update.cost;
+    }
+    else {
+      entry.nexthops.erase(update.faceId);
+    }
+    this->account(entry, +1);
+    changed.insert(update.name);
+  }
+
+  // a change to an entry can only affect the suppression of that entry and its nearest descendants
+  std::set<Name> affected(changed);
+  for (const Name& name : changed) {
+    this->collectChildren(name, affected);
+  }
+
+  FibUpdateList compressedUpdates;
+  for (const Name& name : affected) {
+    this->reevaluate(name, compressedUpdates);
+  }
+
+  NFD_LOG_DEBUG(updates.size() << " updates compressed to " << compressedUpdates.size() <<
+                ", nEntries=" << m_nEntries << " nInstalled=" << m_nInstalled);
+  return compressedUpdates;
+}
+
+void
+FibCompressor::rollback()
+{
+  for (auto& undo : m_undo) {
+    auto it = m_table.find(undo.first);
+    if (it != m_table.end()) {
+      this->account(it->second, -1);
+      m_table.erase(it);
+    }
+
+    if (undo.second) {
+      Entry& entry = m_table[undo.first] = *undo.second;
+      this->account(entry, +1);
+    }
+  }
+  m_undo.clear();
+}
+
+FibCompressor::NextHopMap
+FibCompressor::findLongestPrefixMatch(const Name& name) const
+{
+  for (ssize_t prefixLen = name.size(); prefixLen >= 0; --prefixLen) {
+    auto it = m_table.find(name.getPrefix(prefixLen));
+    if (it != m_table.end() && !it->second.nexthops.empty()) {
+      return it->second.nexthops;
+    }
+  }
+  return {};
+}
+
+FibCompressor::NextHopMap
+FibCompressor::findInstalledLongestPrefixMatch(const Name& name) const
+{
+  for (ssize_t prefixLen = name.size(); prefixLen >= 0; --prefixLen) {
+    auto it = m_table.find(name.getPrefix(prefixLen));
+    if (it != m_table.end() && !it->second.installed.empty()) {
+      return it->second.installed;
+    }
+  }
+  return {};
+}
+
+FibCompressor::Entry&
+FibCompressor::touch(const Name& name)
+{
+  auto it = m_table.find(name);
+  if (m_undo.count(name) == 0) {
+    m_undo.emplace(name, it == m_table.end() ? nullopt : optional<Entry>(it->second));
+  }
+
+  if (it == m_table.end()) {
+    it = m_table.emplace(name, Entry()).first;
+  }
+  return it->second;
+}
+
+const FibCompressor::Entry*
+FibCompressor::findParent(const Name& name) const
+{
+  for (ssize_t prefixLen = name.size() - 1; prefixLen >= 0; --prefixLen) {
+    auto it = m_table.find(name.getPrefix(prefixLen));
+    if (it != m_table.end() && !it->second.nexthops.empty()) {
+      return &it->second;
+    }
+  }
+  return nullptr;
+}
+
+void
+FibCompressor::collectChildren(const Name& prefix, std::set<Name>& names) const
+{
+  auto it = m_table.upper_bound(prefix);
+  while (it != m_table.end() && prefix.isPrefixOf(it->first)) {
+    if (it->second.nexthops.empty()) {
+      // not in the uncompressed FIB, so its descendants may be nearest descendants of prefix
+      ++it;
+      continue;
+    }
+
+    names.insert(it->first);
+    // skip the subtree of a nearest descendant
+    it = m_table.lower_bound(it->first.getSuccessor());
+  }
+}
+
+void
+FibCompressor::reevaluate(const Name& name, FibUpdateList& updates)
+{
+  auto it = m_table.find(name);
+  if (it == m_table.end()) {
+    return;
+  }
+
+  NextHopMap wanted;
+  if (!it->second.nexthops.empty()) {
+    const Entry* parent = this->findParent(name);
+    if (parent == nullptr || parent->nexthops != it->second.nexthops) {
+      wanted = it->second.nexthops;
+    }
+  }
+
+  if (wanted != it->second.installed) {
+    Entry& entry = this->touch(name);
+    for (const auto& nexthop : entry.installed) {
+      if (wanted.count(nexthop.first) == 0) {
+        updates.push_back(FibUpdate::createRemoveUpdate(name, nexthop.first));
+      }
+    }
+    for (const auto& nexthop : wanted) {
+      auto installed = entry.installed.find(nexthop.first);
+      if (installed == entry.installed.end() || installed->second != nexthop.second) {
+        updates.push_back(FibUpdate::createAddUpdate(name, nexthop.first, nexthop.second));
+      }
+    }
+
+    this->account(entry, -1);
+    entry.installed = std::move(wanted);
+    this->account(entry, +1);
+  }
+
+  if (it->second.nexthops.empty() && it->second.installed.empty()) {
+    this->touch(name);
+    m_table.erase(it);
+  }
+}
+
+void
+FibCompressor::account(const Entry& entry, int delta)
+{
+  if (!entry.nexthops.empty()) {
+    m_nEntries += delta;
+  }
+  if (!entry.installed.empty()) {
+    m_nInstalled += delta;
+  }
+}
+
+} // namespace rib
+} // namespace nfd
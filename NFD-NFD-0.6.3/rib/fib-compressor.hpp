@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_RIB_FIB_COMPRESSOR_HPP
+#define NFD_RIB_FIB_COMPRESSOR_HPP
+
+#include "core/common.hpp"
+#include "fib-update.hpp"
+
+#include <map>
+
+namespace nfd {
+namespace rib {
+
+/** \brief suppresses FIB entries that forward like their nearest ancestor
+ *
+ *  FibCompressor tracks the FIB computed from the RIB (the uncompressed FIB) by applying the
+ *  FibUpdates computed for each RIB update, and decides which of its entries are installed in
+ *  the FIB of NFD (the compressed FIB). An entry is suppressed if its nearest ancestor in the
+ *  uncompressed FIB has the same nexthops with the same costs; otherwise it is installed.
+ *  A longest prefix match in the compressed FIB therefore finds the same nexthops as in the
+ *  uncompressed FIB, while redundant entries do not occupy the FIB and the NameTree.
+ *
+ *  Since suppression depends only on an entry and its nearest ancestor, a change to an entry
+ *  only affects that entry and its nearest descendants, which are re-installed as needed.
+ */
+class FibCompressor : noncopyable
+{
+public:
+  using FibUpdateList = std::list<FibUpdate>;
+
+  /// FaceId => cost
+  using NextHopMap = std::map<uint64_t, uint64_t>;
+
+  /** \brief applies updates to the uncompressed FIB
+   *  \param updates FibUpdates computed for a batch of RIB updates
+   *  \return FibUpdates to the compressed FIB
+   *
+   *  The previous batch is considered applied, unless rollback() was invoked after it.
+   */
+  FibUpdateList
+  compress(const FibUpdateList& updates);
+
+  /** \brief reverts the last compress(), after its FibUpdates failed to apply
+   */
+  void
+  rollback();
+
+  /** \return number of entries in the uncompressed FIB
+   */
+  size_t
+  size() const
+  {
+    return m_nEntries;
+  }
+
+  /** \return number of entries in the compressed FIB
+   */
+  size_t
+  getNInstalled() const
+  {
+    return m_nInstalled;
+  }
+
+  /** \return nexthops found by longest prefix match of \p name in the uncompressed FIB
+   */
+  NextHopMap
+  findLongestPrefixMatch(const Name& name) const;
+
+  /** \return nexthops found by longest prefix match of \p name in the compressed FIB
+   */
+  NextHopMap
+  findInstalledLongestPrefixMatch(const Name& name) const;
+
+private:
+  struct Entry
+  {
+    /// nexthops in the uncompressed FIB
+    NextHopMap nexthops;
+    /// nexthops in the compressed FIB, either equal to \p nexthops or empty
+    NextHopMap installed;
+  };
+
+  using Table = std::map<Name, Entry>;
+
+  /** \brief returns the entry of \p name for modification, remembering its previous state
+   */
+  Entry&
+  touch(const Name& name);
+
+  /** \return nearest ancestor of \p name in the uncompressed FIB, or nullptr
+   */
+  const Entry*
+  findParent(const Name& name) const;
+
+  /** \brief adds the nearest descendants of \p prefix in the uncompressed FIB to \p names
+   */
+  void
+  collectChildren(const Name& prefix, std::set<Name>& names) const;
+
+  /** \brief decides whether \p name is installed, and appends the resulting FibUpdates
+   */
+  void
+  reevaluate(const Name& name, FibUpdateList& updates);
+
+  void
+  account(const Entry& entry, int delta);
+
+private:
+  Table m_table;
+  /// state of each entry before the last compress(); nullopt if the entry did not exist
+  std::map<Name, optional<Entry>> m_undo;
+  size_t m_nEntries = 0;
+  size_t m_nInstalled = 0;
+};
+
+} // namespace rib
+} // namespace nfd
+
+#endif // NFD_RIB_FIB_COMPRESSOR_HPP
@@ -27,6 +27,7 @@
 #include "core/logger.hpp"
 
 #include <ndn-cxx/mgmt/nfd/control-parameters.hpp>
+#include <ndn-cxx/mgmt/nfd/status-dataset.hpp>
 
 namespace nfd {
 namespace rib {
@@ -45,6 +46,17 @@ FibUpdater::FibUpdater(Rib& rib, ndn::nfd::Controller& controller)
   rib.setFibUpdater(this);
 }
 
+void
+FibUpdater::setCompressionEnabled(bool isEnabled)
+{
+  if (isEnabled == this->isCompressionEnabled()) {
+    return;
+  }
+
+  NFD_LOG_INFO("FIB compression " << (isEnabled ? "enabled" : "disabled"));
+  m_compressor = isEnabled ? make_unique<FibCompressor>() : nullptr;
+}
+
 void
 FibUpdater::computeAndSendFibUpdates(const RibUpdateBatch& batch,
                                      const FibUpdateSuccessCallback& onSuccess,
@@ -61,7 +73,17 @@ FibUpdater::computeAndSendFibUpdates(const RibUpdateBatch& batch,
 
   computeUpdates(batch);
 
-  sendUpdatesForBatchFaceId(onSuccess, onFailure);
+  if (m_compressor == nullptr) {
+    sendUpdatesForBatchFaceId(onSuccess, onFailure);
+    return;
+  }
+
+  sendUpdatesForBatchFaceId(onSuccess,
+    [this, onFailure] (uint32_t code, const std::string& error) {
+      // the compressed FIB was not updated, so the batch must not be reflected in the compressor
+      m_compressor->rollback();
+      onFailure(code, error);
+    });
 }
 
 void
@@ -69,6 +91,9 @@ FibUpdater::computeUpdates(const RibUpdateBatch& batch)
 {
   NFD_LOG_DEBUG("Computing updates for batch with faceID: " << batch.getFaceId());
 
+  bool isFaceRemoved = false;
+  m_shouldVerifyBatchFace = false;
+
   // Compute updates and add to m_fibUpdates
   for (const RibUpdate& update : batch) {
     switch (update.getAction()) {
@@ -80,13 +105,36 @@ FibUpdater::computeUpdates(const RibUpdateBatch& batch)
         break;
       case RibUpdate::REMOVE_FACE:
         computeUpdatesForUnregistration(update);
-
-        // Do not apply updates with the same face ID as the destroyed face
-        // since they will be rejected by the FIB
-        m_updatesForBatchFaceId.clear();
+        isFaceRemoved = true;
         break;
     }
   }
+
+  if (m_compressor != nullptr) {
+    // If every nexthop on the batch face is suppressed, no command would reach NFD to
+    // reject a route on a nonexistent face, so the face must be verified separately
+    bool hasBatchFaceAdd = std::any_of(m_updatesForBatchFaceId.begin(),
+                                       m_updatesForBatchFaceId.end(),
+                                       [] (const FibUpdate& update) {
+                                         return update.action == FibUpdate::ADD_NEXTHOP;
+                                       });
+
+    FibUpdateList updates;
+    updates.splice(updates.end(), m_updatesForBatchFaceId);
+    updates.splice(updates.end(), m_updatesForNonBatchFaceId);
+
+    for (const FibUpdate& update : m_compressor->compress(updates)) {
+      addFibUpdate(update);
+    }
+
+    m_shouldVerifyBatchFace = hasBatchFaceAdd && !isFaceRemoved && m_updatesForBatchFaceId.empty();
+  }
+
+  if (isFaceRemoved) {
+    // Do not apply updates with the same face ID as the destroyed face
+    // since they will be rejected by the FIB
+    m_updatesForBatchFaceId.clear();
+  }
 }
 
 void
@@ -212,11 +260,45 @@ FibUpdater::sendUpdatesForBatchFaceId(const FibUpdateSuccessCallback& onSuccess,
   if (m_updatesForBatchFaceId.size() > 0) {
     sendUpdates(m_updatesForBatchFaceId, onSuccess, onFailure);
   }
+  else if (m_shouldVerifyBatchFace) {
+    verifyBatchFace(onSuccess, onFailure);
+  }
   else {
     sendUpdatesForNonBatchFaceId(onSuccess, onFailure);
   }
 }
 
+void
+FibUpdater::verifyBatchFace(const FibUpdateSuccessCallback& onSuccess,
+                            const FibUpdateFailureCallback& onFailure,
+                            uint32_t nTimeouts)
+{
+  NFD_LOG_DEBUG("Verifying that face " << m_batchFaceId << " exists");
+
+  m_controller.fetch<ndn::nfd::FaceQueryDataset>(
+    ndn::nfd::FaceQueryFilter().setFaceId(m_batchFaceId),
+    [=] (const std::vector<ndn::nfd::FaceStatus>& faces) {
+      if (faces.empty()) {
+        NFD_LOG_DEBUG("Face " << m_batchFaceId << " does not exist");
+        onFailure(ERROR_FACE_NOT_FOUND, "Face not found");
+      }
+      else {
+        sendUpdatesForNonBatchFaceId(onSuccess, onFailure);
+      }
+    },
+    [=] (uint32_t code, const std::string& reason) {
+      NFD_LOG_DEBUG("Failed to verify face " << m_batchFaceId <<
+                    " (code: " << code << ", error: " << reason << ")");
+
+      if (code == ndn::nfd::Controller::ERROR_TIMEOUT && nTimeouts < MAX_NUM_TIMEOUTS) {
+        verifyBatchFace(onSuccess, onFailure, nTimeouts + 1);
+      }
+      else {
+        onFailure(code, reason);
+      }
+    });
+}
+
 void
 FibUpdater::sendUpdatesForNonBatchFaceId(const FibUpdateSuccessCallback& onSuccess,
                                          const FibUpdateFailureCallback& onFailure)
@@ -27,6 +27,7 @@
 #define NFD_RIB_FIB_UPDATER_HPP
 
 #include "core/common.hpp"
+#include "fib-compressor.hpp"
 #include "fib-update.hpp"
 #include "rib.hpp"
 #include "rib-update-batch.hpp"
@@ -70,6 +71,29 @@ public:
                            const FibUpdateSuccessCallback& onSuccess,
                            const FibUpdateFailureCallback& onFailure);
 
+  /** \brief enables or disables FIB compression
+   *
+   *  When enabled, computed FibUpdates pass through a FibCompressor, so that FIB entries
+   *  forwarding like their nearest ancestor are not installed in NFD.
+   *  This should only be changed while the RIB is empty.
+   */
+  void
+  setCompressionEnabled(bool isEnabled);
+
+  bool
+  isCompressionEnabled() const
+  {
+    return m_compressor != nullptr;
+  }
+
+  /** \return the FibCompressor, or nullptr if FIB compression is disabled
+   */
+  const FibCompressor*
+  getCompressor() const
+  {
+    return m_compressor.get();
+  }
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /** \brief determines the type of action that will be performed on the RIB and calls the
   *          corresponding computation method
@@ -91,12 +115,26 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
               const FibUpdateFailureCallback& onFailure);
 
   /** \brief sends the updates in m_updatesForBatchFaceId to NFD if any exist,
-  *          otherwise calls FibUpdater::sendUpdatesForNonBatchFaceId.
+  *          otherwise calls FibUpdater::verifyBatchFace if the face must be verified,
+  *          or FibUpdater::sendUpdatesForNonBatchFaceId.
   */
   void
   sendUpdatesForBatchFaceId(const FibUpdateSuccessCallback& onSuccess,
                             const FibUpdateFailureCallback& onFailure);
 
+  /** \brief queries NFD for the face of the batch, then calls
+  *          FibUpdater::sendUpdatesForNonBatchFaceId if it exists, otherwise fails the batch.
+  *
+  *   Used when FIB compression suppressed every nexthop on the face of the batch, so that a
+  *   route on a nonexistent face is rejected as if its FibAddNextHopCommand had been sent.
+  *
+  *   \param nTimeouts the number of times the query has failed due to timeout
+  */
+  void
+  verifyBatchFace(const FibUpdateSuccessCallback& onSuccess,
+                  const FibUpdateFailureCallback& onFailure,
+                  uint32_t nTimeouts = 0);
+
   /** \brief sends the updates in m_updatesForNonBatchFaceId to NFD if any exist,
   *          otherwise calls onSuccess.
   */
@@ -258,6 +296,9 @@ private:
   const Rib& m_rib;
   ndn::nfd::Controller& m_controller;
   uint64_t m_batchFaceId;
+  unique_ptr<FibCompressor> m_compressor;
+  /// whether the face of the batch must be verified because no command is sent on it
+  bool m_shouldVerifyBatchFace = false;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   FibUpdateList m_updatesForBatchFaceId;
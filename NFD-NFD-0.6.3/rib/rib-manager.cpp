@@ -55,13 +55,15 @@ RibManager::RibManager(Rib& rib, ndn::Face& face, ndn::nfd::Controller& nfdContr
   , m_localhostValidator(face)
   , m_localhopValidator(face)
   , m_isLocalhopEnabled(false)
+  , m_hasExpiringRoutes(false)
 {
   registerCommandHandler<ndn::nfd::RibRegisterCommand>("register",
     bind(&RibManager::registerEntry, this, _2, _3, _4, _5));
   registerCommandHandler<ndn::nfd::RibUnregisterCommand>("unregister",
     bind(&RibManager::unregisterEntry, this, _2, _3, _4, _5));
 
-  registerStatusDatasetHandler("list", bind(&RibManager::listEntries, this, _1, _2, _3));
+  registerStatusDatasetHandler("list", bind(&RibManager::listEntries, this, _1, _2, _3),
+                               bind(&RibManager::getListEpoch, this));
 }
 
 void
@@ -265,6 +267,7 @@ RibManager::listEntries(const Name& topPrefix, const Interest& interest,
                         ndn::mgmt::StatusDatasetContext& context)
 {
   auto now = time::steady_clock::now();
+  m_hasExpiringRoutes = false;
   for (const auto& kv : m_rib) {
     const RibEntry& entry = *kv.second;
     ndn::nfd::RibEntry item;
@@ -277,6 +280,7 @@ RibManager::listEntries(const Name& topPrefix, const Interest& interest,
       r.setFlags(route.flags);
       if (route.expires) {
         r.setExpirationPeriod(time::duration_cast<time::milliseconds>(*route.expires - now));
+        m_hasExpiringRoutes = true;
       }
       item.addRoute(r);
     }
@@ -285,6 +289,15 @@ RibManager::listEntries(const Name& topPrefix, const Interest& interest,
   context.end();
 }
 
+uint64_t
+RibManager::getListEpoch() const
+{
+  if (m_hasExpiringRoutes) {
+    return makeTimeDependentEpoch(m_rib.getEpoch());
+  }
+  return m_rib.getEpoch();
+}
+
 void
 RibManager::setFaceForSelfRegistration(const Interest& request, ControlParameters& parameters)
 {
@@ -141,6 +141,11 @@ private: // management Dispatcher related
   listEntries(const Name& topPrefix, const Interest& interest,
               ndn::mgmt::StatusDatasetContext& context);
 
+  /** \brief Epoch of rib/list dataset.
+   */
+  uint64_t
+  getListEpoch() const;
+
   void
   setFaceForSelfRegistration(const Interest& request, ControlParameters& parameters);
 
@@ -186,6 +191,7 @@ private:
   ndn::ValidatorConfig m_localhostValidator;
   ndn::ValidatorConfig m_localhopValidator;
   bool m_isLocalhopEnabled;
+  bool m_hasExpiringRoutes; ///< whether the last rib/list response contains ExpirationPeriod
 
 private:
   scheduler::ScopedEventId m_activeFaceFetchEvent;
@@ -47,6 +47,7 @@ sortRoutes(const Route& lhs, const Route& rhs)
 
 Rib::Rib()
   : m_nItems(0)
+  , m_epoch(0)
   , m_isUpdateInProgress(false)
 {
 }
@@ -85,6 +86,7 @@ Rib::find(const Name& prefix, const Route& route) const
 void
 Rib::insert(const Name& prefix, const Route& route)
 {
+  ++m_epoch;
   auto ribIt = m_rib.find(prefix);
 
   // Name prefix exists
@@ -175,6 +177,7 @@ Rib::erase(const Name& prefix, const Route& route)
       auto faceId = route.faceId;
       entry->eraseRoute(routeIt);
       m_nItems--;
+      ++m_epoch;
 
       // If this RibEntry no longer has this faceId, unregister from face lookup table
       if (!entry->hasFaceId(faceId)) {
@@ -91,6 +91,11 @@ public:
   bool
   empty() const;
 
+  /** \return a number that changes whenever a route is inserted, updated, or erased
+   */
+  uint64_t
+  getEpoch() const;
+
   shared_ptr<RibEntry>
   findParent(const Name& prefix) const;
 
@@ -254,6 +259,7 @@ private:
   FibUpdater* m_fibUpdater;
 
   size_t m_nItems;
+  uint64_t m_epoch;
 
   friend class FibUpdater;
 
@@ -297,6 +303,12 @@ Rib::empty() const
   return m_rib.empty();
 }
 
+inline uint64_t
+Rib::getEpoch() const
+{
+  return m_epoch;
+}
+
 std::ostream&
 operator<<(std::ostream& os, const Rib& rib);
 
@@ -50,6 +50,7 @@ static const std::string CFG_LOCALHOST_SECURITY = "localhost_security";
 static const std::string CFG_LOCALHOP_SECURITY = "localhop_security";
 static const std::string CFG_PREFIX_PROPAGATE = "auto_prefix_propagate";
 static const std::string CFG_READVERTISE_NLSR = "readvertise_nlsr";
+static const std::string CFG_FIB_COMPRESSION = "fib_compression";
 static const Name READVERTISE_NLSR_PREFIX = "/localhost/nlsr";
 
 static ConfigSection
@@ -171,6 +172,9 @@ Service::checkConfig(const ConfigSection& section, const std::string& filename)
     else if (key == CFG_READVERTISE_NLSR) {
       ConfigFile::parseYesNo(item, CFG_SECTION + "." + CFG_READVERTISE_NLSR);
     }
+    else if (key == CFG_FIB_COMPRESSION) {
+      ConfigFile::parseYesNo(item, CFG_SECTION + "." + CFG_FIB_COMPRESSION);
+    }
     else {
       BOOST_THROW_EXCEPTION(ConfigFile::Error("Unrecognized option " + CFG_SECTION + "." + key));
     }
@@ -182,6 +186,7 @@ Service::applyConfig(const ConfigSection& section, const std::string& filename)
 {
   bool wantPrefixPropagate = false;
   bool wantReadvertiseNlsr = false;
+  bool wantFibCompression = false;
 
   for (const auto& item : section) {
     const std::string& key = item.first;
@@ -203,6 +208,9 @@ Service::applyConfig(const ConfigSection& section, const std::string& filename)
     else if (key == CFG_READVERTISE_NLSR) {
       wantReadvertiseNlsr = ConfigFile::parseYesNo(item, CFG_SECTION + "." + CFG_READVERTISE_NLSR);
     }
+    else if (key == CFG_FIB_COMPRESSION) {
+      wantFibCompression = ConfigFile::parseYesNo(item, CFG_SECTION + "." + CFG_FIB_COMPRESSION);
+    }
     else {
       BOOST_THROW_EXCEPTION(ConfigFile::Error("Unrecognized option " + CFG_SECTION + "." + key));
     }
@@ -223,6 +231,17 @@ Service::applyConfig(const ConfigSection& section, const std::string& filename)
     NFD_LOG_DEBUG("Disabling readvertise-to-nlsr");
     m_readvertiseNlsr.reset();
   }
+
+  if (wantFibCompression != m_fibUpdater.isCompressionEnabled()) {
+    // the compressor must observe every FIB update since the RIB was empty
+    if (m_rib.empty()) {
+      m_fibUpdater.setCompressionEnabled(wantFibCompression);
+    }
+    else {
+      NFD_LOG_WARN("Cannot change " << CFG_SECTION << "." << CFG_FIB_COMPRESSION <<
+                   " while the RIB is not empty; restart NFD to apply");
+    }
+  }
 }
 
 } // namespace rib
@@ -0,0 +1,131 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/io-runner.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <boost/asio/deadline_timer.hpp>
+#include <boost/thread.hpp>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace nfd {
+namespace tests {
+
+BOOST_FIXTURE_TEST_SUITE(TestIoRunner, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(Blocking)
+{
+  boost::asio::io_service io;
+  IoRunner runner(io, IoRunner::Options());
+  BOOST_CHECK(IoRunner::getCurrent() == nullptr);
+
+  int nRuns = 0;
+  io.post([&] {
+    ++nRuns;
+    BOOST_CHECK(IoRunner::getCurrent() == &runner);
+    io.post([&] { ++nRuns; });
+  });
+  runner.run();
+
+  BOOST_CHECK_EQUAL(nRuns, 2);
+  BOOST_CHECK(IoRunner::getCurrent() == nullptr);
+  BOOST_CHECK_EQUAL(runner.getBusyTime().count(), 0);
+  BOOST_CHECK_EQUAL(runner.getIdleTime().count(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(BusyPoll)
+{
+  boost::asio::io_service io;
+  IoRunner::Options options;
+  options.wantBusyPoll = true;
+  options.spinDuration = time::milliseconds(5);
+  IoRunner runner(io, options);
+
+  // the second timer fires after the loop has stopped spinning and blocked
+  int nExpirations = 0;
+  boost::asio::deadline_timer timer1(io, boost::posix_time::milliseconds(2));
+  boost::asio::deadline_timer timer2(io, boost::posix_time::milliseconds(30));
+  auto onExpire = [&] (const boost::system::error_code& error) {
+    BOOST_CHECK(!error);
+    BOOST_CHECK(IoRunner::getCurrent() == &runner);
+    ++nExpirations;
+  };
+  timer1.async_wait(onExpire);
+  timer2.async_wait(onExpire);
+  runner.run();
+
+  BOOST_CHECK_EQUAL(nExpirations, 2);
+  BOOST_CHECK(IoRunner::getCurrent() == nullptr);
+  BOOST_CHECK_GT(runner.getBusyTime().count(), 0);
+  BOOST_CHECK_GE(runner.getIdleTime(), time::milliseconds(25));
+}
+
+BOOST_AUTO_TEST_CASE(BusyPollStop)
+{
+  boost::asio::io_service io;
+  boost::asio::io_service::work work(io);
+  IoRunner::Options options;
+  options.wantBusyPoll = true;
+  IoRunner runner(io, options);
+
+  io.post([&] { io.stop(); });
+  runner.run();
+  BOOST_CHECK(io.stopped());
+}
+
+BOOST_AUTO_TEST_CASE(Affinity)
+{
+  BOOST_CHECK_EQUAL(setThreadAffinity(-1), false);
+
+#ifdef __linux__
+  // pin to a CPU this process is allowed to run on
+  cpu_set_t allowed;
+  BOOST_REQUIRE_EQUAL(::sched_getaffinity(0, sizeof(allowed), &allowed), 0);
+  int cpu = 0;
+  while (!CPU_ISSET(cpu, &allowed)) {
+    ++cpu;
+  }
+
+  bool isPinned = false;
+  cpu_set_t actual;
+  boost::thread t([&] {
+    isPinned = setThreadAffinity(cpu);
+    ::sched_getaffinity(0, sizeof(actual), &actual);
+  });
+  t.join();
+  BOOST_CHECK_EQUAL(isPinned, true);
+  BOOST_CHECK_EQUAL(CPU_COUNT(&actual), 1);
+  BOOST_CHECK(CPU_ISSET(cpu, &actual));
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestIoRunner
+
+} // namespace tests
+} // namespace nfd
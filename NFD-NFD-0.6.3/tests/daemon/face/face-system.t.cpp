@@ -25,6 +25,11 @@
 
 #include "face/face-system.hpp"
 #include "face-system-fixture.hpp"
+#include "face/socket-utils.hpp"
+
+#ifdef HAVE_IO_URING
+#include "face/io-uring-service.hpp"
+#endif
 
 #include "tests/test-common.hpp"
 
@@ -175,6 +180,88 @@ BOOST_AUTO_TEST_CASE(UnknownSection)
   BOOST_CHECK_THROW(parseConfig(CONFIG, false), ConfigFile::Error);
 }
 
+BOOST_AUTO_TEST_CASE(IoBackend)
+{
+  const std::string CONFIG_ASIO = R"CONFIG(
+    face_system
+    {
+      general
+      {
+        io_backend asio
+      }
+    }
+  )CONFIG";
+
+  const std::string CONFIG_IO_URING = R"CONFIG(
+    face_system
+    {
+      general
+      {
+        io_backend io_uring
+      }
+    }
+  )CONFIG";
+
+  const std::string CONFIG_INVALID = R"CONFIG(
+    face_system
+    {
+      general
+      {
+        io_backend epoll
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_NO_THROW(parseConfig(CONFIG_ASIO, true));
+  BOOST_CHECK_NO_THROW(parseConfig(CONFIG_ASIO, false));
+  BOOST_CHECK_THROW(parseConfig(CONFIG_INVALID, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG_INVALID, false), ConfigFile::Error);
+
+#ifdef HAVE_IO_URING
+  parseConfig(CONFIG_IO_URING, true);
+  BOOST_CHECK_EQUAL(IoUringService::isEnabled(), false);
+  parseConfig(CONFIG_IO_URING, false);
+  BOOST_CHECK_EQUAL(IoUringService::isEnabled(), true);
+  parseConfig(CONFIG_ASIO, false);
+  BOOST_CHECK_EQUAL(IoUringService::isEnabled(), false);
+#else
+  BOOST_CHECK_THROW(parseConfig(CONFIG_IO_URING, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(parseConfig(CONFIG_IO_URING, false), ConfigFile::Error);
+#endif // HAVE_IO_URING
+}
+
+BOOST_AUTO_TEST_CASE(SocketBusyPoll)
+{
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      general
+      {
+        socket_busy_poll 50
+      }
+    }
+  )CONFIG";
+
+  const std::string CONFIG_INVALID = R"CONFIG(
+    face_system
+    {
+      general
+      {
+        socket_busy_poll fast
+      }
+    }
+  )CONFIG";
+
+  parseConfig(CONFIG, true);
+  BOOST_CHECK_EQUAL(getSocketBusyPollTimeout(), time::microseconds::zero());
+  parseConfig(CONFIG, false);
+  BOOST_CHECK_EQUAL(getSocketBusyPollTimeout(), time::microseconds(50));
+  BOOST_CHECK_THROW(parseConfig(CONFIG_INVALID, true), ConfigFile::Error);
+
+  parseConfig("face_system\n{\n}\n", false);
+  BOOST_CHECK_EQUAL(getSocketBusyPollTimeout(), time::microseconds::zero());
+}
+
 BOOST_AUTO_TEST_CASE(ChangeProvidedSchemes)
 {
   faceSystem.m_factories["f1"] = make_unique<DummyProtocolFactory>(faceSystem.makePFCtorParams());
@@ -0,0 +1,252 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/io-uring-service.hpp"
+
+#include "tests/limited-io.hpp"
+#include "tests/test-common.hpp"
+
+#include <numeric>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace nfd {
+namespace face {
+namespace tests {
+
+using namespace nfd::tests;
+
+class IoUringFixture : public BaseFixture
+{
+protected:
+  IoUringFixture()
+  {
+    IoUringService::setEnabled(true);
+  }
+
+  ~IoUringFixture()
+  {
+    a.reset();
+    b.reset();
+    for (int fd : fds) {
+      ::close(fd);
+    }
+    IoUringService::setEnabled(false);
+  }
+
+  /** \return false if io_uring is not supported by the kernel
+   */
+  bool
+  initialize(int type)
+  {
+    BOOST_REQUIRE_EQUAL(::socketpair(AF_UNIX, type | SOCK_CLOEXEC, 0, fds), 0);
+
+    bool isStream = type == SOCK_STREAM;
+    a = IoUringSocket::create(fds[0], isStream,
+          [this] (const uint8_t*, size_t, const boost::system::error_code&) {
+            BOOST_FAIL("unexpected receive on a");
+          },
+          [this] (const boost::system::error_code& error, size_t nBytesSent) {
+            BOOST_CHECK(!error);
+            sentSizes.push_back(nBytesSent);
+            if (wantCountSends) {
+              limitedIo.afterOp();
+            }
+          });
+    b = IoUringSocket::create(fds[1], isStream,
+          [this] (const uint8_t* buffer, size_t nBytesReceived, const boost::system::error_code& error) {
+            if (error) {
+              receiveErrors.push_back(error);
+            }
+            else {
+              received.insert(received.end(), buffer, buffer + nBytesReceived);
+              receivedSizes.push_back(nBytesReceived);
+              if (received.size() < nExpectedOctets) {
+                return;
+              }
+            }
+            limitedIo.afterOp();
+          },
+          [] (const boost::system::error_code&, size_t) {
+            BOOST_FAIL("unexpected send on b");
+          });
+    return a != nullptr && b != nullptr;
+  }
+
+protected:
+  LimitedIo limitedIo;
+  int fds[2] = {-1, -1};
+  unique_ptr<IoUringSocket> a;
+  unique_ptr<IoUringSocket> b;
+
+  bool wantCountSends = true;
+  size_t nExpectedOctets = 0;
+
+  std::vector<size_t> sentSizes;
+  std::vector<uint8_t> received;
+  std::vector<size_t> receivedSizes;
+  std::vector<boost::system::error_code> receiveErrors;
+};
+
+#define SKIP_IF_IO_URING_UNAVAILABLE(type) \
+  do { \
+    if (!initialize(type)) { \
+      BOOST_WARN_MESSAGE(false, "skipping assertions that require io_uring"); \
+      return; \
+    } \
+  } while (false)
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_FIXTURE_TEST_SUITE(TestIoUringService, IoUringFixture)
+
+BOOST_AUTO_TEST_CASE(Disabled)
+{
+  IoUringService::setEnabled(false);
+  BOOST_REQUIRE_EQUAL(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds), 0);
+  BOOST_CHECK(IoUringSocket::create(fds[0], true, nullptr, nullptr) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Datagram)
+{
+  SKIP_IF_IO_URING_UNAVAILABLE(SOCK_DGRAM);
+
+  b->startReceive();
+  Block pkt1 = makeInterest("/A")->wireEncode();
+  Block pkt2 = makeData("/B")->wireEncode();
+  a->send(pkt1);
+  a->send(pkt2);
+
+  BOOST_CHECK_EQUAL(limitedIo.run(4, 1_s), LimitedIo::EXCEED_OPS);
+  BOOST_CHECK_EQUAL(sentSizes.size(), 2);
+  BOOST_REQUIRE_EQUAL(receivedSizes.size(), 2);
+  BOOST_CHECK_EQUAL(receivedSizes[0], pkt1.size());
+  BOOST_CHECK_EQUAL(receivedSizes[1], pkt2.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(received.begin(), received.begin() + pkt1.size(),
+                                pkt1.begin(), pkt1.end());
+  BOOST_CHECK_EQUAL_COLLECTIONS(received.begin() + pkt1.size(), received.end(),
+                                pkt2.begin(), pkt2.end());
+}
+
+BOOST_AUTO_TEST_CASE(StreamManyPackets)
+{
+  SKIP_IF_IO_URING_UNAVAILABLE(SOCK_STREAM);
+
+  // more octets than the receive buffers and the socket buffer can hold at once
+  const size_t N_PACKETS = 600;
+  auto data = makeData("/large");
+  data->setContent(std::vector<uint8_t>(8000, 0xAB).data(), 8000);
+  Block packet = data->wireEncode();
+
+  wantCountSends = false;
+  nExpectedOctets = N_PACKETS * packet.size();
+  b->startReceive();
+  for (size_t i = 0; i < N_PACKETS; ++i) {
+    a->send(packet);
+  }
+
+  BOOST_CHECK_EQUAL(limitedIo.run(1, 5_s), LimitedIo::EXCEED_OPS);
+  limitedIo.defer(10_ms);
+  BOOST_CHECK_EQUAL(sentSizes.size(), N_PACKETS);
+  BOOST_CHECK(std::all_of(sentSizes.begin(), sentSizes.end(),
+                          [&] (size_t size) { return size == packet.size(); }));
+  BOOST_REQUIRE_EQUAL(received.size(), N_PACKETS * packet.size());
+  BOOST_CHECK(std::equal(packet.begin(), packet.end(), received.end() - packet.size()));
+  BOOST_CHECK(receiveErrors.empty());
+}
+
+BOOST_AUTO_TEST_CASE(StreamGatheredSend)
+{
+  SKIP_IF_IO_URING_UNAVAILABLE(SOCK_STREAM);
+
+  std::vector<Block> packets;
+  for (int i = 0; i < 50; ++i) {
+    auto data = makeData("/gather/" + to_string(i));
+    data->setContent(std::vector<uint8_t>(4000, static_cast<uint8_t>(i)).data(), 4000);
+    packets.push_back(data->wireEncode());
+  }
+  size_t totalSize = std::accumulate(packets.begin(), packets.end(), size_t(0),
+                                     [] (size_t sum, const Block& block) { return sum + block.size(); });
+
+  wantCountSends = false;
+  nExpectedOctets = totalSize;
+  b->startReceive();
+  a->send(packets.begin(), packets.end());
+
+  BOOST_CHECK_EQUAL(limitedIo.run(1, 5_s), LimitedIo::EXCEED_OPS);
+  limitedIo.defer(10_ms);
+  BOOST_REQUIRE_EQUAL(sentSizes.size(), 1);
+  BOOST_CHECK_EQUAL(sentSizes.front(), totalSize);
+
+  BOOST_REQUIRE_EQUAL(received.size(), totalSize);
+  auto it = received.begin();
+  for (const Block& packet : packets) {
+    BOOST_CHECK(std::equal(packet.begin(), packet.end(), it));
+    it += packet.size();
+  }
+}
+
+BOOST_AUTO_TEST_CASE(EndOfStream)
+{
+  SKIP_IF_IO_URING_UNAVAILABLE(SOCK_STREAM);
+
+  b->startReceive();
+  a->close();
+  ::shutdown(fds[0], SHUT_WR);
+
+  BOOST_CHECK_EQUAL(limitedIo.run(1, 1_s), LimitedIo::EXCEED_OPS);
+  BOOST_REQUIRE_EQUAL(receiveErrors.size(), 1);
+  BOOST_CHECK(receiveErrors.front() == boost::asio::error::eof);
+
+  // the receive is not restarted after an error
+  limitedIo.defer(10_ms);
+  BOOST_CHECK_EQUAL(receiveErrors.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Close)
+{
+  SKIP_IF_IO_URING_UNAVAILABLE(SOCK_DGRAM);
+
+  b->startReceive();
+  limitedIo.defer(10_ms);
+  b->close();
+  b->startReceive();
+
+  a->send(makeInterest("/A")->wireEncode());
+  BOOST_CHECK_EQUAL(limitedIo.run(1, 1_s), LimitedIo::EXCEED_OPS);
+  BOOST_CHECK_EQUAL(sentSizes.size(), 1);
+
+  // b received nothing because its operations were cancelled
+  limitedIo.defer(10_ms);
+  BOOST_CHECK(received.empty());
+  BOOST_CHECK(receiveErrors.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestIoUringService
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace tests
+} // namespace face
+} // namespace nfd
@@ -113,10 +113,8 @@ public:
   static bool
   netPktHasUnackedFrag(const shared_ptr<LpReliability::NetPkt>& netPkt, lp::Sequence txSeq)
   {
-    return std::any_of(netPkt->unackedFrags.begin(), netPkt->unackedFrags.end(),
-                       [txSeq] (const LpReliability::UnackedFrags::iterator& frag) {
-                         return frag->first == txSeq;
-                       });
+    return std::find(netPkt->unackedFrags.begin(), netPkt->unackedFrags.end(), txSeq) !=
+           netPkt->unackedFrags.end();
   }
 
   /** \brief make an LpPacket with fragment of specified size
@@ -210,7 +208,7 @@ BOOST_AUTO_TEST_CASE(SendUnfragmentedRetx)
                  reliability->m_unackedFrags.at(firstTxSeq + 1).netPkt);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(firstTxSeq).retxCount, 0);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(firstTxSeq + 1).retxCount, 0);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, firstTxSeq);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.getFirstSequence(), firstTxSeq);
   BOOST_CHECK_EQUAL(reliability->m_ackQueue.size(), 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -228,7 +226,7 @@ BOOST_AUTO_TEST_CASE(SendUnfragmentedRetx)
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(firstTxSeq + 2).retxCount, 1);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(firstTxSeq + 1), 1);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(firstTxSeq + 1).retxCount, 0);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, firstTxSeq + 1);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.getFirstSequence(), firstTxSeq + 1);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 3);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -247,7 +245,7 @@ BOOST_AUTO_TEST_CASE(SendUnfragmentedRetx)
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(firstTxSeq + 4).retxCount, 2);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(firstTxSeq + 3), 1);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(firstTxSeq + 3).retxCount, 1);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, firstTxSeq + 3);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.getFirstSequence(), firstTxSeq + 3);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 5);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -266,7 +264,7 @@ BOOST_AUTO_TEST_CASE(SendUnfragmentedRetx)
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(firstTxSeq + 6).retxCount, 3);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(firstTxSeq + 5), 1);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(firstTxSeq + 5).retxCount, 2);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, firstTxSeq + 5);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.getFirstSequence(), firstTxSeq + 5);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 7);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -283,7 +281,7 @@ BOOST_AUTO_TEST_CASE(SendUnfragmentedRetx)
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(firstTxSeq + 6), 0);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(firstTxSeq + 7), 1);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(firstTxSeq + 7).retxCount, 3);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, firstTxSeq + 7);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.getFirstSequence(), firstTxSeq + 7);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 8);
 
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
@@ -354,7 +352,7 @@ BOOST_AUTO_TEST_CASE(SendFragmentedRetx)
   BOOST_CHECK(netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 2));
   BOOST_CHECK(netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 3));
   BOOST_CHECK(netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 4));
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 2);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.getFirstSequence(), 2);
   BOOST_CHECK_EQUAL(reliability->m_ackQueue.size(), 0);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 3);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
@@ -389,7 +387,7 @@ BOOST_AUTO_TEST_CASE(SendFragmentedRetx)
   BOOST_CHECK(!netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 3));
   BOOST_CHECK(netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 5));
   BOOST_CHECK(netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 4));
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 2);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.getFirstSequence(), 2);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 4);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -423,7 +421,7 @@ BOOST_AUTO_TEST_CASE(SendFragmentedRetx)
   BOOST_CHECK(!netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 5));
   BOOST_CHECK(netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 6));
   BOOST_CHECK(netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 4));
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 2);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.getFirstSequence(), 2);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 5);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -457,7 +455,7 @@ BOOST_AUTO_TEST_CASE(SendFragmentedRetx)
   BOOST_CHECK(!netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 6));
   BOOST_CHECK(netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 7));
   BOOST_CHECK(netPktHasUnackedFrag(reliability->m_unackedFrags.at(2).netPkt, 4));
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 2);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.getFirstSequence(), 2);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 6);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -486,7 +484,7 @@ BOOST_AUTO_TEST_CASE(AckUnknownTxSeq)
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), 1);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(2), 1);
   BOOST_CHECK(reliability->m_unackedFrags.at(2).netPkt);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 2);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.getFirstSequence(), 2);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 1);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -500,7 +498,7 @@ BOOST_AUTO_TEST_CASE(AckUnknownTxSeq)
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), 1);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(2), 1);
   BOOST_CHECK(reliability->m_unackedFrags.at(2).netPkt);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 2);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.getFirstSequence(), 2);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 1);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -533,7 +531,7 @@ BOOST_AUTO_TEST_CASE(LossByGreaterAcks)
   BOOST_CHECK(reliability->m_unackedFrags.at(2).netPkt);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(3), 1); // pkt5
   BOOST_CHECK(reliability->m_unackedFrags.at(3).netPkt);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 0xFFFFFFFFFFFFFFFF);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.getFirstSequence(), 0xFFFFFFFFFFFFFFFF);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetxExhausted, 0);
@@ -549,18 +547,18 @@ BOOST_AUTO_TEST_CASE(LossByGreaterAcks)
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), 4);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(0xFFFFFFFFFFFFFFFF), 1); // pkt1
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(0xFFFFFFFFFFFFFFFF).retxCount, 0);
-  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(0xFFFFFFFFFFFFFFFF).nGreaterSeqAcks, 1);
+  BOOST_CHECK_EQUAL(reliability->countGreaterAcks(0xFFFFFFFFFFFFFFFF), 1);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(0), 0); // pkt2
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(1), 1); // pkt3
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(1).retxCount, 0);
-  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(1).nGreaterSeqAcks, 0);
+  BOOST_CHECK_EQUAL(reliability->countGreaterAcks(1), 0);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(2), 1); // pkt4
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(2).retxCount, 0);
-  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(2).nGreaterSeqAcks, 0);
+  BOOST_CHECK_EQUAL(reliability->countGreaterAcks(2), 0);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(3), 1); // pkt5
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(3).retxCount, 0);
-  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(3).nGreaterSeqAcks, 0);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 0xFFFFFFFFFFFFFFFF);
+  BOOST_CHECK_EQUAL(reliability->countGreaterAcks(3), 0);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.getFirstSequence(), 0xFFFFFFFFFFFFFFFF);
   BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 5);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 1);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -578,17 +576,17 @@ BOOST_AUTO_TEST_CASE(LossByGreaterAcks)
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), 3);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(0xFFFFFFFFFFFFFFFF), 1); // pkt1
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(0xFFFFFFFFFFFFFFFF).retxCount, 0);
-  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(0xFFFFFFFFFFFFFFFF).nGreaterSeqAcks, 2);
+  BOOST_CHECK_EQUAL(reliability->countGreaterAcks(0xFFFFFFFFFFFFFFFF), 2);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(0), 0); // pkt2
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(1), 1); // pkt3
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(1).retxCount, 0);
-  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(1).nGreaterSeqAcks, 1);
+  BOOST_CHECK_EQUAL(reliability->countGreaterAcks(1), 1);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(2), 0); // pkt4
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(3), 1); // pkt5
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(3).retxCount, 0);
-  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(3).nGreaterSeqAcks, 0);
+  BOOST_CHECK_EQUAL(reliability->countGreaterAcks(3), 0);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(101010), 0);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 0xFFFFFFFFFFFFFFFF);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.getFirstSequence(), 0xFFFFFFFFFFFFFFFF);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 5);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 2);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 0);
@@ -609,11 +607,11 @@ BOOST_AUTO_TEST_CASE(LossByGreaterAcks)
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(2), 0); // pkt4
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(3), 1); // pkt5
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(3).retxCount, 0);
-  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(3).nGreaterSeqAcks, 0);
+  BOOST_CHECK_EQUAL(reliability->countGreaterAcks(3), 0);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(4), 1); // pkt1 new TxSeq
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(4).retxCount, 1);
-  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(4).nGreaterSeqAcks, 0);
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 3);
+  BOOST_CHECK_EQUAL(reliability->countGreaterAcks(4), 0);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.getFirstSequence(), 3);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 6);
   lp::Packet sentRetxPkt(transport->sentPackets.back().packet);
   BOOST_REQUIRE(sentRetxPkt.has<lp::TxSequenceField>());
@@ -639,9 +637,9 @@ BOOST_AUTO_TEST_CASE(LossByGreaterAcks)
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(2), 0); // pkt4
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(3), 1); // pkt5
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(3).retxCount, 0);
-  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(3).nGreaterSeqAcks, 1);
+  BOOST_CHECK_EQUAL(reliability->countGreaterAcks(3), 1);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(4), 0); // pkt1 new TxSeq
-  BOOST_CHECK_EQUAL(reliability->m_firstUnackedFrag->first, 3);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.getFirstSequence(), 3);
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 6);
   BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 3);
   BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 1);
@@ -666,7 +664,7 @@ BOOST_AUTO_TEST_CASE(SkipFragmentsRemovedInRtt)
   BOOST_CHECK_EQUAL(transport->sentPackets.size(), 5);
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), 5);
 
-  lp::Sequence firstTxSeq = reliability->m_firstUnackedFrag->first;
+  lp::Sequence firstTxSeq = reliability->m_unackedFrags.getFirstSequence();
 
   // Ack the last 2 packets
   lp::Packet ackPkt1;
@@ -675,8 +673,8 @@ BOOST_AUTO_TEST_CASE(SkipFragmentsRemovedInRtt)
   reliability->processIncomingPacket(ackPkt1);
 
   BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), 3);
-  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(firstTxSeq).nGreaterSeqAcks, 2);
-  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(firstTxSeq + 1).nGreaterSeqAcks, 2);
+  BOOST_CHECK_EQUAL(reliability->countGreaterAcks(firstTxSeq), 2);
+  BOOST_CHECK_EQUAL(reliability->countGreaterAcks(firstTxSeq + 1), 2);
 
   // Ack the third packet (5003)
   // This triggers a "loss by greater Acks" for packets 5001 and 5002
@@ -928,6 +926,134 @@ BOOST_AUTO_TEST_CASE(IdleAckTimerMtu)
   BOOST_CHECK(expectedAcks.empty());
 }
 
+BOOST_AUTO_TEST_CASE(PiggybackAckRanges)
+{
+  auto opts = linkService->getOptions();
+  opts.reliabilityOptions.wantAckRanges = true;
+  linkService->setOptions(opts);
+
+  reliability->m_ackQueue.push(256);
+  reliability->m_ackQueue.push(257);
+  reliability->m_ackQueue.push(258);
+  reliability->m_ackQueue.push(10);
+  BOOST_CHECK_EQUAL(reliability->m_ackQueue.size(), 4);
+  BOOST_CHECK_EQUAL(reliability->m_ackQueue.front(), 256);
+  BOOST_CHECK_EQUAL(reliability->m_ackQueue.back(), 10);
+
+  lp::Packet pkt;
+  linkService->sendLpPackets({pkt});
+
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 1);
+  lp::Packet sentPkt(transport->sentPackets.front().packet);
+
+  BOOST_REQUIRE_EQUAL(sentPkt.count<lp::AckRangeField>(), 1);
+  BOOST_CHECK_EQUAL(sentPkt.get<lp::AckRangeField>(), lp::AckRange(256, 258));
+  BOOST_REQUIRE_EQUAL(sentPkt.count<lp::AckField>(), 1);
+  BOOST_CHECK_EQUAL(sentPkt.get<lp::AckField>(), 10);
+
+  BOOST_CHECK(reliability->m_ackQueue.empty());
+}
+
+BOOST_AUTO_TEST_CASE(ProcessAckRange)
+{
+  for (uint32_t i = 1; i <= 5; i++) {
+    linkService->sendLpPackets({makeFrag(i, 50)});
+  }
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), 5);
+  lp::Sequence firstTxSeq = reliability->m_unackedFrags.getFirstSequence();
+
+  // the range extends past both ends of the window
+  lp::Packet ackPkt;
+  ackPkt.add<lp::AckRangeField>(lp::AckRange(firstTxSeq - 10, firstTxSeq + 1));
+  ackPkt.add<lp::AckRangeField>(lp::AckRange(firstTxSeq + 3, firstTxSeq + 1000));
+  reliability->processIncomingPacket(ackPkt);
+
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), 1);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(firstTxSeq + 2), 1);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.getFirstSequence(), firstTxSeq + 2);
+  BOOST_CHECK_EQUAL(reliability->countGreaterAcks(firstTxSeq + 2), 2);
+  BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 4);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 5);
+
+  // the peer understands AckRange, so ranges are used even though wantAckRanges is off
+  BOOST_CHECK(reliability->m_isPeerUsingAckRanges);
+  reliability->m_ackQueue.push(7);
+  reliability->m_ackQueue.push(8);
+  linkService->sendLpPackets({lp::Packet()});
+  lp::Packet sentPkt(transport->sentPackets.back().packet);
+  BOOST_CHECK_EQUAL(sentPkt.count<lp::AckRangeField>(), 1);
+  BOOST_CHECK(!sentPkt.has<lp::AckField>());
+}
+
+BOOST_AUTO_TEST_CASE(WindowGrowth)
+{
+  reliability->m_lastTxSeqNo = 0xFFFFFFFFFFFFFFF0;
+  size_t initialCapacity = reliability->m_unackedFrags.capacity();
+
+  for (uint32_t i = 1; i <= initialCapacity * 2 + 1; i++) {
+    linkService->sendLpPackets({makeFrag(i, 10)});
+  }
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), initialCapacity * 2 + 1);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.capacity(), initialCapacity * 4);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.getFirstSequence(), 0xFFFFFFFFFFFFFFF1);
+
+  // every fragment is still found after the window has been rearranged
+  for (uint32_t i = 1; i <= initialCapacity * 2 + 1; i++) {
+    lp::Sequence txSeq = 0xFFFFFFFFFFFFFFF0 + i;
+    BOOST_REQUIRE_EQUAL(reliability->m_unackedFrags.count(txSeq), 1);
+    BOOST_CHECK_EQUAL(getPktNo(reliability->m_unackedFrags.at(txSeq).pkt), i);
+  }
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(0xFFFFFFFFFFFFFFF0), 0);
+  BOOST_CHECK_THROW(reliability->m_unackedFrags.at(0xFFFFFFFFFFFFFFF0), std::out_of_range);
+
+  // acknowledging the first fragments advances the start of the window past the holes
+  lp::Packet ackPkt;
+  ackPkt.add<lp::AckField>(0xFFFFFFFFFFFFFFF2);
+  ackPkt.add<lp::AckField>(0xFFFFFFFFFFFFFFF1);
+  reliability->processIncomingPacket(ackPkt);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.size(), initialCapacity * 2 - 1);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.getFirstSequence(), 0xFFFFFFFFFFFFFFF3);
+  BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 2);
+}
+
+BOOST_AUTO_TEST_CASE(SingleRtoTimer)
+{
+  reliability->m_lastTxSeqNo = 0;
+
+  // T+0ms: txSeq 1, T+400ms: txSeq 2, both with 1000ms RTO
+  linkService->sendLpPackets({makeFrag(1, 50)});
+  BOOST_CHECK(reliability->m_isRtoTimerRunning);
+  advanceClocks(time::milliseconds(1), 400);
+  linkService->sendLpPackets({makeFrag(2, 50)});
+
+  // acknowledge txSeq 1; the timer fires at T+1000ms and is restarted for txSeq 2
+  lp::Packet ackPkt;
+  ackPkt.add<lp::AckField>(1);
+  reliability->processIncomingPacket(ackPkt);
+  advanceClocks(time::milliseconds(1), 700);
+  BOOST_CHECK(reliability->m_isRtoTimerRunning);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 2);
+
+  // T+1400ms: txSeq 2 is retransmitted as txSeq 3
+  advanceClocks(time::milliseconds(1), 301);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 3);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.count(3), 1);
+  BOOST_CHECK_EQUAL(reliability->m_unackedFrags.at(3).retxCount, 1);
+  BOOST_CHECK(reliability->m_isRtoTimerRunning);
+
+  ackPkt.clear<lp::AckField>();
+  ackPkt.add<lp::AckField>(3);
+  reliability->processIncomingPacket(ackPkt);
+  BOOST_CHECK(reliability->m_unackedFrags.empty());
+  BOOST_CHECK_EQUAL(linkService->getCounters().nAcknowledged, 1);
+  BOOST_CHECK_EQUAL(linkService->getCounters().nRetransmitted, 1);
+
+  // the timer stops once it finds the window empty; RTO of txSeq 3 is 2000ms
+  advanceClocks(time::milliseconds(1), 2500);
+  BOOST_CHECK(!reliability->m_isRtoTimerRunning);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 3);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestLpReliability
 BOOST_AUTO_TEST_SUITE_END() // Face
 
@@ -0,0 +1,177 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/packet-trace.hpp"
+
+#include "face/generic-link-service.hpp"
+
+#include "tests/test-common.hpp"
+#include "dummy-transport.hpp"
+
+#include <boost/filesystem.hpp>
+
+namespace nfd {
+namespace face {
+namespace tests {
+
+using namespace nfd::tests;
+
+class PacketTraceFixture : public BaseFixture
+{
+protected:
+  PacketTraceFixture()
+    : filename((boost::filesystem::path(UNIT_TEST_CONFIG_PATH) / "packet-trace.t").string())
+  {
+    boost::filesystem::create_directories(UNIT_TEST_CONFIG_PATH);
+  }
+
+  ~PacketTraceFixture()
+  {
+    setPacketTraceCapture(nullptr);
+    boost::filesystem::remove(filename);
+  }
+
+  void
+  writeRaw(const std::string& content)
+  {
+    std::ofstream os(filename, std::ios::binary | std::ios::trunc);
+    os << content;
+  }
+
+protected:
+  const std::string filename;
+};
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_FIXTURE_TEST_SUITE(TestPacketTrace, PacketTraceFixture)
+
+BOOST_AUTO_TEST_CASE(WriteRead)
+{
+  auto interest = makeInterest("/A");
+  auto data = makeData("/B");
+  auto timestamp = time::fromUnixTimestamp(time::milliseconds(1520000000123));
+
+  {
+    PacketTraceWriter writer(filename);
+    writer.write(300, PacketTraceRecord::INCOMING, interest->wireEncode());
+    PacketTraceRecord record;
+    record.timestamp = timestamp;
+    record.faceId = 301;
+    record.direction = PacketTraceRecord::OUTGOING;
+    record.packet = data->wireEncode();
+    writer.write(record);
+    BOOST_CHECK_EQUAL(writer.getNRecords(), 2);
+  }
+
+  PacketTraceReader reader(filename);
+  PacketTraceRecord record;
+  BOOST_REQUIRE(reader.read(record));
+  BOOST_CHECK_EQUAL(record.faceId, 300);
+  BOOST_CHECK_EQUAL(record.direction, PacketTraceRecord::INCOMING);
+  BOOST_CHECK_EQUAL(record.packet, interest->wireEncode());
+
+  BOOST_REQUIRE(reader.read(record));
+  BOOST_CHECK(record.timestamp == timestamp);
+  BOOST_CHECK_EQUAL(record.faceId, 301);
+  BOOST_CHECK_EQUAL(record.direction, PacketTraceRecord::OUTGOING);
+  BOOST_CHECK_EQUAL(record.packet, data->wireEncode());
+
+  BOOST_CHECK_EQUAL(reader.read(record), false);
+}
+
+BOOST_AUTO_TEST_CASE(Malformed)
+{
+  BOOST_CHECK_THROW(PacketTraceReader("/nonexistent/packet-trace"), PacketTraceReader::Error);
+
+  writeRaw("NOTATRACE...");
+  BOOST_CHECK_THROW(PacketTraceReader{filename}, PacketTraceReader::Error);
+
+  {
+    PacketTraceWriter writer(filename);
+    writer.write(300, PacketTraceRecord::INCOMING, makeInterest("/A")->wireEncode());
+  }
+  std::string content;
+  {
+    std::ifstream is(filename, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+  }
+
+  // truncated packet
+  writeRaw(content.substr(0, content.size() - 1));
+  PacketTraceReader reader(filename);
+  PacketTraceRecord record;
+  BOOST_CHECK_THROW(reader.read(record), PacketTraceReader::Error);
+
+  // truncated record header
+  writeRaw(content.substr(0, 12 + 10));
+  PacketTraceReader reader2(filename);
+  BOOST_CHECK_THROW(reader2.read(record), PacketTraceReader::Error);
+
+  // length above MAX_NDN_PACKET_SIZE is rejected before allocating the packet
+  std::string oversized = content;
+  oversized.replace(12 + 16, 4, "\xff\xff\xff\xff");
+  writeRaw(oversized);
+  PacketTraceReader reader3(filename);
+  BOOST_CHECK_THROW(reader3.read(record), PacketTraceReader::Error);
+}
+
+BOOST_AUTO_TEST_CASE(Capture)
+{
+  nfd::Face face(make_unique<GenericLinkService>(), make_unique<DummyTransport>());
+  face.setId(300);
+  auto transport = static_cast<DummyTransport*>(face.getTransport());
+  auto interest = makeInterest("/A");
+  auto data = makeData("/A");
+
+  transport->receivePacket(interest->wireEncode());
+  setPacketTraceCapture(make_unique<PacketTraceWriter>(filename));
+  transport->receivePacket(interest->wireEncode());
+  face.sendData(*data);
+  BOOST_CHECK_EQUAL(getPacketTraceCapture()->getNRecords(), 2);
+  setPacketTraceCapture(nullptr);
+  face.sendData(*data);
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 2);
+
+  PacketTraceReader reader(filename);
+  PacketTraceRecord record;
+  BOOST_REQUIRE(reader.read(record));
+  BOOST_CHECK_EQUAL(record.faceId, 300);
+  BOOST_CHECK_EQUAL(record.direction, PacketTraceRecord::INCOMING);
+  BOOST_CHECK_EQUAL(record.packet, interest->wireEncode());
+
+  BOOST_REQUIRE(reader.read(record));
+  BOOST_CHECK_EQUAL(record.faceId, 300);
+  BOOST_CHECK_EQUAL(record.direction, PacketTraceRecord::OUTGOING);
+  BOOST_CHECK_EQUAL(record.packet, transport->sentPackets.front().packet);
+
+  BOOST_CHECK_EQUAL(reader.read(record), false);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPacketTrace
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace tests
+} // namespace face
+} // namespace nfd
@@ -0,0 +1,182 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/shm-channel.hpp"
+
+#include "channel-fixture.hpp"
+
+#include <ndn-cxx/transport/shm-ring.hpp>
+#include <ndn-cxx/transport/shm-transport.hpp>
+#include <boost/filesystem.hpp>
+
+namespace nfd {
+namespace face {
+namespace tests {
+
+namespace fs = boost::filesystem;
+
+class ShmChannelFixture : public ChannelFixture<ShmChannel, unix_stream::Endpoint>
+{
+protected:
+  ShmChannelFixture()
+  {
+    listenerEp = unix_stream::Endpoint("nfd-test-shm-channel.sock");
+  }
+
+  unique_ptr<ShmChannel>
+  makeChannel() final
+  {
+    return make_unique<ShmChannel>(listenerEp, ndn::shm::MIN_RING_CAPACITY, false);
+  }
+
+  void
+  listen()
+  {
+    listenerChannel = makeChannel();
+    listenerChannel->listen(
+      [this] (const shared_ptr<Face>& newFace) {
+        BOOST_REQUIRE(newFace != nullptr);
+        connectFaceClosedSignal(*newFace, [this] { limitedIo.afterOp(); });
+        newFace->afterReceiveInterest.connect([this] (const Interest& interest) {
+          receivedInterests.push_back(interest);
+          limitedIo.afterOp();
+        });
+        listenerFaces.push_back(newFace);
+        limitedIo.afterOp();
+      },
+      ChannelFixture::unexpectedFailure);
+  }
+
+  shared_ptr<ndn::ShmTransport>
+  clientConnect()
+  {
+    auto client = make_shared<ndn::ShmTransport>(listenerEp.path());
+    client->connect(g_io, [this] (const Block& wire) {
+      clientReceived.push_back(wire);
+      limitedIo.afterOp();
+    });
+    return client;
+  }
+
+protected:
+  std::vector<Interest> receivedInterests;
+  std::vector<Block> clientReceived;
+};
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_FIXTURE_TEST_SUITE(TestShmChannel, ShmChannelFixture)
+
+BOOST_AUTO_TEST_CASE(Uri)
+{
+  auto channel = makeChannel();
+  BOOST_CHECK_EQUAL(channel->getUri(), FaceUri("shm://" + listenerEp.path()));
+}
+
+BOOST_AUTO_TEST_CASE(Listen)
+{
+  auto channel = makeChannel();
+  BOOST_CHECK_EQUAL(channel->isListening(), false);
+
+  channel->listen(nullptr, nullptr);
+  BOOST_CHECK_EQUAL(channel->isListening(), true);
+  BOOST_CHECK_EQUAL(fs::symlink_status(listenerEp.path()).type(), fs::socket_file);
+
+  // listen() is idempotent
+  BOOST_CHECK_NO_THROW(channel->listen(nullptr, nullptr));
+  BOOST_CHECK_EQUAL(channel->isListening(), true);
+
+  channel.reset();
+  BOOST_CHECK_EQUAL(fs::symlink_status(listenerEp.path()).type(), fs::file_not_found);
+}
+
+BOOST_AUTO_TEST_CASE(ExchangePackets)
+{
+  this->listen();
+
+  auto client = this->clientConnect();
+  auto interest = makeInterest("/shm/interest");
+  client->send(interest->wireEncode());
+
+  // face created, Interest received
+  BOOST_CHECK_EQUAL(limitedIo.run(2, time::seconds(1)), LimitedIo::EXCEED_OPS);
+  BOOST_REQUIRE_EQUAL(listenerFaces.size(), 1);
+  BOOST_CHECK_EQUAL(client->isConnected(), true);
+  BOOST_REQUIRE_EQUAL(receivedInterests.size(), 1);
+  BOOST_CHECK_EQUAL(receivedInterests.front().getName(), interest->getName());
+
+  auto face = listenerFaces.front();
+  BOOST_CHECK_EQUAL(face->getScope(), ndn::nfd::FACE_SCOPE_LOCAL);
+  BOOST_CHECK_EQUAL(face->getPersistency(), ndn::nfd::FACE_PERSISTENCY_ON_DEMAND);
+  BOOST_CHECK_EQUAL(face->getLinkType(), ndn::nfd::LINK_TYPE_POINT_TO_POINT);
+  BOOST_CHECK_EQUAL(face->getLocalUri().getScheme(), "shm");
+  BOOST_CHECK_EQUAL(face->getRemoteUri().getScheme(), "fd");
+
+  // more packets than fit into one ring are delivered in order
+  const size_t nData = 40;
+  for (size_t i = 0; i < nData; ++i) {
+    auto data = makeData(Name("/shm/data").appendSequenceNumber(i));
+    data->setContent(std::vector<uint8_t>(4000, static_cast<uint8_t>(i)).data(), 4000);
+    face->sendData(*data);
+  }
+  BOOST_CHECK_EQUAL(limitedIo.run(nData, time::seconds(1)), LimitedIo::EXCEED_OPS);
+  BOOST_REQUIRE_EQUAL(clientReceived.size(), nData);
+  for (size_t i = 0; i < nData; ++i) {
+    Data data(clientReceived[i]);
+    BOOST_CHECK_EQUAL(data.getName().at(-1).toSequenceNumber(), i);
+  }
+  BOOST_CHECK_EQUAL(face->getCounters().nOutData, nData);
+
+  // closing the client closes the face
+  client->close();
+  BOOST_CHECK_EQUAL(limitedIo.run(1, time::seconds(1)), LimitedIo::EXCEED_OPS);
+  BOOST_CHECK_EQUAL(face->getState(), FaceState::CLOSED);
+  BOOST_CHECK_EQUAL(listenerChannel->size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(MultipleClients)
+{
+  this->listen();
+
+  auto client1 = this->clientConnect();
+  auto client2 = this->clientConnect();
+  client1->send(makeInterest("/shm/1")->wireEncode());
+  client2->send(makeInterest("/shm/2")->wireEncode());
+
+  BOOST_CHECK_EQUAL(limitedIo.run(4, time::seconds(1)), LimitedIo::EXCEED_OPS);
+  BOOST_CHECK_EQUAL(listenerChannel->size(), 2);
+  BOOST_CHECK_EQUAL(receivedInterests.size(), 2);
+
+  // closing the face disconnects the client
+  listenerFaces.front()->close();
+  BOOST_CHECK_EQUAL(limitedIo.run(2, time::seconds(1)), LimitedIo::EXCEPTION);
+  BOOST_CHECK_EQUAL(client1->isConnected() && client2->isConnected(), false);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestShmChannel
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace tests
+} // namespace face
+} // namespace nfd
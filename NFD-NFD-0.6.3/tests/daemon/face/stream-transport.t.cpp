@@ -70,6 +70,42 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(Send, T, StreamTransportFixtures, T)
   BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
 }
 
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(SendBurst, T, StreamTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+
+  // more than fits in one write, so that packets are gathered into several writes
+  std::vector<Block> blocks;
+  size_t totalSize = 0;
+  for (int i = 0; i < 300; ++i) {
+    blocks.push_back(ndn::encoding::makeStringBlock(300, std::string(1000 + i, 'x')));
+    totalSize += blocks.back().size();
+    this->transport->send(Transport::Packet{Block{blocks.back()}}); // make a copy of the block
+  }
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nOutPackets, blocks.size());
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nOutBytes, totalSize);
+  // octets being written still count until the write completes
+  BOOST_CHECK_GE(this->transport->getSendQueueLength(), static_cast<ssize_t>(totalSize));
+
+  std::vector<uint8_t> readBuf(totalSize);
+  boost::asio::async_read(this->remoteSocket, boost::asio::buffer(readBuf),
+    [this] (const boost::system::error_code& error, size_t) {
+      BOOST_REQUIRE_EQUAL(error, boost::system::errc::success);
+      this->limitedIo.afterOp();
+    });
+
+  BOOST_REQUIRE_EQUAL(this->limitedIo.run(1, time::seconds(1)), LimitedIo::EXCEED_OPS);
+  this->limitedIo.defer(time::milliseconds(10));
+
+  auto it = readBuf.begin();
+  for (const Block& block : blocks) {
+    BOOST_CHECK(std::equal(block.begin(), block.end(), it));
+    it += block.size();
+  }
+  BOOST_CHECK_EQUAL(this->transport->getSendQueueLength(), 0);
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
+}
+
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveNormal, T, StreamTransportFixtures, T)
 {
   TRANSPORT_TEST_INIT();
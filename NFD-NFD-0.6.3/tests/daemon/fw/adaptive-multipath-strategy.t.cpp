@@ -0,0 +1,268 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fw/adaptive-multipath-strategy.hpp"
+#include "choose-strategy.hpp"
+#include "strategy-tester.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using namespace nfd::tests;
+
+typedef StrategyTester<AdaptiveMultipathStrategy> AdaptiveMultipathStrategyTester;
+NFD_REGISTER_STRATEGY(AdaptiveMultipathStrategyTester);
+
+class AdaptiveMultipathStrategyFixture : public UnitTestTimeFixture
+{
+protected:
+  AdaptiveMultipathStrategyFixture()
+    : strategy(choose<AdaptiveMultipathStrategyTester>(forwarder))
+    , fib(forwarder.getFib())
+    , pit(forwarder.getPit())
+    , face1(make_shared<DummyFace>())
+    , face2(make_shared<DummyFace>())
+    , face3(make_shared<DummyFace>())
+  {
+    forwarder.addFace(face1);
+    forwarder.addFace(face2);
+    forwarder.addFace(face3);
+
+    // /P has two nexthops, /S has a single nexthop
+    fib::Entry& fibEntryP = *fib.insert("/P").first;
+    fibEntryP.addNextHop(*face2, 0);
+    fibEntryP.addNextHop(*face3, 0);
+    fib::Entry& fibEntryS = *fib.insert("/S").first;
+    fibEntryS.addNextHop(*face2, 0);
+  }
+
+  /** \brief receive a new Interest from face1
+   */
+  shared_ptr<pit::Entry>
+  receiveInterest(const Name& name, uint32_t nonce = 0)
+  {
+    shared_ptr<Interest> interest = makeInterest(name, nonce);
+    interest->setInterestLifetime(10_s);
+    shared_ptr<pit::Entry> pitEntry = pit.insert(*interest).first;
+    pitEntry->insertOrUpdateInRecord(*face1, *interest);
+    strategy.afterReceiveInterest(*face1, *interest, pitEntry);
+    return pitEntry;
+  }
+
+  /** \brief receive Data for \p pitEntry from \p face after \p rtt
+   */
+  void
+  receiveData(const shared_ptr<pit::Entry>& pitEntry, const Face& face,
+              time::nanoseconds rtt, uint64_t congestionMark = 0)
+  {
+    this->advanceClocks(rtt);
+    shared_ptr<Data> data = makeData(pitEntry->getName());
+    if (congestionMark > 0) {
+      data->setCongestionMark(congestionMark);
+    }
+    strategy.beforeSatisfyInterest(pitEntry, face, *data);
+  }
+
+  double
+  getWeight(const Name& prefix, const Face& face)
+  {
+    measurements::Entry* me = forwarder.getMeasurements().findExactMatch(prefix);
+    BOOST_REQUIRE(me != nullptr);
+    auto mi = me->getStrategyInfo<AdaptiveMultipathStrategy::MtInfo>();
+    BOOST_REQUIRE(mi != nullptr);
+    return mi->getNextHop(face.getId()).weight;
+  }
+
+  void
+  setWeight(const Name& prefix, const Face& face, double weight)
+  {
+    measurements::Entry* me = forwarder.getMeasurements().findExactMatch(prefix);
+    BOOST_REQUIRE(me != nullptr);
+    me->insertStrategyInfo<AdaptiveMultipathStrategy::MtInfo>().first->getNextHop(face.getId()).weight = weight;
+  }
+
+  FaceId
+  getLastOutFaceId()
+  {
+    BOOST_REQUIRE(!strategy.sendInterestHistory.empty());
+    return strategy.sendInterestHistory.back().outFaceId;
+  }
+
+protected:
+  Forwarder forwarder;
+  AdaptiveMultipathStrategyTester& strategy;
+  Fib& fib;
+  Pit& pit;
+  shared_ptr<DummyFace> face1;
+  shared_ptr<DummyFace> face2;
+  shared_ptr<DummyFace> face3;
+};
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestAdaptiveMultipathStrategy, AdaptiveMultipathStrategyFixture)
+
+BOOST_AUTO_TEST_CASE(SplitByWeight)
+{
+  receiveInterest("/P/0");
+  setWeight("/P", *face2, 90.0);
+  setWeight("/P", *face3, 10.0);
+
+  std::map<FaceId, int> nSent;
+  for (int i = 1; i <= 1000; ++i) {
+    receiveInterest(Name("/P").appendNumber(i));
+    ++nSent[getLastOutFaceId()];
+  }
+  BOOST_CHECK_GT(nSent[face2->getId()], 800);
+  BOOST_CHECK_GT(nSent[face3->getId()], 50);
+  BOOST_CHECK_EQUAL(nSent[face1->getId()], 0);
+
+  // per-namespace state is kept at the FIB prefix
+  BOOST_CHECK(forwarder.getMeasurements().findExactMatch("/P/1") == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(AdditiveIncrease)
+{
+  shared_ptr<pit::Entry> pitEntry = receiveInterest("/S/0");
+  BOOST_CHECK_EQUAL(getLastOutFaceId(), face2->getId());
+  BOOST_CHECK_EQUAL(getWeight("/S", *face2), AdaptiveMultipathStrategy::INITIAL_WEIGHT);
+
+  receiveData(pitEntry, *face2, 5_ms);
+  BOOST_CHECK_EQUAL(getWeight("/S", *face2),
+                    AdaptiveMultipathStrategy::INITIAL_WEIGHT + AdaptiveMultipathStrategy::ADDITIVE_INCREASE);
+
+  // the weight does not exceed MAX_WEIGHT
+  setWeight("/S", *face2, AdaptiveMultipathStrategy::MAX_WEIGHT);
+  pitEntry = receiveInterest("/S/1");
+  receiveData(pitEntry, *face2, 5_ms);
+  BOOST_CHECK_EQUAL(getWeight("/S", *face2), AdaptiveMultipathStrategy::MAX_WEIGHT);
+}
+
+BOOST_AUTO_TEST_CASE(MultiplicativeDecreaseOnMark)
+{
+  shared_ptr<pit::Entry> pitEntry0 = receiveInterest("/S/0");
+  shared_ptr<pit::Entry> pitEntry1 = receiveInterest("/S/1");
+  setWeight("/S", *face2, 40.0);
+
+  receiveData(pitEntry0, *face2, 20_ms, 1);
+  BOOST_CHECK_EQUAL(getWeight("/S", *face2), 20.0);
+
+  // another mark within the same RTT is ignored
+  receiveData(pitEntry1, *face2, 5_ms, 1);
+  BOOST_CHECK_EQUAL(getWeight("/S", *face2), 20.0);
+
+  // a mark after one RTT decreases the weight again
+  shared_ptr<pit::Entry> pitEntry2 = receiveInterest("/S/2");
+  receiveData(pitEntry2, *face2, 20_ms, 1);
+  BOOST_CHECK_EQUAL(getWeight("/S", *face2), 10.0);
+
+  // the weight does not go below MIN_WEIGHT
+  for (int i = 3; i < 10; ++i) {
+    shared_ptr<pit::Entry> pitEntry = receiveInterest(Name("/S").appendNumber(i));
+    receiveData(pitEntry, *face2, 20_ms, 1);
+  }
+  BOOST_CHECK_EQUAL(getWeight("/S", *face2), AdaptiveMultipathStrategy::MIN_WEIGHT);
+}
+
+BOOST_AUTO_TEST_CASE(MultiplicativeDecreaseOnQueuingDelay)
+{
+  shared_ptr<pit::Entry> pitEntry = receiveInterest("/S/0");
+  receiveData(pitEntry, *face2, 20_ms);
+  double weight = getWeight("/S", *face2);
+
+  // RTT grows, but queuing delay does not exceed base RTT
+  pitEntry = receiveInterest("/S/1");
+  receiveData(pitEntry, *face2, 35_ms);
+  BOOST_CHECK_EQUAL(getWeight("/S", *face2), weight + AdaptiveMultipathStrategy::ADDITIVE_INCREASE);
+  weight = getWeight("/S", *face2);
+
+  // queuing delay exceeds base RTT
+  pitEntry = receiveInterest("/S/2");
+  receiveData(pitEntry, *face2, 50_ms);
+  BOOST_CHECK_EQUAL(getWeight("/S", *face2), weight * AdaptiveMultipathStrategy::MULTIPLICATIVE_DECREASE);
+}
+
+BOOST_AUTO_TEST_CASE(MultiplicativeDecreaseOnTimeout)
+{
+  shared_ptr<pit::Entry> pitEntry = receiveInterest("/S/0");
+  receiveData(pitEntry, *face2, 10_ms);
+  double weight = getWeight("/S", *face2);
+
+  pitEntry = receiveInterest("/S/1");
+  this->advanceClocks(10_ms, 2_s);
+  BOOST_CHECK_EQUAL(getWeight("/S", *face2), weight * AdaptiveMultipathStrategy::MULTIPLICATIVE_DECREASE);
+}
+
+BOOST_AUTO_TEST_CASE(NackCongestion)
+{
+  shared_ptr<pit::Entry> pitEntry = receiveInterest("/P/0", 3841);
+  FaceId first = getLastOutFaceId();
+  Face& firstFace = *forwarder.getFace(first);
+  Face& secondFace = first == face2->getId() ? *face3 : *face2;
+
+  lp::Nack nack1 = makeNack("/P/0", 3841, lp::NackReason::CONGESTION);
+  pitEntry->getOutRecord(firstFace)->setIncomingNack(nack1);
+  strategy.afterReceiveNack(firstFace, nack1, pitEntry);
+  BOOST_CHECK_EQUAL(getWeight("/P", firstFace),
+                    AdaptiveMultipathStrategy::INITIAL_WEIGHT * AdaptiveMultipathStrategy::MULTIPLICATIVE_DECREASE);
+
+  // Interest is retried on the other nexthop
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 2);
+  BOOST_CHECK_EQUAL(getLastOutFaceId(), secondFace.getId());
+  BOOST_CHECK_EQUAL(strategy.sendNackHistory.size(), 0);
+
+  // all upstreams have returned Nacks
+  lp::Nack nack2 = makeNack("/P/0", 3841, lp::NackReason::NO_ROUTE);
+  pitEntry->getOutRecord(secondFace)->setIncomingNack(nack2);
+  strategy.afterReceiveNack(secondFace, nack2, pitEntry);
+  BOOST_CHECK_EQUAL(getWeight("/P", secondFace), AdaptiveMultipathStrategy::MIN_WEIGHT);
+  BOOST_CHECK_EQUAL(strategy.sendInterestHistory.size(), 2);
+  BOOST_REQUIRE_EQUAL(strategy.sendNackHistory.size(), 1);
+  BOOST_CHECK_EQUAL(strategy.sendNackHistory.back().outFaceId, face1->getId());
+  BOOST_CHECK_EQUAL(strategy.sendNackHistory.back().header.getReason(), lp::NackReason::CONGESTION);
+}
+
+BOOST_AUTO_TEST_CASE(RetransmitToUnused)
+{
+  shared_ptr<Interest> interest = makeInterest("/P/0");
+  shared_ptr<pit::Entry> pitEntry = receiveInterest("/P/0");
+  FaceId first = getLastOutFaceId();
+
+  this->advanceClocks(AdaptiveMultipathStrategy::RETX_SUPPRESSION_INITIAL);
+  pitEntry->insertOrUpdateInRecord(*face1, *interest);
+  strategy.afterReceiveInterest(*face1, *interest, pitEntry);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 2);
+  BOOST_CHECK_NE(getLastOutFaceId(), first);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestAdaptiveMultipathStrategy
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
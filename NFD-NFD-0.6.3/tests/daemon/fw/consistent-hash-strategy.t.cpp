@@ -0,0 +1,348 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fw/consistent-hash-strategy.hpp"
+#include "strategy-tester.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using namespace nfd::tests;
+
+typedef StrategyTester<ConsistentHashStrategy> ConsistentHashStrategyTester;
+NFD_REGISTER_STRATEGY(ConsistentHashStrategyTester);
+
+class ConsistentHashStrategyFixture : public UnitTestTimeFixture
+{
+protected:
+  ConsistentHashStrategyFixture()
+    : strategy(forwarder)
+    , fib(forwarder.getFib())
+    , pit(forwarder.getPit())
+  {
+    for (auto& face : faces) {
+      face = make_shared<DummyFace>();
+      forwarder.addFace(face);
+    }
+  }
+
+  /** \return FaceId of the nexthop ranked first for \p name, with faces[0] as downstream
+   */
+  FaceId
+  getPrimary(const ConsistentHashStrategy& s, const Name& name)
+  {
+    const fib::Entry& fibEntry = fib.findLongestPrefixMatch(name);
+    std::vector<Face*> ranked = s.rankNextHops(*faces[0], *makeInterest(name), fibEntry);
+    BOOST_REQUIRE(!ranked.empty());
+    return ranked.front()->getId();
+  }
+
+  FaceId
+  getPrimary(const Name& name)
+  {
+    return getPrimary(strategy, name);
+  }
+
+protected:
+  Forwarder forwarder;
+  ConsistentHashStrategyTester strategy;
+  Fib& fib;
+  Pit& pit;
+  std::array<shared_ptr<DummyFace>, 6> faces;
+};
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestConsistentHashStrategy, ConsistentHashStrategyFixture)
+
+BOOST_AUTO_TEST_CASE(SamePrefixSameUpstream)
+{
+  fib::Entry& fibEntry = *fib.insert("/P").first;
+  for (size_t i = 1; i <= 4; ++i) {
+    fibEntry.addNextHop(*faces[i], 0);
+  }
+
+  std::set<FaceId> usedFaces;
+  for (int i = 0; i < 40; ++i) {
+    Name prefix = Name("/P").appendNumber(i);
+    FaceId primary = getPrimary(Name(prefix).appendSegment(0));
+    BOOST_CHECK_NE(primary, faces[0]->getId());
+    for (uint64_t seg = 1; seg < 5; ++seg) {
+      BOOST_CHECK_EQUAL(getPrimary(Name(prefix).appendSegment(seg)), primary);
+    }
+    usedFaces.insert(primary);
+  }
+  // prefixes are spread over nexthops
+  BOOST_CHECK_EQUAL(usedFaces.size(), 4);
+
+  shared_ptr<Interest> interest = makeInterest("/P/x/0");
+  shared_ptr<pit::Entry> pitEntry = pit.insert(*interest).first;
+  pitEntry->insertOrUpdateInRecord(*faces[0], *interest);
+  strategy.afterReceiveInterest(*faces[0], *interest, pitEntry);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 1);
+  BOOST_CHECK_EQUAL(strategy.sendInterestHistory.back().outFaceId, getPrimary("/P/x/1"));
+}
+
+BOOST_AUTO_TEST_CASE(LowerCostFirst)
+{
+  fib::Entry& fibEntry = *fib.insert("/P").first;
+  fibEntry.addNextHop(*faces[1], 20);
+  fibEntry.addNextHop(*faces[2], 10);
+  fibEntry.addNextHop(*faces[3], 20);
+
+  for (int i = 0; i < 20; ++i) {
+    std::vector<Face*> ranked = strategy.rankNextHops(*faces[0], *makeInterest(Name("/P").appendNumber(i)),
+                                                      fibEntry);
+    BOOST_REQUIRE_EQUAL(ranked.size(), 3);
+    BOOST_CHECK_EQUAL(ranked.front()->getId(), faces[2]->getId());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MinimalRemapping)
+{
+  fib::Entry& fibEntry = *fib.insert("/P").first;
+  for (size_t i = 1; i <= 4; ++i) {
+    fibEntry.addNextHop(*faces[i], 0);
+  }
+
+  std::map<Name, FaceId> before;
+  for (int i = 0; i < 100; ++i) {
+    Name name = Name("/P").appendNumber(i);
+    before[name] = getPrimary(name);
+  }
+
+  // removing a nexthop only moves the prefixes that were assigned to it
+  fibEntry.removeNextHop(*faces[4]);
+  for (const auto& assignment : before) {
+    FaceId after = getPrimary(assignment.first);
+    if (assignment.second == faces[4]->getId()) {
+      BOOST_CHECK_NE(after, faces[4]->getId());
+    }
+    else {
+      BOOST_CHECK_EQUAL(after, assignment.second);
+    }
+  }
+
+  // adding a nexthop only moves prefixes onto the new nexthop
+  fibEntry.addNextHop(*faces[4], 0);
+  fibEntry.addNextHop(*faces[5], 0);
+  size_t nMoved = 0;
+  for (const auto& assignment : before) {
+    FaceId after = getPrimary(assignment.first);
+    if (after != assignment.second) {
+      BOOST_CHECK_EQUAL(after, faces[5]->getId());
+      ++nMoved;
+    }
+  }
+  BOOST_CHECK_GT(nMoved, 0);
+  BOOST_CHECK_LT(nMoved, before.size() / 2);
+}
+
+BOOST_AUTO_TEST_CASE(FailoverOnNack)
+{
+  fib::Entry& fibEntry = *fib.insert("/P").first;
+  fibEntry.addNextHop(*faces[1], 0);
+  fibEntry.addNextHop(*faces[2], 0);
+
+  shared_ptr<Interest> interest = makeInterest("/P/x/0", 6721);
+  shared_ptr<pit::Entry> pitEntry = pit.insert(*interest).first;
+  pitEntry->insertOrUpdateInRecord(*faces[0], *interest);
+  strategy.afterReceiveInterest(*faces[0], *interest, pitEntry);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 1);
+  FaceId first = strategy.sendInterestHistory.back().outFaceId;
+  Face& firstFace = first == faces[1]->getId() ? *faces[1] : *faces[2];
+  Face& secondFace = first == faces[1]->getId() ? *faces[2] : *faces[1];
+
+  lp::Nack nack1 = makeNack("/P/x/0", 6721, lp::NackReason::CONGESTION);
+  pitEntry->getOutRecord(firstFace)->setIncomingNack(nack1);
+  strategy.afterReceiveNack(firstFace, nack1, pitEntry);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 2);
+  BOOST_CHECK_EQUAL(strategy.sendInterestHistory.back().outFaceId, secondFace.getId());
+  BOOST_CHECK_EQUAL(strategy.sendNackHistory.size(), 0);
+
+  // all nexthops have returned Nacks
+  lp::Nack nack2 = makeNack("/P/x/0", 6721, lp::NackReason::NO_ROUTE);
+  pitEntry->getOutRecord(secondFace)->setIncomingNack(nack2);
+  strategy.afterReceiveNack(secondFace, nack2, pitEntry);
+  BOOST_CHECK_EQUAL(strategy.sendInterestHistory.size(), 2);
+  BOOST_REQUIRE_EQUAL(strategy.sendNackHistory.size(), 1);
+  BOOST_CHECK_EQUAL(strategy.sendNackHistory.back().outFaceId, faces[0]->getId());
+  BOOST_CHECK_EQUAL(strategy.sendNackHistory.back().header.getReason(), lp::NackReason::CONGESTION);
+}
+
+BOOST_AUTO_TEST_CASE(FailoverOnTimeout)
+{
+  fib::Entry& fibEntry = *fib.insert("/P").first;
+  fibEntry.addNextHop(*faces[1], 0);
+  fibEntry.addNextHop(*faces[2], 0);
+
+  shared_ptr<Interest> interest = makeInterest("/P/x/0");
+  interest->setInterestLifetime(10_s);
+  shared_ptr<pit::Entry> pitEntry = pit.insert(*interest).first;
+  pitEntry->insertOrUpdateInRecord(*faces[0], *interest);
+  strategy.afterReceiveInterest(*faces[0], *interest, pitEntry);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 1);
+  FaceId first = strategy.sendInterestHistory.back().outFaceId;
+
+  this->advanceClocks(10_ms, ConsistentHashStrategy::DEFAULT_FAILOVER_TIMEOUT - 20_ms);
+  BOOST_CHECK_EQUAL(strategy.sendInterestHistory.size(), 1);
+
+  this->advanceClocks(10_ms, 40_ms);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 2);
+  BOOST_CHECK_NE(strategy.sendInterestHistory.back().outFaceId, first);
+
+  // no untried nexthop is left
+  this->advanceClocks(100_ms, ConsistentHashStrategy::DEFAULT_FAILOVER_TIMEOUT * 2);
+  BOOST_CHECK_EQUAL(strategy.sendInterestHistory.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(NoFailoverAfterData)
+{
+  fib::Entry& fibEntry = *fib.insert("/P").first;
+  fibEntry.addNextHop(*faces[1], 0);
+  fibEntry.addNextHop(*faces[2], 0);
+
+  shared_ptr<Interest> interest = makeInterest("/P/x/0");
+  interest->setInterestLifetime(10_s);
+  shared_ptr<pit::Entry> pitEntry = pit.insert(*interest).first;
+  pitEntry->insertOrUpdateInRecord(*faces[0], *interest);
+  strategy.afterReceiveInterest(*faces[0], *interest, pitEntry);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 1);
+  Face* upstream = forwarder.getFace(strategy.sendInterestHistory.back().outFaceId);
+
+  strategy.beforeSatisfyInterest(pitEntry, *upstream, *makeData("/P/x/0"));
+  this->advanceClocks(100_ms, ConsistentHashStrategy::DEFAULT_FAILOVER_TIMEOUT * 2);
+  BOOST_CHECK_EQUAL(strategy.sendInterestHistory.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(RetransmitToUntried)
+{
+  fib::Entry& fibEntry = *fib.insert("/P").first;
+  fibEntry.addNextHop(*faces[1], 0);
+  fibEntry.addNextHop(*faces[2], 0);
+
+  shared_ptr<Interest> interest = makeInterest("/P/x/0");
+  shared_ptr<pit::Entry> pitEntry = pit.insert(*interest).first;
+  pitEntry->insertOrUpdateInRecord(*faces[0], *interest);
+  strategy.afterReceiveInterest(*faces[0], *interest, pitEntry);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 1);
+  FaceId first = strategy.sendInterestHistory.back().outFaceId;
+
+  // retransmission within suppression interval
+  this->advanceClocks(1_ms);
+  pitEntry->insertOrUpdateInRecord(*faces[0], *interest);
+  strategy.afterReceiveInterest(*faces[0], *interest, pitEntry);
+  BOOST_CHECK_EQUAL(strategy.sendInterestHistory.size(), 1);
+
+  this->advanceClocks(ConsistentHashStrategy::RETX_SUPPRESSION_INITIAL);
+  pitEntry->insertOrUpdateInRecord(*faces[0], *interest);
+  strategy.afterReceiveInterest(*faces[0], *interest, pitEntry);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 2);
+  BOOST_CHECK_NE(strategy.sendInterestHistory.back().outFaceId, first);
+
+  // all nexthops have been tried, go back to the first ranked nexthop
+  this->advanceClocks(ConsistentHashStrategy::RETX_SUPPRESSION_MAX);
+  pitEntry->insertOrUpdateInRecord(*faces[0], *interest);
+  strategy.afterReceiveInterest(*faces[0], *interest, pitEntry);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 3);
+  BOOST_CHECK_EQUAL(strategy.sendInterestHistory.back().outFaceId, first);
+}
+
+BOOST_AUTO_TEST_CASE(NComponents)
+{
+  fib::Entry& fibEntry = *fib.insert("/P").first;
+  for (size_t i = 1; i <= 4; ++i) {
+    fibEntry.addNextHop(*faces[i], 0);
+  }
+
+  // by default, one component after the FIB prefix is hashed
+  ConsistentHashStrategyTester defaultStrategy(forwarder);
+  std::set<FaceId> usedFaces;
+  for (int i = 0; i < 20; ++i) {
+    usedFaces.insert(getPrimary(defaultStrategy, Name("/P/x").appendNumber(i)));
+  }
+  BOOST_CHECK_EQUAL(usedFaces.size(), 1);
+
+  ConsistentHashStrategyTester s1(forwarder, Name(ConsistentHashStrategyTester::getStrategyName())
+                                             .append("n-components~1"));
+  FaceId primary = getPrimary(s1, "/P/x");
+  for (int i = 0; i < 20; ++i) {
+    BOOST_CHECK_EQUAL(getPrimary(s1, Name("/P").appendNumber(i)), primary);
+  }
+
+  ConsistentHashStrategyTester s3(forwarder, Name(ConsistentHashStrategyTester::getStrategyName())
+                                             .append("n-components~3"));
+  usedFaces.clear();
+  for (int i = 0; i < 20; ++i) {
+    usedFaces.insert(getPrimary(s3, Name("/P/x").appendNumber(i)));
+  }
+  BOOST_CHECK_GT(usedFaces.size(), 1);
+}
+
+class ParametersFixture
+{
+public:
+  void
+  checkValidity(std::string parameters, bool isCorrect)
+  {
+    Name strategyName(Name(ConsistentHashStrategy::getStrategyName()).append(parameters));
+    if (isCorrect) {
+      BOOST_CHECK_NO_THROW(make_unique<ConsistentHashStrategy>(forwarder, strategyName));
+    }
+    else {
+      BOOST_CHECK_THROW(make_unique<ConsistentHashStrategy>(forwarder, strategyName), std::invalid_argument);
+    }
+  }
+
+protected:
+  Forwarder forwarder;
+};
+
+BOOST_FIXTURE_TEST_CASE(Parameters, ParametersFixture)
+{
+  checkValidity("", true);
+  checkValidity("/n-components~2", true);
+  checkValidity("/failover-timeout~0", true);
+  checkValidity("/failover-timeout~500/n-components~3", true);
+
+  checkValidity("/n-components~0", false);
+  checkValidity("/n-components~-1", false);
+  checkValidity("/failover-timeout~-500", false);
+  checkValidity("/failover-timeout", false);
+  checkValidity("/n-components~", false);
+  checkValidity("/~1000", false);
+  checkValidity("/n-components~foo", false);
+  checkValidity("/probing-interval~30000", false);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestConsistentHashStrategy
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
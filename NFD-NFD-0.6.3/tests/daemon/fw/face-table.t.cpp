@@ -82,6 +82,23 @@ BOOST_AUTO_TEST_CASE(AddRemove)
   BOOST_CHECK_EQUAL(removeHistory[0], addHistory[0]);
 }
 
+BOOST_AUTO_TEST_CASE(Epoch)
+{
+  FaceTable faceTable;
+  auto face1 = make_shared<DummyFace>();
+
+  uint64_t epoch = faceTable.getEpoch();
+  faceTable.add(face1);
+  BOOST_CHECK_NE(faceTable.getEpoch(), epoch);
+
+  epoch = faceTable.getEpoch();
+  faceTable.add(face1);
+  BOOST_CHECK_EQUAL(faceTable.getEpoch(), epoch);
+
+  face1->close();
+  BOOST_CHECK_NE(faceTable.getEpoch(), epoch);
+}
+
 BOOST_AUTO_TEST_CASE(AddReserved)
 {
   FaceTable faceTable;
@@ -81,6 +81,33 @@ BOOST_AUTO_TEST_CASE(SimpleExchange)
   BOOST_CHECK_EQUAL(forwarder.getCounters().nOutData, 1);
 }
 
+BOOST_AUTO_TEST_CASE(ReceiveSignals)
+{
+  Forwarder forwarder;
+  auto face1 = make_shared<DummyFace>();
+  forwarder.addFace(face1);
+
+  // packets enter the forwarder before the signals are emitted to other observers
+  std::vector<uint64_t> nInAtSignal;
+  face1->afterReceiveInterest.connect([&] (const Interest&) {
+    nInAtSignal.push_back(forwarder.getCounters().nInInterests);
+  });
+  face1->afterReceiveData.connect([&] (const Data&) {
+    nInAtSignal.push_back(forwarder.getCounters().nInData);
+  });
+  face1->afterReceiveNack.connect([&] (const lp::Nack&) {
+    nInAtSignal.push_back(forwarder.getCounters().nInNacks);
+  });
+
+  face1->receiveInterest(*makeInterest("/A"));
+  face1->receiveData(*makeData("/B"));
+  face1->receiveNack(makeNack("/C", 1, lp::NackReason::NO_ROUTE));
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nInInterests, 1);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nInData, 1);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nInNacks, 1);
+  BOOST_CHECK(nInAtSignal == std::vector<uint64_t>({1, 1, 1}));
+}
+
 BOOST_AUTO_TEST_CASE(CsMatched)
 {
   Forwarder forwarder;
@@ -188,15 +215,7 @@ public:
     ++onDataUnsolicited_count;
   }
 
-protected:
-  void
-  dispatchToStrategy(pit::Entry&, std::function<void(fw::Strategy&)>) override
-  {
-    ++dispatchToStrategy_count;
-  }
-
 public:
-  int dispatchToStrategy_count;
   int onDataUnsolicited_count;
 };
 
@@ -207,30 +226,31 @@ BOOST_AUTO_TEST_CASE(ScopeLocalhostIncoming)
   auto face2 = make_shared<DummyFace>();
   forwarder.addFace(face1);
   forwarder.addFace(face2);
+  DummyStrategy& strategy = choose<DummyStrategy>(forwarder);
 
   // local face, /localhost: OK
-  forwarder.dispatchToStrategy_count = 0;
+  strategy.afterReceiveInterest_count = 0;
   shared_ptr<Interest> i1 = makeInterest("/localhost/A1");
   forwarder.onIncomingInterest(*face1, *i1);
-  BOOST_CHECK_EQUAL(forwarder.dispatchToStrategy_count, 1);
+  BOOST_CHECK_EQUAL(strategy.afterReceiveInterest_count, 1);
 
   // non-local face, /localhost: violate
-  forwarder.dispatchToStrategy_count = 0;
+  strategy.afterReceiveInterest_count = 0;
   shared_ptr<Interest> i2 = makeInterest("/localhost/A2");
   forwarder.onIncomingInterest(*face2, *i2);
-  BOOST_CHECK_EQUAL(forwarder.dispatchToStrategy_count, 0);
+  BOOST_CHECK_EQUAL(strategy.afterReceiveInterest_count, 0);
 
   // local face, non-/localhost: OK
-  forwarder.dispatchToStrategy_count = 0;
+  strategy.afterReceiveInterest_count = 0;
   shared_ptr<Interest> i3 = makeInterest("/A3");
   forwarder.onIncomingInterest(*face1, *i3);
-  BOOST_CHECK_EQUAL(forwarder.dispatchToStrategy_count, 1);
+  BOOST_CHECK_EQUAL(strategy.afterReceiveInterest_count, 1);
 
   // non-local face, non-/localhost: OK
-  forwarder.dispatchToStrategy_count = 0;
+  strategy.afterReceiveInterest_count = 0;
   shared_ptr<Interest> i4 = makeInterest("/A4");
   forwarder.onIncomingInterest(*face2, *i4);
-  BOOST_CHECK_EQUAL(forwarder.dispatchToStrategy_count, 1);
+  BOOST_CHECK_EQUAL(strategy.afterReceiveInterest_count, 1);
 
   // local face, /localhost: OK
   forwarder.onDataUnsolicited_count = 0;
@@ -571,6 +591,74 @@ BOOST_FIXTURE_TEST_CASE(InterestLoopWithShortLifetime, UnitTestTimeFixture) // B
   // an Interest if its Name+Nonce has appeared any point in the past.
 }
 
+BOOST_AUTO_TEST_CASE(PitAdmissionControl)
+{
+  Forwarder forwarder;
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  auto face3 = make_shared<DummyFace>("dummy://", "dummy://",
+                                      ndn::nfd::FACE_SCOPE_NON_LOCAL,
+                                      ndn::nfd::FACE_PERSISTENCY_PERSISTENT,
+                                      ndn::nfd::LINK_TYPE_MULTI_ACCESS);
+  auto face4 = make_shared<DummyFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+  forwarder.addFace(face3);
+  forwarder.addFace(face4);
+
+  Fib& fib = forwarder.getFib();
+  fib.insert("/U3oHPLHGJ").first->addNextHop(*face4, 0);
+  Pit& pit = forwarder.getPit();
+  pit.setFaceQuota(2);
+
+  face1->receiveInterest(*makeInterest("/U3oHPLHGJ/1", 1));
+  face1->receiveInterest(*makeInterest("/U3oHPLHGJ/2", 2));
+  BOOST_CHECK(face1->sentNacks.empty());
+  BOOST_CHECK_EQUAL(pit.getNInRecords(*face1), 2);
+
+  // over quota: Nack-Congestion
+  face1->receiveInterest(*makeInterest("/U3oHPLHGJ/3", 3));
+  BOOST_REQUIRE_EQUAL(face1->sentNacks.size(), 1);
+  BOOST_CHECK_EQUAL(face1->sentNacks.back().getInterest().getName(), "/U3oHPLHGJ/3");
+  BOOST_CHECK_EQUAL(face1->sentNacks.back().getReason(), lp::NackReason::CONGESTION);
+  BOOST_CHECK_EQUAL(pit.size(), 2);
+
+  // retransmission renews an existing in-record
+  face1->receiveInterest(*makeInterest("/U3oHPLHGJ/2", 4));
+  BOOST_CHECK_EQUAL(face1->sentNacks.size(), 1);
+
+  // other faces are not affected by the quota of face1
+  face2->receiveInterest(*makeInterest("/U3oHPLHGJ/2", 5));
+  BOOST_CHECK(face2->sentNacks.empty());
+  BOOST_CHECK_EQUAL(pit.getNInRecords(*face2), 1);
+  pit.setFaceQuota(0);
+
+  // over budget: face1 uses more than the average, face2 does not
+  pit.setBudget(2, 0);
+  face1->receiveInterest(*makeInterest("/U3oHPLHGJ/5", 6));
+  BOOST_CHECK_EQUAL(face1->sentNacks.size(), 2);
+  face2->receiveInterest(*makeInterest("/U3oHPLHGJ/6", 7));
+  BOOST_CHECK(face2->sentNacks.empty());
+  BOOST_CHECK_EQUAL(pit.size(), 3);
+
+  // over the hard limit: face2 is shed although it is below the average
+  face2->receiveInterest(*makeInterest("/U3oHPLHGJ/9", 10));
+  BOOST_CHECK_EQUAL(face2->sentNacks.size(), 1);
+  BOOST_CHECK_EQUAL(pit.size(), 3);
+
+  // shed Interests from multi-access face are dropped
+  pit.setBudget(0, 0);
+  pit.setFaceQuota(1);
+  face3->receiveInterest(*makeInterest("/U3oHPLHGJ/7", 8));
+  face3->receiveInterest(*makeInterest("/U3oHPLHGJ/8", 9));
+  BOOST_CHECK(face3->sentNacks.empty());
+
+  BOOST_CHECK_EQUAL(forwarder.getNShedInterests(*face1), 2);
+  BOOST_CHECK_EQUAL(forwarder.getNShedInterests(*face2), 1);
+  BOOST_CHECK_EQUAL(forwarder.getNShedInterests(*face3), 1);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nShedInterests, 4);
+}
+
 BOOST_AUTO_TEST_CASE(PitLeak) // Bug 3484
 {
   Forwarder forwarder;
@@ -0,0 +1,285 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fw/segment-prefetch-strategy.hpp"
+#include "choose-strategy.hpp"
+#include "strategy-tester.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using namespace nfd::tests;
+
+typedef StrategyTester<SegmentPrefetchStrategy> SegmentPrefetchStrategyTester;
+NFD_REGISTER_STRATEGY(SegmentPrefetchStrategyTester);
+
+class SegmentPrefetchStrategyFixture : public UnitTestTimeFixture
+{
+protected:
+  explicit
+  SegmentPrefetchStrategyFixture(const Name& instanceName = SegmentPrefetchStrategy::getStrategyName())
+    : strategy(choose<SegmentPrefetchStrategy>(forwarder, "/", instanceName))
+    , consumer(make_shared<DummyFace>())
+    , upstream(make_shared<DummyFace>())
+  {
+    forwarder.addFace(consumer);
+    forwarder.addFace(upstream);
+    forwarder.getFib().insert("/P").first->addNextHop(*upstream, 0);
+    forwarder.getCs().setLimit(100);
+  }
+
+  /** \brief receive an Interest for segment \p segment of /P/obj from the consumer
+   */
+  void
+  request(uint64_t segment)
+  {
+    shared_ptr<Interest> interest = makeInterest(Name("/P/obj").appendSegment(segment));
+    interest->setInterestLifetime(2_s);
+    consumer->receiveInterest(*interest);
+    this->advanceClocks(1_ms);
+  }
+
+  /** \brief reply to every Interest sent upstream which has not been answered
+   */
+  void
+  replyAll(optional<uint64_t> finalSegment = nullopt)
+  {
+    for (; nReplied < upstream->sentInterests.size(); ++nReplied) {
+      shared_ptr<Data> data = makeData(upstream->sentInterests[nReplied].getName());
+      if (finalSegment) {
+        data->setFinalBlock(name::Component::fromSegment(*finalSegment));
+      }
+      upstream->receiveData(*data);
+    }
+    this->advanceClocks(1_ms);
+  }
+
+  /** \brief check segment numbers of Interests sent upstream since the last invocation
+   */
+  void
+  checkNewUpstreamSegments(const std::vector<uint64_t>& expected)
+  {
+    std::vector<uint64_t> segments;
+    for (; nChecked < upstream->sentInterests.size(); ++nChecked) {
+      segments.push_back(upstream->sentInterests[nChecked].getName()[-1].toSegment());
+    }
+    BOOST_CHECK_EQUAL_COLLECTIONS(segments.begin(), segments.end(), expected.begin(), expected.end());
+  }
+
+  SegmentPrefetchStrategy::MtInfo&
+  getMtInfo()
+  {
+    measurements::Entry* me = forwarder.getMeasurements().findExactMatch("/P/obj");
+    BOOST_REQUIRE(me != nullptr);
+    auto mi = me->getStrategyInfo<SegmentPrefetchStrategy::MtInfo>();
+    BOOST_REQUIRE(mi != nullptr);
+    return *mi;
+  }
+
+protected:
+  Forwarder forwarder;
+  SegmentPrefetchStrategy& strategy;
+  shared_ptr<DummyFace> consumer;
+  shared_ptr<DummyFace> upstream;
+  size_t nReplied = 0;
+  size_t nChecked = 0;
+};
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestSegmentPrefetchStrategy, SegmentPrefetchStrategyFixture)
+
+BOOST_AUTO_TEST_CASE(PrefetchAfterSequentialAccess)
+{
+  request(0);
+  request(1);
+  checkNewUpstreamSegments({0, 1});
+
+  // the third consecutive segment triggers prefetching at the initial depth
+  request(2);
+  checkNewUpstreamSegments({2, 3, 4});
+  BOOST_CHECK_EQUAL(strategy.getCounters().nPrefetchInterests, 2);
+
+  // prefetched Data is admitted into the ContentStore but not sent to the consumer
+  replyAll();
+  BOOST_CHECK_EQUAL(consumer->sentData.size(), 3);
+  BOOST_CHECK_EQUAL(forwarder.getCs().size(), 5);
+
+  // the consumer's Interest for a prefetched segment is satisfied locally,
+  // and the depth grows so that prefetching stays ahead of the consumer
+  request(3);
+  BOOST_REQUIRE_EQUAL(consumer->sentData.size(), 4);
+  BOOST_CHECK_EQUAL(consumer->sentData.back().getName(), Name("/P/obj").appendSegment(3));
+  BOOST_CHECK_EQUAL(strategy.getCounters().nUsefulPrefetches, 1);
+  BOOST_CHECK_EQUAL(getMtInfo().depth, 3);
+  checkNewUpstreamSegments({5, 6});
+}
+
+BOOST_AUTO_TEST_CASE(AggregateIntoPrefetch)
+{
+  request(0);
+  request(1);
+  request(2);
+  checkNewUpstreamSegments({0, 1, 2, 3, 4});
+
+  // the Interest waits for the pending prefetch Interest instead of being forwarded again
+  request(3);
+  checkNewUpstreamSegments({5, 6});
+  BOOST_CHECK_EQUAL(strategy.getCounters().nUsefulPrefetches, 1);
+
+  replyAll();
+  BOOST_CHECK_EQUAL(consumer->sentData.size(), 4);
+  BOOST_CHECK_EQUAL(forwarder.getPit().size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(SkippedSegmentsAreWasted)
+{
+  request(0);
+  request(1);
+  request(2);
+  BOOST_CHECK_EQUAL(getMtInfo().depth, 2);
+
+  // a jump is not sequential access, and the skipped prefetched segments are wasted
+  request(10);
+  checkNewUpstreamSegments({0, 1, 2, 3, 4, 10});
+  BOOST_CHECK_EQUAL(strategy.getCounters().nWastedPrefetches, 2);
+  BOOST_CHECK_EQUAL(getMtInfo().depth, 1);
+
+  request(11);
+  request(12);
+  checkNewUpstreamSegments({11, 12, 13});
+}
+
+BOOST_AUTO_TEST_CASE(FinalSegment)
+{
+  request(0);
+  replyAll(3);
+  request(1);
+  replyAll(3);
+
+  // no prefetching beyond the final segment
+  request(2);
+  checkNewUpstreamSegments({0, 1, 2, 3});
+}
+
+BOOST_AUTO_TEST_CASE(PrefetchNack)
+{
+  request(0);
+  request(1);
+  request(2);
+  checkNewUpstreamSegments({0, 1, 2, 3, 4});
+
+  upstream->receiveNack(makeNack(upstream->sentInterests[3], lp::NackReason::NO_ROUTE));
+  this->advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(getMtInfo().depth, 1);
+  BOOST_CHECK_EQUAL(strategy.getCounters().nFailedPrefetches, 1);
+  BOOST_CHECK(consumer->sentNacks.empty());
+
+  // the Interest for the Nacked segment is forwarded normally
+  request(3);
+  checkNewUpstreamSegments({3});
+}
+
+BOOST_AUTO_TEST_CASE(PrefetchTimeout)
+{
+  request(0);
+  request(1);
+  request(2);
+  BOOST_CHECK_EQUAL(strategy.getCounters().nPrefetchInterests, 2);
+
+  this->advanceClocks(100_ms, 3_s);
+  BOOST_CHECK_EQUAL(strategy.getCounters().nFailedPrefetches, 2);
+  BOOST_CHECK_EQUAL(forwarder.getPit().size(), 0);
+}
+
+class FaceBudgetFixture : public SegmentPrefetchStrategyFixture
+{
+protected:
+  FaceBudgetFixture()
+    : SegmentPrefetchStrategyFixture(Name(SegmentPrefetchStrategy::getStrategyName())
+                                     .append("face-budget~2"))
+  {
+  }
+};
+
+BOOST_FIXTURE_TEST_CASE(FaceBudget, FaceBudgetFixture)
+{
+  request(0);
+  request(1);
+  request(2);
+  checkNewUpstreamSegments({0, 1, 2, 3, 4});
+
+  // both prefetch Interests are pending
+  request(3);
+  checkNewUpstreamSegments({});
+  BOOST_CHECK_EQUAL(strategy.getCounters().nBudgetExceeded, 1);
+
+  // prefetching resumes after prefetched Data arrives
+  replyAll();
+  request(4);
+  checkNewUpstreamSegments({5, 6});
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestSegmentPrefetchStrategy
+
+class ParametersFixture
+{
+public:
+  void
+  checkValidity(std::string parameters, bool isCorrect)
+  {
+    Name strategyName(Name(SegmentPrefetchStrategy::getStrategyName()).append(parameters));
+    if (isCorrect) {
+      BOOST_CHECK_NO_THROW(make_unique<SegmentPrefetchStrategy>(forwarder, strategyName));
+    }
+    else {
+      BOOST_CHECK_THROW(make_unique<SegmentPrefetchStrategy>(forwarder, strategyName), std::invalid_argument);
+    }
+  }
+
+protected:
+  Forwarder forwarder;
+};
+
+BOOST_FIXTURE_TEST_CASE(SegmentPrefetchParameters, ParametersFixture)
+{
+  checkValidity("", true);
+  checkValidity("/max-depth~4", true);
+  checkValidity("/face-budget~8/max-depth~32", true);
+
+  checkValidity("/max-depth~0", false);
+  checkValidity("/face-budget~-1", false);
+  checkValidity("/max-depth", false);
+  checkValidity("/depth~4", false);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
@@ -29,12 +29,15 @@
 
 // All strategies, sorted alphabetically.
 #include "fw/access-strategy.hpp"
+#include "fw/adaptive-multipath-strategy.hpp"
 #include "fw/asf-strategy.hpp"
 #include "fw/best-route-strategy.hpp"
 #include "fw/best-route-strategy2.hpp"
 #include "fw/client-control-strategy.hpp"
+#include "fw/consistent-hash-strategy.hpp"
 #include "fw/multicast-strategy.hpp"
 #include "fw/ncc-strategy.hpp"
+#include "fw/segment-prefetch-strategy.hpp"
 
 #include "tests/test-common.hpp"
 #include <boost/mpl/vector.hpp>
@@ -75,12 +78,15 @@ public:
 
 using Tests = boost::mpl::vector<
   Test<AccessStrategy, false, 1>,
+  Test<AdaptiveMultipathStrategy, false, 1>,
   Test<AsfStrategy, true, 3>,
   Test<BestRouteStrategy, false, 1>,
   Test<BestRouteStrategy2, false, 5>,
   Test<ClientControlStrategy, false, 2>,
+  Test<ConsistentHashStrategy, true, 1>,
   Test<MulticastStrategy, false, 3>,
-  Test<NccStrategy, false, 1>
+  Test<NccStrategy, false, 1>,
+  Test<SegmentPrefetchStrategy, true, 1>
 >;
 
 BOOST_AUTO_TEST_CASE_TEMPLATE(Registration, T, Tests)
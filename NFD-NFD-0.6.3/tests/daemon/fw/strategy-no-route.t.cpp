@@ -30,9 +30,12 @@
 
 // Strategies returning Nack-NoRoute when there is no usable FIB nexthop,
 // sorted alphabetically.
+#include "fw/adaptive-multipath-strategy.hpp"
 #include "fw/asf-strategy.hpp"
 #include "fw/best-route-strategy2.hpp"
+#include "fw/consistent-hash-strategy.hpp"
 #include "fw/multicast-strategy.hpp"
+#include "fw/segment-prefetch-strategy.hpp"
 
 #include "tests/test-common.hpp"
 #include "tests/limited-io.hpp"
@@ -140,6 +143,10 @@ public:
 };
 
 using Tests = boost::mpl::vector<
+  Test<AdaptiveMultipathStrategy, EmptyNextHopList<AdaptiveMultipathStrategy>>,
+  Test<AdaptiveMultipathStrategy, NextHopIsDownstream<AdaptiveMultipathStrategy>>,
+  Test<AdaptiveMultipathStrategy, NextHopViolatesScope<AdaptiveMultipathStrategy>>,
+
   Test<AsfStrategy, EmptyNextHopList<AsfStrategy>>,
   Test<AsfStrategy, NextHopIsDownstream<AsfStrategy>>,
   Test<AsfStrategy, NextHopViolatesScope<AsfStrategy>>,
@@ -148,9 +155,17 @@ using Tests = boost::mpl::vector<
   Test<BestRouteStrategy2, NextHopIsDownstream<BestRouteStrategy2>>,
   Test<BestRouteStrategy2, NextHopViolatesScope<BestRouteStrategy2>>,
 
+  Test<ConsistentHashStrategy, EmptyNextHopList<ConsistentHashStrategy>>,
+  Test<ConsistentHashStrategy, NextHopIsDownstream<ConsistentHashStrategy>>,
+  Test<ConsistentHashStrategy, NextHopViolatesScope<ConsistentHashStrategy>>,
+
   Test<MulticastStrategy, EmptyNextHopList<MulticastStrategy>>,
   Test<MulticastStrategy, NextHopIsDownstream<MulticastStrategy>>,
-  Test<MulticastStrategy, NextHopViolatesScope<MulticastStrategy>>
+  Test<MulticastStrategy, NextHopViolatesScope<MulticastStrategy>>,
+
+  Test<SegmentPrefetchStrategy, EmptyNextHopList<SegmentPrefetchStrategy>>,
+  Test<SegmentPrefetchStrategy, NextHopIsDownstream<SegmentPrefetchStrategy>>,
+  Test<SegmentPrefetchStrategy, NextHopViolatesScope<SegmentPrefetchStrategy>>
 >;
 
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(IncomingInterest, T, Tests,
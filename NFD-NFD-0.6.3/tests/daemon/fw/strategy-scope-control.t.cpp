@@ -29,11 +29,14 @@
 
 // Strategies implementing namespace-based scope control, sorted alphabetically.
 #include "fw/access-strategy.hpp"
+#include "fw/adaptive-multipath-strategy.hpp"
 #include "fw/asf-strategy.hpp"
 #include "fw/best-route-strategy.hpp"
 #include "fw/best-route-strategy2.hpp"
+#include "fw/consistent-hash-strategy.hpp"
 #include "fw/multicast-strategy.hpp"
 #include "fw/ncc-strategy.hpp"
+#include "fw/segment-prefetch-strategy.hpp"
 
 #include "tests/test-common.hpp"
 #include "tests/limited-io.hpp"
@@ -107,11 +110,14 @@ public:
 
 using Tests = boost::mpl::vector<
   Test<AccessStrategy, false, false>,
+  Test<AdaptiveMultipathStrategy, true, true>,
   Test<AsfStrategy, true, false>,
   Test<BestRouteStrategy, false, false>,
   Test<BestRouteStrategy2, true, true>,
+  Test<ConsistentHashStrategy, true, true>,
   Test<MulticastStrategy, true, true>,
-  Test<NccStrategy, false, false>
+  Test<NccStrategy, false, false>,
+  Test<SegmentPrefetchStrategy, true, true>
 >;
 
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(LocalhostInterestToLocal,
@@ -219,6 +219,54 @@ BOOST_AUTO_TEST_CASE(Info)
   BOOST_CHECK_EQUAL(info.getNEntries(), 310);
   BOOST_CHECK_EQUAL(info.getNHits(), 362);
   BOOST_CHECK_EQUAL(info.getNMisses(), 1493);
+
+  // the default partition is always reported
+  BOOST_REQUIRE_EQUAL(info.getPartitions().size(), 1);
+  const ndn::nfd::CsPartition& defaultInfo = info.getPartitions().front();
+  BOOST_CHECK_EQUAL(defaultInfo.getPrefix(), "/");
+  BOOST_CHECK_EQUAL(defaultInfo.getCapacity(), 2681);
+  BOOST_CHECK_EQUAL(defaultInfo.getNEntries(), 310);
+}
+
+BOOST_AUTO_TEST_CASE(InfoPartitions)
+{
+  cs::Partition& partition = m_cs.addPartition("/FtLc0x4A", 20, cs::Policy::create("lru"));
+  for (int i = 0; i < 25; ++i) {
+    m_cs.insert(*makeData(Name("/FtLc0x4A").appendSequenceNumber(i)));
+  }
+  m_cs.setLimit(1);
+  m_cs.insert(*makeData("/Q8H4oi4g"));
+  m_cs.insert(*makeData("/Q8H4oi4g/2"));
+  m_cs.find(Interest("/FtLc0x4A/miss"), bind([]{}), bind([]{}));
+  m_cs.find(Interest(Name("/FtLc0x4A").appendSequenceNumber(24)), bind([]{}), bind([]{}));
+  m_cs.find(Interest("/Q8H4oi4g/2"), bind([]{}), bind([]{}));
+  m_cs.find(Interest("/Q8H4oi4g/3"), bind([]{}), bind([]{}));
+  m_cs.find(Interest("/Q8H4oi4g/4"), bind([]{}), bind([]{}));
+  BOOST_CHECK_EQUAL(partition.nHits, 1);
+
+  receiveInterest(Interest("/localhost/nfd/cs/info"));
+  Block dataset = concatenateResponses();
+  dataset.parse();
+  BOOST_REQUIRE_EQUAL(dataset.elements_size(), 1);
+
+  ndn::nfd::CsInfo info(*dataset.elements_begin());
+  BOOST_CHECK_EQUAL(info.getNEntries(), 21);
+  BOOST_REQUIRE_EQUAL(info.getPartitions().size(), 2);
+  const ndn::nfd::CsPartition& defaultInfo = info.getPartitions().front();
+  BOOST_CHECK_EQUAL(defaultInfo.getPrefix(), "/");
+  BOOST_CHECK_EQUAL(defaultInfo.getCapacity(), 1);
+  BOOST_CHECK_EQUAL(defaultInfo.getNEntries(), 1);
+  BOOST_CHECK_EQUAL(defaultInfo.getNHits(), 1);
+  BOOST_CHECK_EQUAL(defaultInfo.getNMisses(), 2);
+  BOOST_CHECK_EQUAL(defaultInfo.getNEvictions(), 1);
+
+  const ndn::nfd::CsPartition& partitionInfo = info.getPartitions().back();
+  BOOST_CHECK_EQUAL(partitionInfo.getPrefix(), "/FtLc0x4A");
+  BOOST_CHECK_EQUAL(partitionInfo.getCapacity(), 20);
+  BOOST_CHECK_EQUAL(partitionInfo.getNEntries(), 20);
+  BOOST_CHECK_EQUAL(partitionInfo.getNHits(), 1);
+  BOOST_CHECK_EQUAL(partitionInfo.getNMisses(), 1);
+  BOOST_CHECK_EQUAL(partitionInfo.getNEvictions(), 5);
 }
 
 BOOST_AUTO_TEST_SUITE_END() // TestCsManager
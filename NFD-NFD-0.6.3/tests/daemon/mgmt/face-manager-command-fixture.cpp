@@ -34,8 +34,9 @@ FaceManagerCommandNode::FaceManagerCommandNode(ndn::KeyChain& keyChain, uint16_t
   : face(getGlobalIoService(), keyChain, {true, true})
   , dispatcher(face, keyChain, ndn::security::SigningInfo())
   , authenticator(CommandAuthenticator::create())
+  , faceTable(forwarder.getFaceTable())
   , faceSystem(faceTable, make_shared<ndn::net::NetworkMonitorStub>(0))
-  , manager(faceSystem, dispatcher, *authenticator)
+  , manager(faceSystem, forwarder, dispatcher, *authenticator)
 {
   dispatcher.addTopPrefix("/localhost/nfd");
 
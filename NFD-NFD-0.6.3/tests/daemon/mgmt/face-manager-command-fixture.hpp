@@ -27,7 +27,7 @@
 #define NFD_TESTS_DAEMON_MGMT_FACE_MANAGER_COMMAND_FIXTURE_HPP
 
 #include "mgmt/face-manager.hpp"
-#include "fw/face-table.hpp"
+#include "fw/forwarder.hpp"
 
 #include "tests/manager-common-fixture.hpp"
 
@@ -53,7 +53,8 @@ public:
   ndn::mgmt::Dispatcher dispatcher;
   shared_ptr<CommandAuthenticator> authenticator;
 
-  FaceTable faceTable;
+  Forwarder forwarder;
+  FaceTable& faceTable;
   FaceSystem faceSystem;
   FaceManager manager;
 };
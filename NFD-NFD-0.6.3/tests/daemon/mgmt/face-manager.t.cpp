@@ -45,7 +45,7 @@ public:
   FaceManagerFixture()
     : m_faceTable(m_forwarder.getFaceTable())
     , m_faceSystem(m_faceTable, make_shared<ndn::net::NetworkMonitorStub>(0))
-    , m_manager(m_faceSystem, m_dispatcher, *m_authenticator)
+    , m_manager(m_faceSystem, m_forwarder, m_dispatcher, *m_authenticator)
   {
     setTopPrefix();
     setPrivilege("faces");
@@ -176,6 +176,74 @@ BOOST_AUTO_TEST_CASE(FaceDataset)
   // TODO#3325 check dataset contents including counter values
 }
 
+BOOST_AUTO_TEST_CASE(FaceDatasetShedInterests)
+{
+  auto face1 = static_pointer_cast<DummyFace>(addFace(REMOVE_LAST_NOTIFICATION));
+  auto face2 = addFace(REMOVE_LAST_NOTIFICATION);
+
+  // the PIT is past its hard limit, so every new Interest is shed
+  Pit& pit = m_forwarder.getPit();
+  pit.insert(*makeInterest("/A"));
+  pit.insert(*makeInterest("/B"));
+  pit.setBudget(1, 0);
+  face1->receiveInterest(*makeInterest("/C"));
+  face1->receiveInterest(*makeInterest("/D"));
+  BOOST_REQUIRE_EQUAL(m_forwarder.getNShedInterests(*face1), 2);
+
+  receiveInterest(Interest("/localhost/nfd/faces/list"));
+  Block content = concatenateResponses();
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 2);
+  std::map<FaceId, uint64_t> nShedInterests;
+  for (const Block& element : content.elements()) {
+    ndn::nfd::FaceStatus status(element);
+    nShedInterests[status.getFaceId()] = status.getNShedInterests();
+  }
+  BOOST_CHECK_EQUAL(nShedInterests[face1->getId()], 2);
+  BOOST_CHECK_EQUAL(nShedInterests[face2->getId()], 0);
+}
+
+BOOST_AUTO_TEST_CASE(FaceDatasetEpoch)
+{
+  auto face1 = addFace(REMOVE_LAST_NOTIFICATION);
+  auto face2 = addFace(REMOVE_LAST_NOTIFICATION);
+
+  Interest request("/localhost/nfd/faces/list");
+  request.setCanBePrefix(true);
+  request.setMustBeFresh(true);
+
+  receiveInterest(request);
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+
+  // counters of the requester's face change with every request and response,
+  // yet a request shortly after gets the same signed response
+  ++const_cast<PacketCounter&>(face1->getCounters().nInInterests);
+  ++const_cast<PacketCounter&>(face1->getCounters().nOutData);
+  advanceClocks(time::milliseconds(1100));
+  request.refreshNonce();
+  receiveInterest(request);
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 2);
+  BOOST_CHECK_EQUAL(m_responses[1].wireEncode(), m_responses[0].wireEncode());
+
+  // counters are refreshed after COUNTERS_EPOCH_PERIOD
+  advanceClocks(FaceManager::COUNTERS_EPOCH_PERIOD);
+  request.refreshNonce();
+  receiveInterest(request);
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 3);
+  BOOST_CHECK_NE(m_responses[2].getName(), m_responses[0].getName());
+
+  // a face update produces a new response
+  face2->close();
+  advanceClocks(time::milliseconds(1100), 2);
+  m_responses.clear();
+  request.refreshNonce();
+  receiveInterest(request);
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  Block content = m_responses[0].getContent();
+  content.parse();
+  BOOST_CHECK_EQUAL(content.elements().size(), 1);
+}
+
 BOOST_AUTO_TEST_CASE(FaceQuery)
 {
   using ndn::nfd::FaceQueryFilter;
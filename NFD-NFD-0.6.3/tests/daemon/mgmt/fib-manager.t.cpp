@@ -392,10 +392,12 @@ BOOST_AUTO_TEST_CASE(RecordNotExist)
   BOOST_CHECK_EQUAL(checkResponse(0, expectedName, expectedResponse), CheckResponseResult::OK);
   BOOST_CHECK_EQUAL(checkNextHop("/hello", nullopt, face2 + 100), CheckNextHopResult::NO_NEXTHOP);
 
+  uint64_t epoch = m_fib.getEpoch();
   testRemoveNextHop(makeParameters("/hello", face2));
   BOOST_REQUIRE_EQUAL(m_responses.size(), 1); // record does not exist
   BOOST_CHECK_EQUAL(checkResponse(0, expectedName, expectedResponse), CheckResponseResult::OK);
   BOOST_CHECK_EQUAL(checkNextHop("/hello", nullopt, face2), CheckNextHopResult::NO_NEXTHOP);
+  BOOST_CHECK_EQUAL(m_fib.getEpoch(), epoch);
 }
 
 BOOST_AUTO_TEST_SUITE_END() // RemoveNextHop
@@ -443,6 +445,41 @@ BOOST_AUTO_TEST_CASE(FibDataset)
                                 expectedRecords.begin(), expectedRecords.end());
 }
 
+BOOST_AUTO_TEST_CASE(FibDatasetEpoch)
+{
+  FaceId faceId1 = addFace();
+  FaceId faceId2 = addFace();
+  fib::Entry* fibEntry = m_fib.insert("/test").first;
+  m_fib.addNextHop(*fibEntry, *m_faceTable.get(faceId1), 10);
+
+  Interest request("/localhost/nfd/fib/list");
+  request.setCanBePrefix(true);
+  request.setMustBeFresh(true);
+
+  receiveInterest(request);
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+
+  // FIB is unchanged: the signed response is sent again
+  advanceClocks(time::seconds(2));
+  request.refreshNonce();
+  receiveInterest(request);
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 2);
+  BOOST_CHECK_EQUAL(m_responses[1].wireEncode(), m_responses[0].wireEncode());
+
+  // FIB is changed: a new version is generated
+  m_fib.addNextHop(*fibEntry, *m_faceTable.get(faceId2), 20);
+  advanceClocks(time::seconds(2));
+  request.refreshNonce();
+  receiveInterest(request);
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 3);
+  BOOST_CHECK_NE(m_responses[2].getName(), m_responses[0].getName());
+
+  Block content = m_responses[2].getContent();
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 1);
+  BOOST_CHECK_EQUAL(ndn::nfd::FibEntry(content.elements()[0]).getNextHopRecords().size(), 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // List
 
 BOOST_AUTO_TEST_SUITE_END() // TestFibManager
@@ -24,7 +24,10 @@
  */
 
 #include "mgmt/forwarder-status-manager.hpp"
+#include "core/io-runner.hpp"
 #include "core/version.hpp"
+#include "fw/segment-prefetch-strategy.hpp"
+#include "table/table-arena.hpp"
 
 #include "nfd-manager-common-fixture.hpp"
 
@@ -63,6 +66,7 @@ BOOST_AUTO_TEST_CASE(GeneralStatusDataset)
   m_forwarder.getMeasurements().get("ndn:/measurements3");
   m_forwarder.getCs().insert(*makeData("ndn:/cs1"));
   m_forwarder.getCs().insert(*makeData("ndn:/cs2"));
+  const_cast<PacketCounter&>(m_forwarder.getCounters().nShedInterests).set(7);
   BOOST_CHECK_GE(m_forwarder.getFib().size(), 1);
   BOOST_CHECK_GE(m_forwarder.getPit().size(), 4);
   BOOST_CHECK_GE(m_forwarder.getMeasurements().size(), 3);
@@ -93,6 +97,90 @@ BOOST_AUTO_TEST_CASE(GeneralStatusDataset)
   BOOST_CHECK_EQUAL(status.getNMeasurementsEntries(), m_forwarder.getMeasurements().size());
   BOOST_CHECK_EQUAL(status.getNCsEntries(), m_forwarder.getCs().size());
   // TODO#3325 check packet counter values
+  BOOST_CHECK_EQUAL(status.getNShedInterests(), 7);
+
+  // busy and idle time are only measured in busy-poll mode
+  BOOST_CHECK(!status.hasBusyTime());
+  BOOST_CHECK(!status.hasIdleTime());
+}
+
+BOOST_AUTO_TEST_CASE(BusyPollTimes)
+{
+  IoRunner::Options options;
+  options.wantBusyPoll = true;
+  IoRunner runner(g_io, options);
+
+  g_io.post([this] {
+    Interest request("/localhost/nfd/status/general");
+    request.setMustBeFresh(true);
+    this->receiveInterest(request);
+    g_io.stop();
+  });
+  runner.run();
+  g_io.reset();
+
+  Block response = this->concatenateResponses(0, m_responses.size());
+  ndn::nfd::ForwarderStatus status;
+  BOOST_REQUIRE_NO_THROW(status.wireDecode(response));
+  BOOST_CHECK(status.hasBusyTime());
+  BOOST_CHECK(status.hasIdleTime());
+}
+
+BOOST_AUTO_TEST_CASE(PrefetchCounters)
+{
+  using fw::SegmentPrefetchStrategy;
+  StrategyChoice& sc = m_forwarder.getStrategyChoice();
+  sc.insert("/P", SegmentPrefetchStrategy::getStrategyName());
+  sc.insert("/Q", SegmentPrefetchStrategy::getStrategyName());
+  for (const char* prefix : {"/P", "/Q"}) {
+    auto& strategy = dynamic_cast<SegmentPrefetchStrategy&>(sc.findEffectiveStrategy(prefix));
+    auto& counters = const_cast<SegmentPrefetchStrategy::Counters&>(strategy.getCounters());
+    counters.nPrefetchInterests = 10;
+    counters.nUsefulPrefetches = 6;
+    counters.nWastedPrefetches = 3;
+    counters.nFailedPrefetches = 1;
+  }
+
+  Interest request("/localhost/nfd/status/general");
+  request.setMustBeFresh(true);
+  this->receiveInterest(request);
+
+  Block response = this->concatenateResponses(0, m_responses.size());
+  ndn::nfd::ForwarderStatus status;
+  BOOST_REQUIRE_NO_THROW(status.wireDecode(response));
+  BOOST_CHECK_EQUAL(status.getNPrefetchInterests(), 20);
+  BOOST_CHECK_EQUAL(status.getNUsefulPrefetches(), 12);
+  BOOST_CHECK_EQUAL(status.getNWastedPrefetches(), 6);
+  BOOST_CHECK_EQUAL(status.getNFailedPrefetches(), 2);
+  BOOST_CHECK_EQUAL(status.getNPrefetchBudgetExceeded(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ArenaDataset)
+{
+  TableArena::Options options;
+  options.pageMode = ndn::nfd::ARENA_PAGE_MODE_NORMAL;
+  getTableArena().setOptions(options);
+  m_forwarder.getPit().insert(*makeInterest("/arena-dataset"));
+  getTableArena().setOptions({});
+
+  Interest request("/localhost/nfd/status/arena");
+  request.setMustBeFresh(true);
+  this->receiveInterest(request);
+
+  Block content = this->concatenateResponses(0, m_responses.size());
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 1);
+  ndn::nfd::ArenaInfo info;
+  BOOST_REQUIRE_NO_THROW(info.wireDecode(content.elements()[0]));
+
+  const TableArena& arena = getTableArena();
+  BOOST_CHECK_EQUAL(info.getPageMode(), ndn::nfd::ARENA_PAGE_MODE_OFF);
+  BOOST_CHECK_GE(info.getNChunks(), 1);
+  BOOST_CHECK_EQUAL(info.getNChunks(), arena.getNChunks());
+  BOOST_CHECK_EQUAL(info.getNMappedBytes(), arena.getNMappedBytes());
+  BOOST_CHECK_GT(info.getNAllocatedBytes(), 0);
+  BOOST_CHECK_EQUAL(info.getNAllocatedBytes(), arena.getNAllocatedBytes());
+  BOOST_CHECK_EQUAL(info.getNFreeBytes(), arena.getNFreeBytes());
 }
 
 BOOST_AUTO_TEST_SUITE_END() // TestForwarderStatusManager
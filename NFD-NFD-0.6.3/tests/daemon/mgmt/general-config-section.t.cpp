@@ -159,6 +159,75 @@ BOOST_AUTO_TEST_CASE(InvalidGroupConfig)
                         });
 }
 
+BOOST_AUTO_TEST_CASE(RunnerOptions)
+{
+  const std::string CONFIG = R"CONFIG(
+    general
+    {
+      busy_poll yes
+      busy_poll_spin 50
+      forwarding_cpu 2
+      rib_cpu 3
+    }
+  )CONFIG";
+
+  configFile.parse(CONFIG, true, "test-general-config-section");
+  BOOST_CHECK_EQUAL(getForwardingRunnerOptions().wantBusyPoll, false);
+  BOOST_CHECK_EQUAL(getForwardingRunnerOptions().cpu, -1);
+
+  configFile.parse(CONFIG, false, "test-general-config-section");
+  BOOST_CHECK_EQUAL(getForwardingRunnerOptions().wantBusyPoll, true);
+  BOOST_CHECK_EQUAL(getForwardingRunnerOptions().spinDuration, time::microseconds(50));
+  BOOST_CHECK_EQUAL(getForwardingRunnerOptions().cpu, 2);
+  BOOST_CHECK_EQUAL(getRibRunnerOptions().wantBusyPoll, true);
+  BOOST_CHECK_EQUAL(getRibRunnerOptions().spinDuration, time::microseconds(50));
+  BOOST_CHECK_EQUAL(getRibRunnerOptions().cpu, 3);
+
+  const std::string EMPTY_CONFIG = R"CONFIG(
+    general
+    {
+    }
+  )CONFIG";
+
+  configFile.parse(EMPTY_CONFIG, false, "test-general-config-section");
+  BOOST_CHECK_EQUAL(getForwardingRunnerOptions().wantBusyPoll, false);
+  BOOST_CHECK_EQUAL(getForwardingRunnerOptions().cpu, -1);
+  BOOST_CHECK_EQUAL(getRibRunnerOptions().wantBusyPoll, false);
+  BOOST_CHECK_EQUAL(getRibRunnerOptions().cpu, -1);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidRunnerOptions)
+{
+  const std::string CONFIG1 = R"CONFIG(
+    general
+    {
+      busy_poll maybe
+    }
+  )CONFIG";
+  BOOST_CHECK_THROW(configFile.parse(CONFIG1, true, "test-general-config-section"), ConfigFile::Error);
+
+  const std::string CONFIG2 = R"CONFIG(
+    general
+    {
+      forwarding_cpu -1
+    }
+  )CONFIG";
+  BOOST_CHECK_EXCEPTION(configFile.parse(CONFIG2, true, "test-general-config-section"),
+                        ConfigFile::Error,
+                        [] (const ConfigFile::Error& e) {
+                          return std::strcmp(e.what(), "Invalid value \"-1\" for option "
+                                                       "\"forwarding_cpu\" in \"general\" section") == 0;
+                        });
+
+  const std::string CONFIG3 = R"CONFIG(
+    general
+    {
+      rib_cpu two
+    }
+  )CONFIG";
+  BOOST_CHECK_THROW(configFile.parse(CONFIG3, true, "test-general-config-section"), ConfigFile::Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestGeneralConfigSection
 BOOST_AUTO_TEST_SUITE_END() // Mgmt
 
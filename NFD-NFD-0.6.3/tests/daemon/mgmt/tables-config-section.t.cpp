@@ -200,6 +200,332 @@ BOOST_AUTO_TEST_CASE(Unknown)
 
 BOOST_AUTO_TEST_SUITE_END() // CsPolicy
 
+BOOST_AUTO_TEST_SUITE(CsAdmission)
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+    }
+  )CONFIG";
+
+  runConfig(CONFIG, false);
+  BOOST_CHECK(cs.getAdmissionFilter() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(TinyLfu)
+{
+  const std::string CONFIG_TINYLFU = R"CONFIG(
+    tables
+    {
+      cs_admission tinylfu
+    }
+  )CONFIG";
+
+  const std::string CONFIG_NONE = R"CONFIG(
+    tables
+    {
+      cs_admission none
+    }
+  )CONFIG";
+
+  runConfig(CONFIG_TINYLFU, true);
+  BOOST_CHECK(cs.getAdmissionFilter() == nullptr);
+
+  runConfig(CONFIG_TINYLFU, false);
+  cs::TinyLfu* filter = cs.getAdmissionFilter();
+  BOOST_REQUIRE(filter != nullptr);
+
+  // reload keeps the filter
+  runConfig(CONFIG_TINYLFU, false);
+  BOOST_CHECK_EQUAL(cs.getAdmissionFilter(), filter);
+
+  runConfig(CONFIG_NONE, false);
+  BOOST_CHECK(cs.getAdmissionFilter() == nullptr);
+
+  runConfig(CONFIG_TINYLFU, false);
+  BOOST_CHECK(cs.getAdmissionFilter() != nullptr);
+  tablesConfig.ensureConfigured();
+  BOOST_CHECK(cs.getAdmissionFilter() != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Invalid)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_admission lfu
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CsAdmission
+
+BOOST_AUTO_TEST_SUITE(CsCompression)
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+    }
+  )CONFIG";
+
+  runConfig(CONFIG, false);
+  BOOST_CHECK(cs.getCompressor() == nullptr);
+  BOOST_CHECK_EQUAL(cs.getHotPercent(), Cs::DEFAULT_HOT_PERCENT);
+}
+
+BOOST_AUTO_TEST_CASE(Valid)
+{
+  if (cs::Compressor::getCodecs().empty()) {
+    BOOST_TEST_MESSAGE("no codec available, skipping");
+    return;
+  }
+  const std::string codec = *cs::Compressor::getCodecs().begin();
+
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_compression )CONFIG" + codec + R"CONFIG(
+      cs_compression_hot_percent 25
+    }
+  )CONFIG";
+
+  const std::string CONFIG_NONE = R"CONFIG(
+    tables
+    {
+      cs_compression none
+    }
+  )CONFIG";
+
+  runConfig(CONFIG, true);
+  BOOST_CHECK(cs.getCompressor() == nullptr);
+  BOOST_CHECK_EQUAL(cs.getHotPercent(), Cs::DEFAULT_HOT_PERCENT);
+
+  runConfig(CONFIG, false);
+  const cs::Compressor* compressor = cs.getCompressor();
+  BOOST_REQUIRE(compressor != nullptr);
+  BOOST_CHECK_EQUAL(compressor->getCodec(), codec);
+  BOOST_CHECK_EQUAL(cs.getHotPercent(), 25);
+
+  // reload keeps the compressor
+  runConfig(CONFIG, false);
+  BOOST_CHECK_EQUAL(cs.getCompressor(), compressor);
+
+  runConfig(CONFIG_NONE, false);
+  BOOST_CHECK(cs.getCompressor() == nullptr);
+  BOOST_CHECK_EQUAL(cs.getHotPercent(), Cs::DEFAULT_HOT_PERCENT);
+}
+
+BOOST_AUTO_TEST_CASE(UnavailableCodec)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_compression lz77
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidHotPercent)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_compression_hot_percent 101
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CsCompression
+
+BOOST_AUTO_TEST_SUITE(CsPartitions)
+
+BOOST_AUTO_TEST_CASE(Valid)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_partitions
+      {
+        /video
+        {
+          capacity 1000
+          policy priority_fifo
+          admission tinylfu
+        }
+        /ctrl
+        {
+          capacity 100
+        }
+      }
+    }
+  )CONFIG";
+
+  const std::string CONFIG_RELOAD = R"CONFIG(
+    tables
+    {
+      cs_partitions
+      {
+        /video
+        {
+          capacity 2000
+          policy lru
+        }
+      }
+    }
+  )CONFIG";
+
+  runConfig(CONFIG, true);
+  BOOST_CHECK_EQUAL(cs.getPartitions().size(), 0);
+
+  runConfig(CONFIG, false);
+  BOOST_REQUIRE_EQUAL(cs.getPartitions().size(), 2);
+  cs::Partition* video = cs.getPartition("/video");
+  BOOST_REQUIRE(video != nullptr);
+  BOOST_CHECK_EQUAL(video->getLimit(), 1000);
+  BOOST_CHECK_EQUAL(video->getPolicy()->getName(), "priority_fifo");
+  BOOST_CHECK(video->getAdmissionFilter() != nullptr);
+  cs::Partition* ctrl = cs.getPartition("/ctrl");
+  BOOST_REQUIRE(ctrl != nullptr);
+  BOOST_CHECK_EQUAL(ctrl->getLimit(), 100);
+  BOOST_CHECK_EQUAL(ctrl->getPolicy()->getName(), "lru");
+  BOOST_CHECK(ctrl->getAdmissionFilter() == nullptr);
+
+  cs.insert(*makeData("/video/1"));
+  cs.insert(*makeData("/ctrl/1"));
+  BOOST_CHECK_EQUAL(video->size(), 1);
+
+  // reload keeps a partition that is still listed, but does not change the policy of a
+  // non-empty partition
+  runConfig(CONFIG_RELOAD, false);
+  BOOST_REQUIRE_EQUAL(cs.getPartitions().size(), 1);
+  BOOST_CHECK_EQUAL(cs.getPartition("/video"), video);
+  BOOST_CHECK_EQUAL(video->getLimit(), 2000);
+  BOOST_CHECK_EQUAL(video->getPolicy()->getName(), "priority_fifo");
+  BOOST_CHECK(video->getAdmissionFilter() == nullptr);
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+
+  // omitted section erases all partitions
+  runConfig("tables\n{\n}\n", false);
+  BOOST_CHECK_EQUAL(cs.getPartitions().size(), 0);
+  BOOST_CHECK_EQUAL(cs.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(EnsureConfigured)
+{
+  cs.addPartition("/video", 10, cs::Policy::create("lru"));
+  tablesConfig.ensureConfigured();
+  BOOST_CHECK_EQUAL(cs.getPartitions().size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Invalid)
+{
+  const std::string CONFIG_ROOT = R"CONFIG(
+    tables
+    {
+      cs_partitions
+      {
+        /
+        {
+          capacity 1000
+        }
+      }
+    }
+  )CONFIG";
+
+  const std::string CONFIG_NO_CAPACITY = R"CONFIG(
+    tables
+    {
+      cs_partitions
+      {
+        /video
+        {
+          policy lru
+        }
+      }
+    }
+  )CONFIG";
+
+  const std::string CONFIG_UNKNOWN_POLICY = R"CONFIG(
+    tables
+    {
+      cs_partitions
+      {
+        /video
+        {
+          capacity 1000
+          policy mru
+        }
+      }
+    }
+  )CONFIG";
+
+  const std::string CONFIG_BAD_ADMISSION = R"CONFIG(
+    tables
+    {
+      cs_partitions
+      {
+        /video
+        {
+          capacity 1000
+          admission lfu
+        }
+      }
+    }
+  )CONFIG";
+
+  const std::string CONFIG_UNKNOWN_OPTION = R"CONFIG(
+    tables
+    {
+      cs_partitions
+      {
+        /video
+        {
+          capacity 1000
+          size 1000
+        }
+      }
+    }
+  )CONFIG";
+
+  const std::string CONFIG_DUPLICATE = R"CONFIG(
+    tables
+    {
+      cs_partitions
+      {
+        /video
+        {
+          capacity 1000
+        }
+        /video
+        {
+          capacity 2000
+        }
+      }
+    }
+  )CONFIG";
+
+  for (const std::string& config : {CONFIG_ROOT, CONFIG_NO_CAPACITY, CONFIG_UNKNOWN_POLICY,
+                                    CONFIG_BAD_ADMISSION, CONFIG_UNKNOWN_OPTION, CONFIG_DUPLICATE}) {
+    BOOST_CHECK_THROW(runConfig(config, true), ConfigFile::Error);
+    BOOST_CHECK_THROW(runConfig(config, false), ConfigFile::Error);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CsPartitions
+
 class CsUnsolicitedPolicyFixture : public TablesConfigSectionFixture
 {
 protected:
@@ -273,6 +599,141 @@ BOOST_AUTO_TEST_CASE(Unknown)
 
 BOOST_AUTO_TEST_SUITE_END() // CsUnsolicitedPolicy
 
+class ArenaFixture : public TablesConfigSectionFixture
+{
+protected:
+  ~ArenaFixture()
+  {
+    getTableArena().setOptions({});
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(Arena, ArenaFixture)
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+    }
+  )CONFIG";
+
+  TableArena::Options options;
+  options.pageMode = ndn::nfd::ARENA_PAGE_MODE_NORMAL;
+  getTableArena().setOptions(options);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_EQUAL(getTableArena().getOptions().pageMode, ndn::nfd::ARENA_PAGE_MODE_NORMAL);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(getTableArena().getOptions().pageMode, ndn::nfd::ARENA_PAGE_MODE_OFF);
+  BOOST_CHECK_EQUAL(getTableArena().getOptions().maxSize, 0);
+}
+
+BOOST_AUTO_TEST_CASE(Valid)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      arena_page_mode transparent
+      arena_max_size 64
+    }
+  )CONFIG";
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_EQUAL(getTableArena().getOptions().pageMode, ndn::nfd::ARENA_PAGE_MODE_OFF);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(getTableArena().getOptions().pageMode, ndn::nfd::ARENA_PAGE_MODE_TRANSPARENT);
+  BOOST_CHECK_EQUAL(getTableArena().getOptions().maxSize, 64 * 1024 * 1024);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidPageMode)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      arena_page_mode huge
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidMaxSize)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      arena_max_size many
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Arena
+
+BOOST_AUTO_TEST_SUITE(PitBudget)
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+    }
+  )CONFIG";
+
+  Pit& pit = forwarder.getPit();
+  pit.setBudget(10, 20);
+  pit.setFaceQuota(30);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(pit.getMaxEntries(), 0);
+  BOOST_CHECK_EQUAL(pit.getMaxBytes(), 0);
+  BOOST_CHECK_EQUAL(pit.getFaceQuota(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Valid)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      pit_max_entries 100000
+      pit_max_size 16
+      pit_face_quota 5000
+    }
+  )CONFIG";
+
+  Pit& pit = forwarder.getPit();
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_EQUAL(pit.getMaxEntries(), 0);
+  BOOST_CHECK_EQUAL(pit.getMaxBytes(), 0);
+  BOOST_CHECK_EQUAL(pit.getFaceQuota(), 0);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(pit.getMaxEntries(), 100000);
+  BOOST_CHECK_EQUAL(pit.getMaxBytes(), 16 * 1024 * 1024);
+  BOOST_CHECK_EQUAL(pit.getFaceQuota(), 5000);
+}
+
+BOOST_AUTO_TEST_CASE(Invalid)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      pit_face_quota -1
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // PitBudget
+
 BOOST_AUTO_TEST_SUITE(StrategyChoice)
 
 BOOST_AUTO_TEST_CASE(Unversioned)
@@ -0,0 +1,121 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/cs-compressor.hpp"
+#include "core/random.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace cs {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Table)
+BOOST_FIXTURE_TEST_SUITE(TestCsCompressor, BaseFixture)
+
+static std::vector<uint8_t>
+makeText(size_t size)
+{
+  static const std::string LINE = "{\"sensor\": \"/lab/room1/temp\", \"value\": 21.5, \"unit\": \"C\"}\n";
+  std::vector<uint8_t> text;
+  while (text.size() < size) {
+    text.insert(text.end(), LINE.begin(), LINE.end());
+  }
+  text.resize(size);
+  return text;
+}
+
+static std::vector<uint8_t>
+makeRandom(size_t size)
+{
+  std::uniform_int_distribution<int> dist(0, 255);
+  std::vector<uint8_t> buf(size);
+  for (uint8_t& b : buf) {
+    b = static_cast<uint8_t>(dist(getGlobalRng()));
+  }
+  return buf;
+}
+
+BOOST_AUTO_TEST_CASE(Create)
+{
+  BOOST_CHECK(Compressor::create("none") == nullptr);
+  BOOST_CHECK(Compressor::create("rar") == nullptr);
+
+  for (const std::string& codec : Compressor::getCodecs()) {
+    unique_ptr<Compressor> compressor = Compressor::create(codec);
+    BOOST_REQUIRE(compressor != nullptr);
+    BOOST_CHECK_EQUAL(compressor->getCodec(), codec);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(RoundTrip)
+{
+  std::vector<uint8_t> text = makeText(4096);
+  std::vector<uint8_t> random = makeRandom(4096);
+
+  for (const std::string& codec : Compressor::getCodecs()) {
+    BOOST_TEST_CONTEXT("codec=" << codec) {
+      unique_ptr<Compressor> compressor = Compressor::create(codec);
+
+      CompressedBuffer compressed;
+      BOOST_REQUIRE(compressor->compress(text.data(), text.size(), compressed));
+      BOOST_CHECK_LT(compressed.size(), text.size() / 3);
+
+      std::vector<uint8_t> decompressed(text.size());
+      BOOST_REQUIRE(compressor->decompress(compressed.data(), compressed.size(),
+                                           decompressed.data(), decompressed.size()));
+      BOOST_CHECK_EQUAL_COLLECTIONS(decompressed.begin(), decompressed.end(), text.begin(), text.end());
+
+      // size mismatch
+      BOOST_CHECK(!compressor->decompress(compressed.data(), compressed.size(),
+                                          decompressed.data(), decompressed.size() - 1));
+
+      // does not shrink
+      CompressedBuffer incompressible;
+      BOOST_CHECK(!compressor->compress(random.data(), random.size(), incompressible));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(IsLikelyIncompressible)
+{
+  std::vector<uint8_t> text = makeText(4096);
+  std::vector<uint8_t> random = makeRandom(4096);
+
+  BOOST_CHECK_EQUAL(Compressor::isLikelyIncompressible(text.data(), text.size()), false);
+  BOOST_CHECK_EQUAL(Compressor::isLikelyIncompressible(random.data(), random.size()), true);
+
+  // too short to tell
+  BOOST_CHECK_EQUAL(Compressor::isLikelyIncompressible(random.data(), 100), false);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCsCompressor
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace tests
+} // namespace cs
+} // namespace nfd
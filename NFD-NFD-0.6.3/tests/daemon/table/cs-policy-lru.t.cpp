@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2017,  Regents of the University of California,
+ * Copyright (c) 2014-2018,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -90,6 +90,32 @@ BOOST_FIXTURE_TEST_CASE(EvictOne, UnitTestTimeFixture)
           bind([] { BOOST_CHECK(true); }));
 }
 
+BOOST_FIXTURE_TEST_CASE(EraseMiddle, UnitTestTimeFixture)
+{
+  Cs cs(3);
+  cs.setPolicy(make_unique<LruPolicy>());
+
+  cs.insert(*makeData("ndn:/A"));
+  cs.insert(*makeData("ndn:/B"));
+  cs.insert(*makeData("ndn:/C"));
+
+  size_t nErased = 0;
+  cs.erase("ndn:/B", 1, [&] (size_t n) { nErased = n; });
+  BOOST_CHECK_EQUAL(nErased, 1);
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+
+  // evict A
+  cs.insert(*makeData("ndn:/D"));
+  cs.insert(*makeData("ndn:/E"));
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+  cs.find(Interest("ndn:/A"),
+          bind([] { BOOST_CHECK(false); }),
+          bind([] { BOOST_CHECK(true); }));
+  cs.find(Interest("ndn:/C"),
+          bind([] { BOOST_CHECK(true); }),
+          bind([] { BOOST_CHECK(false); }));
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestCsLru
 BOOST_AUTO_TEST_SUITE_END() // Table
 
@@ -0,0 +1,143 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/cs-policy-slru.hpp"
+#include "table/cs.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace cs {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Table)
+BOOST_AUTO_TEST_SUITE(TestCsSlru)
+
+BOOST_AUTO_TEST_CASE(Registration)
+{
+  std::set<std::string> policyNames = Policy::getPolicyNames();
+  BOOST_CHECK_EQUAL(policyNames.count("slru"), 1);
+}
+
+class SlruFixture : public UnitTestTimeFixture
+{
+protected:
+  SlruFixture()
+    : cs(5)
+  {
+    auto policy = make_unique<SlruPolicy>();
+    this->policy = policy.get();
+    cs.setPolicy(std::move(policy));
+  }
+
+  bool
+  isHit(const Name& name)
+  {
+    bool hit = false;
+    cs.find(Interest(name),
+            [&] (const Interest&, const Data&) { hit = true; },
+            bind([] {}));
+    return hit;
+  }
+
+protected:
+  Cs cs;
+  SlruPolicy* policy;
+};
+
+BOOST_FIXTURE_TEST_CASE(ScanResistance, SlruFixture)
+{
+  cs.insert(*makeData("ndn:/A"));
+  cs.insert(*makeData("ndn:/B"));
+  cs.insert(*makeData("ndn:/C"));
+  cs.insert(*makeData("ndn:/D"));
+  cs.insert(*makeData("ndn:/E"));
+
+  // promote A and B
+  BOOST_CHECK(isHit("ndn:/A"));
+  BOOST_CHECK(isHit("ndn:/B"));
+  BOOST_CHECK_EQUAL(policy->m_protected.size(), 2);
+  BOOST_CHECK_EQUAL(policy->m_probation.size(), 3);
+
+  // scan evicts from probationary segment only
+  cs.insert(*makeData("ndn:/F"));
+  cs.insert(*makeData("ndn:/G"));
+  cs.insert(*makeData("ndn:/H"));
+  cs.insert(*makeData("ndn:/I"));
+  BOOST_CHECK_EQUAL(cs.size(), 5);
+  BOOST_CHECK(!isHit("ndn:/C"));
+  BOOST_CHECK(!isHit("ndn:/D"));
+  BOOST_CHECK(!isHit("ndn:/E"));
+  BOOST_CHECK(!isHit("ndn:/F"));
+  BOOST_CHECK(isHit("ndn:/A"));
+  BOOST_CHECK(isHit("ndn:/B"));
+}
+
+BOOST_FIXTURE_TEST_CASE(Demote, SlruFixture)
+{
+  // protected segment holds 4 entries
+  for (const char* uri : {"ndn:/A", "ndn:/B", "ndn:/C", "ndn:/D", "ndn:/E"}) {
+    cs.insert(*makeData(uri));
+    BOOST_CHECK(isHit(uri));
+  }
+  BOOST_CHECK_EQUAL(policy->m_protected.size(), 4);
+  BOOST_CHECK_EQUAL(policy->m_probation.size(), 1);
+
+  // A was demoted, and is evicted first
+  cs.insert(*makeData("ndn:/F"));
+  BOOST_CHECK_EQUAL(cs.size(), 5);
+  BOOST_CHECK(!isHit("ndn:/A"));
+  BOOST_CHECK(isHit("ndn:/B"));
+}
+
+BOOST_FIXTURE_TEST_CASE(EraseAndLimit, SlruFixture)
+{
+  cs.insert(*makeData("ndn:/A"));
+  cs.insert(*makeData("ndn:/B"));
+  cs.insert(*makeData("ndn:/C"));
+  BOOST_CHECK(isHit("ndn:/B"));
+
+  size_t nErased = 0;
+  cs.erase("ndn:/", 3, [&] (size_t n) { nErased = n; });
+  BOOST_CHECK_EQUAL(nErased, 3);
+  BOOST_CHECK_EQUAL(policy->m_protected.size(), 0);
+  BOOST_CHECK_EQUAL(policy->m_probation.size(), 0);
+
+  cs.insert(*makeData("ndn:/D"));
+  cs.insert(*makeData("ndn:/E"));
+  BOOST_CHECK(isHit("ndn:/D"));
+  cs.setLimit(1);
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+  BOOST_CHECK(isHit("ndn:/D"));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCsSlru
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace tests
+} // namespace cs
+} // namespace nfd
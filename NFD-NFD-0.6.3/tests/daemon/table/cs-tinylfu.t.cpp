@@ -0,0 +1,113 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/cs-tinylfu.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace cs {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(Table)
+BOOST_FIXTURE_TEST_SUITE(TestCsTinyLfu, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(Estimate)
+{
+  TinyLfu filter(100);
+  BOOST_CHECK_EQUAL(filter.estimate("/A"), 0);
+
+  // the first access only goes into the doorkeeper
+  filter.recordAccess("/A");
+  BOOST_CHECK_EQUAL(filter.estimate("/A"), 1);
+
+  for (int i = 0; i < 4; ++i) {
+    filter.recordAccess("/A");
+  }
+  BOOST_CHECK_EQUAL(filter.estimate("/A"), 5);
+  BOOST_CHECK_EQUAL(filter.estimate("/B"), 0);
+
+  // counters saturate
+  for (int i = 0; i < 100; ++i) {
+    filter.recordAccess("/A");
+  }
+  BOOST_CHECK_EQUAL(filter.estimate("/A"), TinyLfu::MAX_COUNT + 1);
+}
+
+BOOST_AUTO_TEST_CASE(Aging)
+{
+  TinyLfu filter(100);
+  for (int i = 0; i < 9; ++i) {
+    filter.recordAccess("/A");
+  }
+  BOOST_CHECK_EQUAL(filter.estimate("/A"), 9);
+
+  filter.age();
+  BOOST_CHECK_EQUAL(filter.estimate("/A"), 4);
+
+  // aging happens automatically after getSampleSize() accesses
+  filter.recordAccess("/A");
+  BOOST_CHECK_EQUAL(filter.estimate("/A"), 5);
+  for (size_t i = 0; i < filter.getSampleSize(); ++i) {
+    filter.recordAccess(Name("/B").appendNumber(i));
+  }
+  BOOST_CHECK_LT(filter.estimate("/A"), 5);
+}
+
+BOOST_AUTO_TEST_CASE(SetCapacity)
+{
+  TinyLfu filter(100);
+  filter.recordAccess("/A");
+  filter.recordAccess("/A");
+
+  filter.setCapacity(100);
+  BOOST_CHECK_EQUAL(filter.estimate("/A"), 2);
+
+  filter.setCapacity(200);
+  BOOST_CHECK_EQUAL(filter.estimate("/A"), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Admit)
+{
+  TinyLfu filter(100);
+  filter.recordAccess("/popular");
+  filter.recordAccess("/popular");
+  filter.recordAccess("/once");
+
+  BOOST_CHECK_EQUAL(filter.admit("/once", "/popular"), false);
+  BOOST_CHECK_EQUAL(filter.admit("/popular", "/once"), true);
+  BOOST_CHECK_EQUAL(filter.admit("/once", "/once"), false); // tie favors the existing entry
+  BOOST_CHECK_EQUAL(filter.getNAdmitted(), 1);
+  BOOST_CHECK_EQUAL(filter.getNRejected(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCsTinyLfu
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace tests
+} // namespace cs
+} // namespace nfd
@@ -24,6 +24,7 @@
  */
 
 #include "table/cs.hpp"
+#include "core/random.hpp"
 
 #include "tests/test-common.hpp"
 
@@ -31,6 +32,7 @@
 
 #include <ndn-cxx/exclude.hpp>
 #include <ndn-cxx/lp/tags.hpp>
+#include <ndn-cxx/security/signature-sha256-with-rsa.hpp>
 #include <ndn-cxx/util/sha256.hpp>
 
 #define CHECK_CS_FIND(expected) find([&] (uint32_t found) { BOOST_CHECK_EQUAL(expected, found); });
@@ -459,6 +461,357 @@ BOOST_FIXTURE_TEST_CASE(EnablementFlags, FindFixture)
   CHECK_CS_FIND(3);
 }
 
+BOOST_FIXTURE_TEST_CASE(Contains, FindFixture)
+{
+  m_cs.setLimit(2);
+  m_cs.setPolicy(Policy::create("lru"));
+  insert(1, "/A");
+  insert(2, "/B");
+
+  BOOST_CHECK_EQUAL(m_cs.contains(Interest("/A")), true);
+  BOOST_CHECK_EQUAL(m_cs.contains(Interest("/C")), false);
+  Partition& partition = m_cs.getDefaultPartition();
+  BOOST_CHECK_EQUAL(partition.nHits, 0);
+  BOOST_CHECK_EQUAL(partition.nMisses, 0);
+
+  // a probe does not refresh /A in the replacement policy, so /A is evicted first
+  insert(3, "/C");
+  startInterest("/A");
+  CHECK_CS_FIND(0);
+  startInterest("/B");
+  CHECK_CS_FIND(2);
+
+  m_cs.enableServe(false);
+  BOOST_CHECK_EQUAL(m_cs.contains(Interest("/B")), false);
+}
+
+BOOST_FIXTURE_TEST_CASE(AdmissionFilter, FindFixture)
+{
+  m_cs.setLimit(2);
+  m_cs.setAdmissionFilter(make_unique<TinyLfu>(2));
+  BOOST_REQUIRE(m_cs.getAdmissionFilter() != nullptr);
+
+  insert(1, "/A");
+  insert(2, "/B");
+  for (int i = 0; i < 2; ++i) {
+    startInterest("/A");
+    CHECK_CS_FIND(1);
+    startInterest("/B");
+    CHECK_CS_FIND(2);
+  }
+
+  // /C is less popular than the LRU victim /A
+  insert(3, "/C");
+  BOOST_CHECK_EQUAL(m_cs.size(), 2);
+  startInterest("/A");
+  CHECK_CS_FIND(1);
+  BOOST_CHECK_EQUAL(m_cs.getAdmissionFilter()->getNRejected(), 1);
+
+  // /C becomes more popular than the LRU victim /B
+  for (int i = 0; i < 4; ++i) {
+    startInterest("/C");
+    CHECK_CS_FIND(0);
+  }
+  insert(3, "/C");
+  BOOST_CHECK_EQUAL(m_cs.size(), 2);
+  startInterest("/B");
+  CHECK_CS_FIND(0);
+  startInterest("/C");
+  CHECK_CS_FIND(3);
+  BOOST_CHECK_EQUAL(m_cs.getAdmissionFilter()->getNAdmitted(), 1);
+
+  m_cs.setAdmissionFilter(nullptr);
+  insert(4, "/D");
+  startInterest("/D");
+  CHECK_CS_FIND(4);
+}
+
+BOOST_FIXTURE_TEST_CASE(AdmissionFilterRecordsDataName, FindFixture)
+{
+  m_cs.setAdmissionFilter(make_unique<TinyLfu>(10));
+  const TinyLfu& filter = *m_cs.getAdmissionFilter();
+
+  insert(1, "/A/1");
+  BOOST_CHECK_EQUAL(filter.estimate("/A/1"), 1);
+
+  // a hit is recorded for the name of the matched Data
+  startInterest("/A");
+  CHECK_CS_FIND(1);
+  BOOST_CHECK_EQUAL(filter.estimate("/A/1"), 2);
+  BOOST_CHECK_EQUAL(filter.estimate("/A"), 0);
+
+  // a miss is recorded for the Interest name
+  startInterest("/B");
+  CHECK_CS_FIND(0);
+  BOOST_CHECK_EQUAL(filter.estimate("/B"), 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(Compression, FindFixture)
+{
+  if (Compressor::getCodecs().empty()) {
+    BOOST_TEST_MESSAGE("no codec available, skipping");
+    return;
+  }
+
+  static const std::string LINE = "{\"sensor\": \"/lab/room1/temp\", \"value\": 21.5}\n";
+  auto appendText = [] (Data& data) {
+    std::vector<uint8_t> content(data.getContent().value_begin(), data.getContent().value_end());
+    while (content.size() < 1024) {
+      content.insert(content.end(), LINE.begin(), LINE.end());
+    }
+    data.setContent(content.data(), content.size());
+  };
+  auto appendRandom = [] (Data& data) {
+    std::vector<uint8_t> content(data.getContent().value_begin(), data.getContent().value_end());
+    std::uniform_int_distribution<int> dist(0, 255);
+    while (content.size() < 1024) {
+      content.push_back(static_cast<uint8_t>(dist(getGlobalRng())));
+    }
+    data.setContent(content.data(), content.size());
+  };
+  auto isCompressed = [this] (const Name& name) {
+    auto it = std::find_if(m_cs.begin(), m_cs.end(),
+                           [&name] (const Entry& entry) { return entry.getName() == name; });
+    BOOST_REQUIRE(it != m_cs.end());
+    return it->isCompressed();
+  };
+
+  m_cs.setLimit(10);
+  m_cs.setHotPercent(20);
+  m_cs.setCompressor(Compressor::create(*Compressor::getCodecs().begin()));
+  BOOST_REQUIRE(m_cs.getCompressor() != nullptr);
+
+  // two hottest entries stay uncompressed
+  insert(1, "/A", appendText);
+  Name fullNameB = insert(2, "/B", appendText);
+  insert(3, "/C", appendText);
+  insert(4, "/D", appendText);
+  insert(5, "/E", appendText);
+  BOOST_CHECK_EQUAL(m_cs.getNCompressedEntries(), 3);
+  BOOST_CHECK_LT(m_cs.getCompressedBytes(), m_cs.getUncompressedBytes());
+  BOOST_CHECK_EQUAL(isCompressed("/A"), true);
+  BOOST_CHECK_EQUAL(isCompressed("/E"), false);
+
+  // a hit decompresses /A and pushes /D out of the hot window
+  startInterest("/A");
+  CHECK_CS_FIND(1);
+  BOOST_CHECK_EQUAL(m_cs.getNCompressedEntries(), 3);
+  BOOST_CHECK_EQUAL(isCompressed("/A"), false);
+  BOOST_CHECK_EQUAL(isCompressed("/D"), true);
+
+  // compressed entries match by full name
+  startInterest(fullNameB);
+  CHECK_CS_FIND(2);
+  BOOST_CHECK_EQUAL(isCompressed("/B"), false);
+  BOOST_CHECK_EQUAL(isCompressed("/E"), true);
+
+  // high-entropy content is never compressed
+  insert(6, "/R", appendRandom);
+  m_cs.setHotPercent(0);
+  BOOST_CHECK_EQUAL(isCompressed("/R"), false);
+  BOOST_CHECK_EQUAL(m_cs.getNCompressedEntries(), 4);
+  startInterest("/R");
+  CHECK_CS_FIND(6);
+
+  BOOST_CHECK_EQUAL(erase("/C", 1), 1);
+  BOOST_CHECK_EQUAL(m_cs.getNCompressedEntries(), 3);
+
+  m_cs.setCompressor(nullptr);
+  BOOST_CHECK_EQUAL(m_cs.getNCompressedEntries(), 0);
+  BOOST_CHECK_EQUAL(m_cs.getCompressedBytes(), 0);
+  BOOST_CHECK_EQUAL(m_cs.getUncompressedBytes(), 0);
+  startInterest("/D");
+  CHECK_CS_FIND(4);
+}
+
+BOOST_FIXTURE_TEST_CASE(CompressionKeyLocator, FindFixture)
+{
+  if (Compressor::getCodecs().empty()) {
+    BOOST_TEST_MESSAGE("no codec available, skipping");
+    return;
+  }
+
+  static const std::string LINE = "{\"sensor\": \"/lab/room1/temp\", \"value\": 21.5}\n";
+  auto appendTextSignedBy = [] (const Name& keyName) {
+    return [keyName] (Data& data) {
+      std::vector<uint8_t> content(data.getContent().value_begin(), data.getContent().value_end());
+      while (content.size() < 1024) {
+        content.insert(content.end(), LINE.begin(), LINE.end());
+      }
+      data.setContent(content.data(), content.size());
+      ndn::SignatureSha256WithRsa signature{ndn::KeyLocator(keyName)};
+      signature.setValue(ndn::encoding::makeEmptyBlock(tlv::SignatureValue));
+      data.setSignature(signature);
+    };
+  };
+  auto startKeyLocatorInterest = [this] (const Name& name, const Name& keyName) {
+    Interest interest(name);
+    interest.setCanBePrefix(true);
+    Block wire = interest.wireEncode();
+    wire.parse();
+    ndn::Selectors selectors;
+    selectors.setPublisherPublicKeyLocator(ndn::KeyLocator(keyName));
+    wire.insert(std::next(wire.elements_begin()), selectors.wireEncode());
+    wire.encode();
+    m_interest = make_shared<Interest>(wire);
+  };
+
+  m_cs.setLimit(10);
+  m_cs.setHotPercent(0);
+  m_cs.setCompressor(Compressor::create(*Compressor::getCodecs().begin()));
+  insert(1, "/A/1", appendTextSignedBy("/key/X"));
+  insert(2, "/A/2", appendTextSignedBy("/key/Y"));
+  insert(3, "/B/3", appendTextSignedBy("/key/X")); // occupies the single hot slot
+  BOOST_CHECK_EQUAL(m_cs.getNCompressedEntries(), 2);
+  size_t compressedBytes = m_cs.getCompressedBytes();
+  size_t uncompressedBytes = m_cs.getUncompressedBytes();
+
+  // candidates are decoded into a temporary; a miss leaves every entry compressed
+  startKeyLocatorInterest("/A", "/key/Z");
+  CHECK_CS_FIND(0);
+  BOOST_CHECK_EQUAL(m_cs.getNCompressedEntries(), 2);
+  BOOST_CHECK_EQUAL(m_cs.getCompressedBytes(), compressedBytes);
+  BOOST_CHECK_EQUAL(m_cs.getUncompressedBytes(), uncompressedBytes);
+
+  // a hit decompresses /A/2 and pushes /B/3 out of the hot window
+  startKeyLocatorInterest("/A", "/key/Y");
+  CHECK_CS_FIND(2);
+  BOOST_CHECK_EQUAL(m_cs.getNCompressedEntries(), 2);
+}
+
+BOOST_FIXTURE_TEST_SUITE(Partitions, FindFixture)
+
+BOOST_AUTO_TEST_CASE(Isolation)
+{
+  m_cs.setLimit(3);
+  Partition& partitionV = m_cs.addPartition("/V", 2, Policy::create("lru"));
+  BOOST_CHECK_EQUAL(m_cs.getPartition("/V"), &partitionV);
+  BOOST_CHECK_EQUAL(m_cs.getPartition("/"), &m_cs.getDefaultPartition());
+  BOOST_CHECK(m_cs.getPartition("/W") == nullptr);
+
+  insert(1, "/A");
+  insert(2, "/B");
+  for (uint32_t i = 0; i < 10; ++i) {
+    insert(10 + i, Name("/V").appendNumber(i));
+  }
+  BOOST_CHECK_EQUAL(m_cs.size(), 4);
+  BOOST_CHECK_EQUAL(partitionV.size(), 2);
+  BOOST_CHECK_EQUAL(partitionV.nEvictions, 8);
+  BOOST_CHECK_EQUAL(m_cs.getDefaultPartition().size(), 2);
+  BOOST_CHECK_EQUAL(m_cs.getDefaultPartition().nEvictions, 0);
+
+  // the bulk namespace has not evicted other Data
+  startInterest("/A");
+  CHECK_CS_FIND(1);
+  startInterest("/B");
+  CHECK_CS_FIND(2);
+  startInterest(Name("/V").appendNumber(9));
+  CHECK_CS_FIND(19);
+  startInterest(Name("/V").appendNumber(0));
+  CHECK_CS_FIND(0);
+  startInterest("/C");
+  CHECK_CS_FIND(0);
+
+  BOOST_CHECK_EQUAL(partitionV.nHits, 1);
+  BOOST_CHECK_EQUAL(partitionV.nMisses, 1);
+  BOOST_CHECK_EQUAL(m_cs.getDefaultPartition().nHits, 2);
+  BOOST_CHECK_EQUAL(m_cs.getDefaultPartition().nMisses, 1);
+}
+
+BOOST_AUTO_TEST_CASE(LongestPrefixMatch)
+{
+  Partition& partitionV = m_cs.addPartition("/V", 10, Policy::create("lru"));
+  Partition& partitionVH = m_cs.addPartition("/V/H", 1, Policy::create("priority_fifo"));
+
+  insert(1, "/V/H/1");
+  insert(2, "/V/H/2");
+  insert(3, "/V/S/1");
+  insert(4, "/V/HD/1");
+  BOOST_CHECK_EQUAL(partitionVH.size(), 1);
+  BOOST_CHECK_EQUAL(partitionV.size(), 2);
+  BOOST_CHECK_EQUAL(m_cs.getDefaultPartition().size(), 0);
+
+  startInterest("/V/H/2");
+  CHECK_CS_FIND(2);
+  BOOST_CHECK_EQUAL(partitionVH.nHits, 1);
+
+  m_cs.erasePartition("/V/H");
+  BOOST_CHECK(m_cs.getPartition("/V/H") == nullptr);
+  BOOST_CHECK_EQUAL(m_cs.size(), 2);
+
+  // an entry stays in the partition that admitted it
+  Partition& partitionVS = m_cs.addPartition("/V/S", 5, Policy::create("lru"));
+  BOOST_CHECK_EQUAL(partitionVS.size(), 0);
+  BOOST_CHECK_EQUAL(partitionV.size(), 2);
+  insert(5, "/V/S/2");
+  BOOST_CHECK_EQUAL(partitionVS.size(), 1);
+
+  // erasing a partition erases its Data, but not Data of a longer partition under it
+  m_cs.erasePartition("/V");
+  BOOST_CHECK_EQUAL(m_cs.size(), 1);
+  startInterest("/V/S/2");
+  CHECK_CS_FIND(5);
+  startInterest("/V/S/1");
+  CHECK_CS_FIND(0);
+}
+
+BOOST_AUTO_TEST_CASE(LongestPrefixMatchSkipsSiblings)
+{
+  Partition& partitionV = m_cs.addPartition("/V", 10, Policy::create("lru"));
+  // these partitions sort between /V and /V/H/1, but none of them is a prefix of it
+  for (int i = 0; i < 10; ++i) {
+    m_cs.addPartition(Name("/V/G").appendNumber(i), 1, Policy::create("lru"));
+  }
+
+  insert(1, "/V/H/1");
+  BOOST_CHECK_EQUAL(partitionV.size(), 1);
+  insert(2, "/W/1");
+  BOOST_CHECK_EQUAL(m_cs.getDefaultPartition().size(), 1);
+
+  startInterest("/V/H");
+  CHECK_CS_FIND(1);
+  BOOST_CHECK_EQUAL(partitionV.nHits, 1);
+}
+
+BOOST_AUTO_TEST_CASE(ZeroCapacity)
+{
+  m_cs.addPartition("/V", 0, Policy::create("lru"));
+  insert(1, "/V/1");
+  insert(2, "/A");
+  BOOST_CHECK_EQUAL(m_cs.size(), 1);
+
+  m_cs.setLimit(0);
+  BOOST_CHECK_EQUAL(m_cs.size(), 0);
+  m_cs.getPartition("/V")->setLimit(1);
+  insert(1, "/V/1");
+  BOOST_CHECK_EQUAL(m_cs.size(), 1);
+  startInterest("/V/1");
+  CHECK_CS_FIND(1);
+}
+
+BOOST_AUTO_TEST_CASE(AdmissionFilter)
+{
+  Partition& partition = m_cs.addPartition("/V", 1, Policy::create("lru"));
+  partition.setAdmissionFilter(make_unique<TinyLfu>(1));
+  BOOST_REQUIRE(partition.getAdmissionFilter() != nullptr);
+  BOOST_CHECK(m_cs.getAdmissionFilter() == nullptr);
+
+  insert(1, "/V/1");
+  startInterest("/V/1");
+  CHECK_CS_FIND(1);
+  startInterest("/V/1");
+  CHECK_CS_FIND(1);
+
+  // /V/2 is less popular than the LRU victim /V/1
+  insert(2, "/V/2");
+  startInterest("/V/1");
+  CHECK_CS_FIND(1);
+  BOOST_CHECK_EQUAL(partition.getAdmissionFilter()->getNRejected(), 1);
+  BOOST_CHECK_EQUAL(partition.nEvictions, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Partitions
+
 BOOST_FIXTURE_TEST_CASE(CachePolicyNoCache, FindFixture)
 {
   insert(1, "/A", [] (Data& data) {
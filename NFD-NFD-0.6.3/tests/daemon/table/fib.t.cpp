@@ -230,6 +230,32 @@ validateNoExactMatch(Fib& fib, const Name& target)
                       "Found unexpected entry for " << target);
 }
 
+BOOST_AUTO_TEST_CASE(DelegationMatch)
+{
+  NameTree nameTree;
+  Fib fib(nameTree);
+  auto face1 = make_shared<DummyFace>();
+
+  BOOST_CHECK_EQUAL(fib.findDelegationMatch("/A/B/C").getPrefix(), "/");
+
+  fib::Entry* entryA = fib.insert("/A").first;
+  BOOST_CHECK_EQUAL(fib.findDelegationMatch("/A/B/C").getPrefix(), "/A");
+  BOOST_CHECK_EQUAL(fib.findDelegationMatch("/A/B/C").getPrefix(), "/A");
+
+  // nexthop changes are visible through the remembered entry
+  fib.addNextHop(*entryA, *face1, 0);
+  BOOST_CHECK(fib.findDelegationMatch("/A/B/C").hasNextHops());
+
+  fib.insert("/A/B");
+  BOOST_CHECK_EQUAL(fib.findDelegationMatch("/A/B/C").getPrefix(), "/A/B");
+
+  fib.erase("/A/B");
+  BOOST_CHECK_EQUAL(fib.findDelegationMatch("/A/B/C").getPrefix(), "/A");
+
+  fib.removeNextHop(*entryA, *face1);
+  BOOST_CHECK_EQUAL(fib.findDelegationMatch("/A/B/C").getPrefix(), "/");
+}
+
 BOOST_AUTO_TEST_CASE(ExactMatch)
 {
   NameTree nameTree;
@@ -301,6 +327,41 @@ BOOST_AUTO_TEST_CASE(Erase)
   validateNoExactMatch(fib, "/");
 }
 
+BOOST_AUTO_TEST_CASE(Epoch)
+{
+  NameTree nameTree;
+  Fib fib(nameTree);
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+
+  uint64_t epoch = fib.getEpoch();
+  fib::Entry* entry = fib.insert("/A").first;
+  BOOST_CHECK_NE(fib.getEpoch(), epoch);
+
+  epoch = fib.getEpoch();
+  fib.insert("/A");
+  BOOST_CHECK_EQUAL(fib.getEpoch(), epoch);
+
+  fib.addNextHop(*entry, *face1, 10);
+  BOOST_CHECK_NE(fib.getEpoch(), epoch);
+
+  epoch = fib.getEpoch();
+  fib.addNextHop(*entry, *face2, 20);
+  BOOST_CHECK_NE(fib.getEpoch(), epoch);
+
+  epoch = fib.getEpoch();
+  fib.removeNextHop(*entry, *face1);
+  BOOST_CHECK_NE(fib.getEpoch(), epoch);
+
+  epoch = fib.getEpoch();
+  fib.removeNextHop(*entry, *face1);
+  BOOST_CHECK_EQUAL(fib.getEpoch(), epoch);
+
+  epoch = fib.getEpoch();
+  fib.erase("/A");
+  BOOST_CHECK_NE(fib.getEpoch(), epoch);
+}
+
 BOOST_AUTO_TEST_CASE(EraseGap)
 {
   NameTree nameTree;
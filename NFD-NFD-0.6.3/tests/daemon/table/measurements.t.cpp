@@ -244,6 +244,65 @@ BOOST_AUTO_TEST_CASE(Lifetime)
   BOOST_CHECK_EQUAL(measurements.size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(LazyExpiry)
+{
+  measurements.get("/A").insertStrategyInfo<DummyStrategyInfo1>();
+  this->advanceClocks(Measurements::SWEEP_INTERVAL / 2);
+  measurements.extendLifetime(measurements.get("/A"), Measurements::getInitialLifetime());
+  // expiry of /A lies between two sweeps
+
+  this->advanceClocks(time::milliseconds(100), Measurements::getInitialLifetime());
+  // /A is expired but not yet reclaimed
+  BOOST_CHECK(measurements.findExactMatch("/A") == nullptr);
+  BOOST_CHECK(measurements.findLongestPrefixMatch("/A/B") == nullptr);
+  BOOST_CHECK_EQUAL(measurements.size(), 1);
+
+  // get() revives the entry without its StrategyInfo
+  Entry& entryA = measurements.get("/A");
+  BOOST_CHECK(entryA.getStrategyInfo<DummyStrategyInfo1>() == nullptr);
+  BOOST_CHECK_EQUAL(measurements.findExactMatch("/A"), &entryA);
+  BOOST_CHECK_EQUAL(measurements.size(), 1);
+
+  this->advanceClocks(time::milliseconds(100), Measurements::getInitialLifetime() +
+                                               Measurements::SWEEP_INTERVAL);
+  BOOST_CHECK_EQUAL(measurements.size(), 0);
+  BOOST_CHECK_EQUAL(nameTree.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(SweepLimit)
+{
+  const size_t nEntries = Measurements::SWEEP_LIMIT * 2 + 1;
+  for (size_t i = 0; i < nEntries; ++i) {
+    measurements.get(Name("/A").appendNumber(i));
+  }
+  BOOST_CHECK_EQUAL(measurements.size(), nEntries);
+
+  // entries expire together; each sweep reclaims at most SWEEP_LIMIT of them,
+  // and the following sweeps run immediately while they keep finding expired entries
+  this->advanceClocks(time::milliseconds(100), Measurements::getInitialLifetime());
+  BOOST_CHECK_EQUAL(measurements.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(SweepBacklog)
+{
+  // more than SWEEP_LIMIT entries are created in every SWEEP_INTERVAL
+  const size_t nEntriesPerInterval = Measurements::SWEEP_LIMIT * 2 + 1;
+  const size_t nIntervals = 10;
+  size_t nCreated = 0;
+  for (size_t interval = 0; interval < nIntervals; ++interval) {
+    for (size_t i = 0; i < nEntriesPerInterval; ++i) {
+      measurements.get(Name("/A").appendNumber(nCreated++));
+    }
+    this->advanceClocks(time::milliseconds(100), Measurements::SWEEP_INTERVAL);
+    // only entries created within the initial lifetime are still present
+    BOOST_CHECK_LE(measurements.size(), nEntriesPerInterval *
+                   (Measurements::getInitialLifetime() / Measurements::SWEEP_INTERVAL + 1));
+  }
+
+  this->advanceClocks(time::milliseconds(100), Measurements::getInitialLifetime());
+  BOOST_CHECK_EQUAL(measurements.size(), 0);
+}
+
 BOOST_AUTO_TEST_CASE(EraseNameTreeEntry)
 {
   size_t nNameTreeEntriesBefore = nameTree.size();
@@ -53,6 +53,19 @@ BOOST_AUTO_TEST_CASE(InProducerRegion)
   nrt4.insert("/ucla/cs/software");
   nrt4.insert("/ucla/cs/irl");
   BOOST_CHECK_EQUAL(nrt4.isInProducerRegion(fh), true);
+
+  NetworkRegionTable nrt5;
+  nrt5.insert("/telia");
+  nrt5.insert("/ucla/c");
+  nrt5.insert("/ucla/csd");
+  nrt5.insert("/zayo/cs");
+  BOOST_CHECK_EQUAL(nrt5.isInProducerRegion(fh), false);
+  nrt5.insert("/ucla/cs/irl");
+  BOOST_CHECK_EQUAL(nrt5.isInProducerRegion(fh), true);
+
+  NetworkRegionTable nrt6;
+  nrt6.insert("/ucla/cs");
+  BOOST_CHECK_EQUAL(nrt6.isInProducerRegion(DelegationList{}), false);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -195,6 +195,73 @@ BOOST_AUTO_TEST_CASE(Erase)
   BOOST_CHECK(pit.find(*interest) != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(AdmissionControl)
+{
+  NameTree nameTree(16);
+  Pit pit(nameTree);
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  auto face3 = make_shared<DummyFace>();
+
+  shared_ptr<Interest> interestA = makeInterest("/A");
+  shared_ptr<Interest> interestB = makeInterest("/B");
+  shared_ptr<Interest> interestC = makeInterest("/C");
+
+  shared_ptr<Entry> entryA = pit.insert(*interestA).first;
+  entryA->insertOrUpdateInRecord(*face1, *interestA);
+  entryA->insertOrUpdateInRecord(*face1, *interestA);
+  entryA->insertOrUpdateInRecord(*face2, *interestA);
+  shared_ptr<Entry> entryB = pit.insert(*interestB).first;
+  entryB->insertOrUpdateInRecord(*face1, *interestB);
+  BOOST_CHECK_EQUAL(pit.getNInRecords(*face1), 2);
+  BOOST_CHECK_EQUAL(pit.getNInRecords(*face2), 1);
+  BOOST_CHECK_EQUAL(pit.getNInRecords(*face3), 0);
+  BOOST_CHECK_GT(pit.getNBytes(), 3 * sizeof(InRecord));
+
+  // unlimited
+  BOOST_CHECK_EQUAL(pit.isOverBudget(), false);
+  BOOST_CHECK_EQUAL(pit.canAdmitInRecord(*face1), true);
+
+  pit.setFaceQuota(2);
+  BOOST_CHECK_EQUAL(pit.canAdmitInRecord(*face1), false);
+  BOOST_CHECK_EQUAL(pit.canAdmitInRecord(*face2), true);
+  pit.setFaceQuota(0);
+
+  // over budget: only faces below the average of 1.5 in-records are admitted
+  pit.setBudget(2, 0);
+  BOOST_CHECK_EQUAL(pit.isOverBudget(), true);
+  BOOST_CHECK_EQUAL(pit.canAdmitInRecord(*face1), false);
+  BOOST_CHECK_EQUAL(pit.canAdmitInRecord(*face2), true);
+  BOOST_CHECK_EQUAL(pit.canAdmitInRecord(*face3), true);
+
+  // over the hard limit: no face is admitted
+  BOOST_CHECK_EQUAL(pit.isOverHardLimit(), false);
+  pit.setBudget(1, 0);
+  BOOST_CHECK_EQUAL(pit.isOverHardLimit(), true);
+  BOOST_CHECK_EQUAL(pit.canAdmitInRecord(*face1), false);
+  BOOST_CHECK_EQUAL(pit.canAdmitInRecord(*face2), false);
+  BOOST_CHECK_EQUAL(pit.canAdmitInRecord(*face3), false);
+
+  size_t nBytes = pit.getNBytes();
+  pit.setBudget(0, nBytes + 1);
+  BOOST_CHECK_EQUAL(pit.isOverBudget(), false);
+  pit.setBudget(0, nBytes);
+  BOOST_CHECK_EQUAL(pit.isOverBudget(), true);
+  pit.setBudget(0, 0);
+
+  entryA->deleteInRecord(*face2);
+  BOOST_CHECK_EQUAL(pit.getNInRecords(*face2), 0);
+  entryA->clearInRecords();
+  BOOST_CHECK_EQUAL(pit.getNInRecords(*face1), 1);
+
+  // in-records of an erased entry are no longer charged
+  pit.erase(entryB.get());
+  BOOST_CHECK_EQUAL(pit.getNInRecords(*face1), 0);
+  entryB->clearInRecords();
+  pit.erase(entryA.get());
+  BOOST_CHECK_EQUAL(pit.getNBytes(), 0);
+}
+
 BOOST_AUTO_TEST_CASE(EraseNameTreeEntry)
 {
   NameTree nameTree;
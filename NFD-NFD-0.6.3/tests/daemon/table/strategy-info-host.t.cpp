@@ -77,6 +77,37 @@ public:
   int m_id;
 };
 
+class DummyStrategyInfo3 : public StrategyInfo, noncopyable
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return 3;
+  }
+
+  DummyStrategyInfo3(int id)
+    : m_id(id)
+  {
+  }
+
+public:
+  int m_id;
+};
+
+class LargeStrategyInfo : public StrategyInfo, noncopyable
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return 4;
+  }
+
+public:
+  std::array<uint64_t, 16> m_payload;
+};
+
 BOOST_AUTO_TEST_SUITE(Table)
 BOOST_FIXTURE_TEST_SUITE(TestStrategyInfoHost, BaseFixture)
 
@@ -131,6 +162,54 @@ BOOST_AUTO_TEST_CASE(Types)
   BOOST_CHECK_EQUAL(host.eraseStrategyInfo<DummyStrategyInfo>(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(Overflow)
+{
+  // DummyStrategyInfo and DummyStrategyInfo3 are assigned the same inline slot
+  BOOST_REQUIRE_EQUAL(StrategyInfoHost::getInlineSlot<DummyStrategyInfo>(),
+                      StrategyInfoHost::getInlineSlot<DummyStrategyInfo3>());
+  BOOST_CHECK_EQUAL(StrategyInfoHost::getInlineSlot<LargeStrategyInfo>(), -1);
+
+  StrategyInfoHost host;
+  g_DummyStrategyInfo_count = 0;
+
+  host.insertStrategyInfo<DummyStrategyInfo3>(1439);
+  host.insertStrategyInfo<DummyStrategyInfo>(4127);
+  host.insertStrategyInfo<LargeStrategyInfo>();
+  BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfo3>() != nullptr);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo3>()->m_id, 1439);
+  BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfo>() != nullptr);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo>()->m_id, 4127);
+  BOOST_CHECK(host.getStrategyInfo<LargeStrategyInfo>() != nullptr);
+  BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 1);
+
+  // DummyStrategyInfo in overflow map remains reachable after the inline slot is freed
+  BOOST_CHECK_EQUAL(host.eraseStrategyInfo<DummyStrategyInfo3>(), 1);
+  BOOST_CHECK(host.getStrategyInfo<DummyStrategyInfo3>() == nullptr);
+  BOOST_REQUIRE(host.getStrategyInfo<DummyStrategyInfo>() != nullptr);
+  BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo>()->m_id, 4127);
+
+  bool isNew = false;
+  std::tie(std::ignore, isNew) = host.insertStrategyInfo<DummyStrategyInfo>(2210);
+  BOOST_CHECK_EQUAL(isNew, false);
+  BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 1);
+
+  BOOST_CHECK_EQUAL(host.eraseStrategyInfo<DummyStrategyInfo>(), 1);
+  BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 0);
+  BOOST_CHECK_EQUAL(host.eraseStrategyInfo<LargeStrategyInfo>(), 1);
+  BOOST_CHECK(host.getStrategyInfo<LargeStrategyInfo>() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Destruction)
+{
+  g_DummyStrategyInfo_count = 0;
+  {
+    StrategyInfoHost host;
+    host.insertStrategyInfo<DummyStrategyInfo>(7013);
+    BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 1);
+  }
+  BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestStrategyInfoHost
 BOOST_AUTO_TEST_SUITE_END() // Table
 
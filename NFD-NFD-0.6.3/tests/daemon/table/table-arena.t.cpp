@@ -0,0 +1,229 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "table/table-arena.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace tests {
+
+using ndn::nfd::ARENA_PAGE_MODE_OFF;
+using ndn::nfd::ARENA_PAGE_MODE_NORMAL;
+using ndn::nfd::ARENA_PAGE_MODE_TRANSPARENT;
+using ndn::nfd::ARENA_PAGE_MODE_EXPLICIT;
+
+static TableArena::Options
+makeOptions(TableArena::PageMode pageMode, size_t maxSize = 0)
+{
+  TableArena::Options options;
+  options.pageMode = pageMode;
+  options.maxSize = maxSize;
+  return options;
+}
+
+BOOST_AUTO_TEST_SUITE(Table)
+BOOST_FIXTURE_TEST_SUITE(TestTableArena, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(Off)
+{
+  TableArena arena;
+  void* ptr = arena.allocate(40);
+  BOOST_CHECK(!arena.contains(ptr));
+  BOOST_CHECK_EQUAL(arena.getNChunks(), 0);
+  BOOST_CHECK_EQUAL(arena.getNAllocatedBytes(), 0);
+  BOOST_CHECK_EQUAL(arena.getNFallbackAllocations(), 0);
+  arena.deallocate(ptr, 40);
+}
+
+BOOST_AUTO_TEST_CASE(SizeClasses)
+{
+  TableArena arena;
+  arena.setOptions(makeOptions(ARENA_PAGE_MODE_NORMAL));
+
+  void* p1 = arena.allocate(1);
+  void* p16 = arena.allocate(16);
+  void* p17 = arena.allocate(17);
+  void* pMax = arena.allocate(TableArena::MAX_BLOCK_SIZE);
+  BOOST_CHECK(arena.contains(p1));
+  BOOST_CHECK(arena.contains(p16));
+  BOOST_CHECK(arena.contains(p17));
+  BOOST_CHECK(arena.contains(pMax));
+  BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(p17) % TableArena::SIZE_CLASS_GRANULARITY, 0);
+  BOOST_CHECK_EQUAL(arena.getNChunks(), 1);
+  BOOST_CHECK_EQUAL(arena.getNMappedBytes(), TableArena::CHUNK_SIZE);
+  BOOST_CHECK_EQUAL(arena.getNAllocatedBytes(), 16 + 16 + 32 + TableArena::MAX_BLOCK_SIZE);
+  BOOST_CHECK_EQUAL(arena.getNFreeBytes(), 0);
+
+  // a released block is reused by the same size class
+  arena.deallocate(p17, 17);
+  BOOST_CHECK_EQUAL(arena.getNAllocatedBytes(), 16 + 16 + TableArena::MAX_BLOCK_SIZE);
+  BOOST_CHECK_EQUAL(arena.getNFreeBytes(), 32);
+  BOOST_CHECK_EQUAL(arena.allocate(30), p17);
+  BOOST_CHECK_EQUAL(arena.getNFreeBytes(), 0);
+
+  arena.deallocate(p1, 1);
+  arena.deallocate(p16, 16);
+  arena.deallocate(p17, 30);
+  arena.deallocate(pMax, TableArena::MAX_BLOCK_SIZE);
+  BOOST_CHECK_EQUAL(arena.getNAllocatedBytes(), 0);
+  BOOST_CHECK_EQUAL(arena.getNFreeBytes(), 16 + 16 + 32 + TableArena::MAX_BLOCK_SIZE);
+  BOOST_CHECK_EQUAL(arena.getNFallbackAllocations(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(LargeBlock)
+{
+  TableArena arena;
+  arena.setOptions(makeOptions(ARENA_PAGE_MODE_NORMAL));
+
+  void* ptr = arena.allocate(TableArena::MAX_BLOCK_SIZE + 1);
+  BOOST_CHECK(!arena.contains(ptr));
+  BOOST_CHECK_EQUAL(arena.getNFallbackAllocations(), 1);
+  BOOST_CHECK_EQUAL(arena.getNAllocatedBytes(), 0);
+  arena.deallocate(ptr, TableArena::MAX_BLOCK_SIZE + 1);
+}
+
+BOOST_AUTO_TEST_CASE(MaxSize)
+{
+  TableArena arena;
+  arena.setOptions(makeOptions(ARENA_PAGE_MODE_NORMAL, TableArena::CHUNK_SIZE));
+
+  const size_t nBlocksPerChunk = TableArena::CHUNK_SIZE / TableArena::MAX_BLOCK_SIZE;
+  std::vector<void*> blocks;
+  for (size_t i = 0; i < nBlocksPerChunk; ++i) {
+    blocks.push_back(arena.allocate(TableArena::MAX_BLOCK_SIZE));
+  }
+  BOOST_CHECK_EQUAL(arena.getNChunks(), 1);
+  BOOST_CHECK_EQUAL(arena.getNAllocatedBytes(), TableArena::CHUNK_SIZE);
+  BOOST_CHECK_EQUAL(arena.getNFallbackAllocations(), 0);
+
+  // the arena is full, so the next allocation comes from the heap
+  void* overflow = arena.allocate(TableArena::MAX_BLOCK_SIZE);
+  BOOST_CHECK(!arena.contains(overflow));
+  BOOST_CHECK_EQUAL(arena.getNChunks(), 1);
+  BOOST_CHECK_EQUAL(arena.getNFallbackAllocations(), 1);
+  arena.deallocate(overflow, TableArena::MAX_BLOCK_SIZE);
+
+  // once a block is released, the arena can serve the size class again
+  arena.deallocate(blocks.back(), TableArena::MAX_BLOCK_SIZE);
+  BOOST_CHECK_EQUAL(arena.allocate(TableArena::MAX_BLOCK_SIZE), blocks.back());
+
+  for (void* block : blocks) {
+    arena.deallocate(block, TableArena::MAX_BLOCK_SIZE);
+  }
+  BOOST_CHECK_EQUAL(arena.getNAllocatedBytes(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ChunkTail)
+{
+  TableArena arena;
+  arena.setOptions(makeOptions(ARENA_PAGE_MODE_NORMAL));
+
+  // leave a 16-octet tail in the first chunk
+  const size_t nBlocks = TableArena::CHUNK_SIZE / TableArena::MAX_BLOCK_SIZE - 1;
+  std::vector<void*> blocks;
+  for (size_t i = 0; i < nBlocks; ++i) {
+    blocks.push_back(arena.allocate(TableArena::MAX_BLOCK_SIZE));
+  }
+  blocks.push_back(arena.allocate(TableArena::MAX_BLOCK_SIZE - 16));
+  BOOST_CHECK_EQUAL(arena.getNChunks(), 1);
+
+  // a block that doesn't fit in the tail maps a new chunk, and the tail is kept for reuse
+  void* next = arena.allocate(32);
+  BOOST_CHECK_EQUAL(arena.getNChunks(), 2);
+  BOOST_CHECK_EQUAL(arena.getNFreeBytes(), 16);
+  void* tail = arena.allocate(16);
+  BOOST_CHECK_EQUAL(static_cast<uint8_t*>(tail),
+                    static_cast<uint8_t*>(blocks.back()) + TableArena::MAX_BLOCK_SIZE - 16);
+  BOOST_CHECK_EQUAL(arena.getNFreeBytes(), 0);
+
+  arena.deallocate(next, 32);
+  arena.deallocate(tail, 16);
+  arena.deallocate(blocks.back(), TableArena::MAX_BLOCK_SIZE - 16);
+  blocks.pop_back();
+  for (void* block : blocks) {
+    arena.deallocate(block, TableArena::MAX_BLOCK_SIZE);
+  }
+  BOOST_CHECK_EQUAL(arena.getNAllocatedBytes(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(SwitchOff)
+{
+  TableArena arena;
+  arena.setOptions(makeOptions(ARENA_PAGE_MODE_NORMAL));
+  void* inArena = arena.allocate(64);
+  BOOST_CHECK(arena.contains(inArena));
+
+  arena.setOptions(makeOptions(ARENA_PAGE_MODE_OFF));
+  void* onHeap = arena.allocate(64);
+  BOOST_CHECK(!arena.contains(onHeap));
+
+  // blocks are released to where they came from
+  arena.deallocate(inArena, 64);
+  arena.deallocate(onHeap, 64);
+  BOOST_CHECK_EQUAL(arena.getNAllocatedBytes(), 0);
+  BOOST_CHECK_EQUAL(arena.getNFreeBytes(), 64);
+}
+
+BOOST_AUTO_TEST_CASE(HugePages)
+{
+  // huge pages may be unavailable; the arena falls back to regular pages in that case
+  for (auto pageMode : {ARENA_PAGE_MODE_TRANSPARENT, ARENA_PAGE_MODE_EXPLICIT}) {
+    TableArena arena;
+    arena.setOptions(makeOptions(pageMode));
+    auto ptr = static_cast<uint8_t*>(arena.allocate(512));
+    BOOST_CHECK(arena.contains(ptr));
+    std::fill_n(ptr, 512, 0xBB);
+    BOOST_CHECK_EQUAL(arena.getNChunks(), 1);
+    BOOST_CHECK_LE(arena.getNHugePageChunks(), 1);
+    arena.deallocate(ptr, 512);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Allocator)
+{
+  getTableArena().setOptions(makeOptions(ARENA_PAGE_MODE_NORMAL));
+  size_t nAllocatedBytes = getTableArena().getNAllocatedBytes();
+  {
+    std::set<int, std::less<int>, TableArenaAllocator<int>> s;
+    for (int i = 0; i < 100; ++i) {
+      s.insert(i);
+    }
+    BOOST_CHECK(getTableArena().contains(&*s.begin()));
+    BOOST_CHECK_GT(getTableArena().getNAllocatedBytes(), nAllocatedBytes);
+
+    auto sp = std::allocate_shared<Name>(TableArenaAllocator<Name>(), "/A");
+    BOOST_CHECK(getTableArena().contains(sp.get()));
+  }
+  BOOST_CHECK_EQUAL(getTableArena().getNAllocatedBytes(), nAllocatedBytes);
+  getTableArena().setOptions({});
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestTableArena
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace tests
+} // namespace nfd
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2017,  Regents of the University of California,
+ * Copyright (c) 2014-2018,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -28,7 +28,11 @@
 
 #include <ndn-cxx/security/signature-sha256-with-rsa.hpp>
 
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <random>
 
 #ifdef HAVE_VALGRIND
 #include <valgrind/callgrind.h>
@@ -136,6 +140,8 @@ protected:
   static constexpr size_t CS_CAPACITY = 50000;
 };
 
+constexpr size_t CsBenchmarkFixture::CS_CAPACITY;
+
 // find miss, then insert
 BOOST_FIXTURE_TEST_CASE(FindMissInsert, CsBenchmarkFixture)
 {
@@ -244,5 +250,134 @@ BOOST_FIXTURE_TEST_CASE(Rightmost, CsBenchmarkFixture)
   std::cout << "find(rightmost) " << (N_INTERESTS * N_CHILDREN * REPEAT) << ": " << d << std::endl;
 }
 
+// insert, find hit, then evict with each replacement policy at 1M entries
+BOOST_FIXTURE_TEST_CASE(PolicyLarge, CsBenchmarkFixture)
+{
+  constexpr size_t N_ENTRIES = 1000000;
+  constexpr size_t N_EVICT = N_ENTRIES / 4;
+
+  std::vector<shared_ptr<Interest>> interestWorkload = makeInterestWorkload(N_ENTRIES);
+  std::vector<shared_ptr<Data>> dataWorkload = makeDataWorkload(N_ENTRIES + N_EVICT);
+
+  for (const char* policyName : {"lru", "slru", "priority_fifo"}) {
+    Cs largeCs;
+    largeCs.setPolicy(cs::Policy::create(policyName));
+    largeCs.setLimit(N_ENTRIES);
+
+    time::microseconds dInsert = timedRun([&] {
+      for (size_t i = 0; i < N_ENTRIES; ++i) {
+        largeCs.insert(*dataWorkload[i], false);
+      }
+    });
+    BOOST_REQUIRE(largeCs.size() == N_ENTRIES);
+
+    time::microseconds dHit = timedRun([&] {
+      for (size_t i = 0; i < N_ENTRIES; ++i) {
+        largeCs.find(*interestWorkload[(i * 7919) % N_ENTRIES], bind([]{}), bind([]{}));
+      }
+    });
+
+    time::microseconds dEvict = timedRun([&] {
+      for (size_t i = N_ENTRIES; i < N_ENTRIES + N_EVICT; ++i) {
+        largeCs.insert(*dataWorkload[i], false);
+      }
+    });
+    BOOST_REQUIRE(largeCs.size() == N_ENTRIES);
+
+    std::cout << policyName << " insert " << N_ENTRIES << ": " << dInsert << "\n"
+              << policyName << " find(hit) " << N_ENTRIES << ": " << dHit << "\n"
+              << policyName << " insert-evict " << N_EVICT << ": " << dEvict << std::endl;
+  }
+}
+
+/** \brief loads a request trace
+ *
+ *  If NFD_CS_BENCHMARK_TRACE environment variable is set, the trace is read from that file,
+ *  which contains one Name URI per line. Otherwise, a synthetic trace is generated, in which
+ *  Zipf-distributed requests for popular objects are interleaved with a bulk transfer that
+ *  never requests the same object twice.
+ */
+static std::vector<Name>
+loadTrace(size_t nCatalog, size_t nRequests)
+{
+  std::vector<Name> trace;
+
+  const char* traceFile = std::getenv("NFD_CS_BENCHMARK_TRACE");
+  if (traceFile != nullptr) {
+    std::ifstream is(traceFile);
+    BOOST_REQUIRE_MESSAGE(is, "cannot open " << traceFile);
+    std::string line;
+    while (std::getline(is, line)) {
+      if (!line.empty()) {
+        trace.emplace_back(line);
+      }
+    }
+    return trace;
+  }
+
+  std::vector<double> cdf(nCatalog);
+  double sum = 0.0;
+  for (size_t i = 0; i < nCatalog; ++i) {
+    sum += 1.0 / std::pow(i + 1, 0.8);
+    cdf[i] = sum;
+  }
+
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<double> uniform(0.0, sum);
+  std::bernoulli_distribution isBulk(0.5);
+  uint64_t bulkSeq = 0;
+  trace.reserve(nRequests);
+  for (size_t i = 0; i < nRequests; ++i) {
+    if (isBulk(rng)) {
+      trace.push_back(Name("/bulk").appendSegment(bulkSeq++));
+    }
+    else {
+      size_t rank = std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin();
+      trace.push_back(Name("/popular").appendNumber(rank));
+    }
+  }
+  return trace;
+}
+
+// replay a request trace with each replacement policy, with and without admission filter
+BOOST_FIXTURE_TEST_CASE(TraceHitRatio, CsBenchmarkFixture)
+{
+  constexpr size_t N_CATALOG = CS_CAPACITY * 4;
+  constexpr size_t N_REQUESTS = CS_CAPACITY * 10;
+
+  std::vector<Name> trace = loadTrace(N_CATALOG, N_REQUESTS);
+  BOOST_REQUIRE(!trace.empty());
+
+  for (const char* policyName : {"lru", "slru", "priority_fifo"}) {
+    for (bool wantAdmission : {false, true}) {
+      Cs traceCs;
+      traceCs.setPolicy(cs::Policy::create(policyName));
+      traceCs.setLimit(CS_CAPACITY);
+      if (wantAdmission) {
+        traceCs.setAdmissionFilter(make_unique<cs::TinyLfu>(CS_CAPACITY));
+      }
+
+      size_t nHits = 0;
+      time::microseconds d = timedRun([&] {
+        for (const Name& name : trace) {
+          Interest interest(name);
+          bool isHit = false;
+          traceCs.find(interest, bind([&] { isHit = true; }), bind([]{}));
+          if (isHit) {
+            ++nHits;
+          }
+          else {
+            traceCs.insert(*makeData(name), false);
+          }
+        }
+      });
+
+      std::cout << policyName << (wantAdmission ? "+tinylfu" : "") << " trace " << trace.size()
+                << ": " << d << ", hit ratio " << static_cast<double>(nHits) / trace.size()
+                << std::endl;
+    }
+  }
+}
+
 } // namespace tests
 } // namespace nfd
@@ -29,6 +29,12 @@
 #include "face/tcp-channel.hpp"
 #include "face/udp-channel.hpp"
 
+#ifdef HAVE_IO_URING
+#include "face/io-uring-service.hpp"
+#endif
+
+#include <cstring>
+#include <ctime>
 #include <fstream>
 #include <iostream>
 
@@ -49,7 +55,7 @@ public:
   {
     m_terminationSignalSet.add(SIGINT);
     m_terminationSignalSet.add(SIGTERM);
-    m_terminationSignalSet.async_wait(bind(&FaceBenchmark::terminate, _1, _2));
+    m_terminationSignalSet.async_wait(bind(&FaceBenchmark::terminate, this, _1, _2));
 
     parseConfig(configFileName);
 
@@ -63,14 +69,45 @@ public:
   }
 
 private:
-  static void
+  void
   terminate(const boost::system::error_code& error, int signalNo)
   {
     if (error)
       return;
+
+    printStatistics();
     getGlobalIoService().stop();
   }
 
+  void
+  printStatistics() const
+  {
+    if (m_nRelayed == 0) {
+      std::clog << "No packets relayed" << std::endl;
+      return;
+    }
+
+    auto elapsed = time::duration_cast<time::microseconds>(time::steady_clock::now() - m_firstRelay);
+    std::clog << "Relayed " << m_nRelayed << " packets in " << elapsed << " ("
+              << static_cast<uint64_t>(m_nRelayed * 1e6 / std::max<int64_t>(1, elapsed.count()))
+              << " packets/s)" << std::endl;
+
+    // user and system CPU time of the process, including the time spent in socket syscalls
+    double cpuNs = static_cast<double>(std::clock() - m_firstRelayCpu) * 1e9 / CLOCKS_PER_SEC;
+    std::clog << "CPU time per packet: " << static_cast<uint64_t>(cpuNs / m_nRelayed) << " ns"
+              << std::endl;
+
+#ifdef HAVE_IO_URING
+    if (face::IoUringService::isEnabled()) {
+      const auto& service = boost::asio::use_service<face::IoUringService>(getGlobalIoService());
+      if (service.getNSubmitCalls() > 0) {
+        std::clog << "io_uring: " << service.getNSubmitted() << " operations in "
+                  << service.getNSubmitCalls() << " submissions" << std::endl;
+      }
+    }
+#endif
+  }
+
   void
   parseConfig(const char* configFileName)
   {
@@ -148,12 +185,30 @@ private:
     tieFaces(faceL, faceR);
   }
 
-  static void
+  void
   tieFaces(const shared_ptr<Face>& face1, const shared_ptr<Face>& face2)
   {
-    face1->afterReceiveInterest.connect([face2] (const Interest& interest) { face2->sendInterest(interest); });
-    face1->afterReceiveData.connect([face2] (const Data& data) { face2->sendData(data); });
-    face1->afterReceiveNack.connect([face2] (const ndn::lp::Nack& nack) { face2->sendNack(nack); });
+    face1->afterReceiveInterest.connect([=] (const Interest& interest) {
+      countRelay();
+      face2->sendInterest(interest);
+    });
+    face1->afterReceiveData.connect([=] (const Data& data) {
+      countRelay();
+      face2->sendData(data);
+    });
+    face1->afterReceiveNack.connect([=] (const ndn::lp::Nack& nack) {
+      countRelay();
+      face2->sendNack(nack);
+    });
+  }
+
+  void
+  countRelay()
+  {
+    if (m_nRelayed++ == 0) {
+      m_firstRelay = time::steady_clock::now();
+      m_firstRelayCpu = std::clock();
+    }
   }
 
   static void
@@ -167,6 +222,9 @@ private:
   face::TcpChannel m_tcpChannel;
   face::UdpChannel m_udpChannel;
   std::vector<std::pair<FaceUri, FaceUri>> m_faceUris;
+  uint64_t m_nRelayed = 0;
+  time::steady_clock::TimePoint m_firstRelay;
+  std::clock_t m_firstRelayCpu = 0;
 };
 
 } // namespace tests
@@ -179,13 +237,31 @@ main(int argc, char** argv)
   std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
 #endif
 
-  if (argc != 2) {
-    std::cerr << "Usage: " << argv[0] << " <config-file>" << std::endl;
+  // the I/O backend can be selected to compare Boost.Asio with io_uring on the same setup
+  std::string backend = "asio";
+  if (argc == 4 && std::strcmp(argv[1], "-b") == 0) {
+    backend = argv[2];
+  }
+  else if (argc != 2) {
+    std::cerr << "Usage: " << argv[0] << " [-b asio|io_uring] <config-file>" << std::endl;
+    return 2;
+  }
+
+  if (backend == "io_uring") {
+#ifdef HAVE_IO_URING
+    nfd::face::IoUringService::setEnabled(true);
+#else
+    std::cerr << "io_uring is not supported on this platform" << std::endl;
+    return 2;
+#endif
+  }
+  else if (backend != "asio") {
+    std::cerr << "Unknown I/O backend '" << backend << "'" << std::endl;
     return 2;
   }
 
   try {
-    nfd::tests::FaceBenchmark bench{argv[1]};
+    nfd::tests::FaceBenchmark bench{argv[argc - 1]};
 #ifdef HAVE_VALGRIND
     CALLGRIND_START_INSTRUMENTATION;
 #endif
@@ -0,0 +1,164 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** \file
+ *  \brief reports the FIB size reduction of FIB compression on route dumps
+ *
+ *  fib-compression-report reads the output of `nfdc fib list` captured on a router, and installs
+ *  every nexthop into a FibCompressor, as the RIB would do when FIB compression is enabled.
+ *  It verifies that longest prefix match on the compressed FIB finds the same nexthops as on the
+ *  uncompressed FIB for every prefix in the dump, and reports the number of FIB entries before
+ *  and after compression.
+ */
+
+#include "core/extended-error-message.hpp"
+#include "rib/fib-compressor.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <regex>
+
+namespace nfd {
+namespace tests {
+
+using rib::FibCompressor;
+using rib::FibUpdate;
+
+class FibCompressionReport
+{
+public:
+  /** \brief reads a FIB dump
+   *  \return number of nexthops read
+   */
+  size_t
+  load(std::istream& is)
+  {
+    static const std::regex entryRegex(R"(^\s*(\S+) nexthops=\{(.*)\}\s*$)");
+    static const std::regex nexthopRegex(R"(faceid=(\d+) \(cost=(\d+)\))");
+
+    FibCompressor::FibUpdateList updates;
+    std::string line;
+    while (std::getline(is, line)) {
+      std::smatch entryMatch;
+      if (!std::regex_match(line, entryMatch, entryRegex)) {
+        continue; // section headers and blank lines
+      }
+
+      Name prefix(entryMatch[1].str());
+      m_prefixes.push_back(prefix);
+
+      const std::string nexthops = entryMatch[2].str();
+      for (std::sregex_iterator it(nexthops.begin(), nexthops.end(), nexthopRegex), end;
+           it != end; ++it) {
+        updates.push_back(FibUpdate::createAddUpdate(prefix, std::stoull((*it)[1].str()),
+                                                     std::stoull((*it)[2].str())));
+      }
+    }
+
+    m_nUpdates += m_compressor.compress(updates).size();
+    return updates.size();
+  }
+
+  /** \return number of names whose longest prefix match differs after compression
+   */
+  size_t
+  verify() const
+  {
+    size_t nMismatches = 0;
+    for (const Name& prefix : m_prefixes) {
+      // a name under the prefix that is not itself a FIB entry
+      Name name = Name(prefix).append("fib-compression-report");
+      if (m_compressor.findInstalledLongestPrefixMatch(name) !=
+          m_compressor.findLongestPrefixMatch(name)) {
+        std::cerr << "MISMATCH: " << name << std::endl;
+        ++nMismatches;
+      }
+    }
+    return nMismatches;
+  }
+
+  void
+  printReport(std::ostream& os) const
+  {
+    size_t nEntries = m_compressor.size();
+    size_t nInstalled = m_compressor.getNInstalled();
+    os << "FIB entries: " << nEntries << "\n"
+       << "Compressed FIB entries: " << nInstalled << "\n"
+       << "NextHop updates sent to NFD: " << m_nUpdates << "\n";
+    if (nEntries > 0) {
+      os << "Reduction: " << std::fixed << std::setprecision(1)
+         << (100.0 * (nEntries - nInstalled) / nEntries) << "%\n";
+    }
+  }
+
+private:
+  FibCompressor m_compressor;
+  std::vector<Name> m_prefixes;
+  size_t m_nUpdates = 0;
+};
+
+} // namespace tests
+} // namespace nfd
+
+int
+main(int argc, char** argv)
+{
+  if (argc != 2) {
+    std::cerr << "Usage: " << argv[0] << " <fib-dump>\n"
+              << "  fib-dump is the output of `nfdc fib list`, or - to read from stdin\n";
+    return 2;
+  }
+
+  try {
+    nfd::tests::FibCompressionReport report;
+    std::string filename(argv[1]);
+    size_t nNextHops = 0;
+    if (filename == "-") {
+      nNextHops = report.load(std::cin);
+    }
+    else {
+      std::ifstream is(filename);
+      if (!is) {
+        std::cerr << "ERROR: cannot open " << filename << std::endl;
+        return 1;
+      }
+      nNextHops = report.load(is);
+    }
+    std::cout << "NextHops: " << nNextHops << "\n";
+
+    if (report.verify() > 0) {
+      std::cerr << "ERROR: compressed FIB does not forward like the uncompressed FIB" << std::endl;
+      return 1;
+    }
+    report.printReport(std::cout);
+  }
+  catch (const std::exception& e) {
+    std::cerr << "FATAL: " << nfd::getExtendedErrorMessage(e) << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,183 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "core/global-io.hpp"
+#include "face/face.hpp"
+#include "face/generic-link-service.hpp"
+#include "fw/forwarder.hpp"
+
+#include <ndn-cxx/security/signature-sha256-with-rsa.hpp>
+
+#include <iostream>
+
+#ifdef HAVE_VALGRIND
+#include <valgrind/callgrind.h>
+#endif
+
+namespace nfd {
+namespace tests {
+
+using face::Face;
+
+/** \brief a Transport that discards every packet sent on it
+ */
+class NullTransport : public face::Transport
+{
+public:
+  NullTransport()
+  {
+    this->setLocalUri(FaceUri("dummy://"));
+    this->setRemoteUri(FaceUri("dummy://"));
+    this->setScope(ndn::nfd::FACE_SCOPE_NON_LOCAL);
+    this->setPersistency(ndn::nfd::FACE_PERSISTENCY_PERSISTENT);
+    this->setLinkType(ndn::nfd::LINK_TYPE_POINT_TO_POINT);
+    this->setMtu(face::MTU_UNLIMITED);
+  }
+
+private:
+  void
+  doClose() override
+  {
+    this->setState(face::TransportState::CLOSED);
+  }
+
+  void
+  doSend(Packet&&) override
+  {
+  }
+};
+
+/** \brief measures the forwarding pipelines from the entry point of received packets
+ *
+ *  Encoded packets are passed to LinkService::receivePacket, as a Transport would, so that
+ *  decoding, the delivery to the Forwarder, the pipelines, and the encoding of outgoing packets
+ *  are all measured, while no I/O takes place.
+ */
+class ForwarderBenchmarkFixture
+{
+protected:
+  ForwarderBenchmarkFixture()
+  {
+#ifdef _DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+
+    consumer = makeFace();
+    producer = makeFace();
+    forwarder.addFace(consumer);
+    forwarder.addFace(producer);
+    Fib& fib = forwarder.getFib();
+    fib.addNextHop(*fib.insert("/bench").first, *producer, 0);
+
+    ndn::SignatureSha256WithRsa fakeSignature;
+    fakeSignature.setValue(ndn::encoding::makeEmptyBlock(tlv::SignatureValue));
+
+    for (size_t i = 0; i < N_EXCHANGES; ++i) {
+      Name name("/bench");
+      name.appendSequenceNumber(i);
+
+      Interest interest(name);
+      interest.setCanBePrefix(false);
+      interestWires.push_back(interest.wireEncode());
+
+      Data data(name);
+      data.setFreshnessPeriod(time::seconds(1));
+      data.setSignature(fakeSignature);
+      dataWires.push_back(data.wireEncode());
+    }
+  }
+
+  static shared_ptr<Face>
+  makeFace()
+  {
+    return make_shared<Face>(make_unique<face::GenericLinkService>(), make_unique<NullTransport>());
+  }
+
+  static void
+  receive(Face& face, const Block& wire)
+  {
+    face.getLinkService()->receivePacket(face::Transport::Packet(Block(wire)));
+  }
+
+protected:
+  static const size_t N_EXCHANGES = 200000;
+  /// number of Interests outstanding before their Data is received
+  static const size_t WINDOW = 1000;
+
+  Forwarder forwarder;
+  shared_ptr<Face> consumer;
+  shared_ptr<Face> producer;
+  std::vector<Block> interestWires;
+  std::vector<Block> dataWires;
+};
+
+const size_t ForwarderBenchmarkFixture::N_EXCHANGES;
+const size_t ForwarderBenchmarkFixture::WINDOW;
+
+BOOST_FIXTURE_TEST_SUITE(ForwarderBenchmark, ForwarderBenchmarkFixture)
+
+// Each Interest is received from the consumer and forwarded to the producer, and its Data is
+// received from the producer WINDOW Interests later and returned to the consumer.
+BOOST_AUTO_TEST_CASE(InterestDataExchange)
+{
+#ifdef HAVE_VALGRIND
+  CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+  auto t1 = time::steady_clock::now();
+
+  for (size_t i = 0; i < N_EXCHANGES + WINDOW; ++i) {
+    if (i < N_EXCHANGES) {
+      receive(*consumer, interestWires[i]);
+    }
+    if (i >= WINDOW) {
+      receive(*producer, dataWires[i - WINDOW]);
+    }
+    if (i % WINDOW == 0) {
+      // run the timers of the PIT entries, as the io_service would between packets
+      getGlobalIoService().poll();
+    }
+  }
+
+  auto t2 = time::steady_clock::now();
+
+#ifdef HAVE_VALGRIND
+  CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nInInterests, N_EXCHANGES);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().nOutData, N_EXCHANGES);
+
+  auto elapsed = time::duration_cast<time::nanoseconds>(t2 - t1);
+  std::cout << "Interest-Data exchanges (" << N_EXCHANGES << "): "
+            << time::duration_cast<time::microseconds>(elapsed) << ", "
+            << elapsed / N_EXCHANGES << " per exchange" << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "bottleneck-strategy.hpp"
+
+namespace nfd {
+namespace fw {
+
+NFD_REGISTER_STRATEGY(BottleneckStrategy);
+
+static uint64_t
+parsePositiveInteger(const name::Component& component, const std::string& what)
+{
+  try {
+    auto s = component.toUri();
+    if (s.empty() || s[0] == '-')
+      BOOST_THROW_EXCEPTION(boost::bad_lexical_cast());
+    auto value = boost::lexical_cast<uint64_t>(s);
+    if (value == 0)
+      BOOST_THROW_EXCEPTION(boost::bad_lexical_cast());
+    return value;
+  }
+  catch (const boost::bad_lexical_cast&) {
+    BOOST_THROW_EXCEPTION(std::invalid_argument(what + " parameter to BottleneckStrategy must be a positive integer"));
+  }
+}
+
+BottleneckStrategy::BottleneckStrategy(Forwarder& forwarder, const Name& name)
+  // Specifying BestRouteStrategy2's own name in its constructor prevents an exception from occuring
+  // when specifying parameters to BottleneckStrategy
+  : BestRouteStrategy2(forwarder, BestRouteStrategy2::getStrategyName())
+  , m_serviceTime(time::nanoseconds(1_s) / 100)
+  , m_queueLimit(50)
+  , m_markingDelay(5_ms)
+  , m_nextSendTime(time::steady_clock::TimePoint::min())
+{
+  ParsedInstanceName parsed = parseInstanceName(name);
+  switch (parsed.parameters.size()) {
+  case 3:
+    m_markingDelay = time::milliseconds(parsePositiveInteger(parsed.parameters.at(2), "Third"));
+    NDN_CXX_FALLTHROUGH;
+  case 2:
+    m_queueLimit = parsePositiveInteger(parsed.parameters.at(1), "Second");
+    NDN_CXX_FALLTHROUGH;
+  case 1:
+    m_serviceTime = time::nanoseconds(1_s) / parsePositiveInteger(parsed.parameters.at(0), "First");
+    NDN_CXX_FALLTHROUGH;
+  case 0:
+    break;
+  default:
+    BOOST_THROW_EXCEPTION(std::invalid_argument("BottleneckStrategy does not accept more than 3 parameters"));
+  }
+
+  if (parsed.version && *parsed.version != getStrategyName()[-1].toVersion()) {
+    BOOST_THROW_EXCEPTION(std::invalid_argument(
+      "BottleneckStrategy does not support version " + to_string(*parsed.version)));
+  }
+  this->setInstanceName(makeInstanceName(name, getStrategyName()));
+}
+
+const Name&
+BottleneckStrategy::getStrategyName()
+{
+  static Name strategyName("/localhost/nfd/strategy/bottleneck/%FD%01");
+  return strategyName;
+}
+
+void
+BottleneckStrategy::afterReceiveInterest(const Face& inFace, const Interest& interest,
+                                         const shared_ptr<pit::Entry>& pitEntry)
+{
+  auto now = time::steady_clock::now();
+  auto sendTime = std::max(now, m_nextSendTime);
+  time::nanoseconds queuingDelay = sendTime - now;
+
+  if (static_cast<size_t>(queuingDelay / m_serviceTime) >= m_queueLimit) {
+    lp::NackHeader nackHeader;
+    nackHeader.setReason(lp::NackReason::CONGESTION);
+    this->sendNack(pitEntry, inFace, nackHeader);
+    this->rejectPendingInterest(pitEntry);
+    return;
+  }
+  m_nextSendTime = sendTime + m_serviceTime;
+
+  PitInfo* pi = pitEntry->insertStrategyInfo<PitInfo>().first;
+  if (queuingDelay > m_markingDelay) {
+    pi->isMarked = true;
+  }
+
+  if (queuingDelay <= time::nanoseconds::zero()) {
+    BestRouteStrategy2::afterReceiveInterest(inFace, interest, pitEntry);
+    return;
+  }
+
+  pi->dequeueEvent = scheduler::schedule(queuingDelay,
+    bind(&BottleneckStrategy::dequeue, this, weak_ptr<pit::Entry>(pitEntry), inFace.getId(), interest));
+}
+
+void
+BottleneckStrategy::dequeue(const weak_ptr<pit::Entry>& pitEntryWeak, FaceId inFaceId,
+                            const Interest& interest)
+{
+  shared_ptr<pit::Entry> pitEntry = pitEntryWeak.lock();
+  Face* inFace = this->getFace(inFaceId);
+  if (pitEntry == nullptr || inFace == nullptr || !pitEntry->hasInRecords()) {
+    return;
+  }
+
+  BestRouteStrategy2::afterReceiveInterest(*inFace, interest, pitEntry);
+}
+
+void
+BottleneckStrategy::afterReceiveData(const shared_ptr<pit::Entry>& pitEntry,
+                                     const Face& inFace, const Data& data)
+{
+  PitInfo* pi = pitEntry->getStrategyInfo<PitInfo>();
+  if (pi == nullptr || !pi->isMarked || data.getCongestionMark() > 0) {
+    BestRouteStrategy2::afterReceiveData(pitEntry, inFace, data);
+    return;
+  }
+
+  Data markedData(data);
+  markedData.setCongestionMark(1);
+  BestRouteStrategy2::afterReceiveData(pitEntry, inFace, markedData);
+}
+
+} // namespace fw
+} // namespace nfd
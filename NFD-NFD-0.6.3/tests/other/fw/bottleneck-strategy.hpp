@@ -0,0 +1,91 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_TESTS_OTHER_FW_BOTTLENECK_STRATEGY_HPP
+#define NFD_TESTS_OTHER_FW_BOTTLENECK_STRATEGY_HPP
+
+#include "daemon/fw/best-route-strategy2.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief Bottleneck emulation integration testing strategy version 1
+ *
+ *  This strategy emulates a bottleneck link with a drop-tail queue on the forwarder where it
+ *  is installed. Otherwise, behaves like BestRouteStrategy2.
+ *
+ *  Incoming Interests are forwarded at no more than a fixed rate, specified through the first
+ *  strategy parameter in Interests per second (defaults to 100). Interests above this rate wait
+ *  in a queue; an Interest arriving when the queue holds as many Interests as the optional second
+ *  parameter (defaults to 50) is answered with Nack-Congestion. Data for an Interest that waited
+ *  longer than the optional third parameter in milliseconds (defaults to 5) carries a
+ *  CongestionMark toward the downstream.
+ */
+class BottleneckStrategy : public BestRouteStrategy2
+{
+public:
+  explicit
+  BottleneckStrategy(Forwarder& forwarder, const Name& name = getStrategyName());
+
+  static const Name&
+  getStrategyName();
+
+  void
+  afterReceiveInterest(const Face& inFace, const Interest& interest,
+                       const shared_ptr<pit::Entry>& pitEntry) override;
+
+  void
+  afterReceiveData(const shared_ptr<pit::Entry>& pitEntry,
+                   const Face& inFace, const Data& data) override;
+
+private:
+  class PitInfo : public StrategyInfo
+  {
+  public:
+    static constexpr int
+    getTypeId()
+    {
+      return 9100;
+    }
+
+  public:
+    bool isMarked = false;
+    scheduler::ScopedEventId dequeueEvent;
+  };
+
+  void
+  dequeue(const weak_ptr<pit::Entry>& pitEntryWeak, FaceId inFaceId, const Interest& interest);
+
+private:
+  time::nanoseconds m_serviceTime;
+  size_t m_queueLimit;
+  time::nanoseconds m_markingDelay;
+  time::steady_clock::TimePoint m_nextSendTime;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_TESTS_OTHER_FW_BOTTLENECK_STRATEGY_HPP
@@ -0,0 +1,236 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "core/global-io.hpp"
+#include "face/shm-channel.hpp"
+#include "face/unix-stream-channel.hpp"
+
+#include <ndn-cxx/security/signature-sha256-with-rsa.hpp>
+#include <ndn-cxx/transport/shm-ring.hpp>
+#include <ndn-cxx/transport/shm-transport.hpp>
+#include <ndn-cxx/transport/unix-transport.hpp>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/filesystem.hpp>
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+namespace nfd {
+namespace tests {
+
+using face::Face;
+
+/** \brief measures latency and throughput between NFD and a local application
+ *
+ *  NFD's side of the face runs on the global io_service in the main thread; the application
+ *  runs an ndn::Transport on its own io_service in a second thread, as a separate process would.
+ */
+class LocalFaceBenchmarkFixture
+{
+protected:
+  LocalFaceBenchmarkFixture()
+  {
+#ifdef _DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+
+    interestWire = Interest("/localhost/benchmark/interest").wireEncode();
+
+    auto data = make_shared<Data>("/localhost/benchmark/data");
+    data->setContent(std::vector<uint8_t>(PAYLOAD_SIZE, 0xBB).data(), PAYLOAD_SIZE);
+    ndn::SignatureSha256WithRsa fakeSignature;
+    fakeSignature.setValue(ndn::encoding::makeEmptyBlock(tlv::SignatureValue));
+    data->setSignature(fakeSignature);
+    data->wireEncode();
+    this->data = data;
+  }
+
+  template<typename ChannelT>
+  void
+  run(const std::string& label, ChannelT& channel, shared_ptr<ndn::Transport> client)
+  {
+    channel.listen([this] (const shared_ptr<Face>& newFace) {
+                     face = newFace;
+                     face->afterReceiveInterest.connect([this] (const Interest&) { onForwarderReceive(); });
+                   },
+                   nullptr);
+
+    std::thread clientThread([this, client] {
+      // Boost.Test assertions are not thread-safe, so failures are reported to the main thread
+      try {
+        boost::asio::io_service::work work(clientIo);
+        client->connect(clientIo, [this, client] (const Block&) { onClientReceive(*client); });
+        latencyStart = time::steady_clock::now();
+        client->send(interestWire);
+        clientIo.run();
+      }
+      catch (const std::exception& e) {
+        failClient(e.what());
+      }
+    });
+
+    getGlobalIoService().run();
+    clientThread.join();
+    client->close();
+    if (face != nullptr) {
+      face->close();
+    }
+    getGlobalIoService().reset();
+
+    if (!clientError.empty()) {
+      BOOST_FAIL(clientError);
+    }
+
+    std::cout << label << " round trip (" << N_ROUND_TRIPS << "): "
+              << time::duration_cast<time::nanoseconds>(latencyEnd - latencyStart) / N_ROUND_TRIPS
+              << " per packet\n"
+              << label << " upstream (" << N_PACKETS << " Interests): "
+              << time::duration_cast<time::microseconds>(upstreamEnd - upstreamStart) << "\n"
+              << label << " downstream (" << N_PACKETS << " Data, " << PAYLOAD_SIZE << " octets): "
+              << time::duration_cast<time::microseconds>(downstreamEnd - downstreamStart) << std::endl;
+  }
+
+private:
+  /** \brief runs in the main thread
+   */
+  void
+  onForwarderReceive()
+  {
+    switch (phase) {
+      case Phase::LATENCY:
+        face->sendData(*data);
+        break;
+      case Phase::UPSTREAM:
+        if (++nUpstream == N_PACKETS) {
+          upstreamEnd = downstreamStart = time::steady_clock::now();
+          phase = Phase::DOWNSTREAM;
+          for (size_t i = 0; i < N_PACKETS; ++i) {
+            face->sendData(*data);
+          }
+        }
+        break;
+      default:
+        BOOST_FAIL("unexpected Interest");
+    }
+  }
+
+  /** \brief runs in the client thread
+   */
+  void
+  onClientReceive(ndn::Transport& client)
+  {
+    switch (phase) {
+      case Phase::LATENCY:
+        if (++nRoundTrips < N_ROUND_TRIPS) {
+          client.send(interestWire);
+          break;
+        }
+        latencyEnd = upstreamStart = time::steady_clock::now();
+        phase = Phase::UPSTREAM;
+        for (size_t i = 0; i < N_PACKETS; ++i) {
+          client.send(interestWire);
+        }
+        break;
+      case Phase::DOWNSTREAM:
+        if (++nDownstream == N_PACKETS) {
+          downstreamEnd = time::steady_clock::now();
+          clientIo.stop();
+          getGlobalIoService().post([] { getGlobalIoService().stop(); });
+        }
+        break;
+      default:
+        failClient("unexpected Data");
+        break;
+    }
+  }
+
+  /** \brief runs in the client thread; stops both threads and records \p error for run()
+   */
+  void
+  failClient(const std::string& error)
+  {
+    clientError = error;
+    clientIo.stop();
+    getGlobalIoService().post([] { getGlobalIoService().stop(); });
+  }
+
+protected:
+  static const size_t N_ROUND_TRIPS = 20000;
+  static const size_t N_PACKETS = 200000;
+  static const size_t PAYLOAD_SIZE = 1024;
+
+  Block interestWire;
+  shared_ptr<const Data> data;
+
+private:
+  enum class Phase {
+    LATENCY,
+    UPSTREAM,
+    DOWNSTREAM
+  };
+  std::atomic<Phase> phase{Phase::LATENCY};
+
+  boost::asio::io_service clientIo;
+  std::string clientError; ///< written by the client thread, read after it is joined
+  shared_ptr<Face> face;
+  size_t nRoundTrips = 0;
+  size_t nUpstream = 0;
+  size_t nDownstream = 0;
+
+  time::steady_clock::TimePoint latencyStart;
+  time::steady_clock::TimePoint latencyEnd;
+  time::steady_clock::TimePoint upstreamStart;
+  time::steady_clock::TimePoint upstreamEnd;
+  time::steady_clock::TimePoint downstreamStart;
+  time::steady_clock::TimePoint downstreamEnd;
+};
+
+const size_t LocalFaceBenchmarkFixture::N_ROUND_TRIPS;
+const size_t LocalFaceBenchmarkFixture::N_PACKETS;
+const size_t LocalFaceBenchmarkFixture::PAYLOAD_SIZE;
+
+BOOST_FIXTURE_TEST_SUITE(LocalFaceBenchmark, LocalFaceBenchmarkFixture)
+
+BOOST_AUTO_TEST_CASE(UnixStream)
+{
+  unix_stream::Endpoint ep("nfd-local-face-benchmark.sock");
+  face::UnixStreamChannel channel(ep, false);
+  run("unix", channel, make_shared<ndn::UnixTransport>(ep.path()));
+}
+
+BOOST_AUTO_TEST_CASE(SharedMemory)
+{
+  unix_stream::Endpoint ep("nfd-local-face-benchmark-shm.sock");
+  face::ShmChannel channel(ep, ndn::shm::DEFAULT_RING_CAPACITY, false);
+  run("shm", channel, make_shared<ndn::ShmTransport>(ep.path()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,184 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark-helpers.hpp"
+#include "face/face.hpp"
+#include "face/generic-link-service.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/face/dummy-transport.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+#ifdef HAVE_VALGRIND
+#include <valgrind/callgrind.h>
+#endif
+
+namespace nfd {
+namespace face {
+namespace tests {
+
+using namespace nfd::tests;
+
+/** \brief runs NDNLPv2 reliability between two faces over a simulated lossy link
+ *
+ *  Time is simulated, so only the CPU cost of the link services is measured. Each round, the
+ *  sender sends a burst of Interests, the link drops packets in both directions at random, and
+ *  the clock advances by one idle-Ack period so the receiver returns its Acks.
+ */
+class LpReliabilityBenchmarkFixture : public UnitTestTimeFixture
+{
+protected:
+  LpReliabilityBenchmarkFixture()
+  {
+#ifdef _DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+  }
+
+  void
+  run(const std::string& label, double lossRate, bool wantAckRanges)
+  {
+    static const size_t N_ROUNDS = 200;
+    static const size_t BURST_SIZE = 512;
+    static const size_t MAX_DRAIN_STEPS = 1000;
+    static const ssize_t MTU = 1500;
+
+    GenericLinkService::Options options;
+    options.allowFragmentation = true;
+    options.allowReassembly = true;
+    options.reliabilityOptions.isEnabled = true;
+    options.reliabilityOptions.wantAckRanges = wantAckRanges;
+
+    auto senderTransport = make_unique<DummyTransport>();
+    auto receiverTransport = make_unique<DummyTransport>();
+    DummyTransport& senderLink = *senderTransport;
+    DummyTransport& receiverLink = *receiverTransport;
+    senderLink.setMtu(MTU);
+    receiverLink.setMtu(MTU);
+    Face sender(make_unique<GenericLinkService>(options), std::move(senderTransport));
+    Face receiver(make_unique<GenericLinkService>(options), std::move(receiverTransport));
+
+    size_t nReceived = 0;
+    receiver.afterReceiveInterest.connect([&nReceived] (const Interest&) { ++nReceived; });
+
+    std::vector<Interest> interests;
+    interests.reserve(BURST_SIZE);
+    for (size_t i = 0; i < BURST_SIZE; ++i) {
+      interests.emplace_back(Name("/lp/reliability/benchmark").appendNumber(i));
+      interests.back().setNonce(static_cast<uint32_t>(i));
+      interests.back().wireEncode();
+    }
+
+    std::mt19937 rng(0);
+    std::bernoulli_distribution isLost(lossRate);
+    size_t nDelivered = 0;
+    auto deliver = [&] (DummyTransport& from, DummyTransport& to) {
+      std::vector<Transport::Packet> packets;
+      packets.swap(from.sentPackets);
+      for (Transport::Packet& packet : packets) {
+        if (!isLost(rng)) {
+          to.receivePacket(std::move(packet.packet));
+          ++nDelivered;
+        }
+      }
+    };
+
+    auto idleAckPeriod = options.reliabilityOptions.idleAckTimerPeriod;
+    auto step = [&] {
+      deliver(senderLink, receiverLink);
+      this->advanceClocks(idleAckPeriod);
+      deliver(receiverLink, senderLink);
+    };
+
+#ifdef HAVE_VALGRIND
+    CALLGRIND_START_INSTRUMENTATION;
+#endif
+    auto t1 = std::chrono::steady_clock::now();
+
+    for (size_t round = 0; round < N_ROUNDS; ++round) {
+      for (const Interest& interest : interests) {
+        sender.sendInterest(interest);
+      }
+      step();
+    }
+    // keep the link running until every Interest is acknowledged or given up on
+    const auto& counters = getLinkCounters(sender);
+    size_t nSent = N_ROUNDS * BURST_SIZE;
+    for (size_t i = 0; i < MAX_DRAIN_STEPS &&
+                       counters.nAcknowledged + counters.nRetransmitted +
+                       counters.nRetxExhausted < nSent; ++i) {
+      step();
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+#ifdef HAVE_VALGRIND
+    CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+    auto d = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1);
+    std::cout << label << ": " << nSent << " Interests, " << nDelivered << " LpPackets delivered, "
+              << d.count() << " us, " << (d.count() * 1000 / nSent) << " ns per Interest\n"
+              << "  received=" << nReceived
+              << " acknowledged=" << counters.nAcknowledged
+              << " retransmitted=" << counters.nRetransmitted
+              << " retxExhausted=" << counters.nRetxExhausted << std::endl;
+  }
+
+private:
+  static const GenericLinkService::Counters&
+  getLinkCounters(const Face& face)
+  {
+    return static_cast<const GenericLinkService*>(face.getLinkService())->getCounters();
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(LpReliabilityBenchmark, LpReliabilityBenchmarkFixture)
+
+BOOST_AUTO_TEST_CASE(NoLoss)
+{
+  run("no loss, Acks", 0.0, false);
+  run("no loss, AckRanges", 0.0, true);
+}
+
+BOOST_AUTO_TEST_CASE(Loss1Percent)
+{
+  run("1% loss, Acks", 0.01, false);
+  run("1% loss, AckRanges", 0.01, true);
+}
+
+BOOST_AUTO_TEST_CASE(Loss5Percent)
+{
+  run("5% loss, Acks", 0.05, false);
+  run("5% loss, AckRanges", 0.05, true);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // LpReliabilityBenchmark
+
+} // namespace tests
+} // namespace face
+} // namespace nfd
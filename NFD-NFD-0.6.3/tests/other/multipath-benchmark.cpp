@@ -0,0 +1,157 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fw/adaptive-multipath-strategy.hpp"
+#include "fw/best-route-strategy2.hpp"
+#include "fw/multicast-strategy.hpp"
+#include "tests/other/fw/bottleneck-strategy.hpp"
+#include "tests/daemon/fw/topology-tester.hpp"
+
+#include <iomanip>
+#include <iostream>
+
+namespace nfd {
+namespace tests {
+
+using fw::tests::TopologyTester;
+using fw::tests::TopologyNode;
+using fw::tests::TopologyLink;
+using fw::tests::TopologyAppLink;
+
+/** \brief evaluates multipath forwarding over emulated bottleneck links
+ *
+ *  \code
+ *                       +------+  100 Interests/s
+ *                   +-->|  B1  |---+
+ *                   |   +------+   |
+ *   consumer   +---+|   +------+   |   +---+
+ *   ---------->| R |+-->|  B2  |---+-->| P |  producer
+ *   600/s      +---+|   +------+   |   +---+
+ *                   |   +------+   |
+ *                   +-->|  B3  |---+
+ *                       +------+  400 Interests/s
+ *  \endcode
+ *
+ *  Each Bi runs BottleneckStrategy, which limits the Interest rate through Bi, marks Data of
+ *  Interests that were queued, and returns Nack-Congestion when its queue overflows.
+ *  R runs the strategy under test. The offered load is below the total capacity of the three
+ *  bottlenecks, but above the capacity of any single one.
+ */
+class MultipathBenchmarkFixture : public UnitTestTimeFixture
+{
+protected:
+  MultipathBenchmarkFixture()
+  {
+#ifdef _DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+  }
+
+  struct Result
+  {
+    uint64_t nData;
+    uint64_t nNacks;
+    std::vector<uint64_t> nInterestsPerPath;
+  };
+
+  template<typename S>
+  Result
+  runScenario()
+  {
+    TopologyTester topo;
+    TopologyNode nodeR = topo.addForwarder("R");
+    TopologyNode nodeP = topo.addForwarder("P");
+    topo.setStrategy<S>(nodeR);
+
+    std::vector<shared_ptr<TopologyLink>> linksRB;
+    for (size_t i = 0; i < CAPACITIES.size(); ++i) {
+      TopologyNode nodeB = topo.addForwarder("B" + to_string(i + 1));
+      topo.setStrategy<fw::BottleneckStrategy>(nodeB, "/",
+        Name(fw::BottleneckStrategy::getStrategyName()).append(to_string(CAPACITIES[i])));
+
+      auto linkRB = topo.addLink("RB" + to_string(i + 1), 5_ms, {nodeR, nodeB});
+      auto linkBP = topo.addLink("B" + to_string(i + 1) + "P", 5_ms, {nodeB, nodeP});
+      topo.registerPrefix(nodeR, linkRB->getFace(nodeR), PREFIX);
+      topo.registerPrefix(nodeB, linkBP->getFace(nodeB), PREFIX);
+      linksRB.push_back(linkRB);
+    }
+
+    shared_ptr<TopologyAppLink> consumer = topo.addAppFace("c", nodeR);
+    shared_ptr<TopologyAppLink> producer = topo.addAppFace("p", nodeP, PREFIX);
+    topo.addEchoProducer(producer->getClientFace(), PREFIX);
+
+    topo.addIntervalConsumer(consumer->getClientFace(), PREFIX,
+                             time::nanoseconds(1_s) / OFFERED_LOAD, N_INTERESTS, 0);
+    this->advanceClocks(1_ms, time::nanoseconds(1_s) * N_INTERESTS / OFFERED_LOAD + 5_s);
+
+    Result result;
+    result.nData = consumer->getForwarderFace().getCounters().nOutData;
+    result.nNacks = consumer->getForwarderFace().getCounters().nOutNacks;
+    for (const auto& link : linksRB) {
+      result.nInterestsPerPath.push_back(link->getFace(nodeR).getCounters().nOutInterests);
+    }
+    return result;
+  }
+
+  static void
+  printResult(const std::string& strategyName, const Result& result)
+  {
+    std::cout << std::setw(20) << std::left << strategyName
+              << " data=" << result.nData << " nacks=" << result.nNacks << " paths=";
+    for (size_t i = 0; i < result.nInterestsPerPath.size(); ++i) {
+      std::cout << (i > 0 ? "/" : "") << result.nInterestsPerPath[i];
+    }
+    std::cout << std::endl;
+  }
+
+protected:
+  static const Name PREFIX;
+  static const std::vector<uint64_t> CAPACITIES;
+  static const uint64_t OFFERED_LOAD = 600;
+  static const size_t N_INTERESTS = 6000;
+};
+
+const Name MultipathBenchmarkFixture::PREFIX("/P");
+const std::vector<uint64_t> MultipathBenchmarkFixture::CAPACITIES{100, 200, 400};
+const uint64_t MultipathBenchmarkFixture::OFFERED_LOAD;
+const size_t MultipathBenchmarkFixture::N_INTERESTS;
+
+BOOST_FIXTURE_TEST_CASE(Bottlenecks, MultipathBenchmarkFixture)
+{
+  Result bestRoute = runScenario<fw::BestRouteStrategy2>();
+  printResult("best-route", bestRoute);
+
+  Result multicast = runScenario<fw::MulticastStrategy>();
+  printResult("multicast", multicast);
+
+  Result adaptive = runScenario<fw::AdaptiveMultipathStrategy>();
+  printResult("adaptive-multipath", adaptive);
+
+  BOOST_CHECK_GT(adaptive.nData, bestRoute.nData);
+  BOOST_CHECK_GT(adaptive.nData, multicast.nData);
+}
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,409 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** \file
+ *  \brief replays a packet trace through a Forwarder
+ *
+ *  nfd-replay reads a trace captured with face_system.general.trace_file, and feeds every
+ *  incoming packet into a Forwarder through in-memory faces, one face per FaceId in the trace.
+ *  Before replaying, a route toward the face on which Data arrived is installed for a prefix of
+ *  every Data name, so that Interests are forwarded to the same faces as in the trace.
+ *
+ *  It reports the replay rate, percentiles of the time spent in the Interest, Data, and Nack
+ *  pipelines, which includes link-layer decoding, and the peak sizes of the tables.
+ */
+
+#include "core/extended-error-message.hpp"
+#include "core/global-io.hpp"
+#include "face/generic-link-service.hpp"
+#include "face/packet-trace.hpp"
+#include "fw/forwarder.hpp"
+
+#include <ndn-cxx/lp/packet.hpp>
+
+#include <boost/program_options/options_description.hpp>
+#include <boost/program_options/parsers.hpp>
+#include <boost/program_options/variables_map.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+#ifdef HAVE_VALGRIND
+#include <valgrind/callgrind.h>
+#endif
+
+namespace nfd {
+namespace tests {
+
+using face::PacketTraceReader;
+using face::PacketTraceRecord;
+
+/** \brief in-memory transport that injects recorded packets and discards sent packets
+ */
+class ReplayTransport : public face::Transport
+{
+public:
+  explicit
+  ReplayTransport(FaceId recordedFaceId)
+  {
+    this->setLocalUri(FaceUri("replay://0"));
+    this->setRemoteUri(FaceUri("replay://" + to_string(recordedFaceId)));
+    this->setScope(ndn::nfd::FACE_SCOPE_NON_LOCAL);
+    this->setPersistency(ndn::nfd::FACE_PERSISTENCY_PERSISTENT);
+    this->setLinkType(ndn::nfd::LINK_TYPE_POINT_TO_POINT);
+    this->setMtu(face::MTU_UNLIMITED);
+  }
+
+  void
+  inject(const Block& packet)
+  {
+    this->receive(Packet(Block(packet)));
+  }
+
+private:
+  void
+  doClose() override
+  {
+    this->setState(face::TransportState::CLOSED);
+  }
+
+  void
+  doSend(Packet&& packet) override
+  {
+  }
+};
+
+class NfdReplay : noncopyable
+{
+public:
+  struct Options
+  {
+    std::string traceFile;
+    bool wantRecordedPace = false;
+    size_t routePrefixLength = 1;
+    size_t csMaxPackets = 65536;
+  };
+
+  explicit
+  NfdReplay(const Options& options)
+    : m_options(options)
+  {
+    m_forwarder.getCs().setLimit(m_options.csMaxPackets);
+  }
+
+  void
+  run()
+  {
+    this->load();
+    this->replay();
+    this->report();
+  }
+
+private:
+  enum PacketKind {
+    KIND_INTEREST,
+    KIND_DATA,
+    KIND_NACK,
+    KIND_OTHER,
+    KIND_MAX
+  };
+
+  struct Step
+  {
+    time::system_clock::TimePoint timestamp;
+    ReplayTransport* transport;
+    PacketKind kind;
+    Block packet;
+  };
+
+  static const char*
+  getKindName(PacketKind kind)
+  {
+    static const char* names[] = {"Interest", "Data", "Nack", "other"};
+    return names[kind];
+  }
+
+  /** \brief determine the network layer packet carried in a link-layer packet
+   *  \param[out] network the network layer packet, if any
+   */
+  static PacketKind
+  classify(const Block& packet, Block& network)
+  {
+    if (packet.type() != lp::tlv::LpPacket) {
+      network = packet;
+    }
+    else {
+      lp::Packet lpPacket(packet);
+      if (!lpPacket.has<lp::FragmentField>() ||
+          (lpPacket.has<lp::FragCountField>() && lpPacket.get<lp::FragCountField>() > 1)) {
+        // idle packet, acknowledgement, or fragment
+        return KIND_OTHER;
+      }
+      ndn::Buffer::const_iterator first, last;
+      std::tie(first, last) = lpPacket.get<lp::FragmentField>();
+      network = Block(&*first, std::distance(first, last));
+      if (lpPacket.has<lp::NackField>()) {
+        return KIND_NACK;
+      }
+    }
+
+    switch (network.type()) {
+      case tlv::Interest:
+        return KIND_INTEREST;
+      case tlv::Data:
+        return KIND_DATA;
+      default:
+        return KIND_OTHER;
+    }
+  }
+
+  Face&
+  getFace(FaceId recordedFaceId)
+  {
+    shared_ptr<Face>& face = m_faces[recordedFaceId];
+    if (face == nullptr) {
+      face = make_shared<Face>(make_unique<face::GenericLinkService>(),
+                               make_unique<ReplayTransport>(recordedFaceId));
+      m_forwarder.addFace(face);
+    }
+    return *face;
+  }
+
+  void
+  load()
+  {
+    PacketTraceReader reader(m_options.traceFile);
+    PacketTraceRecord record;
+    std::set<std::pair<Name, FaceId>> routes;
+    size_t nMalformed = 0;
+    while (reader.read(record)) {
+      if (record.direction != PacketTraceRecord::INCOMING ||
+          record.faceId <= face::FACEID_RESERVED_MAX) {
+        continue;
+      }
+
+      Block network;
+      PacketKind kind = KIND_OTHER;
+      Name dataName;
+      try {
+        kind = classify(record.packet, network);
+        if (kind == KIND_DATA) {
+          dataName = Data(network).getName();
+        }
+      }
+      catch (const tlv::Error&) {
+        // still replayed, so that the link service drops it as it did when it was recorded
+        kind = KIND_OTHER;
+        ++nMalformed;
+      }
+
+      Face& face = this->getFace(record.faceId);
+      if (kind == KIND_DATA) {
+        Name prefix = dataName.getPrefix(m_options.routePrefixLength);
+        if (routes.emplace(prefix, record.faceId).second) {
+          fib::Entry* entry = m_forwarder.getFib().insert(prefix).first;
+          m_forwarder.getFib().addNextHop(*entry, face, 0);
+        }
+      }
+
+      auto transport = static_cast<ReplayTransport*>(face.getTransport());
+      m_steps.push_back({record.timestamp, transport, kind, record.packet});
+    }
+
+    std::clog << "Loaded " << m_steps.size() << " incoming packets on " << m_faces.size()
+              << " faces, " << routes.size() << " routes, " << nMalformed << " malformed"
+              << std::endl;
+  }
+
+  void
+  samplePeakSizes()
+  {
+    m_peakNameTree = std::max(m_peakNameTree, m_forwarder.getNameTree().size());
+    m_peakPit = std::max(m_peakPit, m_forwarder.getPit().size());
+    m_peakCs = std::max(m_peakCs, m_forwarder.getCs().size());
+    m_peakMeasurements = std::max(m_peakMeasurements, m_forwarder.getMeasurements().size());
+  }
+
+  void
+  replay()
+  {
+    if (m_steps.empty()) {
+      return;
+    }
+
+    // the trace timestamps are wall clock, the replay is paced with a monotonic clock
+    auto traceStart = m_steps.front().timestamp;
+    auto replayStart = std::chrono::steady_clock::now();
+
+#ifdef HAVE_VALGRIND
+    CALLGRIND_START_INSTRUMENTATION;
+#endif
+
+    size_t i = 0;
+    for (const Step& step : m_steps) {
+      if (m_options.wantRecordedPace) {
+        time::nanoseconds offset = step.timestamp - traceStart;
+        std::this_thread::sleep_until(replayStart + std::chrono::nanoseconds(offset.count()));
+        getGlobalIoService().poll();
+      }
+      else if ((++i & 0x3FF) == 0) {
+        // run expired timers, e.g., PIT entry expiry
+        getGlobalIoService().poll();
+      }
+
+      auto t1 = std::chrono::steady_clock::now();
+      step.transport->inject(step.packet);
+      auto t2 = std::chrono::steady_clock::now();
+      m_latencies[step.kind].push_back(std::chrono::nanoseconds(t2 - t1).count());
+
+      this->samplePeakSizes();
+    }
+
+#ifdef HAVE_VALGRIND
+    CALLGRIND_STOP_INSTRUMENTATION;
+#endif
+
+    m_elapsed = std::chrono::steady_clock::now() - replayStart;
+  }
+
+  void
+  report()
+  {
+    if (m_steps.empty()) {
+      std::clog << "No incoming packets in trace" << std::endl;
+      return;
+    }
+
+    int64_t busyNs = 0;
+    for (const auto& latencies : m_latencies) {
+      for (int64_t ns : latencies) {
+        busyNs += ns;
+      }
+    }
+    auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(m_elapsed).count();
+
+    std::cout << "Replayed " << m_steps.size() << " packets in " << elapsedNs / 1000 << " us ("
+              << static_cast<uint64_t>(m_steps.size() * 1e9 / std::max<int64_t>(1, elapsedNs))
+              << " packets/s); forwarding capacity "
+              << static_cast<uint64_t>(m_steps.size() * 1e9 / std::max<int64_t>(1, busyNs))
+              << " packets/s" << std::endl;
+
+    std::cout << "Pipeline latency (ns):" << std::endl
+              << std::setw(10) << "" << std::setw(10) << "count" << std::setw(10) << "p50"
+              << std::setw(10) << "p90" << std::setw(10) << "p99" << std::setw(10) << "p99.9"
+              << std::setw(10) << "max" << std::endl;
+    for (int kind = 0; kind < KIND_MAX; ++kind) {
+      std::vector<int64_t>& latencies = m_latencies[kind];
+      if (latencies.empty()) {
+        continue;
+      }
+      std::sort(latencies.begin(), latencies.end());
+      auto percentile = [&latencies] (double p) {
+        return latencies[static_cast<size_t>(p * (latencies.size() - 1))];
+      };
+      std::cout << std::setw(10) << getKindName(static_cast<PacketKind>(kind))
+                << std::setw(10) << latencies.size() << std::setw(10) << percentile(0.5)
+                << std::setw(10) << percentile(0.9) << std::setw(10) << percentile(0.99)
+                << std::setw(10) << percentile(0.999) << std::setw(10) << latencies.back()
+                << std::endl;
+    }
+
+    std::cout << "Peak table sizes: NameTree " << m_peakNameTree << ", PIT " << m_peakPit
+              << ", CS " << m_peakCs << ", Measurements " << m_peakMeasurements << std::endl;
+  }
+
+private:
+  Options m_options;
+  Forwarder m_forwarder;
+  std::map<FaceId, shared_ptr<Face>> m_faces;
+  std::vector<Step> m_steps;
+
+  std::chrono::steady_clock::duration m_elapsed;
+  std::vector<int64_t> m_latencies[KIND_MAX];
+  size_t m_peakNameTree = 0;
+  size_t m_peakPit = 0;
+  size_t m_peakCs = 0;
+  size_t m_peakMeasurements = 0;
+};
+
+} // namespace tests
+} // namespace nfd
+
+int
+main(int argc, char** argv)
+{
+#ifdef _DEBUG
+  std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+
+  namespace po = boost::program_options;
+
+  nfd::tests::NfdReplay::Options options;
+  po::options_description description("Options");
+  description.add_options()
+    ("help,h", "print this help message and exit")
+    ("pace,p", po::bool_switch(&options.wantRecordedPace),
+     "replay at the pace recorded in the trace, instead of as fast as possible")
+    ("route-prefix-length,l", po::value<size_t>(&options.routePrefixLength)->default_value(1),
+     "number of name components in routes learned from Data in the trace")
+    ("cs-max-packets,c", po::value<size_t>(&options.csMaxPackets)->default_value(65536),
+     "ContentStore capacity")
+    ;
+  po::options_description hidden;
+  hidden.add_options()
+    ("trace", po::value<std::string>(&options.traceFile));
+  po::options_description all;
+  all.add(description).add(hidden);
+  po::positional_options_description positional;
+  positional.add("trace", 1);
+
+  po::variables_map vm;
+  try {
+    po::store(po::command_line_parser(argc, argv).options(all).positional(positional).run(), vm);
+    po::notify(vm);
+  }
+  catch (const po::error& e) {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    return 2;
+  }
+
+  if (vm.count("help") > 0 || options.traceFile.empty()) {
+    std::cerr << "Usage: " << argv[0] << " [options] <trace-file>\n" << description;
+    return vm.count("help") > 0 ? 0 : 2;
+  }
+
+  try {
+    nfd::tests::NfdReplay replay(options);
+    replay.run();
+  }
+  catch (const std::exception& e) {
+    std::cerr << "FATAL: " << nfd::getExtendedErrorMessage(e) << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,347 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2018,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "rib/fib-compressor.hpp"
+#include "core/random.hpp"
+
+#include "tests/test-common.hpp"
+#include "fib-updates-common.hpp"
+
+#include <random>
+
+namespace nfd {
+namespace rib {
+namespace tests {
+
+using nfd::tests::BaseFixture;
+using nfd::tests::makeData;
+
+class FibCompressorFixture : public BaseFixture
+{
+protected:
+  FibCompressor::FibUpdateList
+  add(const Name& name, uint64_t faceId, uint64_t cost)
+  {
+    return sortUpdates(compressor.compress({FibUpdate::createAddUpdate(name, faceId, cost)}));
+  }
+
+  FibCompressor::FibUpdateList
+  remove(const Name& name, uint64_t faceId)
+  {
+    return sortUpdates(compressor.compress({FibUpdate::createRemoveUpdate(name, faceId)}));
+  }
+
+  static FibCompressor::FibUpdateList
+  sortUpdates(FibCompressor::FibUpdateList updates)
+  {
+    updates.sort(&compareNameFaceIdCostAction);
+    return updates;
+  }
+
+protected:
+  FibCompressor compressor;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestFibCompressor, FibCompressorFixture)
+
+BOOST_AUTO_TEST_CASE(SuppressSameAsAncestor)
+{
+  BOOST_CHECK_EQUAL(add("/a", 1, 10).size(), 1);
+
+  // same nexthops as /a: suppressed
+  BOOST_CHECK_EQUAL(add("/a/b", 1, 10).size(), 0);
+
+  // different cost: installed
+  FibCompressor::FibUpdateList updates = add("/a/c", 1, 20);
+  BOOST_REQUIRE_EQUAL(updates.size(), 1);
+  BOOST_CHECK_EQUAL(updates.front().name, "/a/c");
+  BOOST_CHECK_EQUAL(updates.front().action, FibUpdate::ADD_NEXTHOP);
+
+  BOOST_CHECK_EQUAL(compressor.size(), 3);
+  BOOST_CHECK_EQUAL(compressor.getNInstalled(), 2);
+  BOOST_CHECK((compressor.findInstalledLongestPrefixMatch("/a/b/x") ==
+               FibCompressor::NextHopMap{{1, 10}}));
+  BOOST_CHECK((compressor.findInstalledLongestPrefixMatch("/a/c/x") ==
+               FibCompressor::NextHopMap{{1, 20}}));
+}
+
+BOOST_AUTO_TEST_CASE(ReinstallWhenEntryDiverges)
+{
+  add("/a", 1, 10);
+  add("/a/b", 1, 10);
+  BOOST_CHECK_EQUAL(compressor.getNInstalled(), 1);
+
+  // /a/b no longer forwards like /a: it is installed with all its nexthops
+  FibCompressor::FibUpdateList updates = add("/a/b", 2, 10);
+  BOOST_REQUIRE_EQUAL(updates.size(), 2);
+  BOOST_CHECK_EQUAL(updates.front().name, "/a/b");
+  BOOST_CHECK_EQUAL(updates.front().faceId, 1);
+  BOOST_CHECK_EQUAL(updates.back().faceId, 2);
+  BOOST_CHECK_EQUAL(compressor.getNInstalled(), 2);
+
+  // back to the same nexthops as /a: uninstalled
+  updates = remove("/a/b", 2);
+  BOOST_REQUIRE_EQUAL(updates.size(), 2);
+  BOOST_CHECK_EQUAL(updates.front().action, FibUpdate::REMOVE_NEXTHOP);
+  BOOST_CHECK_EQUAL(updates.back().action, FibUpdate::REMOVE_NEXTHOP);
+  BOOST_CHECK_EQUAL(compressor.getNInstalled(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ReinstallWhenAncestorChanges)
+{
+  add("/a", 1, 10);
+  add("/a/b", 1, 10);
+  add("/a/b/c", 1, 10);
+  BOOST_CHECK_EQUAL(compressor.getNInstalled(), 1);
+
+  // /a/b is the nearest ancestor of /a/b/c, so only /a/b is re-installed
+  FibCompressor::FibUpdateList updates = add("/a", 2, 10);
+  BOOST_REQUIRE_EQUAL(updates.size(), 2);
+  BOOST_CHECK_EQUAL(updates.front().name, "/a");
+  BOOST_CHECK_EQUAL(updates.front().faceId, 2);
+  BOOST_CHECK_EQUAL(updates.back().name, "/a/b");
+  BOOST_CHECK_EQUAL(updates.back().faceId, 1);
+  BOOST_CHECK_EQUAL(compressor.getNInstalled(), 2);
+
+  // removing /a makes /a/b the root of the subtree
+  updates = remove("/a", 1);
+  BOOST_CHECK_EQUAL(compressor.size(), 3);
+  updates = remove("/a", 2);
+  BOOST_CHECK_EQUAL(updates.size(), 1);
+  BOOST_CHECK_EQUAL(compressor.size(), 2);
+  BOOST_CHECK_EQUAL(compressor.getNInstalled(), 1);
+  BOOST_CHECK((compressor.findInstalledLongestPrefixMatch("/a/b/c/d") ==
+               FibCompressor::NextHopMap{{1, 10}}));
+  BOOST_CHECK(compressor.findInstalledLongestPrefixMatch("/a").empty());
+}
+
+BOOST_AUTO_TEST_CASE(ReinstallNearestDescendants)
+{
+  add("/", 1, 10);
+  add("/a/b", 1, 10);
+  add("/a/b/c", 2, 10);
+  add("/a/d", 1, 10);
+  BOOST_CHECK_EQUAL(compressor.getNInstalled(), 2);
+
+  // /a is not in the FIB; /a/b and /a/d are its nearest descendants, /a/b/c is not affected
+  FibCompressor::FibUpdateList updates = add("/a", 3, 10);
+  BOOST_REQUIRE_EQUAL(updates.size(), 3);
+  auto update = updates.begin();
+  BOOST_CHECK_EQUAL(update->name, "/a");
+  ++update;
+  BOOST_CHECK_EQUAL(update->name, "/a/b");
+  ++update;
+  BOOST_CHECK_EQUAL(update->name, "/a/d");
+  BOOST_CHECK_EQUAL(compressor.getNInstalled(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(Rollback)
+{
+  add("/a", 1, 10);
+  add("/a/b", 1, 10);
+
+  add("/a", 2, 10);
+  BOOST_CHECK_EQUAL(compressor.getNInstalled(), 2);
+
+  compressor.rollback();
+  BOOST_CHECK_EQUAL(compressor.size(), 2);
+  BOOST_CHECK_EQUAL(compressor.getNInstalled(), 1);
+  BOOST_CHECK((compressor.findInstalledLongestPrefixMatch("/a/b") ==
+               FibCompressor::NextHopMap{{1, 10}}));
+
+  // the batch can be recomputed after rollback
+  BOOST_CHECK_EQUAL(add("/a", 2, 10).size(), 2);
+
+  add("/c", 3, 10);
+  compressor.rollback();
+  BOOST_CHECK_EQUAL(compressor.size(), 2);
+  BOOST_CHECK(compressor.findLongestPrefixMatch("/c").empty());
+}
+
+BOOST_AUTO_TEST_CASE(SameAsUncompressed)
+{
+  static const std::vector<Name> names{"/", "/a", "/a/b", "/a/b/c", "/a/d", "/a/d/e",
+                                       "/f", "/f/g", "/f/g/h", "/f/i"};
+  std::uniform_int_distribution<size_t> nameDist(0, names.size() - 1);
+  std::uniform_int_distribution<uint64_t> faceDist(1, 3);
+  std::uniform_int_distribution<uint64_t> costDist(0, 1);
+  std::bernoulli_distribution addDist(0.6);
+
+  // installed FIB of NFD, as a result of applying every compressed update
+  std::map<Name, FibCompressor::NextHopMap> fib;
+  size_t nCompressedEntries = 0;
+
+  for (int i = 0; i < 2000; ++i) {
+    FibCompressor::FibUpdateList updates;
+    for (int j = 0; j < 3; ++j) {
+      const Name& name = names[nameDist(getGlobalRng())];
+      uint64_t faceId = faceDist(getGlobalRng());
+      if (addDist(getGlobalRng())) {
+        updates.push_back(FibUpdate::createAddUpdate(name, faceId, costDist(getGlobalRng())));
+      }
+      else {
+        updates.push_back(FibUpdate::createRemoveUpdate(name, faceId));
+      }
+    }
+
+    for (const FibUpdate& update : compressor.compress(updates)) {
+      if (update.action == FibUpdate::ADD_NEXTHOP) {
+        fib[update.name][update.faceId] = update.cost;
+      }
+      else {
+        BOOST_REQUIRE_EQUAL(fib[update.name].erase(update.faceId), 1);
+        if (fib[update.name].empty()) {
+          fib.erase(update.name);
+        }
+      }
+    }
+    BOOST_REQUIRE_EQUAL(fib.size(), compressor.getNInstalled());
+    BOOST_REQUIRE_LE(compressor.getNInstalled(), compressor.size());
+    nCompressedEntries += compressor.size() - compressor.getNInstalled();
+
+    for (const Name& name : names) {
+      Name interestName = Name(name).append("x");
+      BOOST_REQUIRE((compressor.findInstalledLongestPrefixMatch(interestName) ==
+                     compressor.findLongestPrefixMatch(interestName)));
+    }
+  }
+
+  // the random tables should have some suppressed entries
+  BOOST_CHECK_GT(nCompressedEntries, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestFibCompressor
+
+BOOST_FIXTURE_TEST_SUITE(TestFibUpdates, FibUpdatesFixture)
+
+BOOST_AUTO_TEST_CASE(Compression)
+{
+  fibUpdater.setCompressionEnabled(true);
+  BOOST_CHECK(fibUpdater.isCompressionEnabled());
+
+  insertRoute("/a", 1, 0, 10, 0);
+  BOOST_CHECK_EQUAL(getFibUpdates().size(), 1);
+
+  insertRoute("/a/b", 1, 0, 10, 0);
+  BOOST_CHECK_EQUAL(getFibUpdates().size(), 0);
+  BOOST_CHECK_EQUAL(fibUpdater.getCompressor()->size(), 2);
+  BOOST_CHECK_EQUAL(fibUpdater.getCompressor()->getNInstalled(), 1);
+
+  // /a/b is installed once it forwards differently from /a
+  insertRoute("/a/b", 2, 0, 10, 0);
+  FibUpdater::FibUpdateList updates = getSortedFibUpdates();
+  BOOST_REQUIRE_EQUAL(updates.size(), 2);
+  BOOST_CHECK_EQUAL(updates.front().name, "/a/b");
+  BOOST_CHECK_EQUAL(updates.front().faceId, 1);
+  BOOST_CHECK_EQUAL(updates.back().faceId, 2);
+
+  // updates of the destroyed face are not sent, but /a/b is uninstalled in the compressor
+  destroyFace(2);
+  updates = getSortedFibUpdates();
+  BOOST_REQUIRE_EQUAL(updates.size(), 1);
+  BOOST_CHECK_EQUAL(updates.front().name, "/a/b");
+  BOOST_CHECK_EQUAL(updates.front().faceId, 1);
+  BOOST_CHECK_EQUAL(updates.front().action, FibUpdate::REMOVE_NEXTHOP);
+  BOOST_CHECK_EQUAL(fibUpdater.getCompressor()->getNInstalled(), 1);
+}
+
+class VerifyFaceFixture : public FibUpdatesFixture, public nfd::tests::UnitTestTimeFixture
+{
+protected:
+  /** \brief registers \p name on \p faceId through FibUpdater, without mocking the FIB response
+   */
+  void
+  registerRoute(const Name& name, uint64_t faceId)
+  {
+    RibUpdate update;
+    update.setAction(RibUpdate::REGISTER)
+          .setName(name)
+          .setRoute(createRoute(faceId, 0, 10, 0));
+    RibUpdateBatch batch(faceId);
+    batch.add(update);
+
+    hasSucceeded = false;
+    failureCode = 0;
+    // flush the commands of earlier updates before watching for the faces/query Interest
+    advanceClocks(time::milliseconds(1));
+    face.sentInterests.clear();
+    fibUpdater.computeAndSendFibUpdates(batch,
+      [this] (const RibUpdateList&) { hasSucceeded = true; },
+      [this] (uint32_t code, const std::string&) { failureCode = code; });
+    advanceClocks(time::milliseconds(1));
+  }
+
+  /** \brief responds to the faces/query Interest with \p faces
+   */
+  void
+  respondFaceQuery(const std::vector<ndn::nfd::FaceStatus>& faces)
+  {
+    BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 1);
+    const Interest& interest = face.sentInterests.back();
+    BOOST_REQUIRE(Name("/localhost/nfd/faces/query").isPrefixOf(interest.getName()));
+
+    ndn::encoding::EncodingBuffer buffer;
+    for (auto it = faces.rbegin(); it != faces.rend(); ++it) {
+      it->wireEncode(buffer);
+    }
+
+    auto data = makeData(Name(interest.getName()).appendVersion().appendSegment(0));
+    data->setFinalBlock(name::Component::fromSegment(0));
+    data->setContent(buffer.buf(), buffer.size());
+    face.receive(*data);
+    advanceClocks(time::milliseconds(1));
+  }
+
+protected:
+  bool hasSucceeded = false;
+  uint32_t failureCode = 0;
+};
+
+BOOST_FIXTURE_TEST_CASE(CompressionVerifyFace, VerifyFaceFixture)
+{
+  fibUpdater.setCompressionEnabled(true);
+  insertRoute("/a", 1, 0, 10, 0);
+
+  // /a/b on face 1 is suppressed, so the face is queried instead of sending a command
+  registerRoute("/a/b", 1);
+  BOOST_CHECK_EQUAL(fibUpdater.getCompressor()->size(), 2);
+  respondFaceQuery({ndn::nfd::FaceStatus().setFaceId(1)});
+  BOOST_CHECK(hasSucceeded);
+  BOOST_CHECK_EQUAL(failureCode, 0);
+
+  // face 1 no longer exists: the batch fails and the compressor is rolled back
+  registerRoute("/a/c", 1);
+  BOOST_CHECK_EQUAL(fibUpdater.getCompressor()->size(), 3);
+  respondFaceQuery({});
+  BOOST_CHECK(!hasSucceeded);
+  BOOST_CHECK_EQUAL(failureCode, 410);
+  BOOST_CHECK_EQUAL(fibUpdater.getCompressor()->size(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestFibUpdates
+
+} // namespace tests
+} // namespace rib
+} // namespace nfd
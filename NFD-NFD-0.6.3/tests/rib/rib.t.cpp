@@ -285,6 +285,34 @@ BOOST_AUTO_TEST_CASE(RibSignals)
   BOOST_CHECK_EQUAL(nAfterEraseEntryInvocations, 1);
 }
 
+BOOST_AUTO_TEST_CASE(Epoch)
+{
+  rib::Rib rib;
+
+  Route route;
+  route.faceId = 1;
+  route.cost = 10;
+
+  uint64_t epoch = rib.getEpoch();
+  rib.insert("/A", route);
+  BOOST_CHECK_NE(rib.getEpoch(), epoch);
+
+  // updating an existing route
+  epoch = rib.getEpoch();
+  route.cost = 20;
+  rib.insert("/A", route);
+  BOOST_CHECK_NE(rib.getEpoch(), epoch);
+
+  epoch = rib.getEpoch();
+  rib.erase("/A", route);
+  BOOST_CHECK_NE(rib.getEpoch(), epoch);
+
+  // erasing a nonexistent route
+  epoch = rib.getEpoch();
+  rib.erase("/A", route);
+  BOOST_CHECK_EQUAL(rib.getEpoch(), epoch);
+}
+
 BOOST_AUTO_TEST_CASE(Output)
 {
   rib::Rib rib;
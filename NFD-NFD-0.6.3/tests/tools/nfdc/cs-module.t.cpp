@@ -177,6 +177,16 @@ const std::string STATUS_XML = stripXmlSpaces(R"XML(
     <nEntries>16131</nEntries>
     <nHits>14363</nHits>
     <nMisses>27462</nMisses>
+    <partitions>
+      <partition>
+        <prefix>/video</prefix>
+        <capacity>1024</capacity>
+        <nEntries>1000</nEntries>
+        <nHits>312</nHits>
+        <nMisses>1708</nMisses>
+        <nEvictions>684</nEvictions>
+      </partition>
+    </partitions>
   </cs>
 )XML");
 
@@ -188,6 +198,7 @@ CS information:
   nEntries=16131
      nHits=14363
    nMisses=27462
+  partition /video capacity=1024 nEntries=1000 nHits=312 nMisses=1708 nEvictions=684
 )TEXT").substr(1);
 
 BOOST_FIXTURE_TEST_CASE(Status, StatusFixture<CsModule>)
@@ -199,7 +210,14 @@ BOOST_FIXTURE_TEST_CASE(Status, StatusFixture<CsModule>)
          .setEnableServe(false)
          .setNEntries(16131)
          .setNHits(14363)
-         .setNMisses(27462);
+         .setNMisses(27462)
+         .addPartition(ndn::nfd::CsPartition()
+                       .setPrefix("/video")
+                       .setCapacity(1024)
+                       .setNEntries(1000)
+                       .setNHits(312)
+                       .setNMisses(1708)
+                       .setNEvictions(684));
   this->sendDataset("/localhost/nfd/cs/info", payload);
   this->prepareStatusOutput();
 
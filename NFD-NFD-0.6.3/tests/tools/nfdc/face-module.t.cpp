@@ -957,6 +957,7 @@ const std::string STATUS_XML = stripXmlSpaces(R"XML(
         <incomingBytes>4672308</incomingBytes>
         <outgoingBytes>8957187</outgoingBytes>
       </byteCounters>
+      <nShedInterests>42</nShedInterests>
     </face>
   </faces>
 )XML");
@@ -969,7 +970,7 @@ const std::string STATUS_TEXT =
   "  faceid=745 remote=fd://75 local=unix:///var/run/nfd.sock"
     " congestion={base-marking-interval=100ms default-threshold=65536B} mtu=8800"
     " counters={in={18998i 26701d 147n 4672308B} out={34779i 17028d 1176n 8957187B}}"
-    " flags={local on-demand point-to-point local-fields lp-reliability congestion-marking}\n";
+    " shed=42i flags={local on-demand point-to-point local-fields lp-reliability congestion-marking}\n";
 
 BOOST_FIXTURE_TEST_CASE(Status, StatusFixture<FaceModule>)
 {
@@ -1009,7 +1010,8 @@ BOOST_FIXTURE_TEST_CASE(Status, StatusFixture<FaceModule>)
           .setNOutData(17028)
           .setNOutNacks(1176)
           .setNInBytes(4672308)
-          .setNOutBytes(8957187);
+          .setNOutBytes(8957187)
+          .setNShedInterests(42);
   this->sendDataset("/localhost/nfd/faces/list", payload1, payload2);
   this->prepareStatusOutput();
 
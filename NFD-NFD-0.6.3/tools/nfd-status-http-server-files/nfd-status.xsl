@@ -365,6 +365,32 @@
       </tr>
     </tbody>
   </table>
+  <xsl:if test="nfd:partitions">
+    <table class="item-list">
+      <thead>
+        <tr>
+          <th>Partition</th>
+          <th>Capacity</th>
+          <th>Entries</th>
+          <th>Hits</th>
+          <th>Misses</th>
+          <th>Evictions</th>
+        </tr>
+      </thead>
+      <tbody>
+        <xsl:for-each select="nfd:partitions/nfd:partition">
+        <tr>
+          <td><xsl:value-of select="nfd:prefix"/></td>
+          <td><xsl:value-of select="nfd:capacity"/></td>
+          <td><xsl:value-of select="nfd:nEntries"/></td>
+          <td><xsl:value-of select="nfd:nHits"/></td>
+          <td><xsl:value-of select="nfd:nMisses"/></td>
+          <td><xsl:value-of select="nfd:nEvictions"/></td>
+        </tr>
+        </xsl:for-each>
+      </tbody>
+    </table>
+  </xsl:if>
 </xsl:template>
 
 <xsl:template match="nfd:strategyChoices">
@@ -144,6 +144,20 @@ CsModule::formatItemXml(std::ostream& os, const CsInfo& item)
   os << "<nEntries>" << item.getNEntries() << "</nEntries>";
   os << "<nHits>" << item.getNHits() << "</nHits>";
   os << "<nMisses>" << item.getNMisses() << "</nMisses>";
+  if (!item.getPartitions().empty()) {
+    os << "<partitions>";
+    for (const ndn::nfd::CsPartition& partition : item.getPartitions()) {
+      os << "<partition>"
+         << "<prefix>" << xml::Text{partition.getPrefix().toUri()} << "</prefix>"
+         << "<capacity>" << partition.getCapacity() << "</capacity>"
+         << "<nEntries>" << partition.getNEntries() << "</nEntries>"
+         << "<nHits>" << partition.getNHits() << "</nHits>"
+         << "<nMisses>" << partition.getNMisses() << "</nMisses>"
+         << "<nEvictions>" << partition.getNEvictions() << "</nEvictions>"
+         << "</partition>";
+    }
+    os << "</partitions>";
+  }
   os << "</cs>";
 }
 
@@ -166,6 +180,17 @@ CsModule::formatItemText(std::ostream& os, const CsInfo& item)
      << ia("nHits") << item.getNHits()
      << ia("nMisses") << item.getNMisses()
      << ia.end();
+
+  for (const ndn::nfd::CsPartition& partition : item.getPartitions()) {
+    text::ItemAttributes pia;
+    os << "partition " << partition.getPrefix()
+       << ' ' << pia("capacity") << partition.getCapacity()
+       << pia("nEntries") << partition.getNEntries()
+       << pia("nHits") << partition.getNHits()
+       << pia("nMisses") << partition.getNMisses()
+       << pia("nEvictions") << partition.getNEvictions()
+       << '\n';
+  }
 }
 
 } // namespace nfdc
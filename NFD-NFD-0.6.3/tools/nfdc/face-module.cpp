@@ -442,6 +442,10 @@ FaceModule::formatItemXml(std::ostream& os, const FaceStatus& item) const
   os << "<outgoingBytes>" << item.getNOutBytes() << "</outgoingBytes>";
   os << "</byteCounters>";
 
+  if (item.getNShedInterests() > 0) {
+    os << "<nShedInterests>" << item.getNShedInterests() << "</nShedInterests>";
+  }
+
   os << "</face>";
 }
 
@@ -498,6 +502,10 @@ FaceModule::formatItemText(std::ostream& os, const FaceStatus& item, bool wantMu
      << item.getNOutNacks() << "n "
      << item.getNOutBytes() << "B}}";
 
+  if (item.getNShedInterests() > 0) {
+    os << ia("shed") << item.getNShedInterests() << "i";
+  }
+
   os << ia("flags") << '{';
   text::Separator flagSep("", " ");
   os << flagSep << item.getFaceScope();
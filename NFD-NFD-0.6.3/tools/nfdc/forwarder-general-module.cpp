@@ -88,6 +88,25 @@ ForwarderGeneralModule::formatItemXml(std::ostream& os, const ForwarderStatus& i
      << "</outgoingPackets>";
   os << "</packetCounters>";
 
+  if (item.getNShedInterests() > 0) {
+    os << "<nShedInterests>" << item.getNShedInterests() << "</nShedInterests>";
+  }
+  if (item.getNPrefetchInterests() > 0 || item.getNPrefetchBudgetExceeded() > 0) {
+    os << "<prefetchCounters>"
+       << "<nInterests>" << item.getNPrefetchInterests() << "</nInterests>"
+       << "<nUseful>" << item.getNUsefulPrefetches() << "</nUseful>"
+       << "<nWasted>" << item.getNWastedPrefetches() << "</nWasted>"
+       << "<nFailed>" << item.getNFailedPrefetches() << "</nFailed>"
+       << "<nBudgetExceeded>" << item.getNPrefetchBudgetExceeded() << "</nBudgetExceeded>"
+       << "</prefetchCounters>";
+  }
+  if (item.hasBusyTime()) {
+    os << "<busyTime>" << xml::formatDuration(item.getBusyTime()) << "</busyTime>";
+  }
+  if (item.hasIdleTime()) {
+    os << "<idleTime>" << xml::formatDuration(item.getIdleTime()) << "</idleTime>";
+  }
+
   os << "</generalStatus>";
 }
 
@@ -122,6 +141,23 @@ ForwarderGeneralModule::formatItemText(std::ostream& os, const ForwarderStatus&
      << ia("nInNacks") << item.getNInNacks()
      << ia("nOutNacks") << item.getNOutNacks();
 
+  if (item.getNShedInterests() > 0) {
+    os << ia("nShedInterests") << item.getNShedInterests();
+  }
+  if (item.getNPrefetchInterests() > 0 || item.getNPrefetchBudgetExceeded() > 0) {
+    os << ia("nPrefetchInterests") << item.getNPrefetchInterests()
+       << ia("nUsefulPrefetches") << item.getNUsefulPrefetches()
+       << ia("nWastedPrefetches") << item.getNWastedPrefetches()
+       << ia("nFailedPrefetches") << item.getNFailedPrefetches()
+       << ia("nPrefetchOverBudget") << item.getNPrefetchBudgetExceeded();
+  }
+  if (item.hasBusyTime()) {
+    os << ia("busyTime") << text::formatDuration<time::milliseconds>(item.getBusyTime());
+  }
+  if (item.hasIdleTime()) {
+    os << ia("idleTime") << text::formatDuration<time::milliseconds>(item.getIdleTime());
+  }
+
   os << ia.end();
 }
 
@@ -31,6 +31,7 @@
 #include "../lp/tags.hpp"
 #include "../mgmt/nfd/command-options.hpp"
 #include "../mgmt/nfd/controller.hpp"
+#include "../transport/shm-transport.hpp"
 #include "../transport/tcp-transport.hpp"
 #include "../transport/unix-transport.hpp"
 #include "../util/config-file.hpp"
@@ -31,9 +31,9 @@ template<typename Field, typename Tag, typename Packet>
 void
 addFieldFromTag(lp::Packet& lpPacket, const Packet& packet)
 {
-  shared_ptr<Tag> tag = static_cast<const TagHost&>(packet).getTag<Tag>();
-  if (tag != nullptr) {
-    lpPacket.add<Field>(*tag);
+  auto value = static_cast<const TagHost&>(packet).getTagValue<Tag>();
+  if (value) {
+    lpPacket.add<Field>(*value);
   }
 }
 
@@ -42,7 +42,7 @@ void
 addTagFromField(Packet& packet, const lp::Packet& lpPacket)
 {
   if (lpPacket.has<Field>()) {
-    packet.setTag(make_shared<Tag>(lpPacket.get<Field>()));
+    packet.template setTagValue<Tag>(lpPacket.get<Field>());
   }
 }
 
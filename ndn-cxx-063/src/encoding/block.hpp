@@ -440,6 +440,8 @@ protected:
    */
   mutable element_container m_elements;
 
+  friend class Name; // extends its encoding in place and keeps the parsed elements
+
   /** @brief Print @p block to @p os.
    *
    *  Default-constructed block is printed as: `[invalid]`.
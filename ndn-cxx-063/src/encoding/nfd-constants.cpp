@@ -77,6 +77,22 @@ operator<<(std::ostream& os, LinkType linkType)
   return os << static_cast<unsigned>(linkType);
 }
 
+std::ostream&
+operator<<(std::ostream& os, ArenaPageMode arenaPageMode)
+{
+  switch (arenaPageMode) {
+    case ARENA_PAGE_MODE_OFF:
+      return os << "off";
+    case ARENA_PAGE_MODE_NORMAL:
+      return os << "normal";
+    case ARENA_PAGE_MODE_TRANSPARENT:
+      return os << "transparent";
+    case ARENA_PAGE_MODE_EXPLICIT:
+      return os << "explicit";
+  }
+  return os << static_cast<unsigned>(arenaPageMode);
+}
+
 std::ostream&
 operator<<(std::ostream& os, FaceEventKind faceEventKind)
 {
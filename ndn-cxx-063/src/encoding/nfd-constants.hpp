@@ -94,6 +94,18 @@ enum CsFlagBit {
   BIT_CS_ENABLE_SERVE = 1, ///< enables the CS to satisfy Interests using cached Data
 };
 
+/** \ingroup management
+ */
+enum ArenaPageMode : uint8_t {
+  ARENA_PAGE_MODE_OFF         = 0, ///< table arena is disabled
+  ARENA_PAGE_MODE_NORMAL      = 1, ///< table arena is backed by regular pages
+  ARENA_PAGE_MODE_TRANSPARENT = 2, ///< table arena is backed by transparent huge pages
+  ARENA_PAGE_MODE_EXPLICIT    = 3, ///< table arena is backed by explicit (hugetlbfs) huge pages
+};
+
+std::ostream&
+operator<<(std::ostream& os, ArenaPageMode arenaPageMode);
+
 /** \ingroup management
  */
 enum RouteOrigin : uint16_t {
@@ -58,6 +58,8 @@ enum {
   NPitEntries          = 133,
   NMeasurementsEntries = 134,
   NCsEntries           = 135,
+  BusyTime             = 136,
+  IdleTime             = 137,
 
   // Face Management
   FaceStatus                    = 128,
@@ -75,19 +77,39 @@ enum {
   FaceEventKind                 = 193,
 
   // ForwarderStatus and FaceStatus counters
-  NInInterests  = 144,
-  NInData       = 145,
-  NInNacks      = 151,
-  NOutInterests = 146,
-  NOutData      = 147,
-  NOutNacks     = 152,
-  NInBytes      = 148,
-  NOutBytes     = 149,
+  NInInterests   = 144,
+  NInData        = 145,
+  NInNacks       = 151,
+  NOutInterests  = 146,
+  NOutData       = 147,
+  NOutNacks      = 152,
+  NInBytes       = 148,
+  NOutBytes      = 149,
+  NShedInterests = 153,
+
+  // ForwarderStatus prefetch counters
+  NPrefetchInterests      = 154,
+  NUsefulPrefetches       = 155,
+  NWastedPrefetches       = 156,
+  NFailedPrefetches       = 157,
+  NPrefetchBudgetExceeded = 158,
 
   // Content Store Management
-  CsInfo  = 128,
-  NHits   = 129,
-  NMisses = 130,
+  CsInfo      = 128,
+  NHits       = 129,
+  NMisses     = 130,
+  CsPartition = 133,
+  NEvictions  = 134,
+
+  // Table Arena
+  ArenaInfo            = 128,
+  ArenaPageMode        = 129,
+  NArenaChunks         = 130,
+  NHugePageChunks      = 131,
+  NMappedBytes         = 132,
+  NAllocatedBytes      = 133,
+  NFreeBytes           = 134,
+  NFallbackAllocations = 135,
 
   // FIB Management
   FibEntry      = 128,
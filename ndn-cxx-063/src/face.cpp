@@ -110,6 +110,7 @@ Face::makeDefaultTransport()
 {
   // transport=unix:///var/run/nfd.sock
   // transport=tcp://localhost:6363
+  // transport=shm:///var/run/nfd-shm.sock
 
   std::string transportUri;
 
@@ -138,6 +139,9 @@ Face::makeDefaultTransport()
     else if (protocol == "tcp" || protocol == "tcp4" || protocol == "tcp6") {
       return TcpTransport::create(transportUri);
     }
+    else if (protocol == "shm") {
+      return ShmTransport::create(transportUri);
+    }
     else {
       BOOST_THROW_EXCEPTION(ConfigFile::Error("Unsupported transport protocol \"" + protocol + "\""));
     }
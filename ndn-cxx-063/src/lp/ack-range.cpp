@@ -0,0 +1,123 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2018 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ack-range.hpp"
+#include "../encoding/block-helpers.hpp"
+
+#include <boost/endian/conversion.hpp>
+
+namespace ndn {
+namespace lp {
+
+AckRange::AckRange()
+  : m_first(0)
+  , m_nAdditional(0)
+{
+}
+
+AckRange::AckRange(Sequence first, Sequence last)
+{
+  setRange(first, last);
+}
+
+AckRange::AckRange(const Block& block)
+{
+  wireDecode(block);
+}
+
+template<encoding::Tag TAG>
+size_t
+AckRange::wireEncode(EncodingImpl<TAG>& encoder) const
+{
+  uint64_t first = boost::endian::native_to_big(m_first);
+
+  size_t length = 0;
+  length += encoder.prependNonNegativeInteger(m_nAdditional);
+  length += encoder.prependByteArray(reinterpret_cast<const uint8_t*>(&first), sizeof(first));
+  length += encoder.prependVarNumber(length);
+  length += encoder.prependVarNumber(tlv::AckRange);
+  return length;
+}
+
+NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(AckRange);
+
+Block
+AckRange::wireEncode() const
+{
+  EncodingEstimator estimator;
+  size_t estimatedSize = wireEncode(estimator);
+
+  EncodingBuffer buffer(estimatedSize, 0);
+  wireEncode(buffer);
+
+  return buffer.block();
+}
+
+void
+AckRange::wireDecode(const Block& wire)
+{
+  if (wire.type() != tlv::AckRange) {
+    BOOST_THROW_EXCEPTION(Error("expecting AckRange block"));
+  }
+
+  size_t countSize = wire.value_size() > sizeof(Sequence) ? wire.value_size() - sizeof(Sequence) : 0;
+  if (countSize != 1 && countSize != 2 && countSize != 4 && countSize != 8) {
+    BOOST_THROW_EXCEPTION(Error("AckRange has invalid TLV-LENGTH " + to_string(wire.value_size())));
+  }
+
+  Sequence first;
+  std::memcpy(&first, wire.value(), sizeof(first));
+  m_first = boost::endian::big_to_native(first);
+
+  auto begin = wire.value_begin() + sizeof(Sequence);
+  m_nAdditional = ndn::tlv::readNonNegativeInteger(countSize, begin, wire.value_end());
+}
+
+AckRange&
+AckRange::setRange(Sequence first, Sequence last)
+{
+  m_first = first;
+  m_nAdditional = last - first;
+  return *this;
+}
+
+size_t
+AckRange::estimateSize(uint64_t nSequences)
+{
+  BOOST_ASSERT(nSequences > 0);
+  size_t valueSize = sizeof(Sequence) + ndn::tlv::sizeOfNonNegativeInteger(nSequences - 1);
+  return ndn::tlv::sizeOfVarNumber(tlv::AckRange) + ndn::tlv::sizeOfVarNumber(valueSize) + valueSize;
+}
+
+bool
+operator==(const AckRange& lhs, const AckRange& rhs)
+{
+  return lhs.getFirst() == rhs.getFirst() && lhs.getLast() == rhs.getLast();
+}
+
+std::ostream&
+operator<<(std::ostream& os, const AckRange& range)
+{
+  return os << '[' << range.getFirst() << ',' << range.getLast() << ']';
+}
+
+} // namespace lp
+} // namespace ndn
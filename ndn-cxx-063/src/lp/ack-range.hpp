@@ -0,0 +1,138 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2018 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_LP_ACK_RANGE_HPP
+#define NDN_CXX_LP_ACK_RANGE_HPP
+
+#include "sequence.hpp"
+#include "tlv.hpp"
+#include "../encoding/encoding-buffer.hpp"
+
+namespace ndn {
+namespace lp {
+
+/**
+ * \brief represents an AckRange header field
+ *
+ * An AckRange acknowledges every TxSequence from getFirst() to getLast(), inclusive.
+ * Its TLV-VALUE is the first TxSequence as an 8-octet unsigned integer, followed by
+ * the number of additional TxSequences as a NonNegativeInteger. A run of consecutive
+ * TxSequences therefore costs about as much as a single Ack field.
+ *
+ * The TLV-TYPE of AckRange is ignorable, so a sender must not rely on AckRange fields
+ * unless it knows the peer understands them.
+ */
+class AckRange
+{
+public:
+  class Error : public ndn::tlv::Error
+  {
+  public:
+    using ndn::tlv::Error::Error;
+  };
+
+  AckRange();
+
+  /**
+   * \pre first <= last, allowing for wraparound
+   */
+  AckRange(Sequence first, Sequence last);
+
+  explicit
+  AckRange(const Block& block);
+
+  /**
+   * \brief prepend AckRange to encoder
+   */
+  template<encoding::Tag TAG>
+  size_t
+  wireEncode(EncodingImpl<TAG>& encoder) const;
+
+  /**
+   * \brief encode AckRange into wire format
+   */
+  Block
+  wireEncode() const;
+
+  /**
+   * \brief decode AckRange from wire format
+   */
+  void
+  wireDecode(const Block& wire);
+
+public: // range
+  Sequence
+  getFirst() const
+  {
+    return m_first;
+  }
+
+  Sequence
+  getLast() const
+  {
+    return m_first + m_nAdditional;
+  }
+
+  /**
+   * \return number of TxSequences acknowledged by this range
+   * \note returns 0 if the range covers the whole sequence space
+   */
+  uint64_t
+  size() const
+  {
+    return m_nAdditional + 1;
+  }
+
+  /**
+   * \brief set the acknowledged range to [first, last], allowing for wraparound
+   */
+  AckRange&
+  setRange(Sequence first, Sequence last);
+
+  /**
+   * \brief estimate the encoded size of an AckRange covering \p nSequences TxSequences
+   */
+  static size_t
+  estimateSize(uint64_t nSequences);
+
+private:
+  Sequence m_first;
+  uint64_t m_nAdditional; ///< getLast() - getFirst()
+};
+
+NDN_CXX_DECLARE_WIRE_ENCODE_INSTANTIATIONS(AckRange);
+
+bool
+operator==(const AckRange& lhs, const AckRange& rhs);
+
+inline bool
+operator!=(const AckRange& lhs, const AckRange& rhs)
+{
+  return !(lhs == rhs);
+}
+
+std::ostream&
+operator<<(std::ostream& os, const AckRange& range);
+
+} // namespace lp
+} // namespace ndn
+
+#endif // NDN_CXX_LP_ACK_RANGE_HPP
@@ -24,6 +24,7 @@
 
 #include "field-decl.hpp"
 
+#include "ack-range.hpp"
 #include "cache-policy.hpp"
 #include "nack-header.hpp"
 #include "prefix-announcement-header.hpp"
@@ -109,6 +110,12 @@ typedef FieldDecl<field_location_tags::Header,
                   tlv::PrefixAnnouncement> PrefixAnnouncementField;
 BOOST_CONCEPT_ASSERT((Field<PrefixAnnouncementField>));
 
+typedef FieldDecl<field_location_tags::Header,
+                  AckRange,
+                  tlv::AckRange,
+                  true> AckRangeField;
+BOOST_CONCEPT_ASSERT((Field<AckRangeField>));
+
 /** \brief Declare the Fragment field.
  *
  *  The fragment (i.e. payload) is the bytes between two provided iterators. During encoding,
@@ -134,7 +141,8 @@ typedef boost::mpl::set<
   AckField,
   TxSequenceField,
   NonDiscoveryField,
-  PrefixAnnouncementField
+  PrefixAnnouncementField,
+  AckRangeField
   > FieldSet;
 
 } // namespace lp
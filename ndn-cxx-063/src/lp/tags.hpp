@@ -73,6 +73,33 @@ typedef SimpleTag<EmptyValue, 14> NonDiscoveryTag;
 typedef SimpleTag<PrefixAnnouncementHeader, 15> PrefixAnnouncementTag;
 
 } // namespace lp
+
+namespace detail {
+
+// The tags below are set on nearly every packet in a forwarder,
+// so they are stored by value in TagHost instead of in its map.
+
+template<>
+struct InlineTagSlot<lp::IncomingFaceIdTag> : std::integral_constant<int, 0>
+{
+};
+
+template<>
+struct InlineTagSlot<lp::NextHopFaceIdTag> : std::integral_constant<int, 1>
+{
+};
+
+template<>
+struct InlineTagSlot<lp::CongestionMarkTag> : std::integral_constant<int, 2>
+{
+};
+
+template<>
+struct InlineTagSlot<lp::NonDiscoveryTag> : std::integral_constant<int, 3>
+{
+};
+
+} // namespace detail
 } // namespace ndn
 
 #endif // NDN_CXX_LP_TAGS_HPP
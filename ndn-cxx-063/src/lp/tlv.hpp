@@ -46,6 +46,7 @@ enum {
   TxSequence = 840,
   NonDiscovery = 844,
   PrefixAnnouncement = 848,
+  AckRange = 852,
 };
 
 enum {
@@ -30,6 +30,9 @@ namespace mgmt {
 
 const time::milliseconds DEFAULT_FRESHNESS_PERIOD = 1_s;
 
+// maximum number of retained StatusDataset responses, see Dispatcher::addStatusDataset
+const size_t MAX_SIGNED_DATASETS = 64;
+
 Authorization
 makeAcceptAllAuthorization()
 {
@@ -154,7 +157,7 @@ Dispatcher::queryStorage(const Name& prefix, const Interest& interest,
   }
 }
 
-void
+shared_ptr<Data>
 Dispatcher::sendData(const Name& dataName, const Block& content, const MetaInfo& metaInfo,
                      SendDestination option, time::milliseconds imsFresh)
 {
@@ -173,6 +176,8 @@ Dispatcher::sendData(const Name& dataName, const Block& content, const MetaInfo&
   if (option == SendDestination::FACE || option == SendDestination::FACE_AND_IMS) {
     sendOnFace(*data);
   }
+
+  return data;
 }
 
 void
@@ -245,7 +250,8 @@ Dispatcher::sendControlResponse(const ControlResponse& resp, const Interest& int
 void
 Dispatcher::addStatusDataset(const PartialName& relPrefix,
                              Authorization authorize,
-                             StatusDatasetHandler handle)
+                             StatusDatasetHandler handle,
+                             StatusDatasetEpoch epoch)
 {
   if (!m_topLevelPrefixes.empty()) {
     BOOST_THROW_EXCEPTION(std::domain_error("one or more top-level prefix has been added"));
@@ -256,7 +262,8 @@ Dispatcher::addStatusDataset(const PartialName& relPrefix,
   }
 
   AuthorizationAcceptedCallback accepted =
-    bind(&Dispatcher::processAuthorizedStatusDatasetInterest, this, _1, _2, _3, std::move(handle));
+    bind(&Dispatcher::processAuthorizedStatusDatasetInterest, this, _1, _2, _3,
+         std::move(handle), std::move(epoch));
   AuthorizationRejectedCallback rejected =
     bind(&Dispatcher::afterAuthorizationRejected, this, _1, _2);
 
@@ -292,15 +299,49 @@ void
 Dispatcher::processAuthorizedStatusDatasetInterest(const std::string& requester,
                                                    const Name& prefix,
                                                    const Interest& interest,
-                                                   const StatusDatasetHandler& handler)
+                                                   const StatusDatasetHandler& handler,
+                                                   const StatusDatasetEpoch& epoch)
 {
-  StatusDatasetContext context(interest,
-                               bind(&Dispatcher::sendStatusDatasetSegment, this, _1, _2, _3, _4),
+  if (epoch == nullptr) {
+    StatusDatasetContext context(interest,
+                                 bind(&Dispatcher::sendStatusDatasetSegment, this, _1, _2, _3, _4),
+                                 bind(&Dispatcher::sendControlResponse, this, _1, interest, true));
+    handler(prefix, interest, context);
+    return;
+  }
+
+  uint64_t currentEpoch = epoch();
+  auto it = m_signedDatasets.find(interest.getName());
+  if (it != m_signedDatasets.end() && it->second.epoch == currentEpoch) {
+    resendStatusDataset(it->second.segments, it->second.imsFresh);
+    return;
+  }
+
+  // collect the signed segments, and retain them once the response is complete
+  auto response = make_shared<SignedStatusDataset>();
+  response->epoch = currentEpoch;
+  Name requestName = interest.getName();
+  auto dataSender = [this, response, requestName] (const Name& dataName, const Block& content,
+                                                   time::milliseconds imsFresh, bool isFinalBlock) {
+    response->imsFresh = imsFresh;
+    response->segments.push_back(sendStatusDatasetSegment(dataName, content, imsFresh, isFinalBlock));
+    if (!isFinalBlock) {
+      return;
+    }
+
+    if (m_signedDatasets.size() >= MAX_SIGNED_DATASETS &&
+        m_signedDatasets.count(requestName) == 0) {
+      m_signedDatasets.erase(m_signedDatasets.begin());
+    }
+    m_signedDatasets[requestName] = std::move(*response);
+  };
+
+  StatusDatasetContext context(interest, dataSender,
                                bind(&Dispatcher::sendControlResponse, this, _1, interest, true));
   handler(prefix, interest, context);
 }
 
-void
+shared_ptr<Data>
 Dispatcher::sendStatusDatasetSegment(const Name& dataName, const Block& content,
                                      time::milliseconds imsFresh, bool isFinalBlock)
 {
@@ -316,7 +357,22 @@ Dispatcher::sendStatusDatasetSegment(const Name& dataName, const Block& content,
     metaInfo.setFinalBlock(dataName[-1]);
   }
 
-  sendData(dataName, content, metaInfo, destination, imsFresh);
+  return sendData(dataName, content, metaInfo, destination, imsFresh);
+}
+
+void
+Dispatcher::resendStatusDataset(const std::vector<shared_ptr<Data>>& segments,
+                                time::milliseconds imsFresh)
+{
+  for (const auto& segment : segments) {
+    // an identical packet left in the storage may already be stale, replace it
+    m_storage.erase(segment->getFullName(), false);
+    m_storage.insert(*segment, imsFresh);
+  }
+
+  if (!segments.empty()) {
+    sendOnFace(*segments.front());
+  }
 }
 
 PostNotification
@@ -117,6 +117,14 @@ typedef std::function<void(const Name& prefix, const Interest& interest,
 typedef std::function<void(const Name& prefix, const Interest& interest,
                            StatusDatasetContext& context)> StatusDatasetHandler;
 
+/** \brief a function that returns the current epoch of a StatusDataset
+ *
+ *  The returned value must change whenever StatusDatasetHandler would generate a different
+ *  response.  While it stays the same, the signed segments of the previous response are served
+ *  again, without invoking StatusDatasetHandler, encoding, or signing.
+ */
+typedef std::function<uint64_t()> StatusDatasetEpoch;
+
 //---- NOTIFICATION STREAM ----
 
 /** \brief a function to post a notification
@@ -220,6 +228,8 @@ public: // StatusDataset
    *                   non-overlapping (no relPrefix is a prefix of another relPrefix)
    *  \param authorize should set identity to Name() if the dataset is public
    *  \param handle Callback to process the incoming dataset requests
+   *  \param epoch Callback to obtain the current epoch of the dataset; if empty, every request
+   *               that misses the in-memory storage invokes \p handle
    *  \pre no top-level prefix has been added
    *  \throw std::out_of_range \p relPrefix overlaps with an existing relPrefix
    *  \throw std::domain_error one or more top-level prefix has been added
@@ -243,11 +253,16 @@ public: // StatusDataset
    *
    *  As an optimization, a Data packet may be sent as soon as enough octets have been collected
    *  through StatusDatasetAppend calls.
+   *
+   *  If \p epoch is given, the signed Data packets of a complete response are retained together
+   *  with the epoch at the time of the request.  Step 3 to 7 are skipped for a later request
+   *  with the same Name while the epoch is unchanged, and the retained packets are sent again.
    */
   void
   addStatusDataset(const PartialName& relPrefix,
                    Authorization authorize,
-                   StatusDatasetHandler handle);
+                   StatusDatasetHandler handle,
+                   StatusDatasetEpoch epoch = nullptr);
 
 public: // NotificationStream
   /** \brief register a NotificationStream
@@ -337,8 +352,9 @@ private:
    * @param metaInfo some meta information of this piece of data
    * @param destination where to send this piece of data
    * @param imsFresh freshness period of this piece of data in in-memory storage
+   * @return the signed Data packet
    */
-  void
+  shared_ptr<Data>
   sendData(const Name& dataName, const Block& content, const MetaInfo& metaInfo,
            SendDestination destination, time::milliseconds imsFresh);
 
@@ -414,12 +430,14 @@ private:
    * @param prefix the top-level prefix
    * @param interest the incoming Interest
    * @param handler to process this request
+   * @param epoch to obtain the current epoch of the dataset, may be empty
    */
   void
   processAuthorizedStatusDatasetInterest(const std::string& requester,
                                          const Name& prefix,
                                          const Interest& interest,
-                                         const StatusDatasetHandler& handler);
+                                         const StatusDatasetHandler& handler,
+                                         const StatusDatasetEpoch& epoch);
 
   /**
    * @brief send a segment of StatusDataset
@@ -428,11 +446,21 @@ private:
    * @param content the content of this piece of data
    * @param imsFresh the freshness period of this piece of data in the in-memory storage
    * @param isFinalBlock indicates whether this piece of data is the final block
+   * @return the signed segment
    */
-  void
+  shared_ptr<Data>
   sendStatusDatasetSegment(const Name& dataName, const Block& content,
                            time::milliseconds imsFresh, bool isFinalBlock);
 
+  /**
+   * @brief send again the segments of a previously generated StatusDataset response
+   *
+   * The first segment is sent through the face, and all segments are (re)inserted into
+   * the in-memory storage so that the remaining segments can be retrieved.
+   */
+  void
+  resendStatusDataset(const std::vector<shared_ptr<Data>>& segments, time::milliseconds imsFresh);
+
   void
   postNotification(const Block& notification, const PartialName& relPrefix);
 
@@ -454,8 +482,20 @@ private:
   // NotificationStream name => next sequence number
   std::unordered_map<Name, uint64_t> m_streams;
 
+  /** \brief signed response of a StatusDataset that declares an epoch
+   */
+  struct SignedStatusDataset
+  {
+    uint64_t epoch;
+    time::milliseconds imsFresh;
+    std::vector<shared_ptr<Data>> segments;
+  };
+
 NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   InMemoryStorageFifo m_storage;
+
+  // StatusDataset request name => signed response
+  std::unordered_map<Name, SignedStatusDataset> m_signedDatasets;
 };
 
 template<typename CP>
@@ -0,0 +1,196 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2018 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "arena-info.hpp"
+#include "encoding/block-helpers.hpp"
+#include "encoding/encoding-buffer.hpp"
+#include "encoding/tlv-nfd.hpp"
+#include "util/concepts.hpp"
+
+namespace ndn {
+namespace nfd {
+
+BOOST_CONCEPT_ASSERT((StatusDatasetItem<ArenaInfo>));
+
+ArenaInfo::ArenaInfo()
+  : m_pageMode(ARENA_PAGE_MODE_OFF)
+  , m_nChunks(0)
+  , m_nHugePageChunks(0)
+  , m_nMappedBytes(0)
+  , m_nAllocatedBytes(0)
+  , m_nFreeBytes(0)
+  , m_nFallbackAllocations(0)
+{
+}
+
+ArenaInfo::ArenaInfo(const Block& block)
+{
+  this->wireDecode(block);
+}
+
+template<encoding::Tag TAG>
+size_t
+ArenaInfo::wireEncode(EncodingImpl<TAG>& encoder) const
+{
+  size_t totalLength = 0;
+
+  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NFallbackAllocations,
+                                                m_nFallbackAllocations);
+  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NFreeBytes, m_nFreeBytes);
+  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NAllocatedBytes, m_nAllocatedBytes);
+  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NMappedBytes, m_nMappedBytes);
+  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NHugePageChunks, m_nHugePageChunks);
+  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NArenaChunks, m_nChunks);
+  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::ArenaPageMode, m_pageMode);
+
+  totalLength += encoder.prependVarNumber(totalLength);
+  totalLength += encoder.prependVarNumber(tlv::nfd::ArenaInfo);
+  return totalLength;
+}
+
+NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(ArenaInfo);
+
+const Block&
+ArenaInfo::wireEncode() const
+{
+  if (m_wire.hasWire())
+    return m_wire;
+
+  EncodingEstimator estimator;
+  size_t estimatedSize = wireEncode(estimator);
+
+  EncodingBuffer buffer(estimatedSize, 0);
+  wireEncode(buffer);
+
+  m_wire = buffer.block();
+  return m_wire;
+}
+
+static uint64_t
+decodeRequiredField(Block::element_const_iterator& val, Block::element_const_iterator end,
+                    uint32_t type, const std::string& fieldName)
+{
+  if (val == end || val->type() != type) {
+    BOOST_THROW_EXCEPTION(ArenaInfo::Error("missing required " + fieldName + " field"));
+  }
+  return readNonNegativeInteger(*val++);
+}
+
+void
+ArenaInfo::wireDecode(const Block& block)
+{
+  if (block.type() != tlv::nfd::ArenaInfo) {
+    BOOST_THROW_EXCEPTION(Error("expecting ArenaInfo block, got " + to_string(block.type())));
+  }
+  m_wire = block;
+  m_wire.parse();
+  auto val = m_wire.elements_begin();
+  auto end = m_wire.elements_end();
+
+  m_pageMode = static_cast<ArenaPageMode>(decodeRequiredField(val, end, tlv::nfd::ArenaPageMode,
+                                                              "ArenaPageMode"));
+  m_nChunks = decodeRequiredField(val, end, tlv::nfd::NArenaChunks, "NArenaChunks");
+  m_nHugePageChunks = decodeRequiredField(val, end, tlv::nfd::NHugePageChunks, "NHugePageChunks");
+  m_nMappedBytes = decodeRequiredField(val, end, tlv::nfd::NMappedBytes, "NMappedBytes");
+  m_nAllocatedBytes = decodeRequiredField(val, end, tlv::nfd::NAllocatedBytes, "NAllocatedBytes");
+  m_nFreeBytes = decodeRequiredField(val, end, tlv::nfd::NFreeBytes, "NFreeBytes");
+  m_nFallbackAllocations = decodeRequiredField(val, end, tlv::nfd::NFallbackAllocations,
+                                               "NFallbackAllocations");
+}
+
+ArenaInfo&
+ArenaInfo::setPageMode(ArenaPageMode pageMode)
+{
+  m_wire.reset();
+  m_pageMode = pageMode;
+  return *this;
+}
+
+ArenaInfo&
+ArenaInfo::setNChunks(uint64_t nChunks)
+{
+  m_wire.reset();
+  m_nChunks = nChunks;
+  return *this;
+}
+
+ArenaInfo&
+ArenaInfo::setNHugePageChunks(uint64_t nHugePageChunks)
+{
+  m_wire.reset();
+  m_nHugePageChunks = nHugePageChunks;
+  return *this;
+}
+
+ArenaInfo&
+ArenaInfo::setNMappedBytes(uint64_t nMappedBytes)
+{
+  m_wire.reset();
+  m_nMappedBytes = nMappedBytes;
+  return *this;
+}
+
+ArenaInfo&
+ArenaInfo::setNAllocatedBytes(uint64_t nAllocatedBytes)
+{
+  m_wire.reset();
+  m_nAllocatedBytes = nAllocatedBytes;
+  return *this;
+}
+
+ArenaInfo&
+ArenaInfo::setNFreeBytes(uint64_t nFreeBytes)
+{
+  m_wire.reset();
+  m_nFreeBytes = nFreeBytes;
+  return *this;
+}
+
+ArenaInfo&
+ArenaInfo::setNFallbackAllocations(uint64_t nFallbackAllocations)
+{
+  m_wire.reset();
+  m_nFallbackAllocations = nFallbackAllocations;
+  return *this;
+}
+
+bool
+operator==(const ArenaInfo& a, const ArenaInfo& b)
+{
+  return a.wireEncode() == b.wireEncode();
+}
+
+std::ostream&
+operator<<(std::ostream& os, const ArenaInfo& ai)
+{
+  os << "Arena: " << ai.getPageMode() << ", "
+     << ai.getNChunks() << (ai.getNChunks() == 1 ? " chunk (" : " chunks (")
+     << ai.getNHugePageChunks() << " huge), "
+     << ai.getNMappedBytes() << " mapped, "
+     << ai.getNAllocatedBytes() << " allocated, "
+     << ai.getNFreeBytes() << " free, "
+     << ai.getNFallbackAllocations()
+     << (ai.getNFallbackAllocations() == 1 ? " fallback allocation" : " fallback allocations");
+  return os;
+}
+
+} // namespace nfd
+} // namespace ndn
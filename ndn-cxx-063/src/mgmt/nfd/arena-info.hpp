@@ -0,0 +1,166 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2018 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_MGMT_NFD_ARENA_INFO_HPP
+#define NDN_MGMT_NFD_ARENA_INFO_HPP
+
+#include "../../encoding/block.hpp"
+#include "../../encoding/nfd-constants.hpp"
+
+namespace ndn {
+namespace nfd {
+
+/** \ingroup management
+ *  \brief represents the Table Arena dataset
+ *
+ *  The table arena is the memory pool from which NFD allocates NameTree nodes,
+ *  PIT entries, and CS entries.
+ */
+class ArenaInfo
+{
+public:
+  class Error : public tlv::Error
+  {
+  public:
+    using tlv::Error::Error;
+  };
+
+  ArenaInfo();
+
+  explicit
+  ArenaInfo(const Block& block);
+
+  template<encoding::Tag TAG>
+  size_t
+  wireEncode(EncodingImpl<TAG>& encoder) const;
+
+  const Block&
+  wireEncode() const;
+
+  void
+  wireDecode(const Block& wire);
+
+  /** \brief get the kind of pages backing the arena
+   */
+  ArenaPageMode
+  getPageMode() const
+  {
+    return m_pageMode;
+  }
+
+  ArenaInfo&
+  setPageMode(ArenaPageMode pageMode);
+
+  /** \brief get number of chunks mapped by the arena
+   */
+  uint64_t
+  getNChunks() const
+  {
+    return m_nChunks;
+  }
+
+  ArenaInfo&
+  setNChunks(uint64_t nChunks);
+
+  /** \brief get number of chunks that were mapped with huge pages
+   */
+  uint64_t
+  getNHugePageChunks() const
+  {
+    return m_nHugePageChunks;
+  }
+
+  ArenaInfo&
+  setNHugePageChunks(uint64_t nHugePageChunks);
+
+  /** \brief get number of octets mapped by the arena
+   */
+  uint64_t
+  getNMappedBytes() const
+  {
+    return m_nMappedBytes;
+  }
+
+  ArenaInfo&
+  setNMappedBytes(uint64_t nMappedBytes);
+
+  /** \brief get number of octets handed out to table entries
+   */
+  uint64_t
+  getNAllocatedBytes() const
+  {
+    return m_nAllocatedBytes;
+  }
+
+  ArenaInfo&
+  setNAllocatedBytes(uint64_t nAllocatedBytes);
+
+  /** \brief get number of octets that were released and are held for reuse
+   */
+  uint64_t
+  getNFreeBytes() const
+  {
+    return m_nFreeBytes;
+  }
+
+  ArenaInfo&
+  setNFreeBytes(uint64_t nFreeBytes);
+
+  /** \brief get number of allocations served by the general heap instead of the arena
+   */
+  uint64_t
+  getNFallbackAllocations() const
+  {
+    return m_nFallbackAllocations;
+  }
+
+  ArenaInfo&
+  setNFallbackAllocations(uint64_t nFallbackAllocations);
+
+private:
+  ArenaPageMode m_pageMode;
+  uint64_t m_nChunks;
+  uint64_t m_nHugePageChunks;
+  uint64_t m_nMappedBytes;
+  uint64_t m_nAllocatedBytes;
+  uint64_t m_nFreeBytes;
+  uint64_t m_nFallbackAllocations;
+  mutable Block m_wire;
+};
+
+NDN_CXX_DECLARE_WIRE_ENCODE_INSTANTIATIONS(ArenaInfo);
+
+bool
+operator==(const ArenaInfo& a, const ArenaInfo& b);
+
+inline bool
+operator!=(const ArenaInfo& a, const ArenaInfo& b)
+{
+  return !(a == b);
+}
+
+std::ostream&
+operator<<(std::ostream& os, const ArenaInfo& ai);
+
+} // namespace nfd
+} // namespace ndn
+
+#endif // NDN_MGMT_NFD_ARENA_INFO_HPP
@@ -30,6 +30,182 @@ namespace nfd {
 
 BOOST_CONCEPT_ASSERT((StatusDatasetItem<CsInfo>));
 
+CsPartition::CsPartition()
+  : m_capacity(0)
+  , m_nEntries(0)
+  , m_nHits(0)
+  , m_nMisses(0)
+  , m_nEvictions(0)
+{
+}
+
+CsPartition::CsPartition(const Block& block)
+{
+  this->wireDecode(block);
+}
+
+template<encoding::Tag TAG>
+size_t
+CsPartition::wireEncode(EncodingImpl<TAG>& encoder) const
+{
+  size_t totalLength = 0;
+
+  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NEvictions, m_nEvictions);
+  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NMisses, m_nMisses);
+  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NHits, m_nHits);
+  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NCsEntries, m_nEntries);
+  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::Capacity, m_capacity);
+  totalLength += m_prefix.wireEncode(encoder);
+
+  totalLength += encoder.prependVarNumber(totalLength);
+  totalLength += encoder.prependVarNumber(tlv::nfd::CsPartition);
+  return totalLength;
+}
+
+NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(CsPartition);
+
+const Block&
+CsPartition::wireEncode() const
+{
+  if (m_wire.hasWire())
+    return m_wire;
+
+  EncodingEstimator estimator;
+  size_t estimatedSize = wireEncode(estimator);
+
+  EncodingBuffer buffer(estimatedSize, 0);
+  wireEncode(buffer);
+
+  m_wire = buffer.block();
+  return m_wire;
+}
+
+void
+CsPartition::wireDecode(const Block& block)
+{
+  if (block.type() != tlv::nfd::CsPartition) {
+    BOOST_THROW_EXCEPTION(Error("expecting CsPartition block, got " + to_string(block.type())));
+  }
+  m_wire = block;
+  m_wire.parse();
+  auto val = m_wire.elements_begin();
+
+  if (val != m_wire.elements_end() && val->type() == tlv::Name) {
+    m_prefix.wireDecode(*val);
+    ++val;
+  }
+  else {
+    BOOST_THROW_EXCEPTION(Error("missing required Name field"));
+  }
+
+  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Capacity) {
+    m_capacity = readNonNegativeInteger(*val);
+    ++val;
+  }
+  else {
+    BOOST_THROW_EXCEPTION(Error("missing required Capacity field"));
+  }
+
+  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NCsEntries) {
+    m_nEntries = readNonNegativeInteger(*val);
+    ++val;
+  }
+  else {
+    BOOST_THROW_EXCEPTION(Error("missing required NCsEntries field"));
+  }
+
+  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NHits) {
+    m_nHits = readNonNegativeInteger(*val);
+    ++val;
+  }
+  else {
+    BOOST_THROW_EXCEPTION(Error("missing required NHits field"));
+  }
+
+  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NMisses) {
+    m_nMisses = readNonNegativeInteger(*val);
+    ++val;
+  }
+  else {
+    BOOST_THROW_EXCEPTION(Error("missing required NMisses field"));
+  }
+
+  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NEvictions) {
+    m_nEvictions = readNonNegativeInteger(*val);
+    ++val;
+  }
+  else {
+    BOOST_THROW_EXCEPTION(Error("missing required NEvictions field"));
+  }
+}
+
+CsPartition&
+CsPartition::setPrefix(const Name& prefix)
+{
+  m_wire.reset();
+  m_prefix = prefix;
+  return *this;
+}
+
+CsPartition&
+CsPartition::setCapacity(uint64_t capacity)
+{
+  m_wire.reset();
+  m_capacity = capacity;
+  return *this;
+}
+
+CsPartition&
+CsPartition::setNEntries(uint64_t nEntries)
+{
+  m_wire.reset();
+  m_nEntries = nEntries;
+  return *this;
+}
+
+CsPartition&
+CsPartition::setNHits(uint64_t nHits)
+{
+  m_wire.reset();
+  m_nHits = nHits;
+  return *this;
+}
+
+CsPartition&
+CsPartition::setNMisses(uint64_t nMisses)
+{
+  m_wire.reset();
+  m_nMisses = nMisses;
+  return *this;
+}
+
+CsPartition&
+CsPartition::setNEvictions(uint64_t nEvictions)
+{
+  m_wire.reset();
+  m_nEvictions = nEvictions;
+  return *this;
+}
+
+bool
+operator==(const CsPartition& a, const CsPartition& b)
+{
+  return a.wireEncode() == b.wireEncode();
+}
+
+std::ostream&
+operator<<(std::ostream& os, const CsPartition& partition)
+{
+  os << partition.getPrefix() << ": "
+     << partition.getNEntries() << " entries, " << partition.getCapacity() << " max, "
+     << partition.getNHits() << (partition.getNHits() == 1 ? " hit, " : " hits, ")
+     << partition.getNMisses() << (partition.getNMisses() == 1 ? " miss, " : " misses, ")
+     << partition.getNEvictions() << (partition.getNEvictions() == 1 ? " eviction" : " evictions");
+  return os;
+}
+
+////////////////////
+
 CsInfo::CsInfo()
   : m_capacity(0)
   , m_nEntries(0)
@@ -49,6 +225,9 @@ CsInfo::wireEncode(EncodingImpl<TAG>& encoder) const
 {
   size_t totalLength = 0;
 
+  for (auto it = m_partitions.rbegin(); it != m_partitions.rend(); ++it) {
+    totalLength += it->wireEncode(encoder);
+  }
   totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NMisses, m_nMisses);
   totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NHits, m_nHits);
   totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NCsEntries, m_nEntries);
@@ -127,6 +306,11 @@ CsInfo::wireDecode(const Block& block)
   else {
     BOOST_THROW_EXCEPTION(Error("missing required NMisses field"));
   }
+
+  m_partitions.clear();
+  for (; val != m_wire.elements_end() && val->type() == tlv::nfd::CsPartition; ++val) {
+    m_partitions.emplace_back(*val);
+  }
 }
 
 CsInfo&
@@ -177,6 +361,22 @@ CsInfo::setNMisses(uint64_t nMisses)
   return *this;
 }
 
+CsInfo&
+CsInfo::addPartition(const CsPartition& partition)
+{
+  m_wire.reset();
+  m_partitions.push_back(partition);
+  return *this;
+}
+
+CsInfo&
+CsInfo::clearPartitions()
+{
+  m_wire.reset();
+  m_partitions.clear();
+  return *this;
+}
+
 bool
 operator==(const CsInfo& a, const CsInfo& b)
 {
@@ -192,6 +392,9 @@ operator<<(std::ostream& os, const CsInfo& csi)
      << (csi.getEnableServe() ? "serve enabled, " : "serve disabled, ")
      << csi.getNHits() << (csi.getNHits() == 1 ? " hit, " : " hits, ")
      << csi.getNMisses() << (csi.getNMisses() == 1 ? " miss" : " misses");
+  for (const CsPartition& partition : csi.getPartitions()) {
+    os << "\n  " << partition;
+  }
   return os;
 }
 
@@ -24,12 +24,132 @@
 
 #include "../../encoding/block.hpp"
 #include "../../encoding/nfd-constants.hpp"
+#include "../../name.hpp"
 
 #include <bitset>
 
 namespace ndn {
 namespace nfd {
 
+/** \ingroup management
+ *  \brief represents a CS partition in the CS Information dataset
+ *
+ *  A partition holds Data under a name prefix, with its own capacity and replacement policy.
+ */
+class CsPartition
+{
+public:
+  class Error : public tlv::Error
+  {
+  public:
+    using tlv::Error::Error;
+  };
+
+  CsPartition();
+
+  explicit
+  CsPartition(const Block& block);
+
+  template<encoding::Tag TAG>
+  size_t
+  wireEncode(EncodingImpl<TAG>& encoder) const;
+
+  const Block&
+  wireEncode() const;
+
+  void
+  wireDecode(const Block& wire);
+
+  /** \brief get name prefix of the partition
+   */
+  const Name&
+  getPrefix() const
+  {
+    return m_prefix;
+  }
+
+  CsPartition&
+  setPrefix(const Name& prefix);
+
+  /** \brief get partition capacity (in number of packets)
+   */
+  uint64_t
+  getCapacity() const
+  {
+    return m_capacity;
+  }
+
+  CsPartition&
+  setCapacity(uint64_t capacity);
+
+  /** \brief get number of CS entries stored in the partition
+   */
+  uint64_t
+  getNEntries() const
+  {
+    return m_nEntries;
+  }
+
+  CsPartition&
+  setNEntries(uint64_t nEntries);
+
+  /** \brief get number of lookup hits in the partition
+   */
+  uint64_t
+  getNHits() const
+  {
+    return m_nHits;
+  }
+
+  CsPartition&
+  setNHits(uint64_t nHits);
+
+  /** \brief get number of lookup misses in the partition
+   */
+  uint64_t
+  getNMisses() const
+  {
+    return m_nMisses;
+  }
+
+  CsPartition&
+  setNMisses(uint64_t nMisses);
+
+  /** \brief get number of entries evicted from the partition
+   */
+  uint64_t
+  getNEvictions() const
+  {
+    return m_nEvictions;
+  }
+
+  CsPartition&
+  setNEvictions(uint64_t nEvictions);
+
+private:
+  Name m_prefix;
+  uint64_t m_capacity;
+  uint64_t m_nEntries;
+  uint64_t m_nHits;
+  uint64_t m_nMisses;
+  uint64_t m_nEvictions;
+  mutable Block m_wire;
+};
+
+NDN_CXX_DECLARE_WIRE_ENCODE_INSTANTIATIONS(CsPartition);
+
+bool
+operator==(const CsPartition& a, const CsPartition& b);
+
+inline bool
+operator!=(const CsPartition& a, const CsPartition& b)
+{
+  return !(a == b);
+}
+
+std::ostream&
+operator<<(std::ostream& os, const CsPartition& partition);
+
 /** \ingroup management
  *  \brief represents the CS Information dataset
  *  \sa https://redmine.named-data.net/projects/nfd/wiki/CsMgmt#CS-Information-Dataset
@@ -124,6 +244,24 @@ public:
   CsInfo&
   setNMisses(uint64_t nMisses);
 
+  /** \brief get partitions of the CS
+   *
+   *  NFD reports the default partition first, with prefix "/", followed by the configured
+   *  partitions. Capacity refers to the default partition, while NEntries, NHits and NMisses
+   *  count the CS as a whole, including every partition.
+   */
+  const std::vector<CsPartition>&
+  getPartitions() const
+  {
+    return m_partitions;
+  }
+
+  CsInfo&
+  addPartition(const CsPartition& partition);
+
+  CsInfo&
+  clearPartitions();
+
 private:
   using FlagsBitSet = std::bitset<2>;
 
@@ -132,6 +270,7 @@ private:
   uint64_t m_nEntries;
   uint64_t m_nHits;
   uint64_t m_nMisses;
+  std::vector<CsPartition> m_partitions;
   mutable Block m_wire;
 };
 
@@ -40,6 +40,7 @@ FaceStatus::FaceStatus()
   , m_nOutNacks(0)
   , m_nInBytes(0)
   , m_nOutBytes(0)
+  , m_nShedInterests(0)
 {
 }
 
@@ -54,6 +55,9 @@ FaceStatus::wireEncode(EncodingImpl<TAG>& encoder) const
 {
   size_t totalLength = 0;
 
+  if (m_nShedInterests > 0) {
+    totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NShedInterests, m_nShedInterests);
+  }
   totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::Flags, m_flags);
   totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NOutBytes, m_nOutBytes);
   totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NInBytes, m_nInBytes);
@@ -269,6 +273,14 @@ FaceStatus::wireDecode(const Block& block)
   else {
     BOOST_THROW_EXCEPTION(Error("missing required Flags field"));
   }
+
+  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NShedInterests) {
+    m_nShedInterests = readNonNegativeInteger(*val);
+    ++val;
+  }
+  else {
+    m_nShedInterests = 0;
+  }
 }
 
 FaceStatus&
@@ -399,6 +411,14 @@ FaceStatus::setNOutBytes(uint64_t nOutBytes)
   return *this;
 }
 
+FaceStatus&
+FaceStatus::setNShedInterests(uint64_t nShedInterests)
+{
+  m_wire.reset();
+  m_nShedInterests = nShedInterests;
+  return *this;
+}
+
 bool
 operator==(const FaceStatus& a, const FaceStatus& b)
 {
@@ -426,7 +446,8 @@ operator==(const FaceStatus& a, const FaceStatus& b)
       a.getNOutData() == b.getNOutData() &&
       a.getNOutNacks() == b.getNOutNacks() &&
       a.getNInBytes() == b.getNInBytes() &&
-      a.getNOutBytes() == b.getNOutBytes();
+      a.getNOutBytes() == b.getNOutBytes() &&
+      a.getNShedInterests() == b.getNShedInterests();
 }
 
 std::ostream&
@@ -467,7 +488,13 @@ operator<<(std::ostream& os, const FaceStatus& status)
      << "                Nacks: {in: " << status.getNInNacks() << ", "
      << "out: " << status.getNOutNacks() << "},\n"
      << "                bytes: {in: " << status.getNInBytes() << ", "
-     << "out: " << status.getNOutBytes() << "}}\n";
+     << "out: " << status.getNOutBytes() << "}";
+
+  if (status.getNShedInterests() > 0) {
+    os << ",\n                ShedInterests: " << status.getNShedInterests();
+  }
+
+  os << "}\n";
 
   return os << "     )";
 }
@@ -218,6 +218,19 @@ public: // getters & setters
   FaceStatus&
   setNOutBytes(uint64_t nOutBytes);
 
+  /** \brief number of Interests from this face shed by PIT admission control
+   *
+   *  This field is omitted from the encoding when it is zero.
+   */
+  uint64_t
+  getNShedInterests() const
+  {
+    return m_nShedInterests;
+  }
+
+  FaceStatus&
+  setNShedInterests(uint64_t nShedInterests);
+
 private:
   optional<time::milliseconds> m_expirationPeriod;
   optional<time::nanoseconds> m_baseCongestionMarkingInterval;
@@ -231,6 +244,7 @@ private:
   uint64_t m_nOutNacks;
   uint64_t m_nInBytes;
   uint64_t m_nOutBytes;
+  uint64_t m_nShedInterests;
 };
 
 NDN_CXX_DECLARE_WIRE_ENCODE_INSTANTIATIONS(FaceStatus);
@@ -42,6 +42,12 @@ ForwarderStatus::ForwarderStatus()
   , m_nOutInterests(0)
   , m_nOutData(0)
   , m_nOutNacks(0)
+  , m_nShedInterests(0)
+  , m_nPrefetchInterests(0)
+  , m_nUsefulPrefetches(0)
+  , m_nWastedPrefetches(0)
+  , m_nFailedPrefetches(0)
+  , m_nPrefetchBudgetExceeded(0)
 {
 }
 
@@ -56,6 +62,30 @@ ForwarderStatus::wireEncode(EncodingImpl<TAG>& encoder) const
 {
   size_t totalLength = 0;
 
+  if (m_nPrefetchBudgetExceeded > 0) {
+    totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NPrefetchBudgetExceeded, m_nPrefetchBudgetExceeded);
+  }
+  if (m_nFailedPrefetches > 0) {
+    totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NFailedPrefetches, m_nFailedPrefetches);
+  }
+  if (m_nWastedPrefetches > 0) {
+    totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NWastedPrefetches, m_nWastedPrefetches);
+  }
+  if (m_nUsefulPrefetches > 0) {
+    totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NUsefulPrefetches, m_nUsefulPrefetches);
+  }
+  if (m_nPrefetchInterests > 0) {
+    totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NPrefetchInterests, m_nPrefetchInterests);
+  }
+  if (m_nShedInterests > 0) {
+    totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NShedInterests, m_nShedInterests);
+  }
+  if (m_idleTime) {
+    totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::IdleTime, m_idleTime->count());
+  }
+  if (m_busyTime) {
+    totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::BusyTime, m_busyTime->count());
+  }
   totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NOutNacks, m_nOutNacks);
   totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NOutData, m_nOutData);
   totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NOutInterests, m_nOutInterests);
@@ -217,6 +247,70 @@ ForwarderStatus::wireDecode(const Block& block)
   else {
     BOOST_THROW_EXCEPTION(Error("missing required NOutNacks field"));
   }
+
+  if (val != m_wire.elements_end() && val->type() == tlv::nfd::BusyTime) {
+    m_busyTime.emplace(readNonNegativeInteger(*val));
+    ++val;
+  }
+  else {
+    m_busyTime = nullopt;
+  }
+
+  if (val != m_wire.elements_end() && val->type() == tlv::nfd::IdleTime) {
+    m_idleTime.emplace(readNonNegativeInteger(*val));
+    ++val;
+  }
+  else {
+    m_idleTime = nullopt;
+  }
+
+  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NShedInterests) {
+    m_nShedInterests = readNonNegativeInteger(*val);
+    ++val;
+  }
+  else {
+    m_nShedInterests = 0;
+  }
+
+  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NPrefetchInterests) {
+    m_nPrefetchInterests = readNonNegativeInteger(*val);
+    ++val;
+  }
+  else {
+    m_nPrefetchInterests = 0;
+  }
+
+  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NUsefulPrefetches) {
+    m_nUsefulPrefetches = readNonNegativeInteger(*val);
+    ++val;
+  }
+  else {
+    m_nUsefulPrefetches = 0;
+  }
+
+  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NWastedPrefetches) {
+    m_nWastedPrefetches = readNonNegativeInteger(*val);
+    ++val;
+  }
+  else {
+    m_nWastedPrefetches = 0;
+  }
+
+  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NFailedPrefetches) {
+    m_nFailedPrefetches = readNonNegativeInteger(*val);
+    ++val;
+  }
+  else {
+    m_nFailedPrefetches = 0;
+  }
+
+  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NPrefetchBudgetExceeded) {
+    m_nPrefetchBudgetExceeded = readNonNegativeInteger(*val);
+    ++val;
+  }
+  else {
+    m_nPrefetchBudgetExceeded = 0;
+  }
 }
 
 ForwarderStatus&
@@ -331,6 +425,86 @@ ForwarderStatus::setNOutNacks(uint64_t nOutNacks)
   return *this;
 }
 
+ForwarderStatus&
+ForwarderStatus::setNShedInterests(uint64_t nShedInterests)
+{
+  m_wire.reset();
+  m_nShedInterests = nShedInterests;
+  return *this;
+}
+
+ForwarderStatus&
+ForwarderStatus::setNPrefetchInterests(uint64_t nPrefetchInterests)
+{
+  m_wire.reset();
+  m_nPrefetchInterests = nPrefetchInterests;
+  return *this;
+}
+
+ForwarderStatus&
+ForwarderStatus::setNUsefulPrefetches(uint64_t nUsefulPrefetches)
+{
+  m_wire.reset();
+  m_nUsefulPrefetches = nUsefulPrefetches;
+  return *this;
+}
+
+ForwarderStatus&
+ForwarderStatus::setNWastedPrefetches(uint64_t nWastedPrefetches)
+{
+  m_wire.reset();
+  m_nWastedPrefetches = nWastedPrefetches;
+  return *this;
+}
+
+ForwarderStatus&
+ForwarderStatus::setNFailedPrefetches(uint64_t nFailedPrefetches)
+{
+  m_wire.reset();
+  m_nFailedPrefetches = nFailedPrefetches;
+  return *this;
+}
+
+ForwarderStatus&
+ForwarderStatus::setNPrefetchBudgetExceeded(uint64_t nPrefetchBudgetExceeded)
+{
+  m_wire.reset();
+  m_nPrefetchBudgetExceeded = nPrefetchBudgetExceeded;
+  return *this;
+}
+
+ForwarderStatus&
+ForwarderStatus::setBusyTime(time::milliseconds busyTime)
+{
+  m_wire.reset();
+  m_busyTime = busyTime;
+  return *this;
+}
+
+ForwarderStatus&
+ForwarderStatus::unsetBusyTime()
+{
+  m_wire.reset();
+  m_busyTime = nullopt;
+  return *this;
+}
+
+ForwarderStatus&
+ForwarderStatus::setIdleTime(time::milliseconds idleTime)
+{
+  m_wire.reset();
+  m_idleTime = idleTime;
+  return *this;
+}
+
+ForwarderStatus&
+ForwarderStatus::unsetIdleTime()
+{
+  m_wire.reset();
+  m_idleTime = nullopt;
+  return *this;
+}
+
 bool
 operator==(const ForwarderStatus& a, const ForwarderStatus& b)
 {
@@ -347,7 +521,17 @@ operator==(const ForwarderStatus& a, const ForwarderStatus& b)
       a.getNInNacks() == b.getNInNacks() &&
       a.getNOutInterests() == b.getNOutInterests() &&
       a.getNOutData() == b.getNOutData() &&
-      a.getNOutNacks() == b.getNOutNacks();
+      a.getNOutNacks() == b.getNOutNacks() &&
+      a.getNShedInterests() == b.getNShedInterests() &&
+      a.getNPrefetchInterests() == b.getNPrefetchInterests() &&
+      a.getNUsefulPrefetches() == b.getNUsefulPrefetches() &&
+      a.getNWastedPrefetches() == b.getNWastedPrefetches() &&
+      a.getNFailedPrefetches() == b.getNFailedPrefetches() &&
+      a.getNPrefetchBudgetExceeded() == b.getNPrefetchBudgetExceeded() &&
+      a.hasBusyTime() == b.hasBusyTime() &&
+      (!a.hasBusyTime() || a.getBusyTime() == b.getBusyTime()) &&
+      a.hasIdleTime() == b.hasIdleTime() &&
+      (!a.hasIdleTime() || a.getIdleTime() == b.getIdleTime());
 }
 
 std::ostream&
@@ -366,8 +550,27 @@ operator<<(std::ostream& os, const ForwarderStatus& status)
      << "                         Data: {in: " << status.getNInData() << ", "
      << "out: " << status.getNOutData() << "},\n"
      << "                         Nacks: {in: " << status.getNInNacks() << ", "
-     << "out: " << status.getNOutNacks() << "}}\n"
-     << "              )";
+     << "out: " << status.getNOutNacks() << "}";
+
+  if (status.getNShedInterests() > 0) {
+    os << ",\n                         ShedInterests: " << status.getNShedInterests();
+  }
+  if (status.getNPrefetchInterests() > 0 || status.getNPrefetchBudgetExceeded() > 0) {
+    os << ",\n                         Prefetches: {sent: " << status.getNPrefetchInterests()
+       << ", useful: " << status.getNUsefulPrefetches()
+       << ", wasted: " << status.getNWastedPrefetches()
+       << ", failed: " << status.getNFailedPrefetches()
+       << ", budget-exceeded: " << status.getNPrefetchBudgetExceeded() << "}";
+  }
+  os << "}";
+  if (status.hasBusyTime()) {
+    os << ",\n              BusyTime: " << status.getBusyTime();
+  }
+  if (status.hasIdleTime()) {
+    os << ",\n              IdleTime: " << status.getIdleTime();
+  }
+
+  os << "\n              )";
 
   return os;
 }
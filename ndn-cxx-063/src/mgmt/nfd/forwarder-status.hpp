@@ -196,6 +196,116 @@ public: // getters & setters
   ForwarderStatus&
   setNOutNacks(uint64_t nOutNacks);
 
+  /** \brief number of Interests shed by PIT admission control
+   *
+   *  This field is omitted from the encoding when it is zero.
+   */
+  uint64_t
+  getNShedInterests() const
+  {
+    return m_nShedInterests;
+  }
+
+  ForwarderStatus&
+  setNShedInterests(uint64_t nShedInterests);
+
+  /** \name counters of the segment prefetch strategy
+   *
+   *  These are summed over all namespaces that use the strategy. Each field is omitted
+   *  from the encoding when it is zero.
+   *  @{
+   */
+  uint64_t
+  getNPrefetchInterests() const
+  {
+    return m_nPrefetchInterests;
+  }
+
+  ForwarderStatus&
+  setNPrefetchInterests(uint64_t nPrefetchInterests);
+
+  uint64_t
+  getNUsefulPrefetches() const
+  {
+    return m_nUsefulPrefetches;
+  }
+
+  ForwarderStatus&
+  setNUsefulPrefetches(uint64_t nUsefulPrefetches);
+
+  uint64_t
+  getNWastedPrefetches() const
+  {
+    return m_nWastedPrefetches;
+  }
+
+  ForwarderStatus&
+  setNWastedPrefetches(uint64_t nWastedPrefetches);
+
+  uint64_t
+  getNFailedPrefetches() const
+  {
+    return m_nFailedPrefetches;
+  }
+
+  ForwarderStatus&
+  setNFailedPrefetches(uint64_t nFailedPrefetches);
+
+  uint64_t
+  getNPrefetchBudgetExceeded() const
+  {
+    return m_nPrefetchBudgetExceeded;
+  }
+
+  ForwarderStatus&
+  setNPrefetchBudgetExceeded(uint64_t nPrefetchBudgetExceeded);
+
+  /** @} */
+
+  /** \brief whether the time the forwarding thread spent processing events is reported
+   *
+   *  The forwarder only measures busy and idle time when it busy-polls for events.
+   */
+  bool
+  hasBusyTime() const
+  {
+    return !!m_busyTime;
+  }
+
+  time::milliseconds
+  getBusyTime() const
+  {
+    BOOST_ASSERT(hasBusyTime());
+    return *m_busyTime;
+  }
+
+  ForwarderStatus&
+  setBusyTime(time::milliseconds busyTime);
+
+  ForwarderStatus&
+  unsetBusyTime();
+
+  /** \brief whether the time the forwarding thread spent waiting for events is reported
+   */
+  bool
+  hasIdleTime() const
+  {
+    return !!m_idleTime;
+  }
+
+  time::milliseconds
+  getIdleTime() const
+  {
+    BOOST_ASSERT(hasIdleTime());
+    return *m_idleTime;
+  }
+
+  ForwarderStatus&
+  setIdleTime(time::milliseconds idleTime);
+
+  ForwarderStatus&
+  unsetIdleTime();
+
 private:
   std::string m_nfdVersion;
   time::system_clock::TimePoint m_startTimestamp;
@@ -211,6 +321,14 @@ private:
   uint64_t m_nOutInterests;
   uint64_t m_nOutData;
   uint64_t m_nOutNacks;
+  uint64_t m_nShedInterests;
+  uint64_t m_nPrefetchInterests;
+  uint64_t m_nUsefulPrefetches;
+  uint64_t m_nWastedPrefetches;
+  uint64_t m_nFailedPrefetches;
+  uint64_t m_nPrefetchBudgetExceeded;
+  optional<time::milliseconds> m_busyTime;
+  optional<time::milliseconds> m_idleTime;
 
   mutable Block m_wire;
 };
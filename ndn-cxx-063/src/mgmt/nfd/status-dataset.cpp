@@ -149,6 +149,17 @@ CsInfoDataset::parseResult(ConstBufferPtr payload) const
   return CsInfo(Block(std::move(payload)));
 }
 
+ArenaInfoDataset::ArenaInfoDataset()
+  : StatusDataset("status/arena")
+{
+}
+
+ArenaInfoDataset::ResultType
+ArenaInfoDataset::parseResult(ConstBufferPtr payload) const
+{
+  return ArenaInfo(Block(std::move(payload)));
+}
+
 StrategyChoiceDataset::StrategyChoiceDataset()
   : StatusDataset("strategy-choice/list")
 {
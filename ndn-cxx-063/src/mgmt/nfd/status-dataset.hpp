@@ -28,6 +28,7 @@
 #include "face-query-filter.hpp"
 #include "channel-status.hpp"
 #include "fib-entry.hpp"
+#include "arena-info.hpp"
 #include "cs-info.hpp"
 #include "strategy-choice.hpp"
 #include "rib-entry.hpp"
@@ -221,6 +222,21 @@ public:
   parseResult(ConstBufferPtr payload) const;
 };
 
+/**
+ * \ingroup management
+ * \brief represents a status/arena dataset
+ */
+class ArenaInfoDataset : public StatusDataset
+{
+public:
+  ArenaInfoDataset();
+
+  using ResultType = ArenaInfo;
+
+  ResultType
+  parseResult(ConstBufferPtr payload) const;
+};
+
 /**
  * \ingroup management
  * \brief represents a strategy-choice/list dataset
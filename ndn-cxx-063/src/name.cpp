@@ -26,6 +26,7 @@
 #include "name.hpp"
 
 #include "encoding/block.hpp"
+#include "encoding/block-helpers.hpp"
 #include "encoding/encoding-buffer.hpp"
 #include "util/time.hpp"
 
@@ -59,6 +60,7 @@ Name::Name()
 
 Name::Name(const Block& wire)
   : m_wire(wire)
+  , m_hasHash(false)
 {
   m_wire.parse();
 }
@@ -137,20 +139,91 @@ Name::wireEncode(EncodingImpl<TAG>& encoder) const
 
 NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(Name);
 
+/** @brief space reserved in front of TLV-VALUE in Name::m_encodeBuffer for TLV-TYPE and TLV-LENGTH
+ */
+static const size_t NAME_HEADER_ROOM = tlv::sizeOfVarNumber(tlv::Name) +
+                                       tlv::sizeOfVarNumber(std::numeric_limits<uint64_t>::max());
+
+static size_t
+writeVarNumber(uint8_t* dest, uint64_t number)
+{
+  if (number < 253) {
+    dest[0] = static_cast<uint8_t>(number);
+    return 1;
+  }
+
+  size_t length = 0;
+  if (number <= std::numeric_limits<uint16_t>::max()) {
+    dest[0] = 253;
+    length = 2;
+  }
+  else if (number <= std::numeric_limits<uint32_t>::max()) {
+    dest[0] = 254;
+    length = 4;
+  }
+  else {
+    dest[0] = 255;
+    length = 8;
+  }
+
+  for (size_t i = length; i > 0; --i) {
+    dest[i] = static_cast<uint8_t>(number);
+    number >>= 8;
+  }
+  return length + 1;
+}
+
 const Block&
 Name::wireEncode() const
 {
   if (m_wire.hasWire())
     return m_wire;
 
-  EncodingEstimator estimator;
-  size_t estimatedSize = wireEncode(estimator);
+  Block::element_container& components = m_wire.m_elements;
+  size_t nEncoded = m_encodeBuffer == nullptr ? 0 : std::min(m_nEncoded, components.size());
 
-  EncodingBuffer buffer(estimatedSize, 0);
-  wireEncode(buffer);
+  size_t appendedSize = 0;
+  for (auto i = components.begin() + nEncoded; i != components.end(); ++i) {
+    if (!i->hasWire()) {
+      *i = makeBinaryBlock(i->type(), i->value(), i->value_size());
+    }
+    appendedSize += i->size();
+  }
 
-  m_wire = buffer.block();
-  m_wire.parse();
+  // m_wire has no wire at this point, so if another reference to the buffer exists, the previous
+  // encoding is still in use elsewhere and must not be overwritten
+  size_t encodedSize = nEncoded == 0 ? NAME_HEADER_ROOM : m_encodeBuffer->size();
+  size_t newSize = encodedSize + appendedSize;
+  if (nEncoded == 0 || m_encodeBuffer.use_count() > 1 || m_encodeBuffer->capacity() < newSize) {
+    auto buffer = make_shared<Buffer>();
+    // a name being appended to is likely to grow further
+    buffer->reserve(nEncoded == 0 ? newSize : newSize * 2);
+    if (nEncoded == 0) {
+      buffer->resize(NAME_HEADER_ROOM);
+    }
+    else {
+      buffer->assign(m_encodeBuffer->begin(), m_encodeBuffer->end());
+    }
+    m_encodeBuffer = std::move(buffer);
+  }
+
+  Buffer& buffer = *m_encodeBuffer;
+  for (auto i = components.begin() + nEncoded; i != components.end(); ++i) {
+    buffer.insert(buffer.end(), i->wire(), i->wire() + i->size());
+  }
+
+  size_t valueSize = newSize - NAME_HEADER_ROOM;
+  size_t headerSize = tlv::sizeOfVarNumber(tlv::Name) + tlv::sizeOfVarNumber(valueSize);
+  uint8_t* header = buffer.data() + NAME_HEADER_ROOM - headerSize;
+  header += writeVarNumber(header, tlv::Name);
+  writeVarNumber(header, valueSize);
+
+  const Buffer& wire = buffer;
+  Block block(m_encodeBuffer, tlv::Name, wire.begin() + NAME_HEADER_ROOM - headerSize, wire.end(),
+              wire.begin() + NAME_HEADER_ROOM, wire.end());
+  block.m_elements = std::move(components);
+  m_wire = std::move(block);
+  m_nEncoded = m_wire.m_elements.size();
 
   return m_wire;
 }
@@ -163,14 +236,24 @@ Name::wireDecode(const Block& wire)
 
   m_wire = wire;
   m_wire.parse();
+  m_encodeBuffer = nullptr;
+  m_nEncoded = 0;
+  m_hasHash = false;
 }
 
 Name
 Name::deepCopy() const
 {
-  Name copiedName(*this);
-  copiedName.m_wire.resetWire();
-  copiedName.wireEncode(); // "compress" the underlying buffer
+  // "compress" the underlying buffer
+  EncodingEstimator estimator;
+  size_t estimatedSize = wireEncode(estimator);
+
+  EncodingBuffer buffer(estimatedSize, 0);
+  wireEncode(buffer);
+
+  Name copiedName(buffer.block());
+  copiedName.m_hash = m_hash;
+  copiedName.m_hasHash = m_hasHash;
   return copiedName;
 }
 
@@ -238,6 +321,36 @@ Name::append(const PartialName& name)
 
 // ---- algorithms ----
 
+static size_t
+hashComponent(const Block& component)
+{
+  size_t seed = component.type();
+  boost::hash_range(seed, component.value(), component.value() + component.value_size());
+  return seed;
+}
+
+void
+Name::extendHash(const Block& component)
+{
+  if (m_hasHash) {
+    boost::hash_combine(m_hash, hashComponent(component));
+  }
+}
+
+size_t
+Name::getHash() const
+{
+  if (!m_hasHash) {
+    size_t hash = 0;
+    for (const Block& component : m_wire.elements()) {
+      boost::hash_combine(hash, hashComponent(component));
+    }
+    m_hash = hash;
+    m_hasHash = true;
+  }
+  return m_hash;
+}
+
 Name
 Name::getSuccessor() const
 {
@@ -329,8 +442,7 @@ namespace std {
 size_t
 hash<ndn::Name>::operator()(const ndn::Name& name) const
 {
-  return boost::hash_range(name.wireEncode().wire(),
-                           name.wireEncode().wire() + name.wireEncode().size());
+  return name.getHash();
 }
 
 } // namespace std
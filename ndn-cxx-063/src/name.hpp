@@ -248,6 +248,7 @@ public: // modifiers
   append(const Component& component)
   {
     m_wire.push_back(component);
+    extendHash(component);
     return *this;
   }
 
@@ -324,6 +325,7 @@ public: // modifiers
     else {
       m_wire.push_back(Block(tlv::GenericNameComponent, value));
     }
+    extendHash(m_wire.elements().back());
     return *this;
   }
 
@@ -462,6 +464,10 @@ public: // modifiers
   clear()
   {
     m_wire = Block(tlv::Name);
+    m_encodeBuffer = nullptr;
+    m_nEncoded = 0;
+    m_hash = 0;
+    m_hasHash = true;
   }
 
 public: // algorithms
@@ -552,8 +558,38 @@ public:
    */
   static const size_t npos;
 
+private:
+  /** @brief Fold @p component into the cached hash, if the cached hash is valid
+   */
+  void
+  extendHash(const Block& component);
+
+  /** @brief Get the hash of this name, computing it if it is not cached
+   *
+   *  The hash is a fold over the TLV-TYPE and TLV-VALUE of each component, so that it can be
+   *  extended when a component is appended.
+   */
+  size_t
+  getHash() const;
+
+  friend struct std::hash<Name>;
+
 private:
   mutable Block m_wire;
+
+  /** @brief buffer holding the encoding of the first m_nEncoded components
+   *
+   *  TLV-VALUE starts at a fixed offset, leaving room for TLV-TYPE and TLV-LENGTH in front of it,
+   *  and the buffer has spare capacity, so that components appended to the name can be encoded
+   *  after the existing ones without re-encoding them. Elements of m_wire never refer to this
+   *  buffer, so any reference other than this one and m_wire means that a Block elsewhere still
+   *  uses the encoding, which then must not be modified.
+   */
+  mutable shared_ptr<Buffer> m_encodeBuffer;
+  mutable size_t m_nEncoded = 0;
+
+  mutable size_t m_hash = 0;
+  mutable bool m_hasHash = true;
 };
 
 NDN_CXX_DECLARE_WIRE_ENCODE_INSTANTIATIONS(Name);
@@ -30,12 +30,24 @@ NDN_LOG_INIT(ndn.security.v2.CertificateFetcher);
 
 #define NDN_LOG_DEBUG_DEPTH(x) NDN_LOG_DEBUG(std::string(state->getDepth() + 1, '>') << " " << x)
 
+const time::nanoseconds CertificateFetcher::DEFAULT_NEGATIVE_CACHE_LIFETIME = time::seconds(5);
+
 CertificateFetcher::CertificateFetcher()
   : m_certStorage(nullptr)
+  , m_negativeCacheLifetime(DEFAULT_NEGATIVE_CACHE_LIFETIME)
 {
 }
 
-CertificateFetcher::~CertificateFetcher() = default;
+CertificateFetcher::~CertificateFetcher()
+{
+  // in-flight fetches may outlive the fetcher, do not let their leaders call back into it
+  for (auto& pending : m_pendingFetches) {
+    auto leader = pending.second.leader.lock();
+    if (leader != nullptr) {
+      leader->m_fetchFailureCallbacks.erase(pending.second.failureCallback);
+    }
+  }
+}
 
 void
 CertificateFetcher::setCertificateStorage(CertificateStorage& certStorage)
@@ -43,6 +55,16 @@ CertificateFetcher::setCertificateStorage(CertificateStorage& certStorage)
   m_certStorage = &certStorage;
 }
 
+void
+CertificateFetcher::setNegativeCacheLifetime(time::nanoseconds lifetime)
+{
+  m_negativeCacheLifetime = std::max(lifetime, time::nanoseconds::zero());
+  if (m_negativeCacheLifetime == time::nanoseconds::zero()) {
+    m_failedFetches.clear();
+    m_failedFetchExpiry.clear();
+  }
+}
+
 void
 CertificateFetcher::fetch(const shared_ptr<CertificateRequest>& certRequest,
                           const shared_ptr<ValidationState>& state,
@@ -55,13 +77,115 @@ CertificateFetcher::fetch(const shared_ptr<CertificateRequest>& certRequest,
     continueValidation(*cert, state);
     return;
   }
+
+  const Name& certName = certRequest->m_interest.getName();
+  auto pending = m_pendingFetches.find(certName);
+  if (pending != m_pendingFetches.end()) {
+    if (pending->second.request == certRequest) {
+      // retransmission by the implementation, continueValidation already completes the fetch
+      doFetch(certRequest, state, continueValidation);
+    }
+    else {
+      NDN_LOG_DEBUG_DEPTH("Joining in-flight fetch of " << certName);
+      ++m_counters.nCoalescedFetches;
+      pending->second.waiters.emplace_back(state, continueValidation);
+    }
+    return;
+  }
+
+  const ValidationError* error = findFailedFetch(certName);
+  if (error != nullptr) {
+    NDN_LOG_DEBUG_DEPTH("Recently failed to fetch " << certName);
+    ++m_counters.nNegativeCacheHits;
+    state->fail(*error);
+    return;
+  }
+
+  ++m_counters.nFetches;
+  PendingFetch& entry = m_pendingFetches[certName];
+  entry.request = certRequest;
+  entry.leader = state;
+  entry.failureCallback = state->m_fetchFailureCallbacks.insert(state->m_fetchFailureCallbacks.end(),
+    [this, certName] (const ValidationError& error) { onFetchFailure(certName, error); });
+
   doFetch(certRequest, state,
-          [continueValidation, this] (const Certificate& cert, const shared_ptr<ValidationState>& state) {
+          [continueValidation, certName, this] (const Certificate& cert,
+                                                const shared_ptr<ValidationState>& state) {
             m_certStorage->cacheUnverifiedCert(Certificate(cert));
+            auto waiters = finishPendingFetch(certName);
             continueValidation(cert, state);
+            for (const auto& waiter : waiters) {
+              waiter.second(cert, waiter.first);
+            }
           });
 }
 
+std::vector<std::pair<shared_ptr<ValidationState>, CertificateFetcher::ValidationContinuation>>
+CertificateFetcher::finishPendingFetch(const Name& certName)
+{
+  auto pending = m_pendingFetches.find(certName);
+  if (pending == m_pendingFetches.end()) {
+    return {};
+  }
+
+  auto leader = pending->second.leader.lock();
+  if (leader != nullptr) {
+    leader->m_fetchFailureCallbacks.erase(pending->second.failureCallback);
+  }
+  auto waiters = std::move(pending->second.waiters);
+  m_pendingFetches.erase(pending);
+  return waiters;
+}
+
+void
+CertificateFetcher::onFetchFailure(const Name& certName, const ValidationError& error)
+{
+  // the leader has already dropped its failure callbacks, so only remove the entry
+  auto pending = m_pendingFetches.find(certName);
+  if (pending == m_pendingFetches.end()) {
+    return;
+  }
+  auto waiters = std::move(pending->second.waiters);
+  m_pendingFetches.erase(pending);
+
+  // a state destroyed before its outcome is known says nothing about the certificate
+  if (m_negativeCacheLifetime > time::nanoseconds::zero() &&
+      error.getCode() != ValidationError::Code::IMPLEMENTATION_ERROR) {
+    auto expiry = time::steady_clock::now() + m_negativeCacheLifetime;
+    auto failed = m_failedFetches.find(certName);
+    if (failed == m_failedFetches.end()) {
+      m_failedFetches.emplace(certName, FailedFetch{expiry, error});
+    }
+    else {
+      failed->second = FailedFetch{expiry, error};
+    }
+    m_failedFetchExpiry.emplace_back(expiry, certName);
+  }
+
+  for (const auto& waiter : waiters) {
+    waiter.first->fail(error);
+  }
+}
+
+const ValidationError*
+CertificateFetcher::findFailedFetch(const Name& certName)
+{
+  auto now = time::steady_clock::now();
+  while (!m_failedFetchExpiry.empty() && m_failedFetchExpiry.front().first <= now) {
+    auto failed = m_failedFetches.find(m_failedFetchExpiry.front().second);
+    if (failed != m_failedFetches.end() && failed->second.expiry <= now) {
+      m_failedFetches.erase(failed);
+    }
+    m_failedFetchExpiry.pop_front();
+  }
+
+  auto failed = m_failedFetches.find(certName);
+  if (failed == m_failedFetches.end() || failed->second.expiry <= now) {
+    return nullptr;
+  }
+  return &failed->second.error;
+}
+
 } // namespace v2
 } // namespace security
 } // namespace ndn
@@ -26,6 +26,9 @@
 #include "certificate-storage.hpp"
 #include "validation-state.hpp"
 
+#include <deque>
+#include <unordered_map>
+
 namespace ndn {
 
 class Face;
@@ -42,6 +45,23 @@ public:
   using ValidationContinuation = std::function<void(const Certificate& cert,
                                                     const shared_ptr<ValidationState>& state)>;
 
+  /**
+   * @brief Counters of certificate fetch activity
+   *
+   * The coalescing ratio is nCoalescedFetches / (nFetches + nCoalescedFetches).
+   */
+  struct Counters
+  {
+    /// number of fetches handed over to the implementation-specific doFetch
+    uint64_t nFetches = 0;
+    /// number of requests that joined an in-flight fetch of the same certificate
+    uint64_t nCoalescedFetches = 0;
+    /// number of requests failed by a recent failure to fetch the same certificate
+    uint64_t nNegativeCacheHits = 0;
+  };
+
+  static const time::nanoseconds DEFAULT_NEGATIVE_CACHE_LIFETIME;
+
   CertificateFetcher();
 
   virtual
@@ -67,11 +87,28 @@ public:
    * When the requested certificate is retrieved, continueValidation is called.  Otherwise, the
    * fetcher implementation call state->failed() with the appropriate error code and diagnostic
    * message.
+   *
+   * Concurrent requests for the same certificate name are coalesced: only the first one is
+   * passed to doFetch, the others wait for its outcome.  A failed fetch is remembered for
+   * the negative cache lifetime, during which requests for the same name fail immediately.
    */
   void
   fetch(const shared_ptr<CertificateRequest>& certRequest, const shared_ptr<ValidationState>& state,
         const ValidationContinuation& continueValidation);
 
+  /**
+   * @brief Set how long a failure to fetch a certificate is remembered
+   * @param lifetime negative cache lifetime; zero disables the negative cache
+   */
+  void
+  setNegativeCacheLifetime(time::nanoseconds lifetime);
+
+  const Counters&
+  getCounters() const
+  {
+    return m_counters;
+  }
+
 private:
   /**
    * @brief Asynchronous certificate fetching implementation
@@ -80,8 +117,44 @@ private:
   doFetch(const shared_ptr<CertificateRequest>& certRequest, const shared_ptr<ValidationState>& state,
           const ValidationContinuation& continueValidation) = 0;
 
+  struct PendingFetch
+  {
+    shared_ptr<CertificateRequest> request;
+    weak_ptr<ValidationState> leader;
+    std::list<ValidationState::FetchFailureCallback>::iterator failureCallback;
+    std::vector<std::pair<shared_ptr<ValidationState>, ValidationContinuation>> waiters;
+  };
+
+  /**
+   * @brief Remove the in-flight fetch of @p certName and return requests waiting on it
+   */
+  std::vector<std::pair<shared_ptr<ValidationState>, ValidationContinuation>>
+  finishPendingFetch(const Name& certName);
+
+  void
+  onFetchFailure(const Name& certName, const ValidationError& error);
+
+  /**
+   * @brief Find a non-expired negative cache entry for @p certName
+   */
+  const ValidationError*
+  findFailedFetch(const Name& certName);
+
 protected:
   CertificateStorage* m_certStorage;
+
+private:
+  struct FailedFetch
+  {
+    time::steady_clock::TimePoint expiry;
+    ValidationError error;
+  };
+
+  std::unordered_map<Name, PendingFetch> m_pendingFetches;
+  std::unordered_map<Name, FailedFetch> m_failedFetches;
+  std::deque<std::pair<time::steady_clock::TimePoint, Name>> m_failedFetchExpiry;
+  time::nanoseconds m_negativeCacheLifetime;
+  Counters m_counters;
 };
 
 } // namespace v2
@@ -62,6 +62,16 @@ ValidationState::addCertificate(const Certificate& cert)
   m_certificateChain.push_front(cert);
 }
 
+void
+ValidationState::notifyFetchFailure(const ValidationError& error)
+{
+  auto callbacks = std::move(m_fetchFailureCallbacks);
+  m_fetchFailureCallbacks.clear();
+  for (const auto& callback : callbacks) {
+    callback(error);
+  }
+}
+
 const Certificate*
 ValidationState::verifyCertificateChain(const Certificate& trustedCert)
 {
@@ -135,6 +145,7 @@ DataValidationState::fail(const ValidationError& error)
   m_failureCb(m_data, error);
   BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
   m_outcome = false;
+  notifyFetchFailure(error);
 }
 
 const Data&
@@ -195,6 +206,7 @@ InterestValidationState::fail(const ValidationError& error)
   m_failureCb(m_interest, error);
   BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
   m_outcome = false;
+  notifyFetchFailure(error);
 }
 
 const Interest&
@@ -135,10 +135,22 @@ private: // Interface intended to be used only by Validator class
   const Certificate*
   verifyCertificateChain(const Certificate& trustedCert);
 
+protected:
+  /**
+   * @brief Notify certificate fetchers that wait on a fetch started by this state
+   *
+   * Implementations of fail() must call this method, so that requests coalesced with a
+   * certificate fetch led by this state are failed as well.
+   */
+  void
+  notifyFetchFailure(const ValidationError& error);
+
 protected:
   boost::logic::tribool m_outcome;
 
 private:
+  using FetchFailureCallback = std::function<void(const ValidationError& error)>;
+
   std::unordered_set<Name> m_seenCertificateNames;
 
   /**
@@ -149,7 +161,13 @@ private:
    */
   std::list<v2::Certificate> m_certificateChain;
 
+  /**
+   * @brief callbacks of certificate fetchers whose in-flight fetch is led by this state
+   */
+  std::list<FetchFailureCallback> m_fetchFailureCallbacks;
+
   friend class Validator;
+  friend class CertificateFetcher;
 };
 
 /**
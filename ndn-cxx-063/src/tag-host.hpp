@@ -30,6 +30,10 @@
 namespace ndn {
 
 /** \brief Base class to store tag information (e.g., inside Interest and Data packets)
+ *
+ *  Well-known tags that are set on nearly every packet (see detail::InlineTagSlot) are stored
+ *  by value in inline slots. Other tags are stored in a map as shared_ptr.
+ *  Use getTagValue and setTagValue to access an inline tag without allocating.
  */
 class TagHost
 {
@@ -37,6 +41,7 @@ public:
   /** \brief get a tag item
    *  \tparam T type of the tag, which must be a subclass of ndn::Tag
    *  \retval nullptr if no Tag of type T is stored
+   *  \note If T is stored inline, a copy of the tag is returned.
    */
   template<typename T>
   shared_ptr<T>
@@ -45,6 +50,7 @@ public:
   /** \brief set a tag item
    *  \tparam T type of the tag, which must be a subclass of ndn::Tag
    *  \note Tag can be set even on a const tag host instance
+   *  \note If T is stored inline, the value of \p tag is copied.
    */
   template<typename T>
   void
@@ -57,8 +63,79 @@ public:
   void
   removeTag() const;
 
+  /** \brief get the value of a tag item
+   *  \tparam T type of the tag, which must be a SimpleTag
+   *  \return the enclosed value, or nullopt if no Tag of type T is stored
+   */
+  template<typename T>
+  optional<typename T::ValueType>
+  getTagValue() const;
+
+  /** \brief set a tag item from its value
+   *  \tparam T type of the tag, which must be a SimpleTag
+   *  \note Tag can be set even on a const tag host instance
+   */
+  template<typename T>
+  void
+  setTagValue(const typename T::ValueType& value) const;
+
+private:
+  template<typename T>
+  using IsInline = std::integral_constant<bool, (detail::InlineTagSlot<T>::value >= 0)>;
+
+  template<typename T>
+  shared_ptr<T>
+  getTagImpl(std::true_type) const;
+
+  template<typename T>
+  shared_ptr<T>
+  getTagImpl(std::false_type) const;
+
+  template<typename T>
+  void
+  setTagImpl(shared_ptr<T> tag, std::true_type) const;
+
+  template<typename T>
+  void
+  setTagImpl(shared_ptr<T> tag, std::false_type) const;
+
+  template<typename T>
+  optional<typename T::ValueType>
+  getTagValueImpl(std::true_type) const;
+
+  template<typename T>
+  optional<typename T::ValueType>
+  getTagValueImpl(std::false_type) const;
+
+  template<typename T>
+  void
+  setTagValueImpl(const typename T::ValueType& value, std::true_type) const;
+
+  template<typename T>
+  void
+  setTagValueImpl(const typename T::ValueType& value, std::false_type) const;
+
+  /** \return pointer to the value in the inline slot of T, or nullptr if the slot is empty
+   */
+  template<typename T>
+  const typename T::ValueType*
+  findInline() const;
+
+  template<typename T>
+  void
+  storeInline(const typename T::ValueType& value) const;
+
+  template<typename T>
+  void
+  eraseInline() const;
+
 private:
+  static constexpr int N_INLINE_SLOTS = 4;
+  using InlineStorage = std::aligned_storage<sizeof(uint64_t), alignof(uint64_t)>::type;
+
   mutable std::map<int, shared_ptr<Tag>> m_tags;
+  mutable InlineStorage m_inlineTags[N_INLINE_SLOTS];
+  mutable uint8_t m_inlineMask = 0; ///< bit i is set if m_inlineTags[i] holds a value
 };
 
 template<typename T>
@@ -67,6 +144,58 @@ TagHost::getTag() const
 {
   static_assert(std::is_base_of<Tag, T>::value, "T must inherit from Tag");
 
+  return getTagImpl<T>(IsInline<T>());
+}
+
+template<typename T>
+void
+TagHost::setTag(shared_ptr<T> tag) const
+{
+  static_assert(std::is_base_of<Tag, T>::value, "T must inherit from Tag");
+
+  setTagImpl<T>(std::move(tag), IsInline<T>());
+}
+
+template<typename T>
+void
+TagHost::removeTag() const
+{
+  setTag<T>(nullptr);
+}
+
+template<typename T>
+optional<typename T::ValueType>
+TagHost::getTagValue() const
+{
+  static_assert(std::is_base_of<Tag, T>::value, "T must inherit from Tag");
+
+  return getTagValueImpl<T>(IsInline<T>());
+}
+
+template<typename T>
+void
+TagHost::setTagValue(const typename T::ValueType& value) const
+{
+  static_assert(std::is_base_of<Tag, T>::value, "T must inherit from Tag");
+
+  setTagValueImpl<T>(value, IsInline<T>());
+}
+
+template<typename T>
+shared_ptr<T>
+TagHost::getTagImpl(std::true_type) const
+{
+  const typename T::ValueType* value = findInline<T>();
+  if (value == nullptr) {
+    return nullptr;
+  }
+  return make_shared<T>(*value);
+}
+
+template<typename T>
+shared_ptr<T>
+TagHost::getTagImpl(std::false_type) const
+{
   auto it = m_tags.find(T::getTypeId());
   if (it == m_tags.end()) {
     return nullptr;
@@ -76,10 +205,20 @@ TagHost::getTag() const
 
 template<typename T>
 void
-TagHost::setTag(shared_ptr<T> tag) const
+TagHost::setTagImpl(shared_ptr<T> tag, std::true_type) const
 {
-  static_assert(std::is_base_of<Tag, T>::value, "T must inherit from Tag");
+  if (tag == nullptr) {
+    eraseInline<T>();
+  }
+  else {
+    storeInline<T>(tag->get());
+  }
+}
 
+template<typename T>
+void
+TagHost::setTagImpl(shared_ptr<T> tag, std::false_type) const
+{
   if (tag == nullptr) {
     m_tags.erase(T::getTypeId());
   }
@@ -88,11 +227,81 @@ TagHost::setTag(shared_ptr<T> tag) const
   }
 }
 
+template<typename T>
+optional<typename T::ValueType>
+TagHost::getTagValueImpl(std::true_type) const
+{
+  const typename T::ValueType* value = findInline<T>();
+  if (value == nullptr) {
+    return nullopt;
+  }
+  return *value;
+}
+
+template<typename T>
+optional<typename T::ValueType>
+TagHost::getTagValueImpl(std::false_type) const
+{
+  shared_ptr<T> tag = getTagImpl<T>(std::false_type());
+  if (tag == nullptr) {
+    return nullopt;
+  }
+  return tag->get();
+}
+
 template<typename T>
 void
-TagHost::removeTag() const
+TagHost::setTagValueImpl(const typename T::ValueType& value, std::true_type) const
 {
-  setTag<T>(nullptr);
+  storeInline<T>(value);
+}
+
+template<typename T>
+void
+TagHost::setTagValueImpl(const typename T::ValueType& value, std::false_type) const
+{
+  m_tags[T::getTypeId()] = make_shared<T>(value);
+}
+
+template<typename T>
+const typename T::ValueType*
+TagHost::findInline() const
+{
+  using ValueType = typename T::ValueType;
+  constexpr int slot = detail::InlineTagSlot<T>::value;
+  static_assert(slot >= 0 && slot < N_INLINE_SLOTS, "inline slot out of range");
+
+  if ((m_inlineMask & (1 << slot)) == 0) {
+    return nullptr;
+  }
+  return reinterpret_cast<const ValueType*>(&m_inlineTags[slot]);
+}
+
+template<typename T>
+void
+TagHost::storeInline(const typename T::ValueType& value) const
+{
+  using ValueType = typename T::ValueType;
+  constexpr int slot = detail::InlineTagSlot<T>::value;
+  static_assert(slot >= 0 && slot < N_INLINE_SLOTS, "inline slot out of range");
+  static_assert(sizeof(ValueType) <= sizeof(InlineStorage) &&
+                alignof(ValueType) <= alignof(InlineStorage),
+                "value of inline tag must fit in an inline slot");
+  static_assert(std::is_trivially_copyable<ValueType>::value,
+                "value of inline tag must be trivially copyable");
+
+  new (&m_inlineTags[slot]) ValueType(value);
+  m_inlineMask |= (1 << slot);
+}
+
+template<typename T>
+void
+TagHost::eraseInline() const
+{
+  constexpr int slot = detail::InlineTagSlot<T>::value;
+  static_assert(slot >= 0 && slot < N_INLINE_SLOTS, "inline slot out of range");
+
+  m_inlineMask &= ~(1 << slot);
 }
 
 } // namespace ndn
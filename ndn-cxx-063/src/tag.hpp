@@ -22,6 +22,8 @@
 #ifndef NDN_TAG_HPP
 #define NDN_TAG_HPP
 
+#include <type_traits>
+
 namespace ndn {
 
 /**
@@ -58,6 +60,8 @@ template<typename T, int TypeId>
 class SimpleTag : public Tag
 {
 public:
+  using ValueType = T;
+
   static constexpr int
   getTypeId() noexcept
   {
@@ -92,6 +96,22 @@ private:
   T m_value;
 };
 
+namespace detail {
+
+/** @brief selects the inline slot of TagHost where a tag of type T is stored by value
+ *
+ *  The primary template places every tag type in the map of TagHost.
+ *  A well-known SimpleTag whose value is trivially copyable and fits in 8 octets may be
+ *  assigned an inline slot by specializing this template next to the tag's definition.
+ *  @sa lp/tags.hpp
+ */
+template<typename T>
+struct InlineTagSlot : std::integral_constant<int, -1>
+{
+};
+
+} // namespace detail
+
 } // namespace ndn
 
 #endif // NDN_TAG_HPP
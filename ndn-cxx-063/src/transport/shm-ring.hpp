@@ -0,0 +1,328 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2018 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_TRANSPORT_SHM_RING_HPP
+#define NDN_TRANSPORT_SHM_RING_HPP
+
+#include "../common.hpp"
+#include "../encoding/block.hpp"
+#include "../encoding/tlv.hpp"
+
+#include <atomic>
+#include <cstring>
+
+namespace ndn {
+namespace shm {
+
+/** \brief Layout of the shared memory segment used by the shared-memory face.
+ *
+ *  The forwarder creates the segment and passes it to the client over a Unix socket,
+ *  together with one eventfd per endpoint. The segment contains:
+ *  \li a SegmentHeader
+ *  \li two RingControl blocks: client-to-forwarder and forwarder-to-client
+ *  \li the data area of each ring, \p ringCapacity octets each
+ *
+ *  Each ring has exactly one producer and one consumer. An endpoint only signals the
+ *  eventfd of its peer when the peer has announced that it is about to sleep, so that
+ *  no system call is made while both sides are busy.
+ */
+enum : uint32_t {
+  SEGMENT_MAGIC = 0x4e444e52, // "NDNR"
+  SEGMENT_VERSION = 1
+};
+
+enum RingIndex : size_t {
+  RING_TO_FORWARDER = 0,
+  RING_TO_CLIENT = 1,
+  N_RINGS = 2
+};
+
+/** \brief minimum ring capacity, large enough for one NDN packet of maximum size
+ */
+const size_t MIN_RING_CAPACITY = 65536;
+
+/** \brief default ring capacity
+ */
+const size_t DEFAULT_RING_CAPACITY = 4194304;
+
+static_assert(MIN_RING_CAPACITY >= MAX_NDN_PACKET_SIZE + sizeof(uint32_t),
+              "a ring must be able to hold a packet of maximum size");
+
+struct SegmentHeader
+{
+  uint32_t magic;
+  uint32_t version;
+  uint64_t ringCapacity;
+};
+
+/** \brief control block of one ring in shared memory
+ *
+ *  \c head is written only by the consumer and \c tail only by the producer;
+ *  they live on separate cache lines to avoid false sharing.
+ */
+struct RingControl
+{
+  alignas(64) std::atomic<uint64_t> head;
+  std::atomic<uint32_t> consumerWaiting;
+  alignas(64) std::atomic<uint64_t> tail;
+  std::atomic<uint32_t> producerWaiting;
+};
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+              "shared memory rings require lock-free atomics");
+
+const size_t SEGMENT_HEADER_SIZE = 64;
+
+/** \return whether \p capacity is a valid ring capacity
+ */
+inline bool
+isValidRingCapacity(uint64_t capacity)
+{
+  return capacity >= MIN_RING_CAPACITY && (capacity & (capacity - 1)) == 0;
+}
+
+/** \return total size of a segment whose rings have \p ringCapacity octets each
+ */
+inline size_t
+getSegmentSize(size_t ringCapacity)
+{
+  return SEGMENT_HEADER_SIZE + N_RINGS * sizeof(RingControl) + N_RINGS * ringCapacity;
+}
+
+/** \brief a view of a single-producer single-consumer ring of length-prefixed records
+ *
+ *  A Ring object does not own any memory. Two processes construct a Ring over the same
+ *  segment; one of them only calls producer functions and the other only consumer functions.
+ */
+class Ring : noncopyable
+{
+public:
+  /** \brief construct a view of ring \p index within a mapped segment
+   *  \pre the segment header has been initialized
+   */
+  Ring(uint8_t* segment, RingIndex index)
+  {
+    const auto* header = reinterpret_cast<const SegmentHeader*>(segment);
+    m_capacity = header->ringCapacity;
+    m_mask = m_capacity - 1;
+    m_control = reinterpret_cast<RingControl*>(segment + SEGMENT_HEADER_SIZE) + index;
+    m_data = segment + SEGMENT_HEADER_SIZE + N_RINGS * sizeof(RingControl) + index * m_capacity;
+  }
+
+  /** \brief initialize a segment of getSegmentSize(\p ringCapacity) octets
+   *  \pre isValidRingCapacity(ringCapacity)
+   */
+  static void
+  initializeSegment(uint8_t* segment, size_t ringCapacity)
+  {
+    auto* header = reinterpret_cast<SegmentHeader*>(segment);
+    header->magic = SEGMENT_MAGIC;
+    header->version = SEGMENT_VERSION;
+    header->ringCapacity = ringCapacity;
+
+    auto* control = reinterpret_cast<RingControl*>(segment + SEGMENT_HEADER_SIZE);
+    for (size_t i = 0; i < N_RINGS; ++i) {
+      new (&control[i]) RingControl;
+      control[i].head.store(0);
+      control[i].tail.store(0);
+      control[i].consumerWaiting.store(0);
+      control[i].producerWaiting.store(0);
+    }
+  }
+
+  /** \return whether a mapped segment of \p size octets has a valid header
+   */
+  static bool
+  isValidSegment(const uint8_t* segment, size_t size)
+  {
+    if (size < SEGMENT_HEADER_SIZE) {
+      return false;
+    }
+    const auto* header = reinterpret_cast<const SegmentHeader*>(segment);
+    return header->magic == SEGMENT_MAGIC &&
+           header->version == SEGMENT_VERSION &&
+           isValidRingCapacity(header->ringCapacity) &&
+           getSegmentSize(header->ringCapacity) == size;
+  }
+
+  size_t
+  getCapacity() const
+  {
+    return m_capacity;
+  }
+
+  /** \return number of octets occupied by records, including their length prefixes
+   */
+  size_t
+  getUsedSpace() const
+  {
+    return m_control->tail.load(std::memory_order_acquire) -
+           m_control->head.load(std::memory_order_acquire);
+  }
+
+  /** \return number of octets a record carrying \p payloadSize octets occupies
+   */
+  static size_t
+  getRecordSize(size_t payloadSize)
+  {
+    return sizeof(uint32_t) + payloadSize;
+  }
+
+public: // producer
+  /** \brief append a record containing \p first followed by \p second
+   *  \param second may be an empty Block
+   *  \return true if the record was appended, false if there is not enough space
+   */
+  bool
+  tryWrite(const Block& first, const Block& second = Block())
+  {
+    size_t secondSize = second.hasWire() ? second.size() : 0;
+    uint32_t length = static_cast<uint32_t>(first.size() + secondSize);
+    size_t recordSize = getRecordSize(length);
+    uint64_t tail = m_control->tail.load(std::memory_order_relaxed);
+    uint64_t head = m_control->head.load(std::memory_order_acquire);
+    if (m_capacity - (tail - head) < recordSize) {
+      return false;
+    }
+
+    copyIn(tail, reinterpret_cast<const uint8_t*>(&length), sizeof(length));
+    copyIn(tail + sizeof(length), first.wire(), first.size());
+    if (secondSize > 0) {
+      copyIn(tail + sizeof(length) + first.size(), second.wire(), second.size());
+    }
+    m_control->tail.store(tail + recordSize, std::memory_order_release);
+    return true;
+  }
+
+  /** \brief announce that the producer will sleep until a record of \p recordSize octets fits
+   *  \return false if enough space became available in the meantime; the producer should
+   *          retry instead of sleeping
+   */
+  bool
+  prepareProducerWait(size_t recordSize)
+  {
+    m_control->producerWaiting.store(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_capacity - getUsedSpace() >= recordSize) {
+      m_control->producerWaiting.store(0);
+      return false;
+    }
+    return true;
+  }
+
+  /** \brief called by the producer after appending one or more records
+   *  \return whether the consumer is sleeping and its eventfd must be signaled
+   */
+  bool
+  shouldWakeConsumer()
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return m_control->consumerWaiting.load(std::memory_order_relaxed) != 0 &&
+           m_control->consumerWaiting.exchange(0) != 0;
+  }
+
+public: // consumer
+  /** \brief remove the oldest record
+   *  \param[out] block the record, parsed as a TLV block
+   *  \return false if the ring is empty
+   *  \throw tlv::Error the record is not a valid TLV block; it is removed nevertheless,
+   *                    unless its length prefix is corrupted
+   */
+  bool
+  tryRead(Block& block)
+  {
+    uint64_t head = m_control->head.load(std::memory_order_relaxed);
+    uint64_t tail = m_control->tail.load(std::memory_order_acquire);
+    if (head == tail) {
+      return false;
+    }
+
+    uint32_t length = 0;
+    copyOut(head, reinterpret_cast<uint8_t*>(&length), sizeof(length));
+    if (length == 0 || length > MAX_NDN_PACKET_SIZE || getRecordSize(length) > tail - head) {
+      BOOST_THROW_EXCEPTION(tlv::Error("Corrupted record in shared memory ring"));
+    }
+
+    auto buffer = make_shared<Buffer>(length);
+    copyOut(head + sizeof(length), buffer->data(), length);
+    m_control->head.store(head + getRecordSize(length), std::memory_order_release);
+
+    block = Block(buffer);
+    return true;
+  }
+
+  /** \brief announce that the consumer will sleep until a record is appended
+   *  \return false if a record was appended in the meantime; the consumer should
+   *          retry instead of sleeping
+   */
+  bool
+  prepareConsumerWait()
+  {
+    m_control->consumerWaiting.store(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (getUsedSpace() > 0) {
+      m_control->consumerWaiting.store(0);
+      return false;
+    }
+    return true;
+  }
+
+  /** \brief called by the consumer after removing one or more records
+   *  \return whether the producer is sleeping and its eventfd must be signaled
+   */
+  bool
+  shouldWakeProducer()
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return m_control->producerWaiting.load(std::memory_order_relaxed) != 0 &&
+           m_control->producerWaiting.exchange(0) != 0;
+  }
+
+private:
+  void
+  copyIn(uint64_t pos, const uint8_t* src, size_t size)
+  {
+    size_t offset = pos & m_mask;
+    size_t first = std::min(size, m_capacity - offset);
+    std::memcpy(m_data + offset, src, first);
+    std::memcpy(m_data, src + first, size - first);
+  }
+
+  void
+  copyOut(uint64_t pos, uint8_t* dest, size_t size) const
+  {
+    size_t offset = pos & m_mask;
+    size_t first = std::min(size, m_capacity - offset);
+    std::memcpy(dest, m_data + offset, first);
+    std::memcpy(dest + first, m_data, size - first);
+  }
+
+private:
+  RingControl* m_control;
+  uint8_t* m_data;
+  size_t m_capacity;
+  size_t m_mask;
+};
+
+} // namespace shm
+} // namespace ndn
+
+#endif // NDN_TRANSPORT_SHM_RING_HPP
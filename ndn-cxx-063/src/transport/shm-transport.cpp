@@ -0,0 +1,548 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2018 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "shm-transport.hpp"
+#include "shm-ring.hpp"
+
+#include "../face.hpp"
+#include "net/face-uri.hpp"
+#include "util/logger.hpp"
+
+#include <boost/asio/deadline_timer.hpp>
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/posix/stream_descriptor.hpp>
+
+#include <deque>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+NDN_LOG_INIT(ndn.ShmTransport);
+// DEBUG level: connect, close, pause, resume.
+
+namespace ndn {
+
+/** \brief maximum number of packets received in one round before yielding to other handlers
+ */
+static const size_t MAX_RECEIVE_BATCH = 64;
+
+class ShmTransport::Impl : public std::enable_shared_from_this<ShmTransport::Impl>
+{
+public:
+  Impl(ShmTransport& transport, boost::asio::io_service& ioService)
+    : m_transport(transport)
+    , m_ioService(ioService)
+    , m_socket(ioService)
+    , m_doorbell(ioService)
+    , m_connectTimer(ioService)
+  {
+  }
+
+  ~Impl()
+  {
+    releaseResources();
+  }
+
+  void
+  connect(const std::string& path)
+  {
+    if (!m_isConnecting && !m_transport.m_isConnected) {
+      m_isConnecting = true;
+
+      // Wait at most 4 seconds to connect and receive the shared memory segment
+      m_connectTimer.expires_from_now(boost::posix_time::seconds(4));
+      m_connectTimer.async_wait(bind(&Impl::connectTimeoutHandler, this->shared_from_this(), _1));
+
+      m_socket.open();
+      m_socket.async_connect(boost::asio::local::stream_protocol::endpoint(path),
+                             bind(&Impl::connectHandler, this->shared_from_this(), _1));
+    }
+  }
+
+  void
+  close()
+  {
+    m_isConnecting = false;
+    releaseResources();
+    m_transport.m_isConnected = false;
+    m_transport.m_isReceiving = false;
+  }
+
+  void
+  pause()
+  {
+    if (m_isConnecting)
+      return;
+
+    m_transport.m_isReceiving = false;
+  }
+
+  void
+  resume()
+  {
+    if (m_isConnecting)
+      return;
+
+    if (!m_transport.m_isReceiving) {
+      m_transport.m_isReceiving = true;
+      schedulePoll();
+    }
+  }
+
+  void
+  send(const Block& header, const Block& payload)
+  {
+    if (!m_transport.m_isConnected) {
+      // next write will be scheduled in handshakeHandler
+      m_sendQueue.emplace_back(header, payload);
+      return;
+    }
+
+    if (m_sendQueue.empty() && m_txRing->tryWrite(header, payload)) {
+      if (m_txRing->shouldWakeConsumer()) {
+        notifyPeer();
+      }
+      return;
+    }
+
+    m_sendQueue.emplace_back(header, payload);
+    flushSendQueue();
+  }
+
+private:
+  void
+  connectHandler(const boost::system::error_code& error)
+  {
+    if (error) {
+      if (error == boost::asio::error::operation_aborted)
+        return;
+
+      m_transport.close();
+      BOOST_THROW_EXCEPTION(Transport::Error(error, "error while connecting to the forwarder"));
+    }
+
+    // the forwarder sends the segment right after accepting the connection
+    m_socket.async_read_some(boost::asio::null_buffers(),
+                             bind(&Impl::handshakeHandler, this->shared_from_this(), _1));
+  }
+
+  void
+  handshakeHandler(const boost::system::error_code& error)
+  {
+    if (error == boost::asio::error::operation_aborted)
+      return;
+
+    m_isConnecting = false;
+    m_connectTimer.cancel();
+
+    if (error) {
+      m_transport.close();
+      BOOST_THROW_EXCEPTION(Transport::Error(error, "error while connecting to the forwarder"));
+    }
+
+    try {
+      receiveSegment();
+    }
+    catch (const Transport::Error&) {
+      m_transport.close();
+      throw;
+    }
+
+    m_transport.m_isConnected = true;
+    watchSocket();
+
+    if (!m_sendQueue.empty()) {
+      resume();
+      flushSendQueue();
+    }
+  }
+
+  void
+  connectTimeoutHandler(const boost::system::error_code& error)
+  {
+    if (error) // e.g., cancelled timer
+      return;
+
+    m_transport.close();
+    BOOST_THROW_EXCEPTION(Transport::Error(error, "error while connecting to the forwarder"));
+  }
+
+  /** \brief receive the shared memory segment and eventfds sent by the forwarder
+   */
+  void
+  receiveSegment()
+  {
+    int fd = m_socket.native_handle();
+
+    uint8_t version = 0;
+    iovec iov{&version, sizeof(version)};
+    union {
+      cmsghdr align;
+      char buf[CMSG_SPACE(3 * sizeof(int))];
+    } control;
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+
+    ssize_t nBytes = ::recvmsg(fd, &msg, MSG_DONTWAIT | MSG_CMSG_CLOEXEC);
+
+    // every descriptor received is owned by this process, whether or not the message is valid
+    std::vector<int> received;
+    for (cmsghdr* cmsg = nBytes >= 0 ? CMSG_FIRSTHDR(&msg) : nullptr; cmsg != nullptr;
+         cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+      if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS) {
+        size_t nFds = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        const uint8_t* data = CMSG_DATA(cmsg);
+        for (size_t i = 0; i < nFds; ++i) {
+          int receivedFd = -1;
+          std::memcpy(&receivedFd, data + i * sizeof(int), sizeof(int));
+          received.push_back(receivedFd);
+        }
+      }
+    }
+
+    if (nBytes != sizeof(version) || (msg.msg_flags & MSG_CTRUNC) != 0 || received.size() != 3) {
+      for (int receivedFd : received) {
+        ::close(receivedFd);
+      }
+      BOOST_THROW_EXCEPTION(Transport::Error("forwarder did not send a shared memory segment"));
+    }
+
+    // segment, forwarder's eventfd, client's eventfd;
+    // from here on, the eventfds are closed by close() if the handshake fails
+    const int* fds = received.data();
+    m_peerDoorbell = fds[1];
+    m_doorbell.assign(fds[2]);
+
+    struct stat st;
+    if (version != shm::SEGMENT_VERSION || ::fstat(fds[0], &st) < 0) {
+      ::close(fds[0]);
+      BOOST_THROW_EXCEPTION(Transport::Error("unsupported shared memory segment"));
+    }
+
+    void* addr = ::mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fds[0], 0);
+    ::close(fds[0]);
+    if (addr == MAP_FAILED) {
+      BOOST_THROW_EXCEPTION(Transport::Error("cannot map shared memory segment: "s +
+                                             std::strerror(errno)));
+    }
+    m_segment = static_cast<uint8_t*>(addr);
+    m_segmentSize = st.st_size;
+
+    if (!shm::Ring::isValidSegment(m_segment, m_segmentSize)) {
+      BOOST_THROW_EXCEPTION(Transport::Error("unsupported shared memory segment"));
+    }
+    m_txRing = make_unique<shm::Ring>(m_segment, shm::RING_TO_FORWARDER);
+    m_rxRing = make_unique<shm::Ring>(m_segment, shm::RING_TO_CLIENT);
+  }
+
+  /** \brief detect when the forwarder closes the socket
+   */
+  void
+  watchSocket()
+  {
+    m_socket.async_read_some(boost::asio::buffer(&m_socketBuffer, sizeof(m_socketBuffer)),
+      bind(&Impl::handleSocketRead, this->shared_from_this(), _1));
+  }
+
+  void
+  handleSocketRead(const boost::system::error_code& error)
+  {
+    if (error == boost::asio::error::operation_aborted || m_segment == nullptr) {
+      return;
+    }
+
+    m_transport.close();
+    BOOST_THROW_EXCEPTION(Transport::Error(error, "error while receiving data from socket"));
+  }
+
+  void
+  schedulePoll()
+  {
+    if (!m_isPollScheduled) {
+      m_isPollScheduled = true;
+      m_ioService.post(bind(&Impl::poll, this->shared_from_this()));
+    }
+  }
+
+  /** \brief drain the receive ring and the send queue
+   *
+   *  While packets keep arriving, polling is rescheduled through the io_service without any
+   *  system call. The eventfd is only armed after a round that found the receive ring empty.
+   */
+  void
+  poll()
+  {
+    m_isPollScheduled = false;
+    if (m_segment == nullptr) {
+      return;
+    }
+
+    size_t nReceived = 0;
+    Block block;
+    while (nReceived < MAX_RECEIVE_BATCH && m_transport.m_isReceiving) {
+      try {
+        if (!m_rxRing->tryRead(block)) {
+          break;
+        }
+      }
+      catch (const tlv::Error& e) {
+        m_transport.close();
+        BOOST_THROW_EXCEPTION(Transport::Error("error while receiving data from socket: "s + e.what()));
+      }
+      ++nReceived;
+      m_transport.receive(block);
+      if (m_segment == nullptr) {
+        return; // transport was closed by the receive callback
+      }
+    }
+
+    if (nReceived > 0 && m_rxRing->shouldWakeProducer()) {
+      notifyPeer();
+    }
+
+    flushSendQueue();
+
+    if (nReceived > 0 ||
+        (m_transport.m_isReceiving && !m_rxRing->prepareConsumerWait())) {
+      schedulePoll();
+    }
+    else {
+      armDoorbell();
+    }
+  }
+
+  void
+  flushSendQueue()
+  {
+    bool hasWritten = false;
+    while (!m_sendQueue.empty()) {
+      const auto& record = m_sendQueue.front();
+      if (m_txRing->tryWrite(record.first, record.second)) {
+        m_sendQueue.pop_front();
+        hasWritten = true;
+        continue;
+      }
+
+      size_t payloadSize = record.first.size() + (record.second.hasWire() ? record.second.size() : 0);
+      if (m_txRing->prepareProducerWait(shm::Ring::getRecordSize(payloadSize))) {
+        armDoorbell();
+        break;
+      }
+    }
+
+    if (hasWritten && m_txRing->shouldWakeConsumer()) {
+      notifyPeer();
+    }
+  }
+
+  void
+  armDoorbell()
+  {
+    if (m_isDoorbellArmed) {
+      return;
+    }
+
+    m_isDoorbellArmed = true;
+    m_doorbell.async_read_some(boost::asio::buffer(&m_doorbellValue, sizeof(m_doorbellValue)),
+      bind(&Impl::handleDoorbell, this->shared_from_this(), _1));
+  }
+
+  void
+  handleDoorbell(const boost::system::error_code& error)
+  {
+    m_isDoorbellArmed = false;
+    if (error == boost::asio::error::operation_aborted || m_segment == nullptr) {
+      return;
+    }
+
+    if (error) {
+      m_transport.close();
+      BOOST_THROW_EXCEPTION(Transport::Error(error, "error while waiting for the forwarder"));
+    }
+
+    poll();
+  }
+
+  void
+  notifyPeer()
+  {
+    uint64_t value = 1;
+    ssize_t nBytes = ::write(m_peerDoorbell, &value, sizeof(value));
+    if (nBytes != sizeof(value) && errno != EAGAIN) {
+      NDN_LOG_DEBUG("cannot signal forwarder: " << std::strerror(errno));
+    }
+  }
+
+  void
+  releaseResources()
+  {
+    boost::system::error_code error; // to silently ignore all errors
+    m_connectTimer.cancel(error);
+    m_socket.cancel(error);
+    m_socket.close(error);
+    m_doorbell.cancel(error);
+    m_doorbell.close(error);
+
+    if (m_peerDoorbell >= 0) {
+      ::close(m_peerDoorbell);
+      m_peerDoorbell = -1;
+    }
+
+    m_txRing.reset();
+    m_rxRing.reset();
+    if (m_segment != nullptr) {
+      ::munmap(m_segment, m_segmentSize);
+      m_segment = nullptr;
+    }
+
+    m_sendQueue.clear();
+  }
+
+private:
+  ShmTransport& m_transport;
+  boost::asio::io_service& m_ioService;
+  boost::asio::local::stream_protocol::socket m_socket;
+  boost::asio::posix::stream_descriptor m_doorbell;
+  int m_peerDoorbell = -1;
+  bool m_isConnecting = false;
+  boost::asio::deadline_timer m_connectTimer;
+
+  uint8_t* m_segment = nullptr;
+  size_t m_segmentSize = 0;
+  unique_ptr<shm::Ring> m_txRing;
+  unique_ptr<shm::Ring> m_rxRing;
+
+  std::deque<std::pair<Block, Block>> m_sendQueue;
+  uint64_t m_doorbellValue = 0;
+  uint8_t m_socketBuffer = 0;
+  bool m_isDoorbellArmed = false;
+  bool m_isPollScheduled = false;
+};
+
+ShmTransport::ShmTransport(const std::string& unixSocket)
+  : m_unixSocket(unixSocket)
+{
+}
+
+ShmTransport::~ShmTransport()
+{
+  // pending handlers keep Impl alive; make sure they no longer touch this transport
+  if (m_impl != nullptr) {
+    m_impl->close();
+  }
+}
+
+std::string
+ShmTransport::getSocketNameFromUri(const std::string& uriString)
+{
+  // Assume the default nfd-shm.sock location.
+  std::string path = "/var/run/nfd-shm.sock";
+
+  if (uriString.empty()) {
+    return path;
+  }
+
+  try {
+    const FaceUri uri(uriString);
+
+    if (uri.getScheme() != "shm") {
+      BOOST_THROW_EXCEPTION(Error("Cannot create ShmTransport from \"" +
+                                  uri.getScheme() + "\" URI"));
+    }
+
+    if (!uri.getPath().empty()) {
+      path = uri.getPath();
+    }
+  }
+  catch (const FaceUri::Error& error) {
+    BOOST_THROW_EXCEPTION(Error(error.what()));
+  }
+
+  return path;
+}
+
+shared_ptr<ShmTransport>
+ShmTransport::create(const std::string& uri)
+{
+  return make_shared<ShmTransport>(getSocketNameFromUri(uri));
+}
+
+void
+ShmTransport::connect(boost::asio::io_service& ioService,
+                      const ReceiveCallback& receiveCallback)
+{
+  NDN_LOG_DEBUG("connect path=" << m_unixSocket);
+
+  if (m_impl == nullptr) {
+    Transport::connect(ioService, receiveCallback);
+
+    m_impl = make_shared<Impl>(ref(*this), ref(ioService));
+  }
+
+  m_impl->connect(m_unixSocket);
+}
+
+void
+ShmTransport::send(const Block& wire)
+{
+  BOOST_ASSERT(m_impl != nullptr);
+  m_impl->send(wire, Block());
+}
+
+void
+ShmTransport::send(const Block& header, const Block& payload)
+{
+  BOOST_ASSERT(m_impl != nullptr);
+  m_impl->send(header, payload);
+}
+
+void
+ShmTransport::close()
+{
+  BOOST_ASSERT(m_impl != nullptr);
+  NDN_LOG_DEBUG("close");
+  m_impl->close();
+  m_impl.reset();
+}
+
+void
+ShmTransport::pause()
+{
+  if (m_impl != nullptr) {
+    NDN_LOG_DEBUG("pause");
+    m_impl->pause();
+  }
+}
+
+void
+ShmTransport::resume()
+{
+  BOOST_ASSERT(m_impl != nullptr);
+  NDN_LOG_DEBUG("resume");
+  m_impl->resume();
+}
+
+} // namespace ndn
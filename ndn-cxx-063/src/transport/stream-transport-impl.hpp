@@ -44,10 +44,24 @@ public:
   typedef std::list<Block> BlockSequence;
   typedef std::list<BlockSequence> TransmissionQueue;
 
+  /** \brief maximum number of octets written by a single write operation
+   *
+   *  Sequences queued while a write is in progress are gathered into the next write,
+   *  up to this many octets. A single sequence is always written even if it is larger.
+   */
+  static constexpr size_t MAX_WRITE_BATCH_SIZE = 131072;
+
+  /** \brief maximum number of buffers written by a single write operation
+   *
+   *  Boost.Asio passes at most 64 buffers to each writev call.
+   */
+  static constexpr size_t MAX_WRITE_BATCH_BUFFERS = 64;
+
   StreamTransportImpl(BaseTransport& transport, boost::asio::io_service& ioService)
     : m_transport(transport)
     , m_socket(ioService)
     , m_inputBufferSize(0)
+    , m_nWritingSequences(0)
     , m_isConnecting(false)
     , m_connectTimer(ioService)
   {
@@ -82,6 +96,7 @@ public:
     m_transport.m_isConnected = false;
     m_transport.m_isReceiving = false;
     m_transmissionQueue.clear();
+    m_nWritingSequences = 0;
   }
 
   void
@@ -163,24 +178,48 @@ protected:
   {
     m_transmissionQueue.emplace_back(sequence);
 
-    if (m_transport.m_isConnected && m_transmissionQueue.size() == 1) {
+    if (m_transport.m_isConnected && m_nWritingSequences == 0) {
       asyncWrite();
     }
 
-    // if not connected or there is transmission in progress (m_transmissionQueue.size() > 1),
+    // if not connected or there is transmission in progress (m_nWritingSequences > 0),
     // next write will be scheduled either in connectHandler or in asyncWriteHandler
   }
 
+  /** \brief write the queued sequences, as many as the batch limits allow, with one async_write
+   */
   void
   asyncWrite()
   {
     BOOST_ASSERT(!m_transmissionQueue.empty());
-    boost::asio::async_write(m_socket, m_transmissionQueue.front(),
-      bind(&Impl::handleAsyncWrite, this->shared_from_this(), _1, m_transmissionQueue.begin()));
+    BOOST_ASSERT(m_nWritingSequences == 0);
+
+    m_writeBuffers.clear();
+    size_t nBytes = 0;
+    for (const BlockSequence& sequence : m_transmissionQueue) {
+      size_t sequenceSize = 0;
+      for (const Block& block : sequence) {
+        sequenceSize += block.size();
+      }
+      if (m_nWritingSequences > 0 &&
+          (nBytes + sequenceSize > MAX_WRITE_BATCH_SIZE ||
+           m_writeBuffers.size() + sequence.size() > MAX_WRITE_BATCH_BUFFERS)) {
+        break;
+      }
+
+      for (const Block& block : sequence) {
+        m_writeBuffers.push_back(boost::asio::buffer(block.wire(), block.size()));
+      }
+      nBytes += sequenceSize;
+      ++m_nWritingSequences;
+    }
+
+    boost::asio::async_write(m_socket, m_writeBuffers,
+      bind(&Impl::handleAsyncWrite, this->shared_from_this(), _1));
   }
 
   void
-  handleAsyncWrite(const boost::system::error_code& error, TransmissionQueue::iterator queueItem)
+  handleAsyncWrite(const boost::system::error_code& error)
   {
     if (error) {
       if (error == boost::system::errc::operation_canceled) {
@@ -196,7 +235,11 @@ protected:
       return; // queue has been already cleared
     }
 
-    m_transmissionQueue.erase(queueItem);
+    BOOST_ASSERT(m_nWritingSequences <= m_transmissionQueue.size());
+    auto end = m_transmissionQueue.begin();
+    std::advance(end, m_nWritingSequences);
+    m_transmissionQueue.erase(m_transmissionQueue.begin(), end);
+    m_nWritingSequences = 0;
 
     if (!m_transmissionQueue.empty()) {
       asyncWrite();
@@ -273,11 +316,19 @@ protected:
   size_t m_inputBufferSize;
 
   TransmissionQueue m_transmissionQueue;
+  size_t m_nWritingSequences; ///< number of sequences at the front of m_transmissionQueue being written
+  std::vector<boost::asio::const_buffer> m_writeBuffers;
   bool m_isConnecting;
 
   boost::asio::deadline_timer m_connectTimer;
 };
 
+template<typename BaseTransport, typename Protocol>
+constexpr size_t StreamTransportImpl<BaseTransport, Protocol>::MAX_WRITE_BATCH_SIZE;
+
+template<typename BaseTransport, typename Protocol>
+constexpr size_t StreamTransportImpl<BaseTransport, Protocol>::MAX_WRITE_BATCH_BUFFERS;
+
 } // namespace ndn
 
 #endif // NDN_TRANSPORT_STREAM_TRANSPORT_IMPL_HPP
@@ -0,0 +1,489 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2018 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "packet-file.hpp"
+#include "../encoding/tlv.hpp"
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+namespace ndn {
+namespace util {
+
+/* Layout of a packet file:
+ *   magic (8 octets)
+ *   offset of the index (8 octets, big endian)
+ *   number of Data packets (8 octets, big endian)
+ *   Data packets
+ *   index: offset of every Data packet (8 octets each, big endian), in canonical order of names
+ */
+static const char MAGIC[] = {'N', 'D', 'N', 'P', 'K', 'T', 'F', '\x01'};
+static const size_t MAGIC_SIZE = sizeof(MAGIC);
+static const size_t HEADER_SIZE = MAGIC_SIZE + 2 * sizeof(uint64_t);
+
+const size_t PacketFileWriter::DEFAULT_SEGMENT_SIZE = 8000;
+const time::milliseconds PacketFileWriter::DEFAULT_FRESHNESS_PERIOD = 1_s;
+
+static void
+writeUint64(std::ostream& os, uint64_t value)
+{
+  uint8_t buf[sizeof(value)];
+  for (size_t i = 0; i < sizeof(value); ++i) {
+    buf[i] = static_cast<uint8_t>(value >> (8 * (sizeof(value) - 1 - i)));
+  }
+  os.write(reinterpret_cast<const char*>(buf), sizeof(buf));
+}
+
+static uint64_t
+readUint64(const uint8_t* buf)
+{
+  uint64_t value = 0;
+  for (size_t i = 0; i < sizeof(value); ++i) {
+    value = (value << 8) | buf[i];
+  }
+  return value;
+}
+
+/**
+ * @brief parse the outer TLV of a Data packet and the TLV-LENGTH of its Name
+ * @return whether [@p begin, @p end) starts with a well-formed Data header
+ */
+static bool
+parseDataHeader(const uint8_t* begin, const uint8_t* end, const uint8_t*& packetEnd,
+                const uint8_t*& nameBegin, const uint8_t*& nameEnd)
+{
+  const uint8_t* pos = begin;
+  uint32_t type = 0;
+  uint64_t length = 0;
+  if (!tlv::readType(pos, end, type) || type != tlv::Data ||
+      !tlv::readVarNumber(pos, end, length) || length > static_cast<uint64_t>(end - pos)) {
+    return false;
+  }
+  packetEnd = pos + length;
+
+  if (!tlv::readType(pos, packetEnd, type) || type != tlv::Name ||
+      !tlv::readVarNumber(pos, packetEnd, length) || length > static_cast<uint64_t>(packetEnd - pos)) {
+    return false;
+  }
+  nameBegin = pos;
+  nameEnd = pos + length;
+  return true;
+}
+
+/**
+ * @brief compare names by their TLV-VALUE
+ *
+ * Because NameComponents are self-delimiting and VAR-NUMBER encoding preserves the order of
+ * numbers, the lexicographical order of the TLV-VALUE of names is their canonical order.
+ */
+static int
+compareNames(const uint8_t* aBegin, const uint8_t* aEnd, const uint8_t* bBegin, const uint8_t* bEnd)
+{
+  size_t aSize = aEnd - aBegin;
+  size_t bSize = bEnd - bBegin;
+  int res = std::memcmp(aBegin, bBegin, std::min(aSize, bSize));
+  if (res != 0) {
+    return res;
+  }
+  return aSize < bSize ? -1 : (aSize > bSize ? 1 : 0);
+}
+
+/**
+ * @return whether the name whose TLV-VALUE is [@p nameBegin, @p nameEnd) starts with the name
+ *         whose TLV-VALUE is [@p prefixBegin, @p prefixEnd)
+ */
+static bool
+isPrefixOf(const uint8_t* prefixBegin, const uint8_t* prefixEnd,
+           const uint8_t* nameBegin, const uint8_t* nameEnd)
+{
+  size_t prefixSize = prefixEnd - prefixBegin;
+  return static_cast<size_t>(nameEnd - nameBegin) >= prefixSize &&
+         std::memcmp(nameBegin, prefixBegin, prefixSize) == 0;
+}
+
+/**
+ * @brief advance @p pos past the NameComponent it points to
+ * @return whether a well-formed NameComponent ending before @p end was skipped
+ */
+static bool
+skipComponent(const uint8_t*& pos, const uint8_t* end)
+{
+  uint32_t type = 0;
+  uint64_t length = 0;
+  if (!tlv::readType(pos, end, type) || !tlv::readVarNumber(pos, end, length) ||
+      length > static_cast<uint64_t>(end - pos)) {
+    return false;
+  }
+  pos += length;
+  return true;
+}
+
+PacketFileWriter::PacketFileWriter(const std::string& filename)
+  : m_filename(filename)
+  , m_os(filename, std::ios::binary | std::ios::trunc)
+  , m_offset(HEADER_SIZE)
+{
+  // the header is rewritten when the file is closed
+  m_os.write(MAGIC, MAGIC_SIZE);
+  writeUint64(m_os, 0);
+  writeUint64(m_os, 0);
+  if (!m_os) {
+    BOOST_THROW_EXCEPTION(Error("Cannot open " + filename));
+  }
+}
+
+void
+PacketFileWriter::append(const Data& data)
+{
+  if (!m_os.is_open()) {
+    BOOST_THROW_EXCEPTION(Error("Packet file is closed"));
+  }
+
+  const Block& wire = data.wireEncode();
+  m_os.write(reinterpret_cast<const char*>(wire.wire()), wire.size());
+  if (!m_os) {
+    BOOST_THROW_EXCEPTION(Error("Cannot write to " + m_filename));
+  }
+
+  m_offsets.push_back(m_offset);
+  m_offset += wire.size();
+}
+
+uint64_t
+PacketFileWriter::appendObject(const Name& prefix, std::istream& is, KeyChain& keyChain,
+                               const security::SigningInfo& signingInfo,
+                               size_t segmentSize, time::milliseconds freshnessPeriod)
+{
+  BOOST_ASSERT(segmentSize > 0);
+
+  is.seekg(0, std::ios::end);
+  std::streamoff size = is.tellg();
+  is.seekg(0, std::ios::beg);
+  if (!is || size < 0) {
+    BOOST_THROW_EXCEPTION(Error("Cannot determine the size of the object"));
+  }
+
+  uint64_t nSegments = std::max<uint64_t>(1, (static_cast<uint64_t>(size) + segmentSize - 1) / segmentSize);
+  name::Component finalBlock = name::Component::fromSegment(nSegments - 1);
+
+  std::vector<char> buf(segmentSize);
+  uint64_t remaining = static_cast<uint64_t>(size);
+  for (uint64_t segment = 0; segment < nSegments; ++segment) {
+    size_t contentSize = static_cast<size_t>(std::min<uint64_t>(remaining, segmentSize));
+    is.read(buf.data(), contentSize);
+    if (static_cast<size_t>(is.gcount()) != contentSize) {
+      BOOST_THROW_EXCEPTION(Error("Cannot read the object"));
+    }
+    remaining -= contentSize;
+
+    Data data(Name(prefix).appendSegment(segment));
+    data.setContent(reinterpret_cast<const uint8_t*>(buf.data()), contentSize);
+    data.setFreshnessPeriod(freshnessPeriod);
+    data.setFinalBlock(finalBlock);
+    keyChain.sign(data, signingInfo);
+    this->append(data);
+  }
+  return nSegments;
+}
+
+void
+PacketFileWriter::close()
+{
+  if (!m_os.is_open()) {
+    return;
+  }
+
+  m_os.flush();
+  if (!m_os) {
+    BOOST_THROW_EXCEPTION(Error("Cannot write to " + m_filename));
+  }
+
+  // sort the index by reading the names from the packets written so far
+  if (!m_offsets.empty()) {
+    boost::iostreams::mapped_file_source file;
+    try {
+      file.open(m_filename, static_cast<size_t>(m_offset));
+    }
+    catch (const std::ios::failure& e) {
+      BOOST_THROW_EXCEPTION(Error("Cannot map " + m_filename + ": " + e.what()));
+    }
+    const uint8_t* begin = reinterpret_cast<const uint8_t*>(file.data());
+    const uint8_t* end = begin + m_offset;
+
+    struct Key
+    {
+      const uint8_t* nameBegin;
+      const uint8_t* nameEnd;
+      uint64_t offset;
+    };
+    std::vector<Key> keys;
+    keys.reserve(m_offsets.size());
+    for (uint64_t offset : m_offsets) {
+      Key key{nullptr, nullptr, offset};
+      const uint8_t* packetEnd = nullptr;
+      bool isOk = parseDataHeader(begin + offset, end, packetEnd, key.nameBegin, key.nameEnd);
+      BOOST_ASSERT(isOk);
+      (void)isOk;
+      keys.push_back(key);
+    }
+
+    std::sort(keys.begin(), keys.end(), [] (const Key& a, const Key& b) {
+      return compareNames(a.nameBegin, a.nameEnd, b.nameBegin, b.nameEnd) < 0;
+    });
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+      if (i > 0 && compareNames(keys[i - 1].nameBegin, keys[i - 1].nameEnd,
+                                keys[i].nameBegin, keys[i].nameEnd) == 0) {
+        Name name;
+        name.wireDecode(Block(tlv::Name, make_shared<Buffer>(keys[i].nameBegin, keys[i].nameEnd)));
+        BOOST_THROW_EXCEPTION(Error("Duplicate Data name " + name.toUri()));
+      }
+      m_offsets[i] = keys[i].offset;
+    }
+  }
+
+  m_os.seekp(0, std::ios::end);
+  for (uint64_t offset : m_offsets) {
+    writeUint64(m_os, offset);
+  }
+  m_os.seekp(MAGIC_SIZE);
+  writeUint64(m_os, m_offset);
+  writeUint64(m_os, m_offsets.size());
+  m_os.close();
+  if (!m_os) {
+    BOOST_THROW_EXCEPTION(Error("Cannot write to " + m_filename));
+  }
+}
+
+PacketFile::PacketFile(const std::string& filename)
+  : m_file(make_unique<boost::iostreams::mapped_file_source>())
+{
+  try {
+    m_file->open(filename);
+  }
+  catch (const std::ios::failure& e) {
+    BOOST_THROW_EXCEPTION(Error("Cannot map " + filename + ": " + e.what()));
+  }
+
+  m_begin = reinterpret_cast<const uint8_t*>(m_file->data());
+  m_end = m_begin + m_file->size();
+  if (m_file->size() < HEADER_SIZE || std::memcmp(m_begin, MAGIC, MAGIC_SIZE) != 0) {
+    BOOST_THROW_EXCEPTION(Error(filename + " is not a packet file"));
+  }
+
+  uint64_t indexOffset = readUint64(m_begin + MAGIC_SIZE);
+  uint64_t nPackets = readUint64(m_begin + MAGIC_SIZE + sizeof(uint64_t));
+  if (indexOffset < HEADER_SIZE || indexOffset > m_file->size() ||
+      nPackets != (m_file->size() - indexOffset) / sizeof(uint64_t) ||
+      (m_file->size() - indexOffset) % sizeof(uint64_t) != 0) {
+    BOOST_THROW_EXCEPTION(Error(filename + " is incomplete or corrupted"));
+  }
+  m_index = m_begin + indexOffset;
+  m_nPackets = static_cast<size_t>(nPackets);
+}
+
+PacketFile::~PacketFile() = default;
+
+PacketFile::Packet
+PacketFile::getPacket(size_t i) const
+{
+  BOOST_ASSERT(i < m_nPackets);
+
+  uint64_t offset = readUint64(m_index + i * sizeof(uint64_t));
+  Packet packet;
+  packet.begin = m_begin + offset;
+  if (offset < HEADER_SIZE || packet.begin >= m_index ||
+      !parseDataHeader(packet.begin, m_index, packet.end, packet.nameBegin, packet.nameEnd)) {
+    BOOST_THROW_EXCEPTION(Error("Malformed packet at offset " + to_string(offset)));
+  }
+  return packet;
+}
+
+size_t
+PacketFile::lowerBound(const uint8_t* nameBegin, const uint8_t* nameEnd) const
+{
+  size_t first = 0;
+  size_t count = m_nPackets;
+  while (count > 0) {
+    size_t step = count / 2;
+    Packet packet = this->getPacket(first + step);
+    if (compareNames(packet.nameBegin, packet.nameEnd, nameBegin, nameEnd) < 0) {
+      first += step + 1;
+      count -= step + 1;
+    }
+    else {
+      count = step;
+    }
+  }
+  return first;
+}
+
+size_t
+PacketFile::prefixUpperBound(size_t first, const uint8_t* prefixBegin, const uint8_t* prefixEnd) const
+{
+  size_t count = m_nPackets - first;
+  while (count > 0) {
+    size_t step = count / 2;
+    Packet packet = this->getPacket(first + step);
+    if (isPrefixOf(prefixBegin, prefixEnd, packet.nameBegin, packet.nameEnd)) {
+      first += step + 1;
+      count -= step + 1;
+    }
+    else {
+      count = step;
+    }
+  }
+  return first;
+}
+
+Block
+PacketFile::getWire(size_t i) const
+{
+  Packet packet = this->getPacket(i);
+  // Block must own its buffer, so the packet is copied out of the mapping
+  return Block(packet.begin, packet.end - packet.begin);
+}
+
+shared_ptr<const Data>
+PacketFile::find(const Interest& interest) const
+{
+  const Name& name = interest.getName();
+  bool hasDigest = !name.empty() && name[-1].isImplicitSha256Digest();
+  bool wantExact = hasDigest || !interest.getCanBePrefix();
+
+  Block nameWire = hasDigest ? name.getPrefix(-1).wireEncode() : name.wireEncode();
+  const uint8_t* prefixBegin = nameWire.value();
+  const uint8_t* prefixEnd = prefixBegin + nameWire.value_size();
+
+  // candidates are the Data packets under the Interest name, in [first, last)
+  size_t first = this->lowerBound(prefixBegin, prefixEnd);
+  size_t last = first;
+  if (wantExact) {
+    // names are unique, so only the first candidate can be named exactly as the Interest
+    if (first < m_nPackets) {
+      Packet packet = this->getPacket(first);
+      if (compareNames(packet.nameBegin, packet.nameEnd, prefixBegin, prefixEnd) == 0) {
+        last = first + 1;
+      }
+    }
+  }
+  else {
+    last = this->prefixUpperBound(first, prefixBegin, prefixEnd);
+  }
+
+  if (interest.getChildSelector() != 1) {
+    for (size_t i = first; i < last; ++i) {
+      shared_ptr<const Data> data = this->matchCandidate(interest, i);
+      if (data != nullptr) {
+        return data;
+      }
+    }
+    return nullptr;
+  }
+
+  // rightmost child of the Interest name first, and the leftmost match within a child,
+  // as in the ContentStore of NFD
+  while (last > first) {
+    Packet packet = this->getPacket(last - 1);
+    const uint8_t* childEnd = packet.nameBegin + nameWire.value_size();
+    if (childEnd != packet.nameEnd && !skipComponent(childEnd, packet.nameEnd)) {
+      BOOST_THROW_EXCEPTION(Error("Malformed name in packet " + to_string(last - 1)));
+    }
+
+    size_t childFirst = this->lowerBound(packet.nameBegin, childEnd);
+    for (size_t i = childFirst; i < last; ++i) {
+      shared_ptr<const Data> data = this->matchCandidate(interest, i);
+      if (data != nullptr) {
+        return data;
+      }
+    }
+    last = childFirst;
+  }
+  return nullptr;
+}
+
+shared_ptr<const Data>
+PacketFile::matchCandidate(const Interest& interest, size_t i) const
+{
+  Packet packet = this->getPacket(i);
+  size_t interestNameLength = interest.getName().size();
+
+  // count the components of the Data name, and locate the one that Exclude applies to
+  size_t nComponents = 0;
+  const uint8_t* childBegin = nullptr;
+  const uint8_t* childEnd = nullptr;
+  for (const uint8_t* pos = packet.nameBegin; pos != packet.nameEnd; ++nComponents) {
+    if (nComponents == interestNameLength) {
+      childBegin = pos;
+    }
+    if (!skipComponent(pos, packet.nameEnd)) {
+      BOOST_THROW_EXCEPTION(Error("Malformed name in packet " + to_string(i)));
+    }
+    if (nComponents == interestNameLength) {
+      childEnd = pos;
+    }
+  }
+
+  size_t fullNameLength = nComponents + 1;
+  int minSuffixComponents = interest.getMinSuffixComponents();
+  if (minSuffixComponents >= 0 &&
+      interestNameLength + static_cast<size_t>(minSuffixComponents) > fullNameLength) {
+    return nullptr;
+  }
+  int maxSuffixComponents = interest.getMaxSuffixComponents();
+  if (maxSuffixComponents >= 0 &&
+      interestNameLength + static_cast<size_t>(maxSuffixComponents) < fullNameLength) {
+    return nullptr;
+  }
+
+  const Exclude& exclude = interest.getExclude();
+  if (!exclude.empty() && childBegin != nullptr &&
+      exclude.isExcluded(name::Component(Block(childBegin, childEnd - childBegin)))) {
+    return nullptr;
+  }
+
+  // the implicit digest and PublisherPublicKeyLocator need the decoded packet
+  auto data = make_shared<Data>(Block(packet.begin, packet.end - packet.begin));
+  if (!interest.matchesData(*data)) {
+    return nullptr;
+  }
+  return data;
+}
+
+shared_ptr<const Data>
+PacketFile::find(const Name& name) const
+{
+  const Block& nameWire = name.wireEncode();
+  const uint8_t* nameBegin = nameWire.value();
+  const uint8_t* nameEnd = nameBegin + nameWire.value_size();
+  size_t i = this->lowerBound(nameBegin, nameEnd);
+  if (i == m_nPackets) {
+    return nullptr;
+  }
+
+  Packet packet = this->getPacket(i);
+  if (compareNames(packet.nameBegin, packet.nameEnd, nameBegin, nameEnd) != 0) {
+    return nullptr;
+  }
+  return make_shared<Data>(Block(packet.begin, packet.end - packet.begin));
+}
+
+} // namespace util
+} // namespace ndn
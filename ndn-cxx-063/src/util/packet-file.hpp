@@ -0,0 +1,250 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2018 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_UTIL_PACKET_FILE_HPP
+#define NDN_UTIL_PACKET_FILE_HPP
+
+#include "../data.hpp"
+#include "../interest.hpp"
+#include "../security/key-chain.hpp"
+#include "../security/signing-info.hpp"
+
+#include <fstream>
+
+namespace boost {
+namespace iostreams {
+class mapped_file_source;
+} // namespace iostreams
+} // namespace boost
+
+namespace ndn {
+namespace util {
+
+/**
+ * @brief Writes signed Data packets into a packet file.
+ *
+ * A packet file contains the wire encoding of every Data packet, followed by an index that
+ * lists the packets in canonical order of their names. It is served with PacketFile.
+ *
+ * Example:
+ * @code
+ * PacketFileWriter writer("/var/lib/producer/archive.pkt");
+ * std::ifstream is("archive.tar", std::ios::binary);
+ * writer.appendObject(Name("/example/archive").appendVersion(), is, keyChain);
+ * writer.close();
+ * @endcode
+ */
+class PacketFileWriter : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /**
+   * @brief Create or truncate the packet file @p filename.
+   * @throw Error the file cannot be opened
+   */
+  explicit
+  PacketFileWriter(const std::string& filename);
+
+  /**
+   * @brief Append a signed Data packet.
+   * @throw Error the file is closed, or cannot be written
+   */
+  void
+  append(const Data& data);
+
+  /**
+   * @brief Segment an object, sign every segment, and append the segments.
+   * @param prefix name of the object, to which the segment number is appended
+   * @param is a seekable stream from which the content of the object is read
+   * @param keyChain KeyChain to sign the segments
+   * @param signingInfo signing parameters
+   * @param segmentSize maximum size of the content of each segment
+   * @param freshnessPeriod FreshnessPeriod of each segment
+   * @return number of segments
+   * @throw Error the stream is not seekable or cannot be read, or the file cannot be written
+   *
+   * Every segment carries a FinalBlockId that indicates the last segment.
+   * An empty object is packaged as a single empty segment.
+   */
+  uint64_t
+  appendObject(const Name& prefix, std::istream& is, KeyChain& keyChain,
+               const security::SigningInfo& signingInfo = security::SigningInfo(),
+               size_t segmentSize = DEFAULT_SEGMENT_SIZE,
+               time::milliseconds freshnessPeriod = DEFAULT_FRESHNESS_PERIOD);
+
+  /**
+   * @brief Write the index and close the file.
+   * @throw Error two Data packets have the same name, or the file cannot be written
+   *
+   * The packet file is incomplete, and cannot be served, until it is closed.
+   */
+  void
+  close();
+
+  /**
+   * @return number of Data packets appended
+   */
+  uint64_t
+  size() const
+  {
+    return m_offsets.size();
+  }
+
+public:
+  static const size_t DEFAULT_SEGMENT_SIZE;
+  static const time::milliseconds DEFAULT_FRESHNESS_PERIOD;
+
+private:
+  std::string m_filename;
+  std::ofstream m_os;
+  uint64_t m_offset;
+  /// offsets of Data packets, in the order they are appended
+  std::vector<uint64_t> m_offsets;
+};
+
+/**
+ * @brief A read-only, memory-mapped packet file written by PacketFileWriter.
+ *
+ * Data packets are looked up by binary search on the index, comparing the TLV-VALUE of their
+ * names directly in the mapping. They are signed and encoded when the file is written, so that
+ * serving a packet only copies its wire encoding out of the mapping; the file is not loaded
+ * into memory, and only the pages that are accessed occupy the page cache.
+ *
+ * Example of a producer:
+ * @code
+ * PacketFile file("/var/lib/producer/archive.pkt");
+ * face.setInterestFilter("/example/archive",
+ *   [&] (const InterestFilter&, const Interest& interest) {
+ *     shared_ptr<const Data> data = file.find(interest);
+ *     if (data != nullptr) {
+ *       face.put(*data);
+ *     }
+ *   });
+ * @endcode
+ */
+class PacketFile : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /**
+   * @brief Map the packet file @p filename.
+   * @throw Error the file cannot be mapped, or is not a complete packet file
+   */
+  explicit
+  PacketFile(const std::string& filename);
+
+  ~PacketFile();
+
+  /**
+   * @return number of Data packets in the file
+   */
+  size_t
+  size() const
+  {
+    return m_nPackets;
+  }
+
+  /**
+   * @brief Find a Data packet that satisfies @p interest.
+   * @return the Data packet with the smallest name among those satisfying @p interest;
+   *         if ChildSelector is 1, the one with the smallest name under the largest child of
+   *         the Interest name that has any; nullptr if none
+   * @throw Error the file is corrupted
+   */
+  shared_ptr<const Data>
+  find(const Interest& interest) const;
+
+  /**
+   * @brief Find the Data packet named @p name.
+   * @return the Data packet, or nullptr if none
+   * @throw Error the file is corrupted
+   */
+  shared_ptr<const Data>
+  find(const Name& name) const;
+
+  /**
+   * @brief Get the wire encoding of the i-th Data packet in canonical order of names.
+   * @pre i < size()
+   * @throw Error the file is corrupted
+   */
+  Block
+  getWire(size_t i) const;
+
+private:
+  struct Packet
+  {
+    const uint8_t* begin;
+    const uint8_t* end;
+    /// TLV-VALUE of the Name
+    const uint8_t* nameBegin;
+    const uint8_t* nameEnd;
+  };
+
+  Packet
+  getPacket(size_t i) const;
+
+  /**
+   * @return index of the first Data packet whose name is not less than the name whose
+   *         TLV-VALUE is [@p nameBegin, @p nameEnd)
+   */
+  size_t
+  lowerBound(const uint8_t* nameBegin, const uint8_t* nameEnd) const;
+
+  /**
+   * @return index of the first Data packet at or after @p first whose name does not start with
+   *         the name whose TLV-VALUE is [@p prefixBegin, @p prefixEnd)
+   * @pre every Data packet from lowerBound(prefixBegin, prefixEnd) to @p first starts with it
+   */
+  size_t
+  prefixUpperBound(size_t first, const uint8_t* prefixBegin, const uint8_t* prefixEnd) const;
+
+  /**
+   * @brief check the i-th Data packet against @p interest
+   * @pre the name of the packet starts with the Interest name, without its implicit digest
+   *
+   * Suffix components and Exclude are checked on the name in the mapping, so that only
+   * a packet that passes them is decoded for Interest::matchesData.
+   */
+  shared_ptr<const Data>
+  matchCandidate(const Interest& interest, size_t i) const;
+
+private:
+  unique_ptr<boost::iostreams::mapped_file_source> m_file;
+  const uint8_t* m_begin;
+  const uint8_t* m_end;
+  const uint8_t* m_index;
+  size_t m_nPackets;
+};
+
+} // namespace util
+} // namespace ndn
+
+#endif // NDN_UTIL_PACKET_FILE_HPP
@@ -59,6 +59,15 @@ BOOST_AUTO_TEST_CASE(PrintLinkType)
   BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(static_cast<LinkType>(104)), "104");
 }
 
+BOOST_AUTO_TEST_CASE(PrintArenaPageMode)
+{
+  BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(ARENA_PAGE_MODE_OFF), "off");
+  BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(ARENA_PAGE_MODE_NORMAL), "normal");
+  BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(ARENA_PAGE_MODE_TRANSPARENT), "transparent");
+  BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(ARENA_PAGE_MODE_EXPLICIT), "explicit");
+  BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(static_cast<ArenaPageMode>(61)), "61");
+}
+
 BOOST_AUTO_TEST_CASE(PrintFaceEventKind)
 {
   BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(FACE_EVENT_NONE), "none");
@@ -0,0 +1,107 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2016 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "lp/ack-range.hpp"
+#include "lp/packet.hpp"
+
+#include "boost-test.hpp"
+
+namespace ndn {
+namespace lp {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Lp)
+BOOST_AUTO_TEST_SUITE(TestAckRange)
+
+BOOST_AUTO_TEST_CASE(Encode)
+{
+  AckRange range(0x0102030405060708, 0x0102030405060709);
+  BOOST_CHECK_EQUAL(range.size(), 2);
+
+  Block wire = range.wireEncode();
+  static const uint8_t expectedBlock[] = {
+    0xfd, 0x03, 0x54, 0x09,
+          0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+          0x01
+  };
+  BOOST_CHECK_EQUAL_COLLECTIONS(expectedBlock, expectedBlock + sizeof(expectedBlock),
+                                wire.begin(), wire.end());
+  BOOST_CHECK_EQUAL(AckRange::estimateSize(range.size()), wire.size());
+
+  AckRange decoded(wire);
+  BOOST_CHECK_EQUAL(decoded, range);
+  BOOST_CHECK_EQUAL(decoded.getFirst(), 0x0102030405060708);
+  BOOST_CHECK_EQUAL(decoded.getLast(), 0x0102030405060709);
+}
+
+BOOST_AUTO_TEST_CASE(Wraparound)
+{
+  AckRange range(0xFFFFFFFFFFFFFFFE, 1000);
+  BOOST_CHECK_EQUAL(range.size(), 1003);
+
+  Block wire = range.wireEncode();
+  BOOST_CHECK_EQUAL(wire.value_size(), 10);
+  BOOST_CHECK_EQUAL(AckRange::estimateSize(range.size()), wire.size());
+  BOOST_CHECK_EQUAL(AckRange(wire), range);
+}
+
+BOOST_AUTO_TEST_CASE(DecodeError)
+{
+  static const uint8_t shortBlock[] = {
+    0xfd, 0x03, 0x54, 0x08,
+          0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08
+  };
+  BOOST_CHECK_THROW(AckRange(Block(shortBlock, sizeof(shortBlock))), AckRange::Error);
+
+  static const uint8_t badCountBlock[] = {
+    0xfd, 0x03, 0x54, 0x0b,
+          0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+          0x00, 0x00, 0x01
+  };
+  BOOST_CHECK_THROW(AckRange(Block(badCountBlock, sizeof(badCountBlock))), AckRange::Error);
+
+  static const uint8_t wrongTypeBlock[] = {
+    0xfd, 0x03, 0x44, 0x08,
+          0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08
+  };
+  BOOST_CHECK_THROW(AckRange(Block(wrongTypeBlock, sizeof(wrongTypeBlock))), AckRange::Error);
+}
+
+BOOST_AUTO_TEST_CASE(InPacket)
+{
+  Packet pkt;
+  pkt.add<AckField>(7);
+  pkt.add<AckRangeField>(AckRange(10, 20));
+  pkt.add<AckRangeField>(AckRange(30, 31));
+
+  Packet decoded(pkt.wireEncode());
+  BOOST_CHECK_EQUAL(decoded.get<AckField>(), 7);
+  BOOST_REQUIRE_EQUAL(decoded.count<AckRangeField>(), 2);
+  BOOST_CHECK_EQUAL(decoded.get<AckRangeField>(0), AckRange(10, 20));
+  BOOST_CHECK_EQUAL(decoded.get<AckRangeField>(1), AckRange(30, 31));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestAckRange
+BOOST_AUTO_TEST_SUITE_END() // Lp
+
+} // namespace tests
+} // namespace lp
+} // namespace ndn
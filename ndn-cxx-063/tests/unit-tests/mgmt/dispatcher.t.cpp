@@ -436,6 +436,84 @@ BOOST_AUTO_TEST_CASE(StatusDataset)
   BOOST_CHECK_EQUAL(storage.size(), 0); // the nack packet will not be inserted into the in-memory storage
 }
 
+BOOST_AUTO_TEST_CASE(StatusDatasetEpoch)
+{
+  Block largeBlock;
+  {
+    EncodingBuffer encoder;
+    for (size_t i = 0; i < 5000; ++i) {
+      encoder.prependByte(1);
+    }
+    encoder.prependVarNumber(5000);
+    encoder.prependVarNumber(129);
+    largeBlock = encoder.block();
+  }
+
+  size_t nHandlerCalls = 0;
+  uint64_t epoch = 1;
+  dispatcher.addStatusDataset("test/epoch",
+                              makeTestAuthorization(),
+                              [&] (const Name& prefix, const Interest& interest,
+                                   StatusDatasetContext& context) {
+                                ++nHandlerCalls;
+                                context.append(largeBlock);
+                                context.end();
+                              },
+                              [&epoch] { return epoch; });
+
+  auto makeRequest = [] (uint32_t nonce) {
+    Interest interest("/root/test/epoch/valid");
+    interest.setCanBePrefix(true);
+    interest.setMustBeFresh(true);
+    interest.setNonce(nonce);
+    return interest;
+  };
+
+  dispatcher.addTopPrefix("/root");
+  advanceClocks(1_ms);
+  face.sentData.clear();
+
+  face.receive(makeRequest(1));
+  advanceClocks(1_ms, 10);
+  BOOST_CHECK_EQUAL(nHandlerCalls, 1);
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 1);
+  BOOST_CHECK_EQUAL(storage.size(), 2);
+  Data first = face.sentData[0];
+
+  // the response is stale in the storage, but the epoch is unchanged
+  advanceClocks(1_s, 2);
+  face.sentData.clear();
+  face.receive(makeRequest(2));
+  advanceClocks(1_ms, 10);
+  BOOST_CHECK_EQUAL(nHandlerCalls, 1);
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 1);
+  BOOST_CHECK_EQUAL(face.sentData[0].wireEncode(), first.wireEncode());
+  BOOST_CHECK_EQUAL(storage.size(), 2);
+
+  // the remaining segment is fresh again in the storage
+  Interest segment1(Name(first.getName().getPrefix(-1)).appendSegment(1));
+  segment1.setMustBeFresh(true);
+  BOOST_CHECK(storage.find(segment1) != nullptr);
+
+  // a changed epoch causes the dataset to be regenerated
+  ++epoch;
+  advanceClocks(1_s, 2);
+  face.sentData.clear();
+  face.receive(makeRequest(3));
+  advanceClocks(1_ms, 10);
+  BOOST_CHECK_EQUAL(nHandlerCalls, 2);
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 1);
+  BOOST_CHECK_NE(face.sentData[0].getName(), first.getName());
+
+  // requests that are not authorized do not get the retained response
+  face.sentData.clear();
+  face.receive(*makeInterest("/root/test/epoch/invalid", true));
+  advanceClocks(1_ms, 10);
+  BOOST_CHECK_EQUAL(nHandlerCalls, 2);
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 1);
+  BOOST_CHECK_EQUAL(ControlResponse(face.sentData[0].getContent().blockFromValue()).getCode(), 403);
+}
+
 BOOST_AUTO_TEST_CASE(NotificationStream)
 {
   const uint8_t buf[] = {0x82, 0x01, 0x02};
@@ -0,0 +1,147 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2018 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "mgmt/nfd/arena-info.hpp"
+
+#include "boost-test.hpp"
+#include <boost/lexical_cast.hpp>
+
+namespace ndn {
+namespace nfd {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Mgmt)
+BOOST_AUTO_TEST_SUITE(Nfd)
+BOOST_AUTO_TEST_SUITE(TestArenaInfo)
+
+static ArenaInfo
+makeArenaInfo()
+{
+  return ArenaInfo()
+    .setPageMode(ARENA_PAGE_MODE_TRANSPARENT)
+    .setNChunks(3)
+    .setNHugePageChunks(3)
+    .setNMappedBytes(6291456)
+    .setNAllocatedBytes(5242880)
+    .setNFreeBytes(65536)
+    .setNFallbackAllocations(12);
+}
+
+BOOST_AUTO_TEST_CASE(Encode)
+{
+  ArenaInfo ai1 = makeArenaInfo();
+  Block wire = ai1.wireEncode();
+
+  static const uint8_t EXPECTED[] = {
+    0x80, 0x1E, // ArenaInfo
+          0x81, 0x01, 0x02,                   // ArenaPageMode
+          0x82, 0x01, 0x03,                   // NArenaChunks
+          0x83, 0x01, 0x03,                   // NHugePageChunks
+          0x84, 0x04, 0x00, 0x60, 0x00, 0x00, // NMappedBytes
+          0x85, 0x04, 0x00, 0x50, 0x00, 0x00, // NAllocatedBytes
+          0x86, 0x04, 0x00, 0x01, 0x00, 0x00, // NFreeBytes
+          0x87, 0x01, 0x0C,                   // NFallbackAllocations
+  };
+  BOOST_CHECK_EQUAL_COLLECTIONS(wire.begin(), wire.end(), EXPECTED, EXPECTED + sizeof(EXPECTED));
+
+  ArenaInfo ai2(wire);
+  BOOST_CHECK_EQUAL(ai2.getPageMode(), ARENA_PAGE_MODE_TRANSPARENT);
+  BOOST_CHECK_EQUAL(ai2.getNChunks(), 3);
+  BOOST_CHECK_EQUAL(ai2.getNHugePageChunks(), 3);
+  BOOST_CHECK_EQUAL(ai2.getNMappedBytes(), 6291456);
+  BOOST_CHECK_EQUAL(ai2.getNAllocatedBytes(), 5242880);
+  BOOST_CHECK_EQUAL(ai2.getNFreeBytes(), 65536);
+  BOOST_CHECK_EQUAL(ai2.getNFallbackAllocations(), 12);
+}
+
+BOOST_AUTO_TEST_CASE(DecodeMissingField)
+{
+  static const uint8_t WIRE[] = {
+    0x80, 0x06, // ArenaInfo
+          0x81, 0x01, 0x01, // ArenaPageMode
+          0x83, 0x01, 0x00, // NHugePageChunks
+  };
+  Block wire(WIRE, sizeof(WIRE));
+  BOOST_CHECK_THROW(ArenaInfo{wire}, ArenaInfo::Error);
+}
+
+BOOST_AUTO_TEST_CASE(Equality)
+{
+  ArenaInfo ai1, ai2;
+  BOOST_CHECK_EQUAL(ai1, ai2);
+
+  ai1 = makeArenaInfo();
+  BOOST_CHECK_NE(ai1, ai2);
+  ai2 = ai1;
+  BOOST_CHECK_EQUAL(ai1, ai2);
+
+  ai2.setPageMode(ARENA_PAGE_MODE_EXPLICIT);
+  BOOST_CHECK_NE(ai1, ai2);
+  ai2 = ai1;
+
+  ai2.setNChunks(ai2.getNChunks() + 1);
+  BOOST_CHECK_NE(ai1, ai2);
+  ai2 = ai1;
+
+  ai2.setNHugePageChunks(ai2.getNHugePageChunks() + 1);
+  BOOST_CHECK_NE(ai1, ai2);
+  ai2 = ai1;
+
+  ai2.setNMappedBytes(ai2.getNMappedBytes() + 1);
+  BOOST_CHECK_NE(ai1, ai2);
+  ai2 = ai1;
+
+  ai2.setNAllocatedBytes(ai2.getNAllocatedBytes() + 1);
+  BOOST_CHECK_NE(ai1, ai2);
+  ai2 = ai1;
+
+  ai2.setNFreeBytes(ai2.getNFreeBytes() + 1);
+  BOOST_CHECK_NE(ai1, ai2);
+  ai2 = ai1;
+
+  ai2.setNFallbackAllocations(ai2.getNFallbackAllocations() + 1);
+  BOOST_CHECK_NE(ai1, ai2);
+}
+
+BOOST_AUTO_TEST_CASE(Print)
+{
+  ArenaInfo ai;
+  BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(ai),
+    "Arena: off, 0 chunks (0 huge), 0 mapped, 0 allocated, 0 free, 0 fallback allocations");
+
+  ai = makeArenaInfo();
+  BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(ai),
+    "Arena: transparent, 3 chunks (3 huge), 6291456 mapped, 5242880 allocated, 65536 free, "
+    "12 fallback allocations");
+
+  ai.setNChunks(1).setNFallbackAllocations(1);
+  BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(ai),
+    "Arena: transparent, 1 chunk (3 huge), 6291456 mapped, 5242880 allocated, 65536 free, "
+    "1 fallback allocation");
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestArenaInfo
+BOOST_AUTO_TEST_SUITE_END() // Nfd
+BOOST_AUTO_TEST_SUITE_END() // Mgmt
+
+} // namespace tests
+} // namespace nfd
+} // namespace ndn
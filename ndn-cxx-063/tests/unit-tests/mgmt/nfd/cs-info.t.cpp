@@ -68,6 +68,51 @@ BOOST_AUTO_TEST_CASE(Encode)
   BOOST_CHECK_EQUAL(csi2.getNMisses(), 28179);
 }
 
+BOOST_AUTO_TEST_CASE(EncodePartitions)
+{
+  CsInfo csi1 = makeCsInfo();
+  csi1.addPartition(CsPartition()
+                    .setPrefix("/V")
+                    .setCapacity(100)
+                    .setNEntries(99)
+                    .setNHits(10)
+                    .setNMisses(20)
+                    .setNEvictions(30));
+  Block wire = csi1.wireEncode();
+
+  static const uint8_t EXPECTED[] = {
+    0x80, 0x29, // CsInfo
+          0x83, 0x02, 0x4E, 0xD1, // Capacity
+          0x6C, 0x01, 0x02,       // Flags
+          0x87, 0x02, 0x15, 0x85, // NCsEntries
+          0x81, 0x02, 0x32, 0x97, // NHits
+          0x82, 0x02, 0x6E, 0x13, // NMisses
+          0x85, 0x14, // CsPartition
+                0x07, 0x03, 0x08, 0x01, 0x56, // Name
+                0x83, 0x01, 0x64,             // Capacity
+                0x87, 0x01, 0x63,             // NCsEntries
+                0x81, 0x01, 0x0A,             // NHits
+                0x82, 0x01, 0x14,             // NMisses
+                0x86, 0x01, 0x1E,             // NEvictions
+  };
+  BOOST_CHECK_EQUAL_COLLECTIONS(wire.begin(), wire.end(), EXPECTED, EXPECTED + sizeof(EXPECTED));
+
+  CsInfo csi2(wire);
+  BOOST_CHECK_EQUAL(csi2.getNMisses(), 28179);
+  BOOST_REQUIRE_EQUAL(csi2.getPartitions().size(), 1);
+  const CsPartition& partition = csi2.getPartitions().front();
+  BOOST_CHECK_EQUAL(partition.getPrefix(), "/V");
+  BOOST_CHECK_EQUAL(partition.getCapacity(), 100);
+  BOOST_CHECK_EQUAL(partition.getNEntries(), 99);
+  BOOST_CHECK_EQUAL(partition.getNHits(), 10);
+  BOOST_CHECK_EQUAL(partition.getNMisses(), 20);
+  BOOST_CHECK_EQUAL(partition.getNEvictions(), 30);
+  BOOST_CHECK_EQUAL(csi1, csi2);
+
+  csi2.clearPartitions();
+  BOOST_CHECK_EQUAL(csi2, makeCsInfo());
+}
+
 BOOST_AUTO_TEST_CASE(Equality)
 {
   CsInfo csi1, csi2;
@@ -116,6 +161,12 @@ BOOST_AUTO_TEST_CASE(Print)
   csi.setEnableAdmit(true).setNHits(1).setNMisses(1);
   BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(csi),
     "CS: 5509 entries, 20177 max, admit enabled, serve enabled, 1 hit, 1 miss");
+
+  csi.addPartition(CsPartition().setPrefix("/V").setCapacity(100).setNEntries(99)
+                   .setNHits(1).setNMisses(2).setNEvictions(1));
+  BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(csi),
+    "CS: 5509 entries, 20177 max, admit enabled, serve enabled, 1 hit, 1 miss\n"
+    "  /V: 99 entries, 100 max, 1 hit, 2 misses, 1 eviction");
 }
 
 BOOST_AUTO_TEST_SUITE_END() // TestCsInfo
@@ -20,6 +20,7 @@
  */
 
 #include "mgmt/nfd/face-status.hpp"
+#include "encoding/tlv-nfd.hpp"
 
 #include "boost-test.hpp"
 #include <boost/lexical_cast.hpp>
@@ -135,6 +136,46 @@ BOOST_AUTO_TEST_CASE(Print)
                     "                Nacks: {in: 1, out: 2},\n"
                     "                bytes: {in: 1329719163, out: 999110448}}\n"
                     "     )");
+
+  status.setNShedInterests(5);
+  BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(status),
+                    "Face(FaceId: 100,\n"
+                    "     RemoteUri: tcp4://192.0.2.1:6363,\n"
+                    "     LocalUri: tcp4://192.0.2.2:55555,\n"
+                    "     ExpirationPeriod: 10000 milliseconds,\n"
+                    "     FaceScope: local,\n"
+                    "     FacePersistency: on-demand,\n"
+                    "     LinkType: multi-access,\n"
+                    "     BaseCongestionMarkingInterval: 5 nanoseconds,\n"
+                    "     DefaultCongestionThreshold: 7 bytes,\n"
+                    "     Mtu: 9 bytes,\n"
+                    "     Flags: 0x7,\n"
+                    "     Counters: {Interests: {in: 10, out: 3000},\n"
+                    "                Data: {in: 200, out: 4},\n"
+                    "                Nacks: {in: 1, out: 2},\n"
+                    "                bytes: {in: 1329719163, out: 999110448},\n"
+                    "                ShedInterests: 5}\n"
+                    "     )");
+}
+
+BOOST_AUTO_TEST_CASE(ShedInterests)
+{
+  FaceStatus status1 = makeFaceStatus();
+  BOOST_CHECK_EQUAL(status1.getNShedInterests(), 0);
+
+  status1.setNShedInterests(5);
+  Block wire = status1.wireEncode();
+  wire.parse();
+  BOOST_CHECK_EQUAL(wire.elements().back().type(), tlv::nfd::NShedInterests);
+
+  FaceStatus status2(wire);
+  BOOST_CHECK_EQUAL(status1, status2);
+  BOOST_CHECK_EQUAL(status2.getNShedInterests(), 5);
+
+  status2.setNShedInterests(0);
+  BOOST_CHECK_NE(status1, status2);
+  FaceStatus status3(status2.wireEncode());
+  BOOST_CHECK_EQUAL(status3.getNShedInterests(), 0);
 }
 
 BOOST_AUTO_TEST_CASE(ExpirationPeriod)
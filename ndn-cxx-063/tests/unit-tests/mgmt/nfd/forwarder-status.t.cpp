@@ -20,6 +20,7 @@
  */
 
 #include "mgmt/nfd/forwarder-status.hpp"
+#include "encoding/tlv-nfd.hpp"
 
 #include "boost-test.hpp"
 #include <boost/lexical_cast.hpp>
@@ -80,6 +81,91 @@ BOOST_AUTO_TEST_CASE(Encode)
   BOOST_CHECK_EQUAL(status1, status2);
 }
 
+BOOST_AUTO_TEST_CASE(BusyAndIdleTime)
+{
+  ForwarderStatus status1 = makeForwarderStatus();
+  BOOST_CHECK(!status1.hasBusyTime());
+  BOOST_CHECK(!status1.hasIdleTime());
+
+  status1.setBusyTime(time::milliseconds(2500))
+         .setIdleTime(time::milliseconds(7500));
+  Block wire = status1.wireEncode();
+  wire.parse();
+  BOOST_CHECK_EQUAL(wire.elements().size(), 16);
+  BOOST_CHECK_EQUAL(wire.elements().back().type(), tlv::nfd::IdleTime);
+
+  ForwarderStatus status2(wire);
+  BOOST_CHECK_EQUAL(status1, status2);
+  BOOST_REQUIRE(status2.hasBusyTime());
+  BOOST_CHECK_EQUAL(status2.getBusyTime(), time::milliseconds(2500));
+  BOOST_REQUIRE(status2.hasIdleTime());
+  BOOST_CHECK_EQUAL(status2.getIdleTime(), time::milliseconds(7500));
+
+  status2.unsetBusyTime();
+  BOOST_CHECK(!status2.hasBusyTime());
+  BOOST_CHECK_NE(status1, status2);
+
+  ForwarderStatus status3(status2.wireEncode());
+  BOOST_CHECK(!status3.hasBusyTime());
+  BOOST_REQUIRE(status3.hasIdleTime());
+  BOOST_CHECK_EQUAL(status3.getIdleTime(), time::milliseconds(7500));
+}
+
+BOOST_AUTO_TEST_CASE(ShedInterests)
+{
+  ForwarderStatus status1 = makeForwarderStatus();
+  BOOST_CHECK_EQUAL(status1.getNShedInterests(), 0);
+  Block wire = status1.wireEncode();
+  wire.parse();
+  BOOST_CHECK_EQUAL(wire.elements().size(), 14);
+
+  status1.setNShedInterests(42);
+  wire = status1.wireEncode();
+  wire.parse();
+  BOOST_CHECK_EQUAL(wire.elements().size(), 15);
+  BOOST_CHECK_EQUAL(wire.elements().back().type(), tlv::nfd::NShedInterests);
+
+  ForwarderStatus status2(wire);
+  BOOST_CHECK_EQUAL(status1, status2);
+  BOOST_CHECK_EQUAL(status2.getNShedInterests(), 42);
+
+  status2.setNShedInterests(0);
+  BOOST_CHECK_NE(status1, status2);
+}
+
+BOOST_AUTO_TEST_CASE(PrefetchCounters)
+{
+  ForwarderStatus status1 = makeForwarderStatus();
+  status1.setNShedInterests(42)
+         .setNPrefetchInterests(100)
+         .setNUsefulPrefetches(80)
+         .setNWastedPrefetches(15)
+         .setNFailedPrefetches(5)
+         .setNPrefetchBudgetExceeded(3);
+  Block wire = status1.wireEncode();
+  wire.parse();
+  BOOST_CHECK_EQUAL(wire.elements().size(), 20);
+  BOOST_CHECK_EQUAL(wire.elements().back().type(), tlv::nfd::NPrefetchBudgetExceeded);
+
+  ForwarderStatus status2(wire);
+  BOOST_CHECK_EQUAL(status1, status2);
+  BOOST_CHECK_EQUAL(status2.getNPrefetchInterests(), 100);
+  BOOST_CHECK_EQUAL(status2.getNUsefulPrefetches(), 80);
+  BOOST_CHECK_EQUAL(status2.getNWastedPrefetches(), 15);
+  BOOST_CHECK_EQUAL(status2.getNFailedPrefetches(), 5);
+  BOOST_CHECK_EQUAL(status2.getNPrefetchBudgetExceeded(), 3);
+
+  // zero counters are omitted
+  status2.setNUsefulPrefetches(0);
+  BOOST_CHECK_NE(status1, status2);
+  wire = status2.wireEncode();
+  wire.parse();
+  BOOST_CHECK_EQUAL(wire.elements().size(), 19);
+  ForwarderStatus status3(wire);
+  BOOST_CHECK_EQUAL(status3.getNUsefulPrefetches(), 0);
+  BOOST_CHECK_EQUAL(status3.getNWastedPrefetches(), 15);
+}
+
 BOOST_AUTO_TEST_CASE(Equality)
 {
   ForwarderStatus status1, status2;
@@ -123,6 +209,63 @@ BOOST_AUTO_TEST_CASE(Print)
                     "                         Data: {in: 1843576050, out: 138198826},\n"
                     "                         Nacks: {in: 1234, out: 4321}}\n"
                     "              )");
+
+  status.setBusyTime(time::milliseconds(2500))
+        .setIdleTime(time::milliseconds(7500));
+  BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(status),
+                    "GeneralStatus(NfdVersion: 0.5.1-14-g05dd444,\n"
+                    "              StartTimestamp: 375193249325000000 nanoseconds since Jan 1, 1970,\n"
+                    "              CurrentTimestamp: 886109034272000000 nanoseconds since Jan 1, 1970,\n"
+                    "              Counters: {NameTreeEntries: 1849943160,\n"
+                    "                         FibEntries: 621739748,\n"
+                    "                         PitEntries: 482129741,\n"
+                    "                         MeasurementsEntries: 1771725298,\n"
+                    "                         CsEntries: 1264968688,\n"
+                    "                         Interests: {in: 612811615, out: 952144445},\n"
+                    "                         Data: {in: 1843576050, out: 138198826},\n"
+                    "                         Nacks: {in: 1234, out: 4321}},\n"
+                    "              BusyTime: 2500 milliseconds,\n"
+                    "              IdleTime: 7500 milliseconds\n"
+                    "              )");
+
+  status.setNShedInterests(42)
+        .unsetBusyTime()
+        .unsetIdleTime();
+  BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(status),
+                    "GeneralStatus(NfdVersion: 0.5.1-14-g05dd444,\n"
+                    "              StartTimestamp: 375193249325000000 nanoseconds since Jan 1, 1970,\n"
+                    "              CurrentTimestamp: 886109034272000000 nanoseconds since Jan 1, 1970,\n"
+                    "              Counters: {NameTreeEntries: 1849943160,\n"
+                    "                         FibEntries: 621739748,\n"
+                    "                         PitEntries: 482129741,\n"
+                    "                         MeasurementsEntries: 1771725298,\n"
+                    "                         CsEntries: 1264968688,\n"
+                    "                         Interests: {in: 612811615, out: 952144445},\n"
+                    "                         Data: {in: 1843576050, out: 138198826},\n"
+                    "                         Nacks: {in: 1234, out: 4321},\n"
+                    "                         ShedInterests: 42}\n"
+                    "              )");
+
+  status.setNShedInterests(0)
+        .setNPrefetchInterests(100)
+        .setNUsefulPrefetches(80)
+        .setNWastedPrefetches(15)
+        .setNFailedPrefetches(5);
+  BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(status),
+                    "GeneralStatus(NfdVersion: 0.5.1-14-g05dd444,\n"
+                    "              StartTimestamp: 375193249325000000 nanoseconds since Jan 1, 1970,\n"
+                    "              CurrentTimestamp: 886109034272000000 nanoseconds since Jan 1, 1970,\n"
+                    "              Counters: {NameTreeEntries: 1849943160,\n"
+                    "                         FibEntries: 621739748,\n"
+                    "                         PitEntries: 482129741,\n"
+                    "                         MeasurementsEntries: 1771725298,\n"
+                    "                         CsEntries: 1264968688,\n"
+                    "                         Interests: {in: 612811615, out: 952144445},\n"
+                    "                         Data: {in: 1843576050, out: 138198826},\n"
+                    "                         Nacks: {in: 1234, out: 4321},\n"
+                    "                         Prefetches: {sent: 100, useful: 80, wasted: 15, "
+                    "failed: 5, budget-exceeded: 0}}\n"
+                    "              )");
 }
 
 BOOST_AUTO_TEST_SUITE_END() // TestForwarderStatus
@@ -400,6 +400,28 @@ BOOST_AUTO_TEST_CASE(CsInfo)
   BOOST_CHECK_EQUAL(failCodes.size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(ArenaInfo)
+{
+  using ndn::nfd::ArenaInfo;
+
+  bool hasResult = false;
+  controller.fetch<ArenaInfoDataset>(
+    [&hasResult] (const ArenaInfo& result) {
+      hasResult = true;
+      BOOST_CHECK_EQUAL(result.getNChunks(), 17);
+    },
+    datasetFailCallback);
+  this->advanceClocks(500_ms);
+
+  ArenaInfo payload;
+  payload.setNChunks(17);
+  this->sendDataset("/localhost/nfd/status/arena", payload);
+  this->advanceClocks(500_ms);
+
+  BOOST_CHECK(hasResult);
+  BOOST_CHECK_EQUAL(failCodes.size(), 0);
+}
+
 BOOST_AUTO_TEST_CASE(StrategyChoiceList)
 {
   bool hasResult = false;
@@ -232,6 +232,42 @@ BOOST_AUTO_TEST_CASE(AppendComponent)
   BOOST_CHECK_EQUAL(name.wireEncode(), "0712 080428F0A36B 0803784B68 08020100 080109"_block);
 }
 
+BOOST_AUTO_TEST_CASE(AppendAfterEncode)
+{
+  Name name("/A");
+  Block wire1 = name.wireEncode();
+  Name copy = name;
+
+  name.append("B");
+  Block wire2 = name.wireEncode();
+  for (int i = 0; i < 200; ++i) {
+    name.append("C");
+    name.wireEncode();
+  }
+  name.clear();
+  name.append("D");
+
+  // encodings obtained earlier are not affected by appending to the name
+  BOOST_CHECK_EQUAL(wire1, "0703 080141"_block);
+  BOOST_CHECK_EQUAL(wire2, "0706 080141 080142"_block);
+  BOOST_CHECK_EQUAL(name.wireEncode(), "0703 080144"_block);
+
+  // nor are copies of the name
+  copy.append("E");
+  BOOST_CHECK_EQUAL(copy.wireEncode(), "0706 080141 080145"_block);
+  BOOST_CHECK_EQUAL(Name(copy.wireEncode()), Name("/A/E"));
+
+  Name longName;
+  std::string uri;
+  for (int i = 0; i < 100; ++i) {
+    longName.append("component");
+    uri += "/component";
+    longName.wireEncode();
+  }
+  BOOST_CHECK_EQUAL(longName.wireEncode(), Name(uri).wireEncode());
+  BOOST_CHECK_EQUAL(longName.wireEncode().elements().size(), 100);
+}
+
 BOOST_AUTO_TEST_CASE(AppendPartialName)
 {
   Name name("/A/B");
@@ -446,6 +482,27 @@ BOOST_AUTO_TEST_CASE(UnorderedMap)
   BOOST_CHECK_EQUAL(map[name3], 3);
 }
 
+BOOST_AUTO_TEST_CASE(Hash)
+{
+  std::hash<Name> hash;
+  Name name("/A/B/6=C");
+  Name appended;
+  appended.append("A");
+  BOOST_CHECK_NE(hash(appended), hash(name));
+  appended.append("B").append(6, reinterpret_cast<const uint8_t*>("C"), 1);
+  BOOST_CHECK_EQUAL(hash(appended), hash(name));
+  BOOST_CHECK_EQUAL(hash(Name(name.wireEncode())), hash(name));
+  BOOST_CHECK_EQUAL(hash(name.deepCopy()), hash(name));
+  BOOST_CHECK_NE(hash(Name("/A/B/C")), hash(name));
+
+  Name decoded("0709 080141 080142 060143"_block);
+  decoded.append("D");
+  BOOST_CHECK_EQUAL(hash(decoded), hash(Name("/A/B/6=C/D")));
+
+  decoded.clear();
+  BOOST_CHECK_EQUAL(hash(decoded), hash(Name()));
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestName
 
 } // namespace tests
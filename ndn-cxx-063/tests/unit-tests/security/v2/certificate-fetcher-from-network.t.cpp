@@ -70,6 +70,24 @@ public:
   void
   makeResponse(const Interest& interest);
 
+  /** \brief start validation of data and interest at the same time
+   *  \return number of successful and failed validations
+   */
+  std::pair<size_t, size_t>
+  validateConcurrently()
+  {
+    size_t nSuccesses = 0;
+    size_t nFailures = 0;
+    this->validator.validate(data,
+                             [&] (const Data&) { ++nSuccesses; },
+                             [&] (const Data&, const ValidationError&) { ++nFailures; });
+    this->validator.validate(interest,
+                             [&] (const Interest&) { ++nSuccesses; },
+                             [&] (const Interest&, const ValidationError&) { ++nFailures; });
+    this->mockNetworkOperations();
+    return {nSuccesses, nFailures};
+  }
+
 public:
   Data data;
   Interest interest;
@@ -128,6 +146,58 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(ValidateFailure, T, Failures, CertificateFetche
   BOOST_CHECK_GT(this->face.sentInterests.size(), 2);
 }
 
+BOOST_FIXTURE_TEST_CASE(CoalesceSuccess, CertificateFetcherFromNetworkFixture<Cert>)
+{
+  auto outcome = this->validateConcurrently();
+  BOOST_CHECK_EQUAL(outcome.first, 2);
+  BOOST_CHECK_EQUAL(outcome.second, 0);
+
+  // Sub3 and Sub1 certificates are each fetched once
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 2);
+  const auto& counters = this->validator.getFetcher().getCounters();
+  BOOST_CHECK_EQUAL(counters.nFetches, 2);
+  BOOST_CHECK_EQUAL(counters.nCoalescedFetches, 2);
+  BOOST_CHECK_EQUAL(counters.nNegativeCacheHits, 0);
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(CoalesceFailure, T, Failures, CertificateFetcherFromNetworkFixture<T>)
+{
+  this->validator.getFetcher().setNegativeCacheLifetime(1_h);
+
+  auto outcome = this->validateConcurrently();
+  BOOST_CHECK_EQUAL(outcome.first, 0);
+  BOOST_CHECK_EQUAL(outcome.second, 2);
+
+  // a single fetch with all its retries
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 4);
+  const auto& counters = this->validator.getFetcher().getCounters();
+  BOOST_CHECK_EQUAL(counters.nFetches, 1);
+  BOOST_CHECK_EQUAL(counters.nCoalescedFetches, 1);
+  BOOST_CHECK_EQUAL(counters.nNegativeCacheHits, 0);
+  this->face.sentInterests.clear();
+
+  VALIDATE_FAILURE(this->data, "Should fail, as the certificate recently could not be fetched");
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 0);
+  BOOST_CHECK_EQUAL(counters.nNegativeCacheHits, 1);
+
+  this->advanceClocks(1_h, 2); // expire negative cache
+
+  VALIDATE_FAILURE(this->data, "Should fail, as interests don't bring data");
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 4);
+  BOOST_CHECK_EQUAL(counters.nFetches, 2);
+  BOOST_CHECK_EQUAL(counters.nNegativeCacheHits, 1);
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(NoNegativeCache, T, Failures, CertificateFetcherFromNetworkFixture<T>)
+{
+  this->validator.getFetcher().setNegativeCacheLifetime(0_s);
+
+  VALIDATE_FAILURE(this->data, "Should fail, as interests don't bring data");
+  VALIDATE_FAILURE(this->interest, "Should fail, as interests don't bring data");
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 8);
+  BOOST_CHECK_EQUAL(this->validator.getFetcher().getCounters().nNegativeCacheHits, 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestCertificateFetcherFromNetwork
 BOOST_AUTO_TEST_SUITE_END() // V2
 BOOST_AUTO_TEST_SUITE_END() // Security
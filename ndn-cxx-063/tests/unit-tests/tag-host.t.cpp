@@ -22,6 +22,7 @@
 #include "tag-host.hpp"
 #include "data.hpp"
 #include "interest.hpp"
+#include "lp/tags.hpp"
 
 #include "boost-test.hpp"
 
@@ -80,6 +81,47 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(Basic, T, Fixtures, T)
   BOOST_CHECK(this->template getTag<TestTag2>() == nullptr);
 }
 
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(Inline, T, Fixtures, T)
+{
+  BOOST_CHECK(this->template getTag<lp::IncomingFaceIdTag>() == nullptr);
+  BOOST_CHECK(!this->template getTagValue<lp::IncomingFaceIdTag>());
+
+  this->template setTagValue<lp::IncomingFaceIdTag>(1092);
+  this->setTag(make_shared<lp::CongestionMarkTag>(3));
+  this->template setTagValue<lp::NonDiscoveryTag>(lp::EmptyValue{});
+
+  BOOST_REQUIRE(this->template getTag<lp::IncomingFaceIdTag>() != nullptr);
+  BOOST_CHECK_EQUAL(this->template getTag<lp::IncomingFaceIdTag>()->get(), 1092);
+  BOOST_CHECK_EQUAL(this->template getTagValue<lp::IncomingFaceIdTag>().value_or(0), 1092);
+  BOOST_CHECK_EQUAL(this->template getTagValue<lp::CongestionMarkTag>().value_or(0), 3);
+  BOOST_CHECK(this->template getTagValue<lp::NonDiscoveryTag>());
+  BOOST_CHECK(!this->template getTagValue<lp::NextHopFaceIdTag>());
+
+  this->template setTagValue<lp::IncomingFaceIdTag>(2519);
+  BOOST_CHECK_EQUAL(this->template getTagValue<lp::IncomingFaceIdTag>().value_or(0), 2519);
+
+  this->template removeTag<lp::IncomingFaceIdTag>();
+  BOOST_CHECK(this->template getTag<lp::IncomingFaceIdTag>() == nullptr);
+  BOOST_CHECK_EQUAL(this->template getTagValue<lp::CongestionMarkTag>().value_or(0), 3);
+
+  // tags stored in the map can be accessed by value too
+  this->template setTagValue<lp::CachePolicyTag>(lp::CachePolicy().setPolicy(lp::CachePolicyType::NO_CACHE));
+  BOOST_REQUIRE(this->template getTag<lp::CachePolicyTag>() != nullptr);
+  BOOST_CHECK_EQUAL(this->template getTagValue<lp::CachePolicyTag>()->getPolicy(),
+                    lp::CachePolicyType::NO_CACHE);
+}
+
+BOOST_AUTO_TEST_CASE(InlineCopy)
+{
+  Interest interest("/A");
+  interest.setTagValue<lp::NextHopFaceIdTag>(8530);
+
+  Interest copy(interest);
+  BOOST_CHECK_EQUAL(copy.getTagValue<lp::NextHopFaceIdTag>().value_or(0), 8530);
+  copy.removeTag<lp::NextHopFaceIdTag>();
+  BOOST_CHECK_EQUAL(interest.getTagValue<lp::NextHopFaceIdTag>().value_or(0), 8530);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestTagHost
 
 } // namespace tests
@@ -0,0 +1,196 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2018 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "transport/shm-ring.hpp"
+#include "encoding/block-helpers.hpp"
+
+#include "boost-test.hpp"
+
+#include <cstdlib>
+
+namespace ndn {
+namespace shm {
+namespace tests {
+
+class ShmRingFixture
+{
+protected:
+  ShmRingFixture()
+    : segmentSize(getSegmentSize(MIN_RING_CAPACITY))
+  {
+    void* addr = nullptr;
+    BOOST_REQUIRE_EQUAL(::posix_memalign(&addr, 64, segmentSize), 0);
+    segment.reset(static_cast<uint8_t*>(addr));
+    Ring::initializeSegment(segment.get(), MIN_RING_CAPACITY);
+  }
+
+  static Block
+  makeRecord(size_t valueSize, uint8_t fill)
+  {
+    return makeBinaryBlock(tlv::Content, std::vector<uint8_t>(valueSize, fill).data(), valueSize);
+  }
+
+protected:
+  size_t segmentSize;
+  unique_ptr<uint8_t, decltype(&std::free)> segment{nullptr, &std::free};
+};
+
+BOOST_AUTO_TEST_SUITE(Transport)
+BOOST_FIXTURE_TEST_SUITE(TestShmRing, ShmRingFixture)
+
+BOOST_AUTO_TEST_CASE(Segment)
+{
+  BOOST_CHECK(Ring::isValidSegment(segment.get(), segmentSize));
+  BOOST_CHECK(!Ring::isValidSegment(segment.get(), segmentSize - 1));
+  BOOST_CHECK(!Ring::isValidSegment(segment.get(), 8));
+
+  BOOST_CHECK(isValidRingCapacity(MIN_RING_CAPACITY));
+  BOOST_CHECK(!isValidRingCapacity(MIN_RING_CAPACITY / 2));
+  BOOST_CHECK(!isValidRingCapacity(MIN_RING_CAPACITY + 1));
+
+  Ring r0(segment.get(), RING_TO_FORWARDER);
+  Ring r1(segment.get(), RING_TO_CLIENT);
+  r0.tryWrite(makeRecord(10, 0xAA));
+  BOOST_CHECK_GT(r0.getUsedSpace(), 0);
+  BOOST_CHECK_EQUAL(r1.getUsedSpace(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(WriteRead)
+{
+  Ring producer(segment.get(), RING_TO_CLIENT);
+  Ring consumer(segment.get(), RING_TO_CLIENT);
+
+  Block block;
+  BOOST_CHECK_EQUAL(consumer.tryRead(block), false);
+
+  Block single = makeRecord(5, 0x01);
+  BOOST_CHECK_EQUAL(producer.tryWrite(single), true);
+
+  // a record may be gathered from a TLV header and its value, e.g., LpPacket header and payload
+  Block whole = makeRecord(300, 0x02);
+  auto buffer = make_shared<Buffer>(whole.wire(), whole.size());
+  auto split = buffer->begin() + 4;
+  Block header(buffer, tlv::Content, buffer->begin(), split, split, split);
+  Block payload(buffer, tlv::Content, split, buffer->end(), split, buffer->end());
+  BOOST_CHECK_EQUAL(producer.tryWrite(header, payload), true);
+  BOOST_CHECK_EQUAL(producer.getUsedSpace(),
+                    Ring::getRecordSize(single.size()) + Ring::getRecordSize(whole.size()));
+
+  BOOST_REQUIRE_EQUAL(consumer.tryRead(block), true);
+  BOOST_CHECK_EQUAL(block, single);
+  BOOST_REQUIRE_EQUAL(consumer.tryRead(block), true);
+  BOOST_CHECK_EQUAL(block, whole);
+
+  BOOST_CHECK_EQUAL(consumer.tryRead(block), false);
+  BOOST_CHECK_EQUAL(consumer.getUsedSpace(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(FullAndWrapAround)
+{
+  Ring producer(segment.get(), RING_TO_FORWARDER);
+  Ring consumer(segment.get(), RING_TO_FORWARDER);
+
+  // 1000-octet records do not divide the capacity, so records eventually straddle the end
+  size_t nWritten = 0;
+  size_t nRead = 0;
+  Block block;
+  for (int round = 0; round < 20; ++round) {
+    while (producer.tryWrite(makeRecord(1000, static_cast<uint8_t>(nWritten)))) {
+      ++nWritten;
+    }
+    BOOST_CHECK_LT(producer.getCapacity() - producer.getUsedSpace(), Ring::getRecordSize(1004));
+
+    for (int i = 0; i < 7; ++i) {
+      BOOST_REQUIRE_EQUAL(consumer.tryRead(block), true);
+      BOOST_CHECK_EQUAL(block.value_size(), 1000);
+      BOOST_CHECK_EQUAL(block.value()[0], static_cast<uint8_t>(nRead));
+      BOOST_CHECK_EQUAL(block.value()[999], static_cast<uint8_t>(nRead));
+      ++nRead;
+    }
+  }
+  BOOST_CHECK_GT(nWritten * Ring::getRecordSize(1004), 2 * producer.getCapacity());
+
+  while (consumer.tryRead(block)) {
+    BOOST_CHECK_EQUAL(block.value()[500], static_cast<uint8_t>(nRead));
+    ++nRead;
+  }
+  BOOST_CHECK_EQUAL(nRead, nWritten);
+}
+
+BOOST_AUTO_TEST_CASE(WaitProtocol)
+{
+  Ring producer(segment.get(), RING_TO_CLIENT);
+  Ring consumer(segment.get(), RING_TO_CLIENT);
+
+  // consumer may sleep on an empty ring, and must be woken exactly once
+  BOOST_CHECK_EQUAL(producer.shouldWakeConsumer(), false);
+  BOOST_CHECK_EQUAL(consumer.prepareConsumerWait(), true);
+  producer.tryWrite(makeRecord(10, 0x01));
+  BOOST_CHECK_EQUAL(producer.shouldWakeConsumer(), true);
+  BOOST_CHECK_EQUAL(producer.shouldWakeConsumer(), false);
+
+  // consumer must not sleep on a non-empty ring
+  BOOST_CHECK_EQUAL(consumer.prepareConsumerWait(), false);
+  BOOST_CHECK_EQUAL(producer.shouldWakeConsumer(), false);
+
+  // producer may sleep on a full ring, and is woken after the consumer frees space
+  while (producer.tryWrite(makeRecord(1000, 0x02))) {
+  }
+  BOOST_CHECK_EQUAL(producer.prepareProducerWait(Ring::getRecordSize(1004)), true);
+  Block block;
+  BOOST_CHECK_EQUAL(consumer.shouldWakeProducer(), true);
+  BOOST_CHECK_EQUAL(consumer.shouldWakeProducer(), false);
+
+  // producer must not sleep if the record fits
+  consumer.tryRead(block);
+  consumer.tryRead(block);
+  BOOST_CHECK_EQUAL(producer.prepareProducerWait(Ring::getRecordSize(1004)), false);
+  BOOST_CHECK_EQUAL(consumer.shouldWakeProducer(), false);
+}
+
+BOOST_AUTO_TEST_CASE(CorruptedRecord)
+{
+  Ring producer(segment.get(), RING_TO_FORWARDER);
+  Ring consumer(segment.get(), RING_TO_FORWARDER);
+
+  producer.tryWrite(makeRecord(10, 0x01));
+  // overwrite the length prefix
+  uint8_t* data = segment.get() + SEGMENT_HEADER_SIZE + N_RINGS * sizeof(RingControl);
+  uint32_t length = MAX_NDN_PACKET_SIZE + 1;
+  std::memcpy(data, &length, sizeof(length));
+
+  Block block;
+  BOOST_CHECK_THROW(consumer.tryRead(block), tlv::Error);
+
+  // a record that is not a single TLV element
+  Ring producer2(segment.get(), RING_TO_CLIENT);
+  Ring consumer2(segment.get(), RING_TO_CLIENT);
+  producer2.tryWrite(makeRecord(10, 0x01), makeRecord(10, 0x02));
+  BOOST_CHECK_THROW(consumer2.tryRead(block), tlv::Error);
+  BOOST_CHECK_EQUAL(consumer2.getUsedSpace(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestShmRing
+BOOST_AUTO_TEST_SUITE_END() // Transport
+
+} // namespace tests
+} // namespace shm
+} // namespace ndn
@@ -0,0 +1,69 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2018 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "transport/shm-transport.hpp"
+#include "transport-fixture.hpp"
+
+#include "boost-test.hpp"
+
+#include <boost/asio/io_service.hpp>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Transport)
+BOOST_FIXTURE_TEST_SUITE(TestShmTransport, TransportFixture)
+
+using ndn::Transport;
+
+BOOST_AUTO_TEST_CASE(GetDefaultSocketNameOk)
+{
+  BOOST_CHECK_EQUAL(ShmTransport::getSocketNameFromUri("shm:///tmp/test/nfd-shm.sock"), "/tmp/test/nfd-shm.sock");
+}
+
+BOOST_AUTO_TEST_CASE(GetDefaultSocketNameOkOmittedSocketOmittedProtocol)
+{
+  BOOST_CHECK_EQUAL(ShmTransport::getSocketNameFromUri(""), "/var/run/nfd-shm.sock");
+}
+
+BOOST_AUTO_TEST_CASE(GetDefaultSocketNameBadWrongTransport)
+{
+  BOOST_CHECK_EXCEPTION(ShmTransport::getSocketNameFromUri("unix:///var/run/nfd.sock"),
+                        Transport::Error,
+                        [] (const Transport::Error& error) {
+                          return error.what() == "Cannot create ShmTransport from \"unix\" URI"s;
+                        });
+}
+
+BOOST_AUTO_TEST_CASE(ConnectFailure)
+{
+  boost::asio::io_service io;
+  auto transport = ShmTransport::create("shm:///nonexistent/nfd-shm.sock");
+  transport->connect(io, [] (const Block&) {});
+  BOOST_CHECK_THROW(io.run(), Transport::Error);
+  BOOST_CHECK_EQUAL(transport->isConnected(), false);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestShmTransport
+BOOST_AUTO_TEST_SUITE_END() // Transport
+
+} // namespace tests
+} // namespace ndn
@@ -20,10 +20,16 @@
  */
 
 #include "transport/unix-transport.hpp"
+#include "encoding/block-helpers.hpp"
 #include "transport-fixture.hpp"
 
 #include "boost-test.hpp"
 
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/filesystem.hpp>
+
 namespace ndn {
 namespace tests {
 
@@ -60,6 +66,52 @@ BOOST_AUTO_TEST_CASE(GetDefaultSocketNameBadMalformedUri)
                         });
 }
 
+BOOST_AUTO_TEST_CASE(SendBurst)
+{
+  namespace fs = boost::filesystem;
+  using boost::asio::local::stream_protocol;
+
+  fs::path socketPath = fs::path(UNIT_TEST_CONFIG_PATH) / "unix-transport-burst.sock";
+  fs::create_directories(socketPath.parent_path());
+  fs::remove(socketPath);
+
+  boost::asio::io_service io;
+  stream_protocol::acceptor acceptor(io, stream_protocol::endpoint(socketPath.string()));
+  stream_protocol::socket server(io);
+
+  UnixTransport transport(socketPath.string());
+  transport.connect(io, [] (const Block&) {});
+
+  // queued before the connection is established, then written in several batches
+  std::vector<uint8_t> expected;
+  for (int i = 0; i < 200; ++i) {
+    Block header = encoding::makeStringBlock(100, std::string(10, 'h'));
+    Block payload = encoding::makeStringBlock(101, std::string(1000 + i, 'p'));
+    if (i % 2 == 0) {
+      transport.send(header, payload);
+      expected.insert(expected.end(), header.begin(), header.end());
+    }
+    else {
+      transport.send(payload);
+    }
+    expected.insert(expected.end(), payload.begin(), payload.end());
+  }
+
+  std::vector<uint8_t> received(expected.size());
+  acceptor.async_accept(server, [&] (const boost::system::error_code& error) {
+    BOOST_REQUIRE(!error);
+    boost::asio::async_read(server, boost::asio::buffer(received),
+      [&] (const boost::system::error_code& error, size_t) {
+        BOOST_REQUIRE(!error);
+        transport.close();
+      });
+  });
+  io.run();
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(received.begin(), received.end(), expected.begin(), expected.end());
+  fs::remove(socketPath);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestUnixTransport
 BOOST_AUTO_TEST_SUITE_END() // Transport
 
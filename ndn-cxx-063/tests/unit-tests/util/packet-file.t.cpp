@@ -0,0 +1,224 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2018 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "util/packet-file.hpp"
+#include "security/signing-helpers.hpp"
+
+#include "boost-test.hpp"
+#include "identity-management-fixture.hpp"
+#include "make-interest-data.hpp"
+
+#include <boost/filesystem.hpp>
+#include <sstream>
+
+namespace ndn {
+namespace util {
+namespace tests {
+
+using namespace ndn::tests;
+
+class PacketFileFixture : public IdentityManagementFixture
+{
+protected:
+  PacketFileFixture()
+    : filepath(boost::filesystem::path(UNIT_TEST_CONFIG_PATH) /= "TestPacketFile")
+    , filename(filepath.string())
+  {
+    boost::filesystem::create_directories(filepath.parent_path());
+  }
+
+  ~PacketFileFixture()
+  {
+    boost::system::error_code ec;
+    boost::filesystem::remove(filepath, ec); // ignore error
+  }
+
+protected:
+  const boost::filesystem::path filepath;
+  const std::string filename;
+};
+
+BOOST_AUTO_TEST_SUITE(Util)
+BOOST_FIXTURE_TEST_SUITE(TestPacketFile, PacketFileFixture)
+
+BOOST_AUTO_TEST_CASE(AppendObject)
+{
+  security::Identity identity = addIdentity("/producer");
+  std::string content(2500, 'a');
+  std::istringstream is(content);
+
+  PacketFileWriter writer(filename);
+  BOOST_CHECK_EQUAL(writer.appendObject("/A/object", is, m_keyChain, signingByIdentity(identity),
+                                        1000, 4_s), 3);
+  BOOST_CHECK_EQUAL(writer.size(), 3);
+  writer.close();
+
+  PacketFile file(filename);
+  BOOST_CHECK_EQUAL(file.size(), 3);
+
+  std::string reassembled;
+  for (uint64_t segment = 0; segment < 3; ++segment) {
+    shared_ptr<const Data> data = file.find(Name("/A/object").appendSegment(segment));
+    BOOST_REQUIRE(data != nullptr);
+    BOOST_CHECK_EQUAL(data->getFreshnessPeriod(), 4_s);
+    BOOST_REQUIRE(data->getFinalBlock());
+    BOOST_CHECK_EQUAL(data->getFinalBlock()->toSegment(), 2);
+    BOOST_CHECK_EQUAL(data->getSignature().getKeyLocator().getName().getPrefix(1), "/producer");
+    reassembled.append(reinterpret_cast<const char*>(data->getContent().value()),
+                       data->getContent().value_size());
+  }
+  BOOST_CHECK(reassembled == content);
+  BOOST_CHECK(file.find(Name("/A/object").appendSegment(3)) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(EmptyObject)
+{
+  std::istringstream is;
+  PacketFileWriter writer(filename);
+  BOOST_CHECK_EQUAL(writer.appendObject("/A/empty", is, m_keyChain), 1);
+  writer.close();
+
+  PacketFile file(filename);
+  shared_ptr<const Data> data = file.find(Name("/A/empty").appendSegment(0));
+  BOOST_REQUIRE(data != nullptr);
+  BOOST_CHECK_EQUAL(data->getContent().value_size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Find)
+{
+  PacketFileWriter writer(filename);
+  // appended out of order, the index is sorted on close
+  writer.append(*makeData("/B/2"));
+  writer.append(*makeData("/A"));
+  writer.append(*makeData("/B/10"));
+  writer.append(*makeData("/B/1"));
+  writer.append(*makeData("/C"));
+  writer.close();
+
+  PacketFile file(filename);
+  BOOST_CHECK_EQUAL(file.size(), 5);
+  BOOST_CHECK_EQUAL(Data(file.getWire(0)).getName(), "/A");
+  BOOST_CHECK_EQUAL(Data(file.getWire(4)).getName(), "/C");
+
+  BOOST_CHECK_EQUAL(file.find(Name("/B/10"))->getName(), "/B/10");
+  BOOST_CHECK(file.find(Name("/B")) == nullptr);
+  BOOST_CHECK(file.find(Name("/D")) == nullptr);
+
+  Interest interest("/B");
+  interest.setCanBePrefix(false);
+  BOOST_CHECK(file.find(interest) == nullptr);
+
+  interest.setCanBePrefix(true);
+  shared_ptr<const Data> data = file.find(interest);
+  BOOST_REQUIRE(data != nullptr);
+  BOOST_CHECK_EQUAL(data->getName(), "/B/1");
+
+  interest.setName("/B/2");
+  interest.setCanBePrefix(false);
+  BOOST_CHECK_EQUAL(file.find(interest)->getName(), "/B/2");
+
+  Name fullName = makeData("/B/2")->getFullName();
+  BOOST_CHECK_EQUAL(file.find(Interest(fullName))->getName(), "/B/2");
+  fullName = makeData("/B/3")->getFullName();
+  BOOST_CHECK(file.find(Interest(fullName)) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(FindSelectors)
+{
+  PacketFileWriter writer(filename);
+  for (const char* name : {"/B", "/B/1", "/B/1/x", "/B/2", "/B/2/y", "/B/10", "/C"}) {
+    writer.append(*makeData(name));
+  }
+  writer.close();
+  PacketFile file(filename);
+
+  Interest interest("/B");
+  interest.setCanBePrefix(true);
+  interest.setMinSuffixComponents(2);
+  BOOST_CHECK_EQUAL(file.find(interest)->getName(), "/B/1");
+
+  // rightmost child, leftmost Data within the child
+  interest.setChildSelector(1);
+  BOOST_CHECK_EQUAL(file.find(interest)->getName(), "/B/10");
+
+  interest.setExclude(Exclude().excludeOne(name::Component("10")));
+  BOOST_CHECK_EQUAL(file.find(interest)->getName(), "/B/2");
+
+  interest.setMinSuffixComponents(3);
+  BOOST_CHECK_EQUAL(file.find(interest)->getName(), "/B/2/y");
+
+  interest.setChildSelector(0);
+  BOOST_CHECK_EQUAL(file.find(interest)->getName(), "/B/1/x");
+
+  interest.setMinSuffixComponents(-1);
+  interest.setMaxSuffixComponents(1);
+  BOOST_CHECK_EQUAL(file.find(interest)->getName(), "/B");
+
+  interest.setChildSelector(1);
+  BOOST_CHECK_EQUAL(file.find(interest)->getName(), "/B");
+
+  interest.setName("/B/3");
+  BOOST_CHECK(file.find(interest) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+  PacketFileWriter writer(filename);
+  writer.close();
+
+  PacketFile file(filename);
+  BOOST_CHECK_EQUAL(file.size(), 0);
+  BOOST_CHECK(file.find(Name("/A")) == nullptr);
+  BOOST_CHECK(file.find(Interest("/A")) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(DuplicateName)
+{
+  PacketFileWriter writer(filename);
+  writer.append(*makeData("/A"));
+  writer.append(*makeData("/A"));
+  BOOST_CHECK_THROW(writer.close(), PacketFileWriter::Error);
+}
+
+BOOST_AUTO_TEST_CASE(Incomplete)
+{
+  {
+    PacketFileWriter writer(filename);
+    writer.append(*makeData("/A"));
+    // not closed, index is missing
+  }
+  BOOST_CHECK_THROW(PacketFile{filename}, PacketFile::Error);
+
+  {
+    std::ofstream os(filename, std::ios::binary | std::ios::trunc);
+    os << "not a packet file";
+  }
+  BOOST_CHECK_THROW(PacketFile{filename}, PacketFile::Error);
+
+  BOOST_CHECK_THROW(PacketFile{filename + "-nonexistent"}, PacketFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPacketFile
+BOOST_AUTO_TEST_SUITE_END() // Util
+
+} // namespace tests
+} // namespace util
+} // namespace ndn